@@ -96,8 +96,13 @@ static void Run(const Options& options)
     using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
     using BlockEpilogue = void;
 
+#ifdef L2_AWARE_SWIZZLE
+    // Swizzle offset and direction are chosen on device from the L2 footprint of each wave.
+    using BlockScheduler = typename Gemm::Block::GemmL2AwareBlockSwizzle<ElementA, ElementB>;
+#else
     // Swizzle offset is 3 and direction is 0.
     using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+#endif
 
     // kernel level
     using MatmulKernel = Gemm::Kernel::BasicMatmul<BlockMmad, BlockEpilogue, BlockScheduler>;
@@ -20,6 +20,7 @@ struct PlatformInfo {
     uint64_t l0ASize{64 * 1024};
     uint64_t l0BSize{64 * 1024};
     uint64_t l0CSize{128 * 1024};
+    uint64_t l2Size{192 * 1024 * 1024};
 
     PlatformInfo()
     {
@@ -34,6 +35,8 @@ struct PlatformInfo {
             platform_ascendc::CoreMemType::L0_B, l0BSize);
         platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreMemSize(
             platform_ascendc::CoreMemType::L0_C, l0CSize);
+        platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreMemSize(
+            platform_ascendc::CoreMemType::L2, l2Size);
     }
 
     ~PlatformInfo()
@@ -16,6 +16,7 @@
 #include <limits>
 
 #include "catlass/detail/alignment.hpp"
+#include "catlass/gemm/block/block_swizzle_l2_aware.hpp"
 #include "platform_info.h"
 #include "tiling_params.h"
 #include "utils.h"
@@ -528,7 +529,7 @@ bool AivMatmulB16Handler(TilingParams& params, PlatformInfo& platformInfo)
     return true;
 }
 
-void SetSwizzleParams(TilingParams& tilingParams)
+void SetSwizzleParams(TilingParams& tilingParams, PlatformInfo& platformInfo)
 {
     if (tilingParams.m > tilingParams.n) {
         tilingParams.swizzleOffset = 3;
@@ -537,6 +538,27 @@ void SetSwizzleParams(TilingParams& tilingParams)
         tilingParams.swizzleOffset = 3;
         tilingParams.swizzleDirection = 1;
     }
+    if (tilingParams.m1 == 0 || tilingParams.n1 == 0) {
+        return;
+    }
+    // When A and B no longer fit in half of L2 together, the fixed band re-streams the other operand once per band
+    // and a wave may span more than L2 for large k. Derive the band from the L2 footprint instead.
+    constexpr uint64_t elementSize = 2;
+    uint64_t l2Budget = platformInfo.l2Size / 2;
+    uint64_t sizeA = static_cast<uint64_t>(tilingParams.m) * tilingParams.k * elementSize;
+    uint64_t sizeB = static_cast<uint64_t>(tilingParams.k) * tilingParams.n * elementSize;
+    if (sizeA + sizeB <= l2Budget) {
+        return;
+    }
+    uint32_t swizzleOffset = 1;
+    uint32_t swizzleDirection = 0;
+    uint64_t rowBytes = static_cast<uint64_t>(tilingParams.m1) * tilingParams.k * elementSize;
+    uint64_t colBytes = static_cast<uint64_t>(tilingParams.n1) * tilingParams.k * elementSize;
+    Catlass::Gemm::Block::GetL2AwareSwizzleParams(
+        CeilDiv(tilingParams.m, tilingParams.m1), CeilDiv(tilingParams.n, tilingParams.n1), rowBytes, colBytes,
+        platformInfo.coreNum, l2Budget, swizzleOffset, swizzleDirection);
+    tilingParams.swizzleOffset = static_cast<uint8_t>(swizzleOffset);
+    tilingParams.swizzleDirection = static_cast<uint8_t>(swizzleDirection);
 }
 
 void SelectKernelB16(TilingParams& tilingParams, PlatformInfo& platformInfo)
@@ -575,7 +597,7 @@ void SelectKernelB16(TilingParams& tilingParams, PlatformInfo& platformInfo)
     tilingParams.layoutTagA = layoutTagATmp;
     tilingParams.layoutTagB = layoutTagBTmp;
 
-    SetSwizzleParams(tilingParams);
+    SetSwizzleParams(tilingParams, platformInfo);
 }
 
 #endif // SELECT_KERNEL_HALF_H
@@ -24,6 +24,8 @@ WORKSPACE = os.path.dirname(os.path.abspath(__file__))
 
 
 class TestPagedMLAttention:
+    post_mask_factor = 1.0
+
     @dataclass
     class AttentionInputs:
         query: any
@@ -56,6 +58,7 @@ class TestPagedMLAttention:
         k_seqlen_list: list,
         num_blocks: int,
         block_size: int,
+        max_q_seqlen: int = 4,
     ):
         # 检查列表长度是否与 batch size 匹配
         if len(q_seqlen_list) != batch or len(k_seqlen_list) != batch:
@@ -75,11 +78,11 @@ class TestPagedMLAttention:
             logging("[ERROR] blockSize != 128 is not supported.")
             sys.exit()
 
-        # 检查每个 q_seqlen 是否在有效范围内 [1, 4]
+        # 检查每个 q_seqlen 是否在有效范围内 [1, max_q_seqlen]，树形掩码下为 64，否则为 4
         for q_seqlen in q_seqlen_list:
-            if q_seqlen > 4 or q_seqlen < 1:
+            if q_seqlen > max_q_seqlen or q_seqlen < 1:
                 logging(
-                    f"[ERROR] q_seqlen value {q_seqlen} is not in the valid range of [1, 4]."
+                    f"[ERROR] q_seqlen value {q_seqlen} is not in the valid range of [1, {max_q_seqlen}]."
                 )
                 sys.exit()
 
@@ -106,6 +109,15 @@ class TestPagedMLAttention:
                 score = np.concatenate((score, group_score), 0)
         return score
 
+    @classmethod
+    def gen_tree_bits(cls, q_seqlen):
+        # 随机生成一棵以 0 号 draft token 为根的树，每个 token 可见自身及其全部祖先
+        bits = [1]
+        for token in range(1, q_seqlen):
+            parent = np.random.randint(0, token)
+            bits.append(bits[parent] | (1 << token))
+        return bits
+
     @classmethod
     def softmax_numpy(cls, sim):
         row_max = np.max(sim, axis=-1, keepdims=True)
@@ -180,7 +192,7 @@ class TestPagedMLAttention:
             keys = np.stack(keys, axis=0)
             values = np.stack(values, axis=0)
             scale = 1.0 / (head_size_qk**0.5)
-            if attention_inputs.mask_type == 1:
+            if attention_inputs.mask_type in (1, 2):
                 mask = attention_inputs.global_mask[
                     cu_seqlen : (cu_seqlen + q_seqlen), :
                 ]
@@ -252,6 +264,25 @@ class TestPagedMLAttention:
                 ] = tri
                 pre_qseqlen += qseqlen
             mask = mask.astype(gen_data_params.dtype)
+        elif gen_data_params.mask_type == 2:
+            # draft token 位于每个 batch 最后 qseqlen 个 kv 位置，tree_mask.bin 每个 q token 存一个 uint64 位图
+            mask = np.zeros(shape=(num_tokens, max_k_seqlen)).astype(
+                gen_data_params.dtype
+            )
+            tree_mask = []
+            pre_qseqlen = 0
+            for i in range(batch_size):
+                qseqlen = gen_data_params.q_seqlen_list[i]
+                kseqlen = gen_data_params.k_seqlen_list[i]
+                bits = self.gen_tree_bits(qseqlen)
+                tree_mask.extend(bits)
+                for token in range(qseqlen):
+                    for draft in range(qseqlen):
+                        if not (bits[token] >> draft) & 1:
+                            mask[
+                                pre_qseqlen + token, kseqlen - qseqlen + draft
+                            ] = pre_mask_factor
+                pre_qseqlen += qseqlen
         elif gen_data_params.mask_type == 0:
             mask = None
 
@@ -291,8 +322,12 @@ class TestPagedMLAttention:
         np.array(gen_data_params.k_seqlen_list).astype(np.int32).tofile(
             os.path.join(WORKSPACE, "data", "kv_seqlen.bin")
         )
-        if mask:
+        if gen_data_params.mask_type == 1:
             mask.tofile(os.path.join(WORKSPACE, "data", "mask.bin"))
+        elif gen_data_params.mask_type == 2:
+            np.array(tree_mask, dtype=np.uint64).tofile(
+                os.path.join(WORKSPACE, "data", "tree_mask.bin")
+            )
         ref_output.astype(gen_data_params.dtype).tofile(
             os.path.join(WORKSPACE, "data", "cpu_low.bin")
         )
@@ -305,9 +340,9 @@ if __name__ == "__main__":
     os.makedirs(os.path.join(WORKSPACE, "data"), exist_ok=True)
 
     # 修改命令行参数解析逻辑，以接受列表形式的输入
-    if len(sys.argv) != 8:
+    if len(sys.argv) not in (8, 9) or (len(sys.argv) == 9 and sys.argv[8] != "tree"):
         print(
-            'Usage: python gen_data.py <batchSize> "<qSeqlen_list>" "<kvSeqlen_list>" <qheadNum> <numBlock> <blockSize> <dtype>'
+            'Usage: python gen_data.py <batchSize> "<qSeqlen_list>" "<kvSeqlen_list>" <qheadNum> <numBlock> <blockSize> <dtype> [tree]'
         )
         print(
             'Example: python gen_data.py 4 "1,2,3,4" "128,256,512,1024" 16 16 128 half'
@@ -328,7 +363,8 @@ if __name__ == "__main__":
     str_dtype = str(sys.argv[7])
     max_kv_seqlen = max(kv_seqlen_list) if kv_seqlen_list else 0
 
-    mask_type = 0
+    mask_type = 2 if len(sys.argv) == 9 else 0
+    max_q_seqlen = 64 if mask_type == 2 else 4
     kv_heads = 1
     embedding_size = 512
     embedding_size_rope = 64
@@ -342,7 +378,9 @@ if __name__ == "__main__":
 
     testObj = TestPagedMLAttention()
 
-    testObj.check_attr(batch, q_seqlen_list, kv_seqlen_list, num_blocks, block_size)
+    testObj.check_attr(
+        batch, q_seqlen_list, kv_seqlen_list, num_blocks, block_size, max_q_seqlen
+    )
     gen_data_params = testObj.GenDataParams(
         q_seqlen_list,
         kv_seqlen_list,
@@ -32,6 +32,7 @@ constexpr int32_t TILING_HEADSIZE = 8;
 constexpr int32_t TILING_PARASIZE = 9;
 constexpr int32_t TILING_HEAD_SPLIT_SIZE = 10;
 constexpr int32_t TILING_HEAD_SPLIT_NUM = 11;
+constexpr int32_t TILING_MASKTYPE = 12;
 constexpr int32_t TILING_HEADDIM_ROPE = 13;
 constexpr int32_t TILING_MAX_KVSEQLEN = 14;
 constexpr int32_t TILING_KVSPLIT = 15;
@@ -47,6 +48,9 @@ constexpr int32_t TILING_HEADDIM_V_SPLIT = 39;
 constexpr int32_t TILING_HEADDIM_V_SPLIT_VECTOR_FORMER = 40;
 constexpr int32_t TILING_HEADDIM_V_SPLIT_VECTOR_TAIL = 41;
 
+// Keep in sync with MLATiling::MaskType
+constexpr uint32_t MASK_TYPE_TREE = 2;
+
 constexpr int32_t NUM1 = 1;
 constexpr int32_t NUM4 = 4;
 constexpr int32_t NUM64 = 64;
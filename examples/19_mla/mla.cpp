@@ -44,7 +44,7 @@ vector<uint32_t> splitSeqList(const string& seqStr)
 struct Options {
     static constexpr auto HELPER =
         "Usage: mla batch \"qSeqlenList\" \"kvSeqlenList\" numHeads numBlocks blockSize [--dtype DTYPE "
-        "--datapath DATA_PATH --device DEVICE_ID]\n"
+        "--datapath DATA_PATH --device DEVICE_ID --tree]\n"
         "Example: ./19_mla 4 \"1,2,3,4\" \"128,256,512,1024\" 16 16 128\n";
     static constexpr auto MIN_ARGS = 7;
 
@@ -98,6 +98,8 @@ struct Options {
                 deviceId = atoi(argv[argIndex++]);
             } else if (flag == "--dtype") {
                 dataType = string(argv[argIndex++]);
+            } else if (flag == "--tree") {
+                maskType = static_cast<uint32_t>(MLATiling::MaskType::MASK_TREE);
             } else {
                 printf(HELPER);
                 return -1;
@@ -156,6 +158,11 @@ static void Run(const Options& options)
         cerr << "[ERROR] dtype must be 'half' or 'bf16'." << endl;
         return;
     }
+    bool isTreeMask = (maskType == static_cast<int32_t>(MLATiling::MaskType::MASK_TREE));
+    if (isTreeMask && (numHeads == MLATiling::NUM128)) {
+        cerr << "[ERROR] tree mask is not supported when numHeads = 128." << endl;
+        return;
+    }
 
     int32_t dTypeKey = (dataType == "half") ? 0 : 1;
     int32_t specStraKey = (numHeads == MLATiling::NUM128) ? 1 : 0;
@@ -234,6 +241,16 @@ static void Run(const Options& options)
     ReadFile(dataPath + "/block_table.bin", blockTableHost, blockTableSize);
     ACL_CHECK(aclrtMemcpy(blockTableDevice, blockTableSize, blockTableHost, blockTableSize, ACL_MEMCPY_HOST_TO_DEVICE));
 
+    // Load the packed speculative tree mask, one uint64 bitset per q token.
+    uint8_t* treeMaskHost{nullptr};
+    uint8_t* treeMaskDevice{nullptr};
+    uint64_t treeMaskSize = (uint64_t)numTokens * sizeof(uint64_t);
+    if (isTreeMask) {
+        AllocMem(&treeMaskHost, &treeMaskDevice, treeMaskSize);
+        ReadFile(dataPath + "/tree_mask.bin", treeMaskHost, treeMaskSize);
+        ACL_CHECK(aclrtMemcpy(treeMaskDevice, treeMaskSize, treeMaskHost, treeMaskSize, ACL_MEMCPY_HOST_TO_DEVICE));
+    }
+
     // Allocate matrices in device memory for workspace.
     uint8_t* sDevice;
     ACL_CHECK(aclrtMalloc(
@@ -278,7 +295,11 @@ static void Run(const Options& options)
     mlaInfo.batch = batch;
     mlaInfo.qSeqLen = static_cast<int32_t*>(qSeq);
     mlaInfo.kvSeqLen = static_cast<int32_t*>(kvSeq);
-    MLATiling::GetMLATilingParam(mlaInfo, blockDim, (uint32_t*)tilingHost);
+    mlaInfo.maskType = static_cast<MLATiling::MaskType>(maskType);
+    if (MLATiling::GetMLATilingParam(mlaInfo, blockDim, (uint32_t*)tilingHost) != 0) {
+        cerr << "[ERROR] failed to get mla tiling." << endl;
+        return;
+    }
 
     ACL_CHECK(aclrtMemcpy(tilingDevice, tilingSize, tilingHost, tilingSize, ACL_MEMCPY_HOST_TO_DEVICE));
 
@@ -301,12 +322,12 @@ static void Run(const Options& options)
         case 0:
             MLA<half><<<blockDim, nullptr, stream>>>(
                 hardwareSyncAddr, qDevice, qRopeDevice, kDevice, kRopeDevice, blockTableDevice, oDevice, sDevice,
-                pDevice, oTmpDevice, globaloDevice, oCoreTmpDevice, lDevice, tilingDevice);
+                pDevice, oTmpDevice, globaloDevice, oCoreTmpDevice, lDevice, treeMaskDevice, tilingDevice);
             break;
         case 1:
             MLA<bfloat16_t><<<blockDim, nullptr, stream>>>(
                 hardwareSyncAddr, qDevice, qRopeDevice, kDevice, kRopeDevice, blockTableDevice, oDevice, sDevice,
-                pDevice, oTmpDevice, globaloDevice, oCoreTmpDevice, lDevice, tilingDevice);
+                pDevice, oTmpDevice, globaloDevice, oCoreTmpDevice, lDevice, treeMaskDevice, tilingDevice);
             break;
         case 4:
             AMLATp1Spec<half><<<blockDim, nullptr, stream>>>(
@@ -376,6 +397,9 @@ static void Run(const Options& options)
     FreeMem(kHost, kDevice);
     FreeMem(kRopeHost, kRopeDevice);
     FreeMem(blockTableHost, blockTableDevice);
+    if (isTreeMask) {
+        FreeMem(treeMaskHost, treeMaskDevice);
+    }
     aclrtFree(oDevice);
     aclrtFree(tilingDevice);
     aclrtFree(sDevice);
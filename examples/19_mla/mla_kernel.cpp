@@ -81,6 +81,7 @@ public:
         GM_ADDR oUpdate;
         GM_ADDR oCoreTmp;
         GM_ADDR l;
+        GM_ADDR treeMask;
         GM_ADDR tiling;
 
         // Methods
@@ -91,7 +92,8 @@ public:
         CATLASS_DEVICE
         Params(
             GM_ADDR q_, GM_ADDR qRope_, GM_ADDR k_, GM_ADDR kRope_, GM_ADDR blockTables_, GM_ADDR o_, GM_ADDR s_,
-            GM_ADDR p_, GM_ADDR oTmp_, GM_ADDR oUpdate_, GM_ADDR oCoreTmp_, GM_ADDR l_, GM_ADDR tiling_)
+            GM_ADDR p_, GM_ADDR oTmp_, GM_ADDR oUpdate_, GM_ADDR oCoreTmp_, GM_ADDR l_, GM_ADDR treeMask_,
+            GM_ADDR tiling_)
             : q(q_),
               qRope(qRope_),
               k(k_),
@@ -104,6 +106,7 @@ public:
               oUpdate(oUpdate_),
               oCoreTmp(oCoreTmp_),
               l(l_),
+              treeMask(treeMask_),
               tiling(tiling_)
         {}
     };
@@ -197,6 +200,8 @@ public:
         gl.SetGlobalBuffer((__gm__ ElementOTmp*)params.l);
         AscendC::GlobalTensor<float> gTilingFp64;
         gTilingFp64.SetGlobalBuffer((__gm__ float*)params.tiling);
+        AscendC::GlobalTensor<uint64_t> gTreeMask;
+        gTreeMask.SetGlobalBuffer((__gm__ uint64_t*)params.treeMask);
 #endif
 
         // Get tiling parameters
@@ -215,6 +220,7 @@ public:
 #ifdef __DAV_VEC__
         float tor = gTilingFp64.GetValue(TILING_TOR);
         uint32_t glFlag[2] = {1, 1};
+        bool isTreeMask = (gTiling.GetValue(TILING_MASKTYPE) == MASK_TYPE_TREE);
 
         EpilogueMLASoftmax epilogueMLASoftmax(resource, tor, maxKvSplitCoreNum);
         EpilogueMLARescaleO epilogueMLARescaleO(resource, maxKvSplitCoreNum);
@@ -351,6 +357,18 @@ public:
                 oFdOffset = FdAddr * maxKvSplitCoreNum + headIdx * embed * maxKvSplitCoreNum + curNIdx * embed;
                 lOffset = lAddr + headIdx * maxKvSplitCoreNum + curNIdx;
             }
+            // The draft tokens of a speculative tree occupy the last qSeqlen kv positions of the batch
+            AscendC::GlobalTensor<uint64_t> gTreeMaskBatch;
+            int32_t draftStart = 0;
+            uint32_t draftLen = 0;
+            if (isTreeMask) {
+                uint32_t maskAddrHigh32 = gTiling.GetValue(offsetTiling + 8);
+                uint32_t maskAddrLow32 = gTiling.GetValue(offsetTiling + 9);
+                uint64_t maskAddr = (uint64_t)((((uint64_t)maskAddrHigh32) << 32) | maskAddrLow32);
+                gTreeMaskBatch = gTreeMask[maskAddr];
+                draftStart = static_cast<int32_t>(kvSeqlen - qSeqlen) - static_cast<int32_t>(curNIdx * kvSplitPerCore);
+                draftLen = qSeqlen;
+            }
 #endif
 
             if (isFirstTask && nLoop > 0) {
@@ -392,9 +410,11 @@ public:
                 GemmCoord actualBlockShapeQK{rowNum, kSeqTile, embedRound};
                 uint64_t gmOffsetP = (uint64_t)coreIdx * TMP_SIZE + softmaxPingPongFlag * TMP_SIZE / 2;
                 uint64_t gmOffsetS = (uint64_t)coreIdx * TMP_SIZE_DECODER + softmaxPingPongFlag * TMP_SIZE_DECODER / 2;
+                int32_t tileDraftStart = draftStart - static_cast<int32_t>(nIdx * seqTile);
                 epilogueMLASoftmax(
                     gP[gmOffsetP], gS[gmOffsetS], layoutP, layoutS, actualBlockShapeQK, nIdx, qHeadSplitSizeActual,
-                    softmaxPingPongFlag, glFlag, taskPingPongFlag);
+                    softmaxPingPongFlag, glFlag, taskPingPongFlag, gTreeMaskBatch, tileDraftStart,
+                    GetTileDraftLen(tileDraftStart, draftLen, kSeqTile));
 
                 pingpongIdx++;
                 Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(softmaxReady);
@@ -440,9 +460,11 @@ public:
                     uint64_t gmOffsetP = (uint64_t)coreIdx * TMP_SIZE + softmaxPingPongFlag * TMP_SIZE / 2;
                     uint64_t gmOffsetS =
                         (uint64_t)coreIdx * TMP_SIZE_DECODER + softmaxPingPongFlag * TMP_SIZE_DECODER / 2;
+                    int32_t tileDraftStart = draftStart - static_cast<int32_t>(nIdx * seqTile);
                     epilogueMLASoftmax(
                         gP[gmOffsetP], gS[gmOffsetS], layoutP, layoutS, actualBlockShapeQK, nIdx, qHeadSplitSizeActual,
-                        softmaxPingPongFlag, glFlag, taskPingPongFlag);
+                        softmaxPingPongFlag, glFlag, taskPingPongFlag, gTreeMaskBatch, tileDraftStart,
+                        GetTileDraftLen(tileDraftStart, draftLen, kSeqTile));
 
                     Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(softmaxReady);
 #endif
@@ -564,9 +586,23 @@ public:
                         uint64_t nextGMOffsetP = (uint64_t)coreIdx * TMP_SIZE + softmaxPingPongFlag * TMP_SIZE / 2;
                         uint64_t nextGMOffsetS =
                             (uint64_t)coreIdx * TMP_SIZE_DECODER + softmaxPingPongFlag * TMP_SIZE_DECODER / 2;
+                        AscendC::GlobalTensor<uint64_t> nextGTreeMaskBatch;
+                        int32_t nextDraftStart = 0;
+                        uint32_t nextDraftLen = 0;
+                        if (isTreeMask) {
+                            uint32_t nextMaskAddrHigh32 = gTiling.GetValue(nextOffsetTiling + 8);
+                            uint32_t nextMaskAddrLow32 = gTiling.GetValue(nextOffsetTiling + 9);
+                            uint64_t nextMaskAddr =
+                                (uint64_t)((((uint64_t)nextMaskAddrHigh32) << 32) | nextMaskAddrLow32);
+                            nextGTreeMaskBatch = gTreeMask[nextMaskAddr];
+                            nextDraftStart = static_cast<int32_t>(nextKVSeqlen - nextQSeqlen) -
+                                             static_cast<int32_t>(nextCurNIdx * nextKVSplitPerCore);
+                            nextDraftLen = GetTileDraftLen(nextDraftStart, nextQSeqlen, nextKSeqTile);
+                        }
                         epilogueMLASoftmax(
                             gP[nextGMOffsetP], gS[nextGMOffsetS], nextLayoutP, nextLayoutS, nextActualBlockShapeQK,
-                            nextNIdx, nextQHeadSplitSizeActual, softmaxPingPongFlag, glFlag, nextTaskPingPongFlag);
+                            nextNIdx, nextQHeadSplitSizeActual, softmaxPingPongFlag, glFlag, nextTaskPingPongFlag,
+                            nextGTreeMaskBatch, nextDraftStart, nextDraftLen);
 
                         Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(softmaxReady);
 #endif
@@ -726,6 +762,15 @@ public:
     }
 
 private:
+    /// Only kv tiles that overlap the draft region need the tree mask
+    CATLASS_DEVICE
+    static uint32_t GetTileDraftLen(int32_t tileDraftStart, uint32_t draftLen, uint32_t kSeqTile)
+    {
+        bool overlap = (tileDraftStart < static_cast<int32_t>(kSeqTile)) &&
+                       (tileDraftStart + static_cast<int32_t>(draftLen) > 0);
+        return overlap ? draftLen : 0;
+    }
+
     Arch::Resource<ArchTag> resource;
     Arch::CrossCoreFlag qkReady{QK_READY_ID};
     Arch::CrossCoreFlag softmaxReady{SOFTMAX_READY_ID};
@@ -735,7 +780,7 @@ private:
 template <class Dtype>
 CATLASS_GLOBAL void MLA(
     uint64_t hardwareSyncAddr, GM_ADDR q, GM_ADDR qRope, GM_ADDR k, GM_ADDR kRope, GM_ADDR blockTables, GM_ADDR o,
-    GM_ADDR s, GM_ADDR p, GM_ADDR oTmp, GM_ADDR oUpdate, GM_ADDR oCoreTmp, GM_ADDR l, GM_ADDR tiling)
+    GM_ADDR s, GM_ADDR p, GM_ADDR oTmp, GM_ADDR oUpdate, GM_ADDR oCoreTmp, GM_ADDR l, GM_ADDR treeMask, GM_ADDR tiling)
 {
     // Set hardware sync address
     AscendC::SetSyncBaseAddr(hardwareSyncAddr);
@@ -799,7 +844,8 @@ CATLASS_GLOBAL void MLA(
     // Kernel level
     using MLAKernel =
         MLAKernel<BlockMmadQK, BlockMmadPV, EpilogueMLASoftmax, EpilogueMLARescaleO, EpilogueMLAFDRescaleO>;
-    typename MLAKernel::Params params{q, qRope, k, kRope, blockTables, o, s, p, oTmp, oUpdate, oCoreTmp, l, tiling};
+    typename MLAKernel::Params params{
+        q, qRope, k, kRope, blockTables, o, s, p, oTmp, oUpdate, oCoreTmp, l, treeMask, tiling};
 
     // call kernel
     MLAKernel mla;
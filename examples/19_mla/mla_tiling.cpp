@@ -125,7 +125,7 @@ int32_t GetQNBlockTile(const MLAInfo& mlaInfo, int32_t qSeqLen, uint32_t specStr
         tokenNum = NUM1;
     }
     int32_t tileListIdx = static_cast<int32_t>(std::ceil(std::log2(tokenNum)));
-    tileListIdx = (tileListIdx > NUM5) ? NUM5 : tileListIdx;
+    tileListIdx = (tileListIdx > NUM6) ? NUM6 : tileListIdx;
     int32_t qNBlockTile = QN_TILE_LIST[tileListIdx];
     int32_t group = mlaInfo.numHeads / mlaInfo.kvHeads;
     qNBlockTile = (qNBlockTile > group) ? group : qNBlockTile;
@@ -481,7 +481,10 @@ int32_t GetMLATilingParam(const MLAInfo& mlaInfo, uint32_t& blockDim, uint32_t*
 
         uint64_t deltaQSeq = static_cast<uint64_t>(mlaInfo.numHeads * mlaInfo.embeddingSize * qSeqLen);
         uint64_t deltaQSeqRope = static_cast<uint64_t>(mlaInfo.numHeads * mlaInfo.embeddingSizeRope * qSeqLen);
-        uint64_t deltaMaskBatch = static_cast<uint64_t>(mlaInfo.maxKvSeqlen * qSeqLen);
+        // The tree mask packs one uint64 bitset per q token instead of a dense [qSeqLen, maxKvSeqlen] block
+        uint64_t deltaMaskBatch = (mlaInfo.maskType == MaskType::MASK_TREE) ?
+                                      static_cast<uint64_t>(qSeqLen) :
+                                      static_cast<uint64_t>(mlaInfo.maxKvSeqlen * qSeqLen);
 
         addrOffsetsPerBatch[i].qSeqOffset = currentQSeqOffset;
         addrOffsetsPerBatch[i].qSeqRopeOffset = currentQSeqRopeOffset;
@@ -511,14 +514,25 @@ int32_t GetMLATilingParam(const MLAInfo& mlaInfo, uint32_t& blockDim, uint32_t*
         quickSortIndices(sortedIndices, mlaInfo.kvSeqLen, mlaInfo.qSeqLen, 0, mlaInfo.batch - 1);
     }
 
+    bool isTreeMask = (mlaInfo.maskType == MaskType::MASK_TREE);
+    if (isTreeMask && mlaInfo.numHeads == NUM128) {
+        cerr << "[ERROR] tree mask is not supported when numHeads = 128." << endl;
+        return -1;
+    }
+    int32_t maxQseqlenLimit = isTreeMask ? MAX_QSEQLEN_TREE : MAX_QSEQLEN_MTP;
     int32_t maxQseqlen = 0;
     int32_t totalKvNumtokens = 0;
     for (int32_t seqIdx = 0; seqIdx < mlaInfo.batch; seqIdx++) {
         int32_t qSeqLen = *(mlaInfo.qSeqLen + seqIdx);
-        if (qSeqLen > NUM4) {
-            cerr << "[ERROR] qSeqLen > 4 is not supported." << endl;
+        if (qSeqLen > maxQseqlenLimit) {
+            cerr << "[ERROR] qSeqLen > " << maxQseqlenLimit << " is not supported." << endl;
+            return -1;
         }
         int32_t kvSeqLen = *(mlaInfo.kvSeqLen + seqIdx);
+        if (isTreeMask && kvSeqLen > 0 && kvSeqLen < qSeqLen) {
+            cerr << "[ERROR] kvSeqLen must cover the draft tokens when tree mask is used." << endl;
+            return -1;
+        }
         qSeqLen = (kvSeqLen == 0) ? 0 : qSeqLen;
         maxQseqlen = std::max(qSeqLen, maxQseqlen);
         totalKvNumtokens += kvSeqLen;
@@ -79,13 +79,17 @@ const int32_t WORKSPACE_BLOCK_SIZE_DB = 65536;
 
 const float SPLITKV_RATION = 0.8;
 const int32_t KV_SEQLEN_SLICE = 128;
+const int32_t MAX_QSEQLEN_MTP = 4;
+const int32_t MAX_QSEQLEN_TREE = 64;
 
-constexpr std::array<int32_t, NUM6> QN_TILE_LIST = {128, 64, 32, 16, 8, 1};
+// Heads per task indexed by ceil(log2(qSeqLen)), so that heads * qSeqLen fills the 128-row M tile
+constexpr std::array<int32_t, NUM7> QN_TILE_LIST = {128, 64, 32, 16, 8, 4, 2};
 
 enum class MaskType
 {
     NO_MASK = 0,
-    MASK_SPEC = 1
+    MASK_SPEC = 1,
+    MASK_TREE = 2
 };
 
 struct MLAInfo {
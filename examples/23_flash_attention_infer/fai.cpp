@@ -26,7 +26,8 @@ using namespace std;
 struct Options {
     static constexpr auto HELPER =
         "Usage: fai batch qSeqlen kvSeqlen numHeads kvHeads embeddingSize isVariedLen maskType [--dtype DTYPE "
-        "--datapath DATA_PATH --device DEVICE_ID]\n";
+        "--datapath DATA_PATH --device DEVICE_ID --window WINDOW_SIZE --mask-gen --kvquant KV_QUANT_TYPE --rope "
+        "--prefix PREFIX_LEN]\n";
     static constexpr auto MIN_ARGS = 7;
 
     // Define default value.
@@ -38,6 +39,11 @@ struct Options {
     uint32_t embeddingSize{0};
     uint32_t isVariedLen{0};
     uint32_t maskType{0};
+    uint32_t windowSize{0};
+    bool maskGenFlag{false};
+    uint32_t kvQuantType{0};
+    bool ropeFlag{false};
+    uint32_t prefixLen{0};
     uint32_t deviceId{0};
     uint32_t blockSize{128};
     string dataType = "half";
@@ -72,11 +78,31 @@ struct Options {
                 deviceId = atoi(argv[argIndex++]);
             } else if (flag == "--dtype") {
                 dataType = string(argv[argIndex++]);
+            } else if (flag == "--window") {
+                windowSize = atoi(argv[argIndex++]);
+            } else if (flag == "--mask-gen") {
+                maskGenFlag = true;
+            } else if (flag == "--kvquant") {
+                kvQuantType = atoi(argv[argIndex++]);
+            } else if (flag == "--rope") {
+                ropeFlag = true;
+            } else if (flag == "--prefix") {
+                prefixLen = atoi(argv[argIndex++]);
             } else {
                 printf(HELPER);
                 return -1;
             }
         }
+        // maskType 3: sliding window, 4: chunked local, both need a window size
+        if ((maskType == 3 || maskType == 4) && windowSize == 0) {
+            printf(HELPER);
+            return -1;
+        }
+        // kvQuantType 0: fp16/bf16 KV cache, 1: int8 KV with per-head scales, 2: int8 KV with per-(block, head) scales
+        if (kvQuantType > 2) {
+            printf(HELPER);
+            return -1;
+        }
         return 0;
     }
 };
@@ -114,6 +140,9 @@ static void Run(const Options& options)
     int32_t embeddingSize = options.embeddingSize;
     int32_t blockSize = options.blockSize;
     int32_t maskType = options.maskType;
+    uint32_t kvQuantType = options.kvQuantType;
+    bool ropeFlag = options.ropeFlag;
+    uint32_t prefixLen = options.prefixLen;
     string dataType = options.dataType;
     string dataPath = options.dataPath;
     int32_t maxKvSeqlen = kvSeqlen;
@@ -132,8 +161,11 @@ static void Run(const Options& options)
 
     uint64_t seqArraySize = batch * sizeof(int64_t);
     uint64_t qoSize = (uint64_t)numTokens * (uint64_t)numHeads * (uint64_t)embeddingSize * sizeof(fp16_t);
+    // an int8 KV cache stores one byte per element
+    uint64_t kvElemSize = (kvQuantType != 0) ? sizeof(int8_t) : sizeof(fp16_t);
     uint64_t kvSize =
-        (uint64_t)numBlocks * (uint64_t)blockSize * (uint64_t)kvHeads * (uint64_t)embeddingSize * sizeof(fp16_t);
+        (uint64_t)numBlocks * (uint64_t)blockSize * (uint64_t)kvHeads * (uint64_t)embeddingSize * kvElemSize;
+    uint64_t kvScaleSize = ((kvQuantType == 2) ? (uint64_t)numBlocks : 1) * (uint64_t)kvHeads * sizeof(float);
     uint64_t maskSize = 1024 * 1024 * sizeof(fp16_t);
     uint64_t blockTableSize =
         static_cast<uint64_t>(batch * ((maxKvSeqlen + blockSize - 1) / blockSize) * sizeof(int32_t));
@@ -175,10 +207,57 @@ static void Run(const Options& options)
     ReadFile(dataPath + "/v.bin", vHost, kvSize);
     ACL_CHECK(aclrtMemcpy(vDevice, kvSize, vHost, kvSize, ACL_MEMCPY_HOST_TO_DEVICE));
 
+    // Allocate and load the RoPE inputs: cos/sin tables, position of every q token and the un-rotated new K rows.
+    // The rotated Q goes to a workspace, the rotated new K rows are written into the kv cache by the kernel.
+    uint64_t ropeTableSize = (uint64_t)maxKvSeqlen * (uint64_t)embeddingSize * sizeof(fp16_t);
+    uint64_t positionIdsSize = (uint64_t)numTokens * sizeof(int32_t);
+    uint64_t kNewSize = (uint64_t)numTokens * (uint64_t)kvHeads * (uint64_t)embeddingSize * sizeof(fp16_t);
+    uint8_t* cosHost{nullptr};
+    uint8_t* cosDevice{nullptr};
+    uint8_t* sinHost{nullptr};
+    uint8_t* sinDevice{nullptr};
+    uint8_t* positionIdsHost{nullptr};
+    uint8_t* positionIdsDevice{nullptr};
+    uint8_t* kNewHost{nullptr};
+    uint8_t* kNewDevice{nullptr};
+    uint8_t* qRopeDevice{nullptr};
+    if (ropeFlag) {
+        AllocMem(&cosHost, &cosDevice, ropeTableSize);
+        ReadFile(dataPath + "/cos.bin", cosHost, ropeTableSize);
+        ACL_CHECK(aclrtMemcpy(cosDevice, ropeTableSize, cosHost, ropeTableSize, ACL_MEMCPY_HOST_TO_DEVICE));
+        AllocMem(&sinHost, &sinDevice, ropeTableSize);
+        ReadFile(dataPath + "/sin.bin", sinHost, ropeTableSize);
+        ACL_CHECK(aclrtMemcpy(sinDevice, ropeTableSize, sinHost, ropeTableSize, ACL_MEMCPY_HOST_TO_DEVICE));
+        AllocMem(&positionIdsHost, &positionIdsDevice, positionIdsSize);
+        ReadFile(dataPath + "/position_ids.bin", positionIdsHost, positionIdsSize);
+        ACL_CHECK(aclrtMemcpy(
+            positionIdsDevice, positionIdsSize, positionIdsHost, positionIdsSize, ACL_MEMCPY_HOST_TO_DEVICE));
+        AllocMem(&kNewHost, &kNewDevice, kNewSize);
+        ReadFile(dataPath + "/k_new.bin", kNewHost, kNewSize);
+        ACL_CHECK(aclrtMemcpy(kNewDevice, kNewSize, kNewHost, kNewSize, ACL_MEMCPY_HOST_TO_DEVICE));
+        ACL_CHECK(aclrtMalloc((void**)(&qRopeDevice), qoSize, ACL_MEM_MALLOC_HUGE_FIRST));
+    }
+
+    // Allocate and load the K/V dequant scales of an int8 KV cache.
+    uint8_t* kScaleHost{nullptr};
+    uint8_t* kScaleDevice{nullptr};
+    uint8_t* vScaleHost{nullptr};
+    uint8_t* vScaleDevice{nullptr};
+    if (kvQuantType != 0) {
+        AllocMem(&kScaleHost, &kScaleDevice, kvScaleSize);
+        ReadFile(dataPath + "/k_scale.bin", kScaleHost, kvScaleSize);
+        ACL_CHECK(aclrtMemcpy(kScaleDevice, kvScaleSize, kScaleHost, kvScaleSize, ACL_MEMCPY_HOST_TO_DEVICE));
+        AllocMem(&vScaleHost, &vScaleDevice, kvScaleSize);
+        ReadFile(dataPath + "/v_scale.bin", vScaleHost, kvScaleSize);
+        ACL_CHECK(aclrtMemcpy(vScaleDevice, kvScaleSize, vScaleHost, kvScaleSize, ACL_MEMCPY_HOST_TO_DEVICE));
+    }
+
     // Allocate matrices in host and device memory and load Matrix v.
-    uint8_t* maskHost;
-    uint8_t* maskDevice;
-    if (maskType == 1) {
+    // with --mask-gen the kernel generates the causal mask on chip and no mask tensor is needed
+    bool maskLoadFlag = (maskType != 0) && !options.maskGenFlag;
+    uint8_t* maskHost{nullptr};
+    uint8_t* maskDevice{nullptr};
+    if (maskLoadFlag) {
         AllocMem(&maskHost, &maskDevice, maskSize);
         ReadFile(dataPath + "/mask.bin", maskHost, maskSize);
         ACL_CHECK(aclrtMemcpy(maskDevice, maskSize, maskHost, maskSize, ACL_MEMCPY_HOST_TO_DEVICE));
@@ -229,6 +308,11 @@ static void Run(const Options& options)
     faInfo.kvHeads = kvHeads;
     faInfo.batch = batch;
     faInfo.maskType = static_cast<FAInferTiling::MaskType>(maskType);
+    faInfo.windowSize = static_cast<int32_t>(options.windowSize);
+    faInfo.maskGenFlag = options.maskGenFlag;
+    faInfo.kvQuantType = static_cast<FAInferTiling::KvQuantType>(kvQuantType);
+    faInfo.ropeFlag = ropeFlag;
+    faInfo.prefixLen = static_cast<int32_t>(prefixLen);
     faInfo.qSeqlenList = reinterpret_cast<int64_t*>(qSeqHost);
     faInfo.kvSeqlenList = reinterpret_cast<int64_t*>(kvSeqHost);
 
@@ -236,6 +320,31 @@ static void Run(const Options& options)
 
     FAInferTiling::GetFATilingParam(faInfo, blockDim, faTilingData);
 
+    // Per-core rings for the dequantized K and V of an int8 KV cache, followed by the block table that maps the
+    // kv pages of a task onto ring pages.
+    uint8_t* kvDequantDevice{nullptr};
+    if (kvQuantType != 0) {
+        uint64_t kvDequantSize = FAInferTiling::GetKvDequantSize(blockDim, faTilingData);
+        ACL_CHECK(aclrtMalloc((void**)(&kvDequantDevice), kvDequantSize, ACL_MEM_MALLOC_HUGE_FIRST));
+        std::vector<int32_t> ringTable(faTilingData.maxNumBlocksPerBatch);
+        for (uint32_t pageIdx = 0; pageIdx < ringTable.size(); pageIdx++) {
+            ringTable[pageIdx] = static_cast<int32_t>(pageIdx % faTilingData.kvDequantRingPages);
+        }
+        uint64_t ringTableSize = ringTable.size() * sizeof(int32_t);
+        ACL_CHECK(aclrtMemcpy(
+            kvDequantDevice + kvDequantSize - ringTableSize, ringTableSize, ringTable.data(), ringTableSize,
+            ACL_MEMCPY_HOST_TO_DEVICE));
+    }
+
+    // Cascade attention: output of the shared prefix pass and the float lse of both passes.
+    uint8_t* oPrefixDevice{nullptr};
+    uint8_t* lseDevice{nullptr};
+    if (prefixLen != 0) {
+        uint64_t lseSize = 2 * (uint64_t)numTokens * (uint64_t)numHeads * sizeof(float);
+        ACL_CHECK(aclrtMalloc((void**)(&oPrefixDevice), qoSize, ACL_MEM_MALLOC_HUGE_FIRST));
+        ACL_CHECK(aclrtMalloc((void**)(&lseDevice), lseSize, ACL_MEM_MALLOC_HUGE_FIRST));
+    }
+
     tilingHost = reinterpret_cast<void*>(&faTilingData);
 
     uint32_t tilingKey = 0;
@@ -247,14 +356,28 @@ static void Run(const Options& options)
     ACL_CHECK(aclrtGetHardwareSyncAddr(reinterpret_cast<void**>(&hardwareSyncAddr)));
 
     for (int i = 0; i < 1; i++) {
-        if (dataType == "half") {
+        if (kvQuantType != 0) {
+            if (dataType == "half") {
+                FAInferKvInt8Fp16<<<blockDim, nullptr, stream>>>(
+                    hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, blockTableDevice, oDevice, qSeqDevice,
+                    kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice, kScaleDevice,
+                    vScaleDevice, kvDequantDevice);
+            } else {
+                FAInferKvInt8Bf16<<<blockDim, nullptr, stream>>>(
+                    hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, blockTableDevice, oDevice, qSeqDevice,
+                    kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice, kScaleDevice,
+                    vScaleDevice, kvDequantDevice);
+            }
+        } else if (dataType == "half") {
             FAInferFp16<<<blockDim, nullptr, stream>>>(
                 hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, blockTableDevice, oDevice, qSeqDevice,
-                kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice);
+                kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice, cosDevice, sinDevice,
+                positionIdsDevice, kNewDevice, qRopeDevice, oPrefixDevice, lseDevice);
         } else {
             FAInferBf16<<<blockDim, nullptr, stream>>>(
                 hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, blockTableDevice, oDevice, qSeqDevice,
-                kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice);
+                kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice, cosDevice, sinDevice,
+                positionIdsDevice, kNewDevice, qRopeDevice, oPrefixDevice, lseDevice);
         }
         ACL_CHECK(aclrtSynchronizeStream(stream));
         // Copy the result from device to host
@@ -287,10 +410,26 @@ static void Run(const Options& options)
     FreeMem(qHost, qDevice);
     FreeMem(kHost, kDevice);
     FreeMem(vHost, vDevice);
-    if (maskType == 1) {
+    if (maskLoadFlag) {
         FreeMem(maskHost, maskDevice);
     }
     FreeMem(blockTableHost, blockTableDevice);
+    if (ropeFlag) {
+        FreeMem(cosHost, cosDevice);
+        FreeMem(sinHost, sinDevice);
+        FreeMem(positionIdsHost, positionIdsDevice);
+        FreeMem(kNewHost, kNewDevice);
+        aclrtFree(qRopeDevice);
+    }
+    if (kvQuantType != 0) {
+        FreeMem(kScaleHost, kScaleDevice);
+        FreeMem(vScaleHost, vScaleDevice);
+        aclrtFree(kvDequantDevice);
+    }
+    if (prefixLen != 0) {
+        aclrtFree(oPrefixDevice);
+        aclrtFree(lseDevice);
+    }
     aclrtFree(oDevice);
     aclrtFree(tilingDevice);
     aclrtFree(sDevice);
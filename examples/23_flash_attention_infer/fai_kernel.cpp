@@ -17,6 +17,9 @@
 #include "catlass/gemm/block/block_mmad.hpp"
 #include "catlass/gemm/dispatch_policy.hpp"
 #include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemm/tile/apply_rope.hpp"
+#include "catlass/gemm/tile/dequant_kv_int8.hpp"
+#include "catlass/gemm/tile/merge_attn_state.hpp"
 #include "catlass/layout/layout.hpp"
 
 #include "kernel_common.hpp"
@@ -25,7 +28,7 @@ using namespace Catlass;
 
 template <
     class BlockMmadQK, class BlockMmadPV, class BlockMmadQKTail, class BlockMmadPVTail, class EpilogueOnlineSoftmax,
-    class EpilogueRescaleO, bool PAGED_CACHE_FLAG>
+    class EpilogueRescaleO, bool PAGED_CACHE_FLAG, bool KV_INT8_FLAG = false>
 class FAInferKernel {
 public:
     using ArchTag = typename BlockMmadQK::ArchTag;
@@ -51,6 +54,10 @@ public:
     using ElementOTmp = typename EpilogueRescaleO::ElementInput;
     using LayoutOTmp = typename EpilogueRescaleO::LayoutInput;
 
+    // With an int8 KV cache the vector cores dequantize the kv pages one stack tile ahead of the cube core into a
+    // small per-core ring, which the cube core reads through the paged blocks with a block table of ring pages.
+    static_assert(!KV_INT8_FLAG || PAGED_CACHE_FLAG, "int8 KV cache is consumed through the paged blocks");
+
     // Methods
     CATLASS_DEVICE
     FAInferKernel()
@@ -101,16 +108,33 @@ public:
         uint32_t totalTaskNum = fATilingData->totalTaskNum;
         uint32_t blockSize = fATilingData->blockSize;
         uint32_t maskType = fATilingData->maskType;
+        uint32_t windowSize = fATilingData->windowSize;
+        uint64_t kvDequantCoreSize = fATilingData->kvDequantCoreSize;
+        bool ropeFlag = !KV_INT8_FLAG && (fATilingData->ropeFlag != 0);
+        uint32_t numTokens = fATilingData->numTokens;
+        uint32_t prefixLen = (PAGED_CACHE_FLAG && !KV_INT8_FLAG) ? fATilingData->prefixLen : 0;
+        uint32_t prefixBlockNum = prefixLen / pagedBlockSize;
         float scaleValue = fATilingData->scaleValue;
+        uint32_t coreIdx = AscendC::GetBlockIdx();
+        uint32_t coreNum = AscendC::GetBlockNum();
 
         AscendC::GlobalTensor<ElementQ> gQ;
-        gQ.SetGlobalBuffer((__gm__ ElementQ*)params.q);
+        // with the RoPE prologue the rotated Q is read from the workspace written by the vector cores
+        gQ.SetGlobalBuffer((__gm__ ElementQ*)(ropeFlag ? params.qRope : params.q));
         AscendC::GlobalTensor<ElementK> gK;
-        gK.SetGlobalBuffer((__gm__ ElementK*)params.k);
         AscendC::GlobalTensor<ElementK> gV;
-        gV.SetGlobalBuffer((__gm__ ElementK*)params.v);
         AscendC::GlobalTensor<int32_t> gBlockTable;
-        gBlockTable.SetGlobalBuffer((__gm__ int32_t*)(params.blockTables));
+        if constexpr (KV_INT8_FLAG) {
+            gK.SetGlobalBuffer((__gm__ ElementK*)params.kvDequant);
+            gV.SetGlobalBuffer((__gm__ ElementK*)params.kvDequant);
+            // ring page of every kv page of a task, stored behind the rings of all cores
+            gBlockTable.SetGlobalBuffer((__gm__ int32_t*)(
+                params.kvDequant + static_cast<uint64_t>(coreNum) * kvDequantCoreSize * 2 * sizeof(ElementK)));
+        } else {
+            gK.SetGlobalBuffer((__gm__ ElementK*)params.k);
+            gV.SetGlobalBuffer((__gm__ ElementK*)params.v);
+            gBlockTable.SetGlobalBuffer((__gm__ int32_t*)(params.blockTables));
+        }
         AscendC::GlobalTensor<int64_t> gActualQseqlen;
         gActualQseqlen.SetGlobalBuffer((__gm__ int64_t*)params.actualQseqlen);
         AscendC::GlobalTensor<int64_t> gActualKvseqlen;
@@ -123,12 +147,10 @@ public:
         gOTmp.SetGlobalBuffer((__gm__ ElementOTmp*)params.oTemp);
 
         uint64_t strideQO = qHeads * embed;
-        uint64_t strideKV = kvHeads * embed;
+        uint64_t strideKV = KV_INT8_FLAG ? embed : kvHeads * embed;
         uint32_t embedRound = RoundUp<BLOCK_SIZE>(embed);
         uint32_t groupSize = qHeads / kvHeads;
 
-        uint32_t coreIdx = AscendC::GetBlockIdx();
-        uint32_t coreNum = AscendC::GetBlockNum();
         curTotalTaskNum = 0;
         uint32_t preTotalTaskNum = 0;
         uint32_t curBatch = 0;
@@ -145,27 +167,45 @@ public:
         uint32_t curQSBlockNum;
 
         preTotalTaskNum = curTotalTaskNum;
-        qSeqlen = reinterpret_cast<int64_t>(gActualQseqlen.GetValue(curBatch));
-        kvSeqlen = reinterpret_cast<int64_t>(gActualKvseqlen.GetValue(curBatch));
+        // cascade attention starts with the shared prefix pass: all query tokens against the prefix pages
+        bool inPrefix = (prefixLen != 0);
+        if (inPrefix) {
+            maskType = 0;
+            qSeqlen = numTokens;
+            kvSeqlen = prefixLen;
+        } else {
+            qSeqlen = reinterpret_cast<int64_t>(gActualQseqlen.GetValue(curBatch));
+            kvSeqlen = reinterpret_cast<int64_t>(gActualKvseqlen.GetValue(curBatch));
+        }
         curQSBlockTile = GetQSBlockTile(kvSeqlen);
         curQNBlockTile = GetQNBlockTile(qSeqlen, groupSize);
         qNBlockNumPerGroup = CeilDiv(groupSize, curQNBlockTile);
         curQNBlockNum = qNBlockNumPerGroup * kvHeads;
         curQSBlockNum = CeilDiv(qSeqlen, curQSBlockTile);
         curTotalTaskNum += curQNBlockNum * curQSBlockNum;
+        if (ropeFlag) {
+            Arch::CrossCoreWaitFlag(ropeReady);
+        }
         for (uint32_t taskIdx = coreIdx; taskIdx < totalTaskNum; taskIdx += uint32_t(coreNum)) {
             while (taskIdx >= curTotalTaskNum) {
-                ++curBatch;
                 preTotalTaskNum = curTotalTaskNum;
-                qBOffset += qSeqlen * strideQO;
-                if constexpr (!PAGED_CACHE_FLAG) {
-                    kBOffset += kvSeqlen * strideKV;
-                    vBOffset += kvSeqlen * strideKV;
+                if (inPrefix) {
+                    // every request then attends to its own pages behind the shared prefix
+                    inPrefix = false;
+                    maskType = fATilingData->maskType;
+                    blockBOffset = prefixBlockNum;
                 } else {
-                    blockBOffset += maxNumBlocksPerBatch;
+                    ++curBatch;
+                    qBOffset += qSeqlen * strideQO;
+                    if constexpr (!PAGED_CACHE_FLAG) {
+                        kBOffset += kvSeqlen * strideKV;
+                        vBOffset += kvSeqlen * strideKV;
+                    } else {
+                        blockBOffset += maxNumBlocksPerBatch;
+                    }
                 }
                 qSeqlen = reinterpret_cast<int64_t>(gActualQseqlen.GetValue(curBatch));
-                kvSeqlen = reinterpret_cast<int64_t>(gActualKvseqlen.GetValue(curBatch));
+                kvSeqlen = reinterpret_cast<int64_t>(gActualKvseqlen.GetValue(curBatch)) - prefixLen;
                 curQSBlockTile = GetQSBlockTile(kvSeqlen);
                 curQNBlockTile = GetQNBlockTile(qSeqlen, groupSize);
                 qNBlockNumPerGroup = CeilDiv(groupSize, curQNBlockTile);
@@ -182,6 +222,11 @@ public:
             uint64_t gmQOffset = qBOffset + qSBlockIdx * curQSBlockTile * strideQO + qHeadIdx * embed;
             uint64_t gmKOffset = kBOffset + kvHeadIdx * embed;
             uint64_t gmVOffset = vBOffset + kvHeadIdx * embed;
+            if constexpr (KV_INT8_FLAG) {
+                // [K ring | V ring] of this core, page i of the task lives in ring page i % kvDequantRingPages
+                gmKOffset = coreIdx * kvDequantCoreSize * 2;
+                gmVOffset = gmKOffset + kvDequantCoreSize;
+            }
             uint32_t qSBlockSize =
                 (qSBlockIdx == (curQSBlockNum - 1)) ? (qSeqlen - qSBlockIdx * curQSBlockTile) : curQSBlockTile;
             uint32_t qNBlockSize = (qNBlockIdxCurGroup == (qNBlockNumPerGroup - 1)) ?
@@ -192,13 +237,26 @@ public:
             uint32_t noSkipKvS = kvSeqlen;
             uint32_t noMaskKvS = kvSeqlen;
             uint32_t noMaskTailS = 0;
+            uint32_t kvSkipS = 0;
             if (maskType != 0) {
                 uint32_t diffS = kvSeqlen - qSeqlen;
                 noSkipKvS = (qSBlockIdx + 1) * curQSBlockTile + diffS;
                 noSkipKvS = Min((uint32_t)kvSeqlen, noSkipKvS);
                 noMaskKvS = noSkipKvS - qSBlockSize;
+                if ((maskType == MASK_TYPE_SLIDING_WINDOW) || (maskType == MASK_TYPE_CHUNKED_LOCAL)) {
+                    // skip the kv pages that lie entirely before the window of the whole qS block
+                    int64_t windowStartKvS = GetWindowStartKvS(maskType, noMaskKvS, windowSize);
+                    kvSkipS = (windowStartKvS > 0) ? RoundDown((uint32_t)windowStartKvS, pagedBlockSize) : 0;
+                    noSkipKvS -= kvSkipS;
+                    noMaskKvS -= kvSkipS;
+                }
                 noMaskTailS = noMaskKvS % pagedBlockSize;
             }
+            if constexpr (!PAGED_CACHE_FLAG) {
+                gmKOffset += kvSkipS * strideKV;
+                gmVOffset += kvSkipS * strideKV;
+            }
+            uint64_t blockTableOffset = KV_INT8_FLAG ? 0 : blockBOffset + kvSkipS / pagedBlockSize;
             uint32_t maskedKvS = qSBlockSize;
             uint32_t kvSLoopNumNoMask = CeilDiv(noMaskKvS, pagedBlockSize);
             uint32_t kvSLoopNumTotal = CeilDiv(noSkipKvS, pagedBlockSize);
@@ -214,6 +272,10 @@ public:
             LayoutK layoutKTemp(strideKV, blockStackNum * pagedBlockSize);
             LayoutV layoutVTemp(blockStackNum * pagedBlockSize, strideKV);
             blockMmadQK.loadQGM(gQ[gmQOffset], layoutQTemp, rowNum, qNBlockSize, qHeads);
+            if constexpr (KV_INT8_FLAG) {
+                // the first stack tile of the task
+                Arch::CrossCoreWaitFlag(kvDequantReady);
+            }
             for (uint32_t kvSIdx = 0; kvSIdx < kvSLoopNumNoMask; kvSIdx += blockStackNum) {
                 if (kvSIdx < kvSLoopNumNoMask) {
                     if (kvSIdx + blockStackNum > kvSLoopNumNoMask - 1) {
@@ -221,6 +283,12 @@ public:
                     } else {
                         stackSeqTile = pagedBlockSize * blockStackNum;
                     }
+                    if constexpr (KV_INT8_FLAG) {
+                        // QK prefetches the first page of the next stack tile, so that one must be ready as well
+                        if (stackSeqCount + 1 < totalStackSeqNum) {
+                            Arch::CrossCoreWaitFlag(kvDequantReady);
+                        }
+                    }
                     uint32_t SWorkSpacePingPongFlag = stackSeqCount % (preLaunch + 1);
                     uint64_t gmSOffset = coreIdx * WORKSPACE_BLOCK_SIZE_DB * (preLaunch + 1) +
                                          SWorkSpacePingPongFlag * WORKSPACE_BLOCK_SIZE_DB;
@@ -231,7 +299,7 @@ public:
                             actualBlockShapeQK, kvSIdx, kvSLoopNumNoMask, pagedBlockSize, noMaskKvS, strideKV);
                     } else {
                         blockMmadQK(
-                            gQ[gmQOffset], gK[gmKOffset], gS[gmSOffset], gBlockTable[blockBOffset], layoutQTemp,
+                            gQ[gmQOffset], gK[gmKOffset], gS[gmSOffset], gBlockTable[blockTableOffset], layoutQTemp,
                             layoutKTemp, actualBlockShapeQK, kvSIdx, kvSLoopNumNoMask, pagedBlockSize, noMaskKvS,
                             strideKV);
                     }
@@ -258,9 +326,9 @@ public:
                             softmaxReady);
                     } else {
                         blockMmadPV(
-                            gP[gmPOffset], gV[gmVOffset], gOTmp[gmOTmpOffset], gBlockTable[blockBOffset], layoutPTemp,
-                            layoutVTemp, actualBlockShapePV, nowkvSIdx, kvSLoopNumNoMask, pagedBlockSize, noMaskKvS,
-                            strideKV, softmaxReady);
+                            gP[gmPOffset], gV[gmVOffset], gOTmp[gmOTmpOffset], gBlockTable[blockTableOffset],
+                            layoutPTemp, layoutVTemp, actualBlockShapePV, nowkvSIdx, kvSLoopNumNoMask, pagedBlockSize,
+                            noMaskKvS, strideKV, softmaxReady);
                     }
                     Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(pvReady);
                 }
@@ -299,7 +367,7 @@ public:
                             noMaskTailS, 1);
                     } else {
                         blockMmadQKTail(
-                            gQ[gmQOffset], gK[gmKOffset], gS[gmSOffset], gBlockTable[blockBOffset], layoutQTemp,
+                            gQ[gmQOffset], gK[gmKOffset], gS[gmSOffset], gBlockTable[blockTableOffset], layoutQTemp,
                             layoutKTemp, actualBlockShapeQK, kvSIdx, kvSLoopNumTotal, pagedBlockSize, noSkipKvS,
                             strideKV, noMaskTailS, 1);
                     }
@@ -332,7 +400,7 @@ public:
                                 noSkipKvS, strideKV, softmaxReady, noMaskTailS, 1);
                         } else {
                             blockMmadPVTail(
-                                gP[gmPOffset], gV[gmVOffset], gOTmp[gmOTmpOffset], gBlockTable[blockBOffset],
+                                gP[gmPOffset], gV[gmVOffset], gOTmp[gmOTmpOffset], gBlockTable[blockTableOffset],
                                 layoutPTemp, layoutVTemp, actualBlockShapePV, delayedKvSIdx, kvSLoopNumTotal,
                                 pagedBlockSize, noSkipKvS, strideKV, softmaxReady, noMaskTailS, 1);
                         }
@@ -344,7 +412,7 @@ public:
                                 noMaskKvS, strideKV, softmaxReady);
                         } else {
                             blockMmadPV(
-                                gP[gmPOffset], gV[gmVOffset], gOTmp[gmOTmpOffset], gBlockTable[blockBOffset],
+                                gP[gmPOffset], gV[gmVOffset], gOTmp[gmOTmpOffset], gBlockTable[blockTableOffset],
                                 layoutPTemp, layoutVTemp, actualBlockShapePV, delayedKvSIdx, kvSLoopNumNoMask,
                                 pagedBlockSize, noMaskKvS, strideKV, softmaxReady);
                         }
@@ -412,6 +480,11 @@ public:
         uint32_t firstBatchTaskNum = fATilingData->firstBatchTaskNum;
         uint32_t totalTaskNum = fATilingData->totalTaskNum;
         uint32_t maskType = fATilingData->maskType;
+        uint32_t windowSize = fATilingData->windowSize;
+        bool maskGenFlag = (fATilingData->maskGenFlag != 0);
+        uint32_t numTokens = fATilingData->numTokens;
+        uint32_t prefixLen = (PAGED_CACHE_FLAG && !KV_INT8_FLAG) ? fATilingData->prefixLen : 0;
+        bool cascadeFlag = (prefixLen != 0);
         float scaleValue = fATilingData->scaleValue;
         // Get the memory offset address of the input on Global Memory
         AscendC::GlobalTensor<ElementMask> gMask;
@@ -422,6 +495,12 @@ public:
         gActualKvseqlen.SetGlobalBuffer((__gm__ int64_t*)params.actualKvseqlen);
         AscendC::GlobalTensor<ElementO> gO;
         gO.SetGlobalBuffer((__gm__ ElementO*)params.o);
+        AscendC::GlobalTensor<ElementO> gOPrefix;
+        AscendC::GlobalTensor<float> gLse;
+        if (cascadeFlag) {
+            gOPrefix.SetGlobalBuffer((__gm__ ElementO*)params.oPrefix);
+            gLse.SetGlobalBuffer((__gm__ float*)params.lse);
+        }
         AscendC::GlobalTensor<ElementS> gS;
         gS.SetGlobalBuffer((__gm__ ElementS*)params.s);
         AscendC::GlobalTensor<ElementP> gP;
@@ -430,10 +509,23 @@ public:
         gOTmp.SetGlobalBuffer((__gm__ ElementOTmp*)params.oTemp);
         AscendC::GlobalTensor<ElementOTmp> gOUpdate;
         gOUpdate.SetGlobalBuffer((__gm__ ElementOTmp*)params.oUpdate);
+        if constexpr (KV_INT8_FLAG) {
+            gKvBlockTable.SetGlobalBuffer((__gm__ int32_t*)params.blockTables);
+            gKInt8.SetGlobalBuffer((__gm__ int8_t*)params.k);
+            gVInt8.SetGlobalBuffer((__gm__ int8_t*)params.v);
+            gKScale.SetGlobalBuffer((__gm__ float*)params.kScale);
+            gVScale.SetGlobalBuffer((__gm__ float*)params.vScale);
+            gKvRing.SetGlobalBuffer((__gm__ ElementK*)params.kvDequant);
+        }
 
         uint32_t groupSize = qHeads / kvHeads;
+        uint64_t strideKV = kvHeads * embed;
         uint32_t embedRound = RoundUp(embed, BLOCK_SIZE);
 
+        if (!KV_INT8_FLAG && (fATilingData->ropeFlag != 0)) {
+            RopePrologue(params, fATilingData);
+        }
+
         EpilogueOnlineSoftmax epilogueOnlineSoftmax(resource, scaleValue);
         EpilogueRescaleO epilogueRescaleO(resource);
 
@@ -441,8 +533,19 @@ public:
         uint32_t preTotalTaskNum = 0;
         uint32_t curBatch = 0;
         int64_t oBatchOffset = 0;
+        uint64_t blockBOffset = 0;
         uint32_t qSeqlen = static_cast<uint32_t>(gActualQseqlen.GetValue(curBatch));
         uint32_t kvSeqlen = static_cast<uint32_t>(gActualKvseqlen.GetValue(curBatch));
+        // the shared prefix pass writes oPrefix and the first half of lse, the suffix pass O and the second half
+        bool inPrefix = cascadeFlag;
+        AscendC::GlobalTensor<ElementO> gOCur = gO;
+        AscendC::GlobalTensor<float> gLseCur = gLse;
+        if (inPrefix) {
+            maskType = 0;
+            qSeqlen = numTokens;
+            kvSeqlen = prefixLen;
+            gOCur = gOPrefix;
+        }
         uint32_t curQNBlockTile = GetQNBlockTile(qSeqlen, groupSize);
         uint32_t qNBlockNumPerGroup = CeilDiv(groupSize, curQNBlockTile);
         uint32_t curQNBlockNum = qNBlockNumPerGroup * kvHeads;
@@ -456,11 +559,20 @@ public:
         for (uint32_t taskIdx = coreIdx; taskIdx < totalTaskNum; taskIdx += uint32_t(coreNum)) {
             // Get the offset of each core on the GM.
             while (taskIdx >= curTotalTaskNum) {
-                curBatch++;
-                oBatchOffset += static_cast<int64_t>(qSeqlen) * qHeads * embed;
+                if (inPrefix) {
+                    inPrefix = false;
+                    maskType = fATilingData->maskType;
+                    blockBOffset = prefixLen / pagedBlockSize;
+                    gOCur = gO;
+                    gLseCur = gLse[static_cast<uint64_t>(numTokens) * qHeads];
+                } else {
+                    curBatch++;
+                    oBatchOffset += static_cast<int64_t>(qSeqlen) * qHeads * embed;
+                    blockBOffset += maxNumBlocksPerBatch;
+                }
                 preTotalTaskNum = curTotalTaskNum;
                 qSeqlen = static_cast<uint32_t>(gActualQseqlen.GetValue(curBatch));
-                kvSeqlen = static_cast<uint32_t>(gActualKvseqlen.GetValue(curBatch));
+                kvSeqlen = static_cast<uint32_t>(gActualKvseqlen.GetValue(curBatch)) - prefixLen;
                 curQNBlockTile = GetQNBlockTile(qSeqlen, groupSize);
                 qNBlockNumPerGroup = CeilDiv(groupSize, curQNBlockTile);
                 curQNBlockNum = qNBlockNumPerGroup * kvHeads;
@@ -490,13 +602,26 @@ public:
             uint32_t noSkipKvS = kvSeqlen;
             uint32_t noMaskKvS = kvSeqlen;
             uint32_t noMaskTailS = 0;
+            uint32_t kvSkipS = 0;
+            int32_t windowMaskOffset = 0;
             if (maskType != 0) {
                 uint32_t diffS = kvSeqlen - qSeqlen;
                 noSkipKvS = (qSBlockIdx + 1) * curQSBlockTile + diffS;
                 noSkipKvS = Min(kvSeqlen, noSkipKvS);
                 noMaskKvS = noSkipKvS - qSBlockSize;
+                if ((maskType == MASK_TYPE_SLIDING_WINDOW) || (maskType == MASK_TYPE_CHUNKED_LOCAL)) {
+                    // skip the kv pages that lie entirely before the window of the whole qS block
+                    int64_t windowStartKvS = GetWindowStartKvS(maskType, noMaskKvS, windowSize);
+                    kvSkipS = (windowStartKvS > 0) ? RoundDown((uint32_t)windowStartKvS, pagedBlockSize) : 0;
+                    windowMaskOffset = static_cast<int32_t>(windowStartKvS - kvSkipS);
+                    noSkipKvS -= kvSkipS;
+                    noMaskKvS -= kvSkipS;
+                }
                 noMaskTailS = noMaskKvS % pagedBlockSize;
             }
+            // only the first stack tile holds kv positions left of the window
+            bool applyWindowMask = (maskType == MASK_TYPE_SLIDING_WINDOW) &&
+                                   (windowMaskOffset + static_cast<int32_t>(qSBlockSize) - 1 > 0);
             uint32_t maskedKvS = qSBlockSize;
             uint32_t kvSLoopNumTotal = CeilDiv(noSkipKvS, pagedBlockSize);
             uint32_t kvSLoopNumNoMask = CeilDiv(noMaskKvS, pagedBlockSize);
@@ -507,6 +632,20 @@ public:
             int32_t totalStackSeqNum = (maskType != 0) ? (CeilDiv(noMaskKvS, blockStackNum * pagedBlockSize) + 1) :
                                                          CeilDiv(noMaskKvS, blockStackNum * pagedBlockSize);
             int32_t stackSeqCount = 0;
+            // int8 KV cache: the kv pages of stack tile i are dequantized right after the softmax of stack tile i - 2,
+            // so the cube core never waits for more than one stack tile and the ring holds
+            // (preLaunch + 3) stack tiles: the ones in flight plus the two ahead.
+            uint64_t kvBlockTableOffset = blockBOffset + kvSkipS / pagedBlockSize;
+            uint32_t kvDequantPageEnd = 0;
+            if constexpr (KV_INT8_FLAG) {
+                for (int32_t stackIdx = 0; (stackIdx < 2) && (stackIdx < totalStackSeqNum); stackIdx++) {
+                    uint32_t pageEnd = (stackIdx == totalStackSeqNum - 1) ?
+                                           kvSLoopNumTotal :
+                                           Min((stackIdx + 1) * blockStackNum, kvSLoopNumNoMask);
+                    DequantKvPages(fATilingData, kvBlockTableOffset, kvNIdx, noSkipKvS, kvDequantPageEnd, pageEnd);
+                    kvDequantPageEnd = pageEnd;
+                }
+            }
 
             // no mask kvSeqlen loop
             for (uint32_t kvSIdx = 0; kvSIdx < kvSLoopNumNoMask; kvSIdx += blockStackNum) {
@@ -529,8 +668,19 @@ public:
                 // online softmax
                 epilogueOnlineSoftmax(
                     gP[gmOffsetP], gS[gmOffsetS], layOutP, layOutS, actualBlockShapeQK, (stackSeqCount == 0),
-                    qSBlockSize, qNBlockSize, curStackTileMod);
+                    qSBlockSize, qNBlockSize, curStackTileMod, applyWindowMask && (stackSeqCount == 0),
+                    windowMaskOffset);
                 Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(softmaxReady);
+                if constexpr (KV_INT8_FLAG) {
+                    int32_t stackIdx = stackSeqCount + 2;
+                    if (stackIdx < totalStackSeqNum) {
+                        uint32_t pageEnd = (stackIdx == totalStackSeqNum - 1) ?
+                                               kvSLoopNumTotal :
+                                               Min((stackIdx + 1) * blockStackNum, kvSLoopNumNoMask);
+                        DequantKvPages(fATilingData, kvBlockTableOffset, kvNIdx, noSkipKvS, kvDequantPageEnd, pageEnd);
+                        kvDequantPageEnd = pageEnd;
+                    }
+                }
 
                 if (kvSIdx >= preLaunch * blockStackNum) {
                     uint32_t delayedKvSIdx = kvSIdx - preLaunch * blockStackNum;
@@ -548,7 +698,7 @@ public:
                     Arch::CrossCoreWaitFlag(pvReady);
                     // rescale O
                     epilogueRescaleO(
-                        gO[gmOffsetO], gOTmp[gmOffsetOTmp], layoutO, layoutOTmp, actualBlockShapePV, qSBlockSize,
+                        gOCur[gmOffsetO], gOTmp[gmOffsetOTmp], layoutO, layoutOTmp, actualBlockShapePV, qSBlockSize,
                         qNBlockSize, (stackSeqCount - preLaunch == 0), 0, curStackTileMod);
                 }
                 stackSeqCount++;
@@ -583,9 +733,15 @@ public:
                     // vec core offset will be processed within epilogue block
                     uint32_t gmOffsetP = gmOffsetS;
                     // online softmax
-                    epilogueOnlineSoftmax(
-                        gP[gmOffsetP], gS[gmOffsetS], gMask, layOutP, layOutS, layOutMask, actualBlockShapeQK,
-                        (stackSeqCount == 0), qSBlockSize, qNBlockSize, curStackTileMod, qkReady);
+                    if (maskGenFlag) {
+                        epilogueOnlineSoftmax(
+                            gP[gmOffsetP], gS[gmOffsetS], layOutP, layOutS, actualBlockShapeQK, (stackSeqCount == 0),
+                            qSBlockSize, qNBlockSize, curStackTileMod, qkReady);
+                    } else {
+                        epilogueOnlineSoftmax(
+                            gP[gmOffsetP], gS[gmOffsetS], gMask, layOutP, layOutS, layOutMask, actualBlockShapeQK,
+                            (stackSeqCount == 0), qSBlockSize, qNBlockSize, curStackTileMod, qkReady);
+                    }
                     Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(softmaxReady);
                 }
                 if (kvSIdx >= preLaunchStackNum) {
@@ -604,11 +760,19 @@ public:
                     uint32_t gmOffsetOTmp =
                         coreIdx * WORKSPACE_BLOCK_SIZE_DB * (preLaunch + 1) + curStackTileMod * WORKSPACE_BLOCK_SIZE_DB;
                     Arch::CrossCoreWaitFlag(pvReady);
-                    // rescale O
-                    epilogueRescaleO(
-                        gO[gmOffsetO], gOTmp[gmOffsetOTmp], layoutO, layoutOTmp, actualBlockShapePV, qSBlockSize,
-                        qNBlockSize, (stackSeqCount - preLaunch == 0),
-                        (stackSeqCount - preLaunch == totalStackSeqNum - 1), curStackTileMod);
+                    // rescale O, the cascade passes also keep the lse of every row for the merge
+                    if (cascadeFlag) {
+                        epilogueRescaleO(
+                            gOCur[gmOffsetO], gOTmp[gmOffsetOTmp], layoutO, layoutOTmp, actualBlockShapePV,
+                            qSBlockSize, qNBlockSize, (stackSeqCount - preLaunch == 0),
+                            (stackSeqCount - preLaunch == totalStackSeqNum - 1), curStackTileMod,
+                            gLseCur[gmOffsetO / embed]);
+                    } else {
+                        epilogueRescaleO(
+                            gO[gmOffsetO], gOTmp[gmOffsetOTmp], layoutO, layoutOTmp, actualBlockShapePV, qSBlockSize,
+                            qNBlockSize, (stackSeqCount - preLaunch == 0),
+                            (stackSeqCount - preLaunch == totalStackSeqNum - 1), curStackTileMod);
+                    }
                 }
                 if ((maskType != 0) && (stackSeqCount - preLaunch == totalStackSeqNum - 2)) {
                     kvSIdx += noMaskTailInteStackNum;
@@ -631,18 +795,180 @@ public:
         AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID1);
         AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID2);
         AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID3);
+
+        if (cascadeFlag) {
+            MergeCascade(params, fATilingData);
+        }
     }
 
 private:
+    // Dequantizes the kv pages [pageStart, pageEnd) of a task into the ring of this core, pages spread over the two
+    // vector cores, and hands them to the cube core. The UB below the softmax/rescale state is free between the
+    // epilogue calls, so the tile reuses it after draining all pipes.
+    CATLASS_DEVICE
+    void DequantKvPages(
+        __gm__ FATilingData* fATilingData, uint64_t blockTableOffset, uint32_t kvHeadIdx, uint32_t kvTokens,
+        uint32_t pageStart, uint32_t pageEnd)
+    {
+        uint32_t kvHeads = fATilingData->kvHeads;
+        uint32_t embed = fATilingData->embeddingSize;
+        uint32_t pagedBlockSize = fATilingData->blockSize;
+        uint32_t kvQuantType = fATilingData->kvQuantType;
+        uint32_t ringPages = fATilingData->kvDequantRingPages;
+        uint64_t kvDequantCoreSize = fATilingData->kvDequantCoreSize;
+        uint64_t strideKV = kvHeads * embed;
+        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint64_t gmKRingOffset = coreIdx * kvDequantCoreSize * 2;
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+        {
+            Gemm::Tile::TileDequantKvInt8<ArchTag, ElementK> tileDequantKv(resource, 0, EVENT_ID6);
+            for (uint32_t pageIdx = pageStart + AscendC::GetSubBlockIdx(); pageIdx < pageEnd;
+                 pageIdx += AscendC::GetSubBlockNum()) {
+                uint32_t blockId = static_cast<uint32_t>(gKvBlockTable.GetValue(blockTableOffset + pageIdx));
+                uint32_t pageTokens = Min(pagedBlockSize, kvTokens - pageIdx * pagedBlockSize);
+                uint64_t scaleIdx = (kvQuantType == KV_QUANT_TYPE_PER_BLOCK) ?
+                                        static_cast<uint64_t>(blockId) * kvHeads + kvHeadIdx :
+                                        kvHeadIdx;
+                uint64_t gmInt8Offset = static_cast<uint64_t>(blockId) * pagedBlockSize * strideKV + kvHeadIdx * embed;
+                uint64_t gmRingOffset =
+                    gmKRingOffset + static_cast<uint64_t>(pageIdx % ringPages) * pagedBlockSize * embed;
+                tileDequantKv(
+                    gKvRing[gmRingOffset], gKInt8[gmInt8Offset], pageTokens, embed, strideKV, embed,
+                    gKScale.GetValue(scaleIdx));
+                tileDequantKv(
+                    gKvRing[gmRingOffset + kvDequantCoreSize], gVInt8[gmInt8Offset], pageTokens, embed, strideKV,
+                    embed, gVScale.GetValue(scaleIdx));
+            }
+        }
+        AscendC::PipeBarrier<PIPE_ALL>();
+        Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(kvDequantReady);
+    }
+
+    // Merges the shared prefix pass into O by the lse of both passes, rows spread over all vector cores; starts once
+    // every vector core has written both passes.
+    CATLASS_DEVICE
+    void MergeCascade(FAIKernelParams const& params, __gm__ FATilingData* fATilingData)
+    {
+        uint32_t qHeads = fATilingData->numHeads;
+        uint32_t embed = fATilingData->embeddingSize;
+        uint32_t numTokens = fATilingData->numTokens;
+
+        AscendC::GlobalTensor<ElementO> gO;
+        gO.SetGlobalBuffer((__gm__ ElementO*)params.o);
+        AscendC::GlobalTensor<ElementO> gOPrefix;
+        gOPrefix.SetGlobalBuffer((__gm__ ElementO*)params.oPrefix);
+        AscendC::GlobalTensor<float> gLse;
+        gLse.SetGlobalBuffer((__gm__ float*)params.lse);
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+        Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+
+        uint32_t rows = numTokens * qHeads;
+        uint32_t aivIdx = AscendC::GetBlockIdx();
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+        uint32_t rowsPerCore = CeilDiv(rows, aivNum);
+        uint32_t rowStart = aivIdx * rowsPerCore;
+        if (rowStart >= rows) {
+            return;
+        }
+        uint32_t actualRows = Min(rowsPerCore, rows - rowStart);
+        uint64_t gmOffsetO = static_cast<uint64_t>(rowStart) * embed;
+        Gemm::Tile::TileMergeAttnState<ArchTag, ElementO> tileMergeAttnState(resource, 0, EVENT_ID7);
+        tileMergeAttnState(
+            gO[gmOffsetO], gOPrefix[gmOffsetO], gLse[rowStart], gO[gmOffsetO], gLse[rows + rowStart], actualRows,
+            embed);
+    }
+
+    // Rotates Q into the qRope workspace and the new K rows into their kv cache slots, tokens spread over all vector
+    // cores; the cube cores start once every vector core has finished.
+    CATLASS_DEVICE
+    void RopePrologue(FAIKernelParams const& params, __gm__ FATilingData* fATilingData)
+    {
+        uint32_t batch = fATilingData->batch;
+        uint32_t qHeads = fATilingData->numHeads;
+        uint32_t kvHeads = fATilingData->kvHeads;
+        uint32_t embed = fATilingData->embeddingSize;
+        uint32_t pagedBlockSize = fATilingData->blockSize;
+        uint32_t maxNumBlocksPerBatch = fATilingData->maxNumBlocksPerBatch;
+
+        AscendC::GlobalTensor<ElementQ> gQ;
+        gQ.SetGlobalBuffer((__gm__ ElementQ*)params.q);
+        AscendC::GlobalTensor<ElementQ> gQRope;
+        gQRope.SetGlobalBuffer((__gm__ ElementQ*)params.qRope);
+        AscendC::GlobalTensor<ElementK> gK;
+        gK.SetGlobalBuffer((__gm__ ElementK*)params.k);
+        AscendC::GlobalTensor<ElementK> gKNew;
+        gKNew.SetGlobalBuffer((__gm__ ElementK*)params.kNew);
+        AscendC::GlobalTensor<ElementQ> gCos;
+        gCos.SetGlobalBuffer((__gm__ ElementQ*)params.cos);
+        AscendC::GlobalTensor<ElementQ> gSin;
+        gSin.SetGlobalBuffer((__gm__ ElementQ*)params.sin);
+        AscendC::GlobalTensor<int32_t> gPositionIds;
+        gPositionIds.SetGlobalBuffer((__gm__ int32_t*)params.positionIds);
+        AscendC::GlobalTensor<int32_t> gBlockTable;
+        gBlockTable.SetGlobalBuffer((__gm__ int32_t*)params.blockTables);
+        AscendC::GlobalTensor<int64_t> gActualQseqlen;
+        gActualQseqlen.SetGlobalBuffer((__gm__ int64_t*)params.actualQseqlen);
+        AscendC::GlobalTensor<int64_t> gActualKvseqlen;
+        gActualKvseqlen.SetGlobalBuffer((__gm__ int64_t*)params.actualKvseqlen);
+
+        uint64_t strideQO = qHeads * embed;
+        uint64_t strideKV = kvHeads * embed;
+        uint32_t aivIdx = AscendC::GetBlockIdx();
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+
+        Gemm::Tile::TileApplyRope<ArchTag, ElementQ> tileApplyRope(resource, 0, EVENT_ID7);
+        uint64_t qTokenOffset = 0;
+        uint64_t kvTokenOffset = 0;
+        for (uint32_t batchIdx = 0; batchIdx < batch; batchIdx++) {
+            uint32_t qSeqlen = static_cast<uint32_t>(gActualQseqlen.GetValue(batchIdx));
+            uint32_t kvSeqlen = static_cast<uint32_t>(gActualKvseqlen.GetValue(batchIdx));
+            // the first token of this batch owned by this vector core
+            uint32_t tokenStart = (aivIdx + aivNum - static_cast<uint32_t>(qTokenOffset % aivNum)) % aivNum;
+            for (uint32_t tokenIdx = tokenStart; tokenIdx < qSeqlen; tokenIdx += aivNum) {
+                uint64_t qTokenIdx = qTokenOffset + tokenIdx;
+                uint64_t posOffset = static_cast<uint64_t>(gPositionIds.GetValue(qTokenIdx)) * embed;
+                tileApplyRope(
+                    gQRope[qTokenIdx * strideQO], gQ[qTokenIdx * strideQO], gCos[posOffset], gSin[posOffset], qHeads,
+                    embed);
+                // the new tokens are the last qSeqlen kv positions of the batch
+                uint32_t kvPos = kvSeqlen - qSeqlen + tokenIdx;
+                uint64_t gmKOffset = (kvTokenOffset + kvPos) * strideKV;
+                if constexpr (PAGED_CACHE_FLAG) {
+                    uint64_t blockId = static_cast<uint64_t>(
+                        gBlockTable.GetValue(batchIdx * maxNumBlocksPerBatch + kvPos / pagedBlockSize));
+                    gmKOffset = (blockId * pagedBlockSize + kvPos % pagedBlockSize) * strideKV;
+                }
+                tileApplyRope(
+                    gK[gmKOffset], gKNew[qTokenIdx * strideKV], gCos[posOffset], gSin[posOffset], kvHeads, embed);
+            }
+            qTokenOffset += qSeqlen;
+            kvTokenOffset += kvSeqlen;
+        }
+        Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+        Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(ropeReady);
+    }
+
     Arch::Resource<ArchTag> resource;
+    // int8 KV cache inputs and the dequantized ring, used by the vector cores
+    AscendC::GlobalTensor<int32_t> gKvBlockTable;
+    AscendC::GlobalTensor<int8_t> gKInt8;
+    AscendC::GlobalTensor<int8_t> gVInt8;
+    AscendC::GlobalTensor<float> gKScale;
+    AscendC::GlobalTensor<float> gVScale;
+    AscendC::GlobalTensor<ElementK> gKvRing;
     Arch::CrossCoreFlag qkReady{QK_READY_ID};
     Arch::CrossCoreFlag softmaxReady{SOFTMAX_READY_ID};
     Arch::CrossCoreFlag pvReady{PV_READY_ID};
+    Arch::CrossCoreFlag kvDequantReady{KV_DEQUANT_READY_ID};
+    Arch::CrossCoreFlag ropeReady{ROPE_READY_ID};
 };
 
 extern "C" CATLASS_GLOBAL void FAInferFp16(
     uint64_t hardwareSyncAddr, GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR mask, GM_ADDR blockTables, GM_ADDR o,
-    GM_ADDR actualQseqlen, GM_ADDR actualKvseqlen, GM_ADDR s, GM_ADDR p, GM_ADDR oTemp, GM_ADDR oUpdate, GM_ADDR tiling)
+    GM_ADDR actualQseqlen, GM_ADDR actualKvseqlen, GM_ADDR s, GM_ADDR p, GM_ADDR oTemp, GM_ADDR oUpdate, GM_ADDR tiling,
+    GM_ADDR cos, GM_ADDR sin, GM_ADDR positionIds, GM_ADDR kNew, GM_ADDR qRope, GM_ADDR oPrefix, GM_ADDR lse)
 {
     AscendC::SetSyncBaseAddr(hardwareSyncAddr);
 
@@ -683,7 +1009,7 @@ extern "C" CATLASS_GLOBAL void FAInferFp16(
     using BlockMmadQKTail = Gemm::Block::BlockMmad<DispatchPolicyQKTail, L1TileShape, L0TileShape, QType, KType, SType>;
 
     // Epilogue Block模块，实现Flash Attention Infer中当前S基块的softmax
-    using DispatchPolicyOnlineSoftmax = Epilogue::EpilogueAtlasA2OnlineSoftmax;
+    using DispatchPolicyOnlineSoftmax = Epilogue::EpilogueAtlasA2OnlineSoftmax<>;
     using PType = Gemm::GemmType<ElementP, LayoutP>;
     using maskType = Gemm::GemmType<ElementMask, LayoutMask>;
     using EpilogueOnlineSoftmax = Epilogue::Block::BlockEpilogue<DispatchPolicyOnlineSoftmax, PType, SType, maskType>;
@@ -712,6 +1038,13 @@ extern "C" CATLASS_GLOBAL void FAInferFp16(
     using FAInferKernel = FAInferKernel<
         BlockMmadQK, BlockMmadPV, BlockMmadQKTail, BlockMmadPVTail, EpilogueOnlineSoftmax, EpilogueRescaleO, true>;
     FAIKernelParams params{q, k, v, mask, blockTables, actualQseqlen, actualKvseqlen, o, s, p, oTemp, oUpdate, tiling};
+    params.cos = cos;
+    params.sin = sin;
+    params.positionIds = positionIds;
+    params.kNew = kNew;
+    params.qRope = qRope;
+    params.oPrefix = oPrefix;
+    params.lse = lse;
 
     // call kernel
     FAInferKernel flashAttnInfer;
@@ -720,7 +1053,8 @@ extern "C" CATLASS_GLOBAL void FAInferFp16(
 
 extern "C" CATLASS_GLOBAL void FAInferBf16(
     uint64_t hardwareSyncAddr, GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR mask, GM_ADDR blockTables, GM_ADDR o,
-    GM_ADDR actualQseqlen, GM_ADDR actualKvseqlen, GM_ADDR s, GM_ADDR p, GM_ADDR oTemp, GM_ADDR oUpdate, GM_ADDR tiling)
+    GM_ADDR actualQseqlen, GM_ADDR actualKvseqlen, GM_ADDR s, GM_ADDR p, GM_ADDR oTemp, GM_ADDR oUpdate, GM_ADDR tiling,
+    GM_ADDR cos, GM_ADDR sin, GM_ADDR positionIds, GM_ADDR kNew, GM_ADDR qRope, GM_ADDR oPrefix, GM_ADDR lse)
 {
     AscendC::SetSyncBaseAddr(hardwareSyncAddr);
 
@@ -761,7 +1095,7 @@ extern "C" CATLASS_GLOBAL void FAInferBf16(
     using BlockMmadQKTail = Gemm::Block::BlockMmad<DispatchPolicyQKTail, L1TileShape, L0TileShape, QType, KType, SType>;
 
     // Epilogue Block模块，实现Flash Attention Infer中当前S基块的softmax
-    using DispatchPolicyOnlineSoftmax = Epilogue::EpilogueAtlasA2OnlineSoftmax;
+    using DispatchPolicyOnlineSoftmax = Epilogue::EpilogueAtlasA2OnlineSoftmax<>;
     using PType = Gemm::GemmType<ElementP, LayoutP>;
     using maskType = Gemm::GemmType<ElementMask, LayoutMask>;
     using EpilogueOnlineSoftmax = Epilogue::Block::BlockEpilogue<DispatchPolicyOnlineSoftmax, PType, SType, maskType>;
@@ -790,8 +1124,105 @@ extern "C" CATLASS_GLOBAL void FAInferBf16(
     using FAInferKernel = FAInferKernel<
         BlockMmadQK, BlockMmadPV, BlockMmadQKTail, BlockMmadPVTail, EpilogueOnlineSoftmax, EpilogueRescaleO, true>;
     FAIKernelParams params{q, k, v, mask, blockTables, actualQseqlen, actualKvseqlen, o, s, p, oTemp, oUpdate, tiling};
+    params.cos = cos;
+    params.sin = sin;
+    params.positionIds = positionIds;
+    params.kNew = kNew;
+    params.qRope = qRope;
+    params.oPrefix = oPrefix;
+    params.lse = lse;
 
     // call kernel
     FAInferKernel flashAttnInfer;
     flashAttnInfer(params);
 }
+
+// int8 paged KV cache: the vector cores dequantize K/V pages with per-head or per-(page, head) float scales into a
+// per-core ring one stack tile ahead, the cube cores read it through the paged QK/PV blocks.
+template <class ElementQ>
+CATLASS_DEVICE void FAInferKvInt8(
+    GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR mask, GM_ADDR blockTables, GM_ADDR o, GM_ADDR actualQseqlen,
+    GM_ADDR actualKvseqlen, GM_ADDR s, GM_ADDR p, GM_ADDR oTemp, GM_ADDR oUpdate, GM_ADDR tiling, GM_ADDR kScale,
+    GM_ADDR vScale, GM_ADDR kvDequant)
+{
+    using ArchTag = Arch::AtlasA2;
+    using LayoutQ = layout::RowMajor;
+    // element type of the dequantized K/V
+    using ElementK = ElementQ;
+    using LayoutK = layout::ColumnMajor;
+    using ElementV = ElementQ;
+    using LayoutV = layout::RowMajor;
+    using ElementS = float;
+    using LayoutS = layout::RowMajor;
+    using ElementP = ElementQ;
+    using LayoutP = layout::RowMajor;
+    using ElementO = ElementQ;
+    using LayoutO = layout::RowMajor;
+    using ElementMask = ElementQ;
+    using LayoutMask = layout::RowMajor;
+    using ElementOTmp = float;
+    using LayoutOTmp = layout::RowMajor;
+    using ElementUpdate = float;
+    using LayoutUpdate = layout::RowMajor;
+    // L1TileShape::K must be embdding
+    using L1TileShape = GemmShape<128, 128, 128>;
+    using L0TileShape = L1TileShape;
+    using QType = Gemm::GemmType<ElementQ, LayoutQ>;
+    using KType = Gemm::GemmType<ElementK, LayoutK>;
+    using SType = Gemm::GemmType<ElementS, LayoutS>;
+    using PType = Gemm::GemmType<ElementP, LayoutP>;
+    using VType = Gemm::GemmType<ElementV, LayoutV>;
+    using OTmpType = Gemm::GemmType<ElementOTmp, LayoutOTmp>;
+
+    // the ring is addressed through a block table of ring pages, so the paged blocks are used
+    using DispatchPolicyQK = Gemm::MmadAtlasA2FAIQK<true, false>;
+    using BlockMmadQK = Gemm::Block::BlockMmad<DispatchPolicyQK, L1TileShape, L0TileShape, QType, KType, SType>;
+    using DispatchPolicyQKTail = Gemm::MmadAtlasA2FAITailQK<true, false>;
+    using BlockMmadQKTail = Gemm::Block::BlockMmad<DispatchPolicyQKTail, L1TileShape, L0TileShape, QType, KType, SType>;
+
+    using DispatchPolicyOnlineSoftmax = Epilogue::EpilogueAtlasA2OnlineSoftmax<>;
+    using maskType = Gemm::GemmType<ElementMask, LayoutMask>;
+    using EpilogueOnlineSoftmax = Epilogue::Block::BlockEpilogue<DispatchPolicyOnlineSoftmax, PType, SType, maskType>;
+
+    using DispatchPolicyPV = Gemm::MmadAtlasA2FAIPV<true, false>;
+    using BlockMmadPV = Gemm::Block::BlockMmad<DispatchPolicyPV, L1TileShape, L0TileShape, PType, VType, OTmpType>;
+    using DispatchPolicyPVTail = Gemm::MmadAtlasA2FAITailPV<true, false>;
+    using BlockMmadPVTail =
+        Gemm::Block::BlockMmad<DispatchPolicyPVTail, L1TileShape, L0TileShape, PType, VType, OTmpType>;
+
+    using DispatchPolicyRescaleO = Epilogue::EpilogueAtlasA2RescaleO;
+    using OType = Gemm::GemmType<ElementO, LayoutO>;
+    using OUpdateType = Gemm::GemmType<ElementUpdate, LayoutUpdate>;
+    using EpilogueRescaleO = Epilogue::Block::BlockEpilogue<DispatchPolicyRescaleO, OType, OTmpType, OUpdateType>;
+
+    using FAInferKernelKvInt8 = FAInferKernel<
+        BlockMmadQK, BlockMmadPV, BlockMmadQKTail, BlockMmadPVTail, EpilogueOnlineSoftmax, EpilogueRescaleO, true,
+        true>;
+    FAIKernelParams params{q, k, v, mask, blockTables, actualQseqlen, actualKvseqlen, o, s, p, oTemp, oUpdate, tiling,
+                           kScale, vScale, kvDequant};
+
+    FAInferKernelKvInt8 flashAttnInfer;
+    flashAttnInfer(params);
+}
+
+extern "C" CATLASS_GLOBAL void FAInferKvInt8Fp16(
+    uint64_t hardwareSyncAddr, GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR mask, GM_ADDR blockTables, GM_ADDR o,
+    GM_ADDR actualQseqlen, GM_ADDR actualKvseqlen, GM_ADDR s, GM_ADDR p, GM_ADDR oTemp, GM_ADDR oUpdate, GM_ADDR tiling,
+    GM_ADDR kScale, GM_ADDR vScale, GM_ADDR kvDequant)
+{
+    AscendC::SetSyncBaseAddr(hardwareSyncAddr);
+    FAInferKvInt8<half>(
+        q, k, v, mask, blockTables, o, actualQseqlen, actualKvseqlen, s, p, oTemp, oUpdate, tiling, kScale, vScale,
+        kvDequant);
+}
+
+extern "C" CATLASS_GLOBAL void FAInferKvInt8Bf16(
+    uint64_t hardwareSyncAddr, GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR mask, GM_ADDR blockTables, GM_ADDR o,
+    GM_ADDR actualQseqlen, GM_ADDR actualKvseqlen, GM_ADDR s, GM_ADDR p, GM_ADDR oTemp, GM_ADDR oUpdate, GM_ADDR tiling,
+    GM_ADDR kScale, GM_ADDR vScale, GM_ADDR kvDequant)
+{
+    AscendC::SetSyncBaseAddr(hardwareSyncAddr);
+    FAInferKvInt8<bfloat16_t>(
+        q, k, v, mask, blockTables, o, actualQseqlen, actualKvseqlen, s, p, oTemp, oUpdate, tiling, kScale, vScale,
+        kvDequant);
+}
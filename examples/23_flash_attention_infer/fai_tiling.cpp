@@ -52,7 +52,16 @@ enum class MaskType
 {
     NO_MASK = 0,
     MASK_SPEC = 1,
-    MASK_CAUSUAL = 2
+    MASK_CAUSUAL = 2,
+    MASK_SLIDING_WINDOW = 3,
+    MASK_CHUNKED_LOCAL = 4
+};
+
+enum class KvQuantType
+{
+    NONE = 0,
+    PER_HEAD = 1,
+    PER_BLOCK = 2
 };
 
 struct FAInfo {
@@ -67,6 +76,11 @@ struct FAInfo {
     int64_t* kvSeqlenList{nullptr};
     int64_t* qSeqlen{nullptr};
     MaskType maskType = MaskType::MASK_SPEC;
+    int32_t windowSize = 0;
+    bool maskGenFlag = false;
+    KvQuantType kvQuantType = KvQuantType::NONE;
+    bool ropeFlag = false;
+    int32_t prefixLen = 0;
 };
 
 void FillBasicTilingData(const FAInfo& faInfo, FATilingData& faTilingData, int64_t maxKvSeqlen)
@@ -82,6 +96,17 @@ void FillBasicTilingData(const FAInfo& faInfo, FATilingData& faTilingData, int64
     faTilingData.maxKvSeqlen = static_cast<uint32_t>(maxKvSeqlen);
     faTilingData.maxNumBlocksPerBatch = maxNumBlocksPerBatch;
     faTilingData.maskType = static_cast<uint32_t>(faInfo.maskType);
+    faTilingData.windowSize = static_cast<uint32_t>(faInfo.windowSize);
+    faTilingData.maskGenFlag = faInfo.maskGenFlag ? 1 : 0;
+    faTilingData.kvQuantType = static_cast<uint32_t>(faInfo.kvQuantType);
+    faTilingData.ropeFlag = faInfo.ropeFlag ? 1 : 0;
+    faTilingData.numTokens = static_cast<uint32_t>(faInfo.numTokens);
+    faTilingData.prefixLen = static_cast<uint32_t>(faInfo.prefixLen);
+    // int8 KV cache: every core keeps a ring of dequantized K and V pages of one kv head, a few stack tiles long
+    faTilingData.kvDequantRingPages =
+        (faInfo.kvQuantType == KvQuantType::NONE) ? 0 : std::min(maxNumBlocksPerBatch, KV_DEQUANT_RING_PAGES);
+    faTilingData.kvDequantCoreSize =
+        static_cast<uint64_t>(faTilingData.kvDequantRingPages) * faInfo.blockSize * faInfo.embeddingSize;
     faTilingData.scaleValue = scaleValue;
 }
 
@@ -108,16 +133,18 @@ void FillSplitCoreTilingData(const FAInfo& faInfo, FATilingData& faTilingData)
 {
     uint32_t totalTaskNum = 0;
     uint32_t groupSize = faInfo.numHeads / faInfo.kvHeads;
-    for (int32_t batchIdx = 0; batchIdx < faInfo.batch; batchIdx++) {
-        int64_t qSeqlen = *(faInfo.qSeqlenList + batchIdx);
-        int64_t kvSeqlen = *(faInfo.kvSeqlenList + batchIdx);
+    // with a shared prefix, the prefix pass of all query tokens runs first as one more batch
+    int32_t batchStart = (faInfo.prefixLen > 0) ? -1 : 0;
+    for (int32_t batchIdx = batchStart; batchIdx < faInfo.batch; batchIdx++) {
+        int64_t qSeqlen = (batchIdx < 0) ? faInfo.numTokens : *(faInfo.qSeqlenList + batchIdx);
+        int64_t kvSeqlen = (batchIdx < 0) ? faInfo.prefixLen : *(faInfo.kvSeqlenList + batchIdx) - faInfo.prefixLen;
         uint32_t curQNBlockTile = GetQNBlockTile(qSeqlen, groupSize);
         uint32_t qNBlockNumPerGroup = (groupSize + curQNBlockTile - 1) / curQNBlockTile;
         uint32_t curQNBlockNum = qNBlockNumPerGroup * faInfo.kvHeads;
         uint32_t curQSBlockTile = GetQSBlockTile(kvSeqlen);
         uint32_t curQSBlockNum = (qSeqlen + curQSBlockTile - 1) / curQSBlockTile;
         uint32_t curTaskNum = curQNBlockNum * curQSBlockNum;
-        if (batchIdx == 0) {
+        if (batchIdx == batchStart) {
             faTilingData.firstBatchTaskNum = curTaskNum;
         }
         totalTaskNum += curTaskNum;
@@ -125,13 +152,80 @@ void FillSplitCoreTilingData(const FAInfo& faInfo, FATilingData& faTilingData)
     faTilingData.totalTaskNum = totalTaskNum;
 }
 
+int32_t CheckWindowMask(const FAInfo& faInfo)
+{
+    if (faInfo.maskType == MaskType::MASK_SLIDING_WINDOW) {
+        // in-block window mask is generated within the first unmasked stack tile,
+        // so the window must not reach into the causal tail tile
+        if (faInfo.windowSize < NUM128) {
+            cerr << "[ERROR] sliding window mask requires windowSize >= 128." << endl;
+            return -1;
+        }
+    } else if (faInfo.maskType == MaskType::MASK_CHUNKED_LOCAL) {
+        // every qS block must lie within a single chunk, so the chunk start is the only kv bound
+        if (faInfo.windowSize <= 0 || faInfo.windowSize % NUM128 != 0) {
+            cerr << "[ERROR] chunked local mask requires windowSize to be a positive multiple of 128." << endl;
+            return -1;
+        }
+        for (int32_t batchIdx = 0; batchIdx < faInfo.batch; batchIdx++) {
+            int64_t qSeqlen = *(faInfo.qSeqlenList + batchIdx);
+            int64_t kvSeqlen = *(faInfo.kvSeqlenList + batchIdx);
+            if (qSeqlen != 1 && (kvSeqlen - qSeqlen) % NUM128 != 0) {
+                cerr << "[ERROR] chunked local mask requires (kvSeqlen - qSeqlen) % 128 == 0 for prefill." << endl;
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+int32_t CheckPrefix(const FAInfo& faInfo)
+{
+    if (faInfo.prefixLen == 0) {
+        return 0;
+    }
+    // the prefix pass reads whole pages and leaves the mask to the suffix pass
+    if (faInfo.prefixLen < 0 || faInfo.prefixLen % faInfo.blockSize != 0) {
+        cerr << "[ERROR] shared prefix length must be a multiple of blockSize." << endl;
+        return -1;
+    }
+    if (faInfo.kvQuantType != KvQuantType::NONE) {
+        cerr << "[ERROR] shared prefix does not support the int8 KV cache." << endl;
+        return -1;
+    }
+    if (faInfo.maskType == MaskType::MASK_SLIDING_WINDOW || faInfo.maskType == MaskType::MASK_CHUNKED_LOCAL) {
+        cerr << "[ERROR] shared prefix does not support sliding window or chunked local masks." << endl;
+        return -1;
+    }
+    for (int32_t batchIdx = 0; batchIdx < faInfo.batch; batchIdx++) {
+        int64_t qSeqlen = *(faInfo.qSeqlenList + batchIdx);
+        int64_t kvSeqlen = *(faInfo.kvSeqlenList + batchIdx);
+        if (kvSeqlen - qSeqlen < faInfo.prefixLen) {
+            cerr << "[ERROR] shared prefix requires kvSeqlen - qSeqlen >= prefixLen for every batch." << endl;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// Rings of all cores followed by the ring block table
+uint64_t GetKvDequantSize(uint32_t blockDim, const FATilingData& faTilingData)
+{
+    if (faTilingData.kvDequantRingPages == 0) {
+        return 0;
+    }
+    return blockDim * faTilingData.kvDequantCoreSize * NUM2 * NUM2 +
+           static_cast<uint64_t>(faTilingData.maxNumBlocksPerBatch) * sizeof(int32_t);
+}
+
 void FillWorkSpaceTilingData(uint32_t blockDim, FATilingData& faTilingData)
 {
     uint64_t mm1OutSize = blockDim * WORKSPACE_BLOCK_SIZE_DB * NUM4 * NUM3;
     uint64_t smOnlineOutSize = blockDim * WORKSPACE_BLOCK_SIZE_DB * NUM2 * NUM3;
     uint64_t mm2OutSize = blockDim * WORKSPACE_BLOCK_SIZE_DB * NUM4 * NUM3;
     uint64_t UpdateSize = blockDim * WORKSPACE_BLOCK_SIZE_DB * NUM4 * NUM3;
-    uint64_t workSpaceSize = mm1OutSize + smOnlineOutSize + mm2OutSize + UpdateSize;
+    uint64_t kvDequantSize = GetKvDequantSize(blockDim, faTilingData);
+    uint64_t workSpaceSize = mm1OutSize + smOnlineOutSize + mm2OutSize + UpdateSize + kvDequantSize;
     faTilingData.mm1OutSize = mm1OutSize;
     faTilingData.smOnlineOutSize = smOnlineOutSize;
     faTilingData.mm2OutSize = mm2OutSize;
@@ -149,6 +243,24 @@ int32_t GetFATilingParam(const FAInfo& faInfo, uint32_t blockDim, FATilingData&
         cerr << "[ERROR] blockSize != 128 is not supported." << endl;
         return -1;
     }
+    if (CheckWindowMask(faInfo) != 0) {
+        return -1;
+    }
+    if (CheckPrefix(faInfo) != 0) {
+        return -1;
+    }
+    if (faInfo.ropeFlag) {
+        // both halves of a rotated head must start on a 32B boundary in UB
+        if (faInfo.embeddingSize % NUM16 != 0 || faInfo.embeddingSize > NUM512) {
+            cerr << "[ERROR] RoPE prologue requires embeddingSize to be a multiple of 16 and no larger than 512."
+                 << endl;
+            return -1;
+        }
+        if (faInfo.kvQuantType != KvQuantType::NONE) {
+            cerr << "[ERROR] RoPE prologue does not support the int8 KV cache." << endl;
+            return -1;
+        }
+    }
     int64_t maxKvSeqlen = 0;
     for (int32_t batchIdx = 0; batchIdx < faInfo.batch; batchIdx++) {
         int64_t qSeqlen = *(faInfo.qSeqlenList + batchIdx);
@@ -71,6 +71,10 @@ class TestFlashAttentionInfer:
         inner_prec: int
         max_q_seqlen: int
         max_kv_seqlen: int
+        window_size: int = 0
+        kv_quant_type: int = 0
+        rope_flag: int = 0
+        prefix_len: int = 0
 
     @classmethod
     def check_attr(
@@ -95,6 +99,41 @@ class TestFlashAttentionInfer:
                 score = np.concatenate((score, group_score), 0)
         return score
 
+    @classmethod
+    def quantize_kv_cache(cls, cache, kv_quant_type, dtype):
+        # cache: [num_blocks, block_size, kv_heads, head_size]
+        # 1: one scale per kv head, 2: one scale per (block, kv head)
+        cache_fp32 = cache.astype(np.float32)
+        if kv_quant_type == 1:
+            amax = np.max(np.abs(cache_fp32), axis=(0, 1, 3))
+            scale_bc = amax[np.newaxis, np.newaxis, :, np.newaxis]
+        else:
+            amax = np.max(np.abs(cache_fp32), axis=(1, 3))
+            scale_bc = amax[:, np.newaxis, :, np.newaxis]
+        scale = np.maximum(amax, 1e-6).astype(np.float32) / 127.0
+        scale_bc = np.maximum(scale_bc, 1e-6).astype(np.float32) / 127.0
+        cache_int8 = np.clip(np.round(cache_fp32 / scale_bc), -127, 127).astype(np.int8)
+        # the kernel dequantizes as dtype(float(int8) * scale)
+        cache_dequant = (cache_int8.astype(np.float32) * scale_bc).astype(dtype)
+        return cache_int8, scale, cache_dequant
+
+    @classmethod
+    def gen_rope_table(cls, max_position, head_size, dtype, base=10000.0):
+        inv_freq = 1.0 / (base ** (np.arange(0, head_size, 2, dtype=np.float32) / head_size))
+        freqs = np.outer(np.arange(max_position, dtype=np.float32), inv_freq)
+        emb = np.concatenate((freqs, freqs), axis=-1)
+        return np.cos(emb).astype(dtype), np.sin(emb).astype(dtype)
+
+    @classmethod
+    def apply_rope(cls, x, cos, sin):
+        # x: [tokens, heads, head_size], cos/sin: [tokens, head_size], rotate-half form computed in float32
+        half = x.shape[-1] // 2
+        x_fp32 = x.astype(np.float32)
+        cos_fp32 = cos.astype(np.float32)[:, np.newaxis, :]
+        sin_fp32 = sin.astype(np.float32)[:, np.newaxis, :]
+        rotated = np.concatenate((-x_fp32[..., half:], x_fp32[..., :half]), axis=-1)
+        return (x_fp32 * cos_fp32 + rotated * sin_fp32).astype(x.dtype)
+
     @classmethod
     def softmax_numpy(cls, sim):
         row_max = np.max(sim, axis=-1, keepdims=True)
@@ -332,7 +371,7 @@ class TestFlashAttentionInfer:
                     keys = attention_inputs.key_cache[i, :, :, :]
                     values = attention_inputs.value_cache[i, :, :, :]
             scale = 1.0 / (head_size_qk**0.5)
-            if attention_inputs.mask_type == 1:
+            if attention_inputs.mask_type in (1, 3, 4):
                 mask = attention_inputs.global_mask[
                     cu_seqlen : (cu_seqlen + q_seqlen), :
                 ]
@@ -427,6 +466,17 @@ class TestFlashAttentionInfer:
                     for j in range(max_num_blocks_per_seq)
                 ]
                 block_tables.append(block_table)
+            # the pages of the shared prefix are the same physical blocks in every block table
+            for i in range(1, batch_size):
+                for j in range(gen_data_params.prefix_len // gen_data_params.block_size):
+                    block_tables[i][j] = block_tables[0][j]
+            if gen_data_params.kv_quant_type != 0:
+                key_cache_int8, key_scale, key_cache = self.quantize_kv_cache(
+                    key_cache, gen_data_params.kv_quant_type, gen_data_params.dtype
+                )
+                value_cache_int8, value_scale, value_cache = self.quantize_kv_cache(
+                    value_cache, gen_data_params.kv_quant_type, gen_data_params.dtype
+                )
         elif gen_data_params.kv_dtype == 0:
             if gen_data_params.layout_dtype == 1:
                 key_cache = np.random.uniform(
@@ -460,6 +510,43 @@ class TestFlashAttentionInfer:
                         head_size_vo,
                     ),
                 ).astype(gen_data_params.dtype)
+        golden_query = query
+        key_cache_input = key_cache
+        if gen_data_params.rope_flag != 0:
+            # the last q_seqlen kv positions of every batch are the new tokens: the kernel rotates Q and the new K
+            # rows, and writes the rotated K rows into their kv cache slots
+            cos_table, sin_table = self.gen_rope_table(
+                max_k_seqlen, head_size_qk, gen_data_params.dtype
+            )
+            key_new = np.random.uniform(
+                kv_min_range,
+                kv_max_range,
+                size=(num_tokens, gen_data_params.kv_heads, head_size_qk),
+            ).astype(gen_data_params.dtype)
+            position_ids = np.concatenate([
+                np.arange(k_len - q_len, k_len)
+                for q_len, k_len in zip(gen_data_params.q_seqlen_list, gen_data_params.k_seqlen_list)
+            ]).astype(np.int32)
+            golden_query = self.apply_rope(query, cos_table[position_ids], sin_table[position_ids])
+            key_new_rot = self.apply_rope(key_new, cos_table[position_ids], sin_table[position_ids])
+            key_cache_input = key_cache.copy()
+            token_idx = 0
+            kv_token_offset = 0
+            for i in range(batch_size):
+                q_len = gen_data_params.q_seqlen_list[i]
+                k_len = gen_data_params.k_seqlen_list[i]
+                for j in range(q_len):
+                    kv_pos = k_len - q_len + j
+                    if gen_data_params.kv_dtype == 1:
+                        block_number = block_tables[i][kv_pos // gen_data_params.block_size]
+                        slot = (block_number, kv_pos % gen_data_params.block_size)
+                    else:
+                        slot = (kv_token_offset + kv_pos,)
+                    key_cache[slot] = key_new_rot[token_idx]
+                    # stale slot content, must be overwritten by the kernel
+                    key_cache_input[slot] = 0
+                    token_idx += 1
+                kv_token_offset += k_len
         if gen_data_params.mask_type == 1:
             mask = np.zeros(shape=(num_tokens, max_k_seqlen)).astype(
                 gen_data_params.dtype
@@ -475,6 +562,27 @@ class TestFlashAttentionInfer:
                 ] = tri
                 pre_qseqlen += qseqlen
             mask = mask.astype(gen_data_params.dtype)
+        elif gen_data_params.mask_type in (3, 4):
+            # 3: sliding window, query at kv position q sees [q - window_size, q]
+            # 4: chunked local, query at kv position q sees [q // window_size * window_size, q]
+            window_size = gen_data_params.window_size
+            mask = np.zeros(shape=(num_tokens, max_k_seqlen)).astype(
+                gen_data_params.dtype
+            )
+            pre_qseqlen = 0
+            for i in range(batch_size):
+                qseqlen = gen_data_params.q_seqlen_list[i]
+                kseqlen = gen_data_params.k_seqlen_list[i]
+                q_pos = np.arange(kseqlen - qseqlen, kseqlen)[:, None]
+                kv_pos = np.arange(kseqlen)[None, :]
+                if gen_data_params.mask_type == 3:
+                    window_start = q_pos - window_size
+                else:
+                    window_start = q_pos // window_size * window_size
+                masked = (kv_pos > q_pos) | (kv_pos < window_start)
+                mask[pre_qseqlen : (pre_qseqlen + qseqlen), :kseqlen] = masked
+                pre_qseqlen += qseqlen
+            mask = mask.astype(gen_data_params.dtype)
         elif gen_data_params.mask_type == 2:
             mask = np.ones(shape=(max_q_seqlen, max_k_seqlen)).astype(np.float16)
             mask = np.triu(mask, 1)
@@ -490,7 +598,7 @@ class TestFlashAttentionInfer:
         golden_gpu_lse_output = np.zeros(lse_shape_out, dtype=np.float32)
 
         attention_inputs = self.AttentionInputs(
-            query,
+            golden_query,
             key_cache,
             value_cache,
             block_tables,
@@ -520,8 +628,19 @@ class TestFlashAttentionInfer:
             os.path.join(WORKSPACE, "data", "kv_ntokens.bin")
         )
         query.tofile(os.path.join(WORKSPACE, "data", "q.bin"))
-        key_cache.tofile(os.path.join(WORKSPACE, "data", "k.bin"))
-        value_cache.tofile(os.path.join(WORKSPACE, "data", "v.bin"))
+        if gen_data_params.kv_quant_type != 0:
+            key_cache_int8.tofile(os.path.join(WORKSPACE, "data", "k.bin"))
+            value_cache_int8.tofile(os.path.join(WORKSPACE, "data", "v.bin"))
+            key_scale.tofile(os.path.join(WORKSPACE, "data", "k_scale.bin"))
+            value_scale.tofile(os.path.join(WORKSPACE, "data", "v_scale.bin"))
+        else:
+            key_cache_input.tofile(os.path.join(WORKSPACE, "data", "k.bin"))
+            value_cache.tofile(os.path.join(WORKSPACE, "data", "v.bin"))
+        if gen_data_params.rope_flag != 0:
+            cos_table.tofile(os.path.join(WORKSPACE, "data", "cos.bin"))
+            sin_table.tofile(os.path.join(WORKSPACE, "data", "sin.bin"))
+            position_ids.tofile(os.path.join(WORKSPACE, "data", "position_ids.bin"))
+            key_new.tofile(os.path.join(WORKSPACE, "data", "k_new.bin"))
         np.array(block_tables).astype(np.int32).tofile(
             os.path.join(WORKSPACE, "data", "block_table.bin")
         )
@@ -548,7 +667,7 @@ class TestFlashAttentionInfer:
         np.array(gen_data_params.k_seqlen_list).astype(np.int64).tofile(
             os.path.join(WORKSPACE, "data", "kv_seqlen.bin")
         )
-        if gen_data_params.mask_type == 1:
+        if gen_data_params.mask_type != 0:
             actual_input_mask_triu = np.triu(np.ones((1024, 1024)), 1).astype(
                 gen_data_params.dtype
             )
@@ -595,6 +714,25 @@ if __name__ == "__main__":
         sys.exit()
 
     kv_dtype = int(sys.argv[10])
+    window_size = int(sys.argv[11]) if len(sys.argv) > 11 else 0
+    if mask_type in (3, 4) and window_size <= 0:
+        logging.error("[ERROR] mask_type 3/4 requires a positive window_size")
+        sys.exit()
+    # 0: fp16/bf16 KV cache, 1: int8 KV with per-head scales, 2: int8 KV with per-(block, head) scales
+    kv_quant_type = int(sys.argv[12]) if len(sys.argv) > 12 else 0
+    if kv_quant_type not in (0, 1, 2) or (kv_quant_type != 0 and kv_dtype != 1):
+        logging.error("[ERROR] kv_quant_type must be 0/1/2 and requires the paged kv cache (kv_dtype 1)")
+        sys.exit()
+    # 1: RoPE prologue, q.bin / k_new.bin hold the un-rotated Q and new K rows
+    rope_flag = int(sys.argv[13]) if len(sys.argv) > 13 else 0
+    if rope_flag != 0 and kv_quant_type != 0:
+        logging.error("[ERROR] rope_flag does not support the int8 kv cache")
+        sys.exit()
+    # shared prefix: the first prefix_len kv positions of every batch share their pages
+    prefix_len = int(sys.argv[14]) if len(sys.argv) > 14 else 0
+    if prefix_len != 0 and (kv_dtype != 1 or prefix_len % block_size != 0):
+        logging.error("[ERROR] prefix_len requires the paged kv cache and must be a multiple of block_size")
+        sys.exit()
     layout_dtype = 1
     inner_prec = 0
     lse_flag = 0
@@ -602,6 +740,9 @@ if __name__ == "__main__":
         q_seqlen, kv_seqlen, is_varied_len, batch
     )
 
+    if any(kv - q < prefix_len for q, kv in zip(q_seqlen_list, kv_seqlen_list)):
+        logging.error("[ERROR] prefix_len requires kv_seqlen - q_seqlen >= prefix_len for every batch")
+        sys.exit()
     max_kv_seqlen = max(kv_seqlen_list)
     num_blocks = batch * ((max_kv_seqlen + block_size - 1) // block_size)
     testObj = TestFlashAttentionInfer()
@@ -620,5 +761,9 @@ if __name__ == "__main__":
         inner_prec,
         q_seqlen,
         kv_seqlen,
+        window_size,
+        kv_quant_type,
+        rope_flag,
+        prefix_len,
     )
     testObj.calc_data(gen_data_params)
@@ -14,6 +14,8 @@
 constexpr uint32_t QK_READY_ID = 1;
 constexpr uint32_t SOFTMAX_READY_ID = 2;
 constexpr uint32_t PV_READY_ID = 3;
+constexpr uint32_t KV_DEQUANT_READY_ID = 4;
+constexpr uint32_t ROPE_READY_ID = 5;
 constexpr uint32_t BLOCK_SIZE = 16;
 constexpr uint32_t WORKSPACE_BLOCK_SIZE_DB = 131072;
 constexpr uint32_t TMP_SIZE_DECODER = 32768;
@@ -53,6 +55,17 @@ constexpr uint32_t FLOAT_VECTOR_SIZE = 64;
 
 constexpr uint32_t UNIT_BLOCK_STACK_NUM = 4;
 
+constexpr uint32_t MASK_TYPE_SLIDING_WINDOW = 3;
+constexpr uint32_t MASK_TYPE_CHUNKED_LOCAL = 4;
+
+// int8 KV cache scales: one float per kv head, or one float per (page, kv head)
+constexpr uint32_t KV_QUANT_TYPE_NONE = 0;
+constexpr uint32_t KV_QUANT_TYPE_PER_HEAD = 1;
+constexpr uint32_t KV_QUANT_TYPE_PER_BLOCK = 2;
+// Pages of the per-core ring that holds the dequantized int8 KV: (preLaunch + 1) stack tiles in flight on the cube
+// core plus the two stack tiles dequantized ahead, UNIT_BLOCK_STACK_NUM pages each
+constexpr uint32_t KV_DEQUANT_RING_PAGES = 5 * UNIT_BLOCK_STACK_NUM;
+
 template <typename T>
 CATLASS_DEVICE T AlignUp(T a, T b)
 {
@@ -93,6 +106,17 @@ uint32_t GetQSBlockTile(uint32_t kvSeqlen)
     return qSBlockTile;
 }
 
+// The first kv position visible to the start token (at kv position qStartKvS) of a qS block.
+// Sliding window sees [q - windowSize, q], chunked local sees [q / windowSize * windowSize, q].
+CATLASS_DEVICE
+int64_t GetWindowStartKvS(uint32_t maskType, uint32_t qStartKvS, uint32_t windowSize)
+{
+    if (maskType == MASK_TYPE_SLIDING_WINDOW) {
+        return static_cast<int64_t>(qStartKvS) - static_cast<int64_t>(windowSize);
+    }
+    return static_cast<int64_t>(qStartKvS / windowSize * windowSize);
+}
+
 struct FATilingData {
     uint32_t numHeads = 0;
     uint32_t embeddingSize = 0;
@@ -105,6 +129,16 @@ struct FATilingData {
     uint32_t firstBatchTaskNum = 0;
     uint32_t totalTaskNum = 0;
     uint32_t maskType = 0;
+    uint32_t windowSize = 0;
+    // 1: the causal mask of the diagonal tile is generated in ub and no mask tensor is read
+    uint32_t maskGenFlag = 0;
+    uint32_t kvQuantType = 0;
+    uint64_t kvDequantCoreSize = 0;
+    uint32_t kvDequantRingPages = 0;
+    uint32_t ropeFlag = 0;
+    // Shared prefix of every request: the first prefixLen kv positions, whose pages are shared by all block tables
+    uint32_t numTokens = 0;
+    uint32_t prefixLen = 0;
     uint64_t mm1OutSize = 0;
     uint64_t smOnlineOutSize = 0;
     uint64_t mm2OutSize = 0;
@@ -127,6 +161,19 @@ struct FAIKernelParams {
     GM_ADDR oTemp;
     GM_ADDR oUpdate;
     GM_ADDR tiling;
+    GM_ADDR kScale{nullptr};
+    GM_ADDR vScale{nullptr};
+    GM_ADDR kvDequant{nullptr};
+    // RoPE prologue: cos/sin tables [maxPosition, embed], position of every q token, new K rows in the q token order,
+    // and the workspace that receives the rotated Q
+    GM_ADDR cos{nullptr};
+    GM_ADDR sin{nullptr};
+    GM_ADDR positionIds{nullptr};
+    GM_ADDR kNew{nullptr};
+    GM_ADDR qRope{nullptr};
+    // Cascade attention: output of the shared-prefix pass and the lse of both passes [2, numTokens, numHeads]
+    GM_ADDR oPrefix{nullptr};
+    GM_ADDR lse{nullptr};
     // Methods
     CATLASS_DEVICE
     FAIKernelParams()
@@ -149,6 +196,18 @@ struct FAIKernelParams {
           oUpdate(oUpdate_),
           tiling(tiling_)
     {}
+    CATLASS_DEVICE
+    FAIKernelParams(
+        GM_ADDR q_, GM_ADDR k_, GM_ADDR v_, GM_ADDR mask_, GM_ADDR blockTables_, GM_ADDR actualQseqlen_,
+        GM_ADDR actualKvseqlen_, GM_ADDR o_, GM_ADDR s_, GM_ADDR p_, GM_ADDR oTemp_, GM_ADDR oUpdate_, GM_ADDR tiling_,
+        GM_ADDR kScale_, GM_ADDR vScale_, GM_ADDR kvDequant_)
+        : FAIKernelParams(
+              q_, k_, v_, mask_, blockTables_, actualQseqlen_, actualKvseqlen_, o_, s_, p_, oTemp_, oUpdate_, tiling_)
+    {
+        kScale = kScale_;
+        vScale = vScale_;
+        kvDequant = kvDequant_;
+    }
 };
 
 #endif
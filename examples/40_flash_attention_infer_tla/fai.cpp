@@ -22,11 +22,16 @@
 
 using namespace std;
 
+constexpr uint32_t SCORE_MOD_NONE = 0;
+constexpr uint32_t SCORE_MOD_ALIBI = 1;
+constexpr uint32_t SCORE_MOD_SOFTCAP = 2;
+constexpr uint32_t SCORE_MOD_REL_POS_BIAS = 3;
+
 // This code section describes the parameters to execute the run function.
 struct Options {
     static constexpr auto HELPER =
         "Usage: fai batch qSeqlen kvSeqlen numHeads kvHeads embeddingSize isVariedLen maskType [--dtype DTYPE "
-        "--datapath DATA_PATH --device DEVICE_ID]\n";
+        "--datapath DATA_PATH --device DEVICE_ID --window WINDOW_SIZE --score-mod SCORE_MOD --softcap SOFTCAP]\n";
     static constexpr auto MIN_ARGS = 7;
 
     // Define default value.
@@ -38,6 +43,10 @@ struct Options {
     uint32_t embeddingSize{0};
     uint32_t isVariedLen{0};
     uint32_t maskType{0};
+    uint32_t windowSize{0};
+    // 0: none, 1: alibi, 2: softcap, 3: relative position bias
+    uint32_t scoreMod{0};
+    float softcap{0.0};
     uint32_t deviceId{0};
     uint32_t blockSize{128};
     string dataType = "half";
@@ -72,11 +81,26 @@ struct Options {
                 deviceId = atoi(argv[argIndex++]);
             } else if (flag == "--dtype") {
                 dataType = string(argv[argIndex++]);
+            } else if (flag == "--window") {
+                windowSize = atoi(argv[argIndex++]);
+            } else if (flag == "--score-mod") {
+                scoreMod = atoi(argv[argIndex++]);
+            } else if (flag == "--softcap") {
+                softcap = atof(argv[argIndex++]);
             } else {
                 printf(HELPER);
                 return -1;
             }
         }
+        // maskType 3: sliding window, 4: chunked local, both need a window size
+        if ((maskType == 3 || maskType == 4) && windowSize == 0) {
+            printf(HELPER);
+            return -1;
+        }
+        if (scoreMod > SCORE_MOD_REL_POS_BIAS || (scoreMod == SCORE_MOD_SOFTCAP && softcap <= 0)) {
+            printf(HELPER);
+            return -1;
+        }
         return 0;
     }
 };
@@ -93,6 +117,39 @@ static void FreeMem(uint8_t* host, uint8_t* device)
     ACL_CHECK(aclrtFree(device));
 }
 
+// The score mod is a compile-time policy of the softmax epilogue, pick the matching kernel instance
+template <class Dtype>
+static void LaunchFAInferTla(
+    uint32_t scoreMod, uint32_t blockDim, aclrtStream stream, uint64_t hardwareSyncAddr, uint8_t* qDevice,
+    uint8_t* kDevice, uint8_t* vDevice, uint8_t* maskDevice, uint8_t* scoreModDevice, uint8_t* blockTableDevice,
+    uint8_t* oDevice, uint8_t* qSeqDevice, uint8_t* kvSeqDevice, uint8_t* sDevice, uint8_t* pDevice,
+    uint8_t* oTempDevice, uint8_t* oUpdateDevice, uint8_t* tilingDevice)
+{
+    switch (scoreMod) {
+        case SCORE_MOD_ALIBI:
+            FAInferTla<Dtype, Epilogue::FAScoreModAlibi><<<blockDim, nullptr, stream>>>(
+                hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, scoreModDevice, blockTableDevice, oDevice,
+                qSeqDevice, kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice);
+            break;
+        case SCORE_MOD_SOFTCAP:
+            FAInferTla<Dtype, Epilogue::FAScoreModSoftcap><<<blockDim, nullptr, stream>>>(
+                hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, scoreModDevice, blockTableDevice, oDevice,
+                qSeqDevice, kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice);
+            break;
+        case SCORE_MOD_REL_POS_BIAS:
+            FAInferTla<Dtype, Epilogue::FAScoreModRelPosBias><<<blockDim, nullptr, stream>>>(
+                hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, scoreModDevice, blockTableDevice, oDevice,
+                qSeqDevice, kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice);
+            break;
+        case SCORE_MOD_NONE:
+        default:
+            FAInferTla<Dtype, Epilogue::FAScoreModNone><<<blockDim, nullptr, stream>>>(
+                hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, scoreModDevice, blockTableDevice, oDevice,
+                qSeqDevice, kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice);
+            break;
+    }
+}
+
 // Allocate several matrices in NPU device memory and call a
 // CATLASS FAI kernel.
 static void Run(const Options& options)
@@ -137,7 +194,6 @@ static void Run(const Options& options)
     uint64_t maskSize = 1024 * 1024 * sizeof(fp16_t);
     uint64_t blockTableSize =
         static_cast<uint64_t>(batch * ((maxKvSeqlen + blockSize - 1) / blockSize) * sizeof(int32_t));
-    uint32_t tilingSize = sizeof(FATilingData);
 
     // Allocate matrices in host and device memory.
     uint8_t* qSeqHost;
@@ -177,12 +233,28 @@ static void Run(const Options& options)
     // Allocate matrices in host and device memory and load Matrix mask.
     uint8_t* maskHost;
     uint8_t* maskDevice;
-    if (maskType == 1) {
+    if (maskType != 0) {
         AllocMem(&maskHost, &maskDevice, maskSize);
         ReadFile(dataPath + "/mask.bin", maskHost, maskSize);
         ACL_CHECK(aclrtMemcpy(maskDevice, maskSize, maskHost, maskSize, ACL_MEMCPY_HOST_TO_DEVICE));
     }
 
+    // ALiBi slopes (numHeads floats) or the relative position bias table (numHeads * relBiasLen floats)
+    uint32_t relBiasLen = 2 * maxKvSeqlen - 1;
+    uint64_t scoreModSize = 0;
+    if (options.scoreMod == SCORE_MOD_ALIBI) {
+        scoreModSize = static_cast<uint64_t>(numHeads) * sizeof(float);
+    } else if (options.scoreMod == SCORE_MOD_REL_POS_BIAS) {
+        scoreModSize = static_cast<uint64_t>(numHeads) * relBiasLen * sizeof(float);
+    }
+    uint8_t* scoreModHost{nullptr};
+    uint8_t* scoreModDevice{nullptr};
+    if (scoreModSize != 0) {
+        AllocMem(&scoreModHost, &scoreModDevice, scoreModSize);
+        ReadFile(dataPath + "/score_mod.bin", scoreModHost, scoreModSize);
+        ACL_CHECK(aclrtMemcpy(scoreModDevice, scoreModSize, scoreModHost, scoreModSize, ACL_MEMCPY_HOST_TO_DEVICE));
+    }
+
     // Allocate matrices in host and device memory and load Matrix block_table.
     uint8_t* blockTableHost;
     uint8_t* blockTableDevice;
@@ -211,12 +283,7 @@ static void Run(const Options& options)
     uint8_t* oDevice{nullptr};
     ACL_CHECK(aclrtMalloc((void**)(&oDevice), qoSize * 2, ACL_MEM_MALLOC_HUGE_FIRST));
 
-    uint8_t* tilingDevice;
-    ACL_CHECK(aclrtMalloc((void**)(&tilingDevice), tilingSize, ACL_MEM_MALLOC_HUGE_FIRST));
-
     // get tiling
-    void* tilingHost = nullptr;
-    ACL_CHECK(aclrtMallocHost(&tilingHost, tilingSize));
     uint32_t blockDim = aicCoreNum;
 
     FAInferTiling::FAInfo faInfo;
@@ -228,16 +295,24 @@ static void Run(const Options& options)
     faInfo.kvHeads = kvHeads;
     faInfo.batch = batch;
     faInfo.maskType = static_cast<FAInferTiling::MaskType>(maskType);
+    faInfo.windowSize = static_cast<int32_t>(options.windowSize);
+    faInfo.softcap = options.softcap;
+    faInfo.relBiasLen = relBiasLen;
     faInfo.qSeqlenList = reinterpret_cast<int64_t*>(qSeqHost);
     faInfo.kvSeqlenList = reinterpret_cast<int64_t*>(kvSeqHost);
 
     FATilingData faTilingData;
+    // FATilingData followed by cu_seqlens and the balanced per-core task list
+    std::vector<uint8_t> tilingBuffer;
+    if (FAInferTiling::GetFATilingParam(faInfo, blockDim, faTilingData, tilingBuffer) != 0) {
+        cerr << "[ERROR] Get tiling failed." << endl;
+        return;
+    }
+    uint64_t tilingSize = tilingBuffer.size();
 
-    FAInferTiling::GetFATilingParam(faInfo, blockDim, faTilingData);
-
-    tilingHost = reinterpret_cast<void*>(&faTilingData);
-
-    ACL_CHECK(aclrtMemcpy(tilingDevice, tilingSize, tilingHost, tilingSize, ACL_MEMCPY_HOST_TO_DEVICE));
+    uint8_t* tilingDevice;
+    ACL_CHECK(aclrtMalloc((void**)(&tilingDevice), tilingSize, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(tilingDevice, tilingSize, tilingBuffer.data(), tilingSize, ACL_MEMCPY_HOST_TO_DEVICE));
 
     // Prepare hardware sync address
     uint64_t hardwareSyncAddr{0};
@@ -245,13 +320,15 @@ static void Run(const Options& options)
 
     for (int i = 0; i < 1; i++) {
         if (dataType == "half") {
-            FAInferTla<half><<<blockDim, nullptr, stream>>>(
-                hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, blockTableDevice, oDevice, qSeqDevice,
-                kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice);
+            LaunchFAInferTla<half>(
+                options.scoreMod, blockDim, stream, hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice,
+                scoreModDevice, blockTableDevice, oDevice, qSeqDevice, kvSeqDevice, sDevice, pDevice, oTempDevice,
+                oUpdateDevice, tilingDevice);
         } else {
-            FAInferTla<bfloat16_t><<<blockDim, nullptr, stream>>>(
-                hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice, blockTableDevice, oDevice, qSeqDevice,
-                kvSeqDevice, sDevice, pDevice, oTempDevice, oUpdateDevice, tilingDevice);
+            LaunchFAInferTla<bfloat16_t>(
+                options.scoreMod, blockDim, stream, hardwareSyncAddr, qDevice, kDevice, vDevice, maskDevice,
+                scoreModDevice, blockTableDevice, oDevice, qSeqDevice, kvSeqDevice, sDevice, pDevice, oTempDevice,
+                oUpdateDevice, tilingDevice);
         }
         ACL_CHECK(aclrtSynchronizeStream(stream));
         // Copy the result from device to host
@@ -284,9 +361,12 @@ static void Run(const Options& options)
     FreeMem(qHost, qDevice);
     FreeMem(kHost, kDevice);
     FreeMem(vHost, vDevice);
-    if (maskType == 1) {
+    if (maskType != 0) {
         FreeMem(maskHost, maskDevice);
     }
+    if (scoreModSize != 0) {
+        FreeMem(scoreModHost, scoreModDevice);
+    }
     FreeMem(blockTableHost, blockTableDevice);
     aclrtFree(oDevice);
     aclrtFree(tilingDevice);
@@ -294,7 +374,6 @@ static void Run(const Options& options)
     aclrtFree(pDevice);
     aclrtFree(oTempDevice);
     aclrtFree(oUpdateDevice);
-    aclrtFreeHost(tilingHost);
     aclrtFreeHost(qNtokens);
 
     // Destroy specified Stream and reset device.
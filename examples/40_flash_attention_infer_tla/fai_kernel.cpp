@@ -55,6 +55,8 @@ public:
     using ElementV = typename BlockMmadPV::ElementB;
 
     using ElementMask = typename EpilogueOnlineSoftmax::ElementMask;
+    using ScoreMod = typename EpilogueOnlineSoftmax::DispatchPolicy::ScoreMod;
+    using ScoreModParams = typename EpilogueOnlineSoftmax::ScoreModParams;
 
     using ElementO = typename EpilogueRescaleO::ElementOutput;
     using ElementOTmp = typename EpilogueRescaleO::ElementInput;
@@ -104,10 +106,9 @@ public:
         uint32_t embed = fATilingData->embeddingSize;
         uint32_t pagedBlockSize = fATilingData->blockSize;
         uint32_t maxNumBlocksPerBatch = fATilingData->maxNumBlocksPerBatch;
-        uint32_t curTotalTaskNum = fATilingData->firstBatchTaskNum;
-        uint32_t totalTaskNum = fATilingData->totalTaskNum;
         uint32_t blockSize = fATilingData->blockSize;
         uint32_t maskType = fATilingData->maskType;
+        uint32_t windowSize = fATilingData->windowSize;
         float scaleValue = fATilingData->scaleValue;
 
         AscendC::GlobalTensor<ElementQ> gQ;
@@ -135,10 +136,19 @@ public:
         uint32_t groupSize = qHeads / kvHeads;
 
         uint32_t coreIdx = AscendC::GetBlockIdx();
-        uint32_t coreNum = AscendC::GetBlockNum();
-        curTotalTaskNum = 0;
-        uint32_t preTotalTaskNum = 0;
-        uint32_t curBatch = 0;
+        // The balanced task list is laid out after FATilingData, see FillTilingBuffer in fai_tiling.cpp
+        AscendC::GlobalTensor<int64_t> gCuSeqlenQ;
+        gCuSeqlenQ.SetGlobalBuffer((__gm__ int64_t*)(params.tiling + fATilingData->cuSeqlenQOffset));
+        AscendC::GlobalTensor<int64_t> gCuSeqlenKv;
+        gCuSeqlenKv.SetGlobalBuffer((__gm__ int64_t*)(params.tiling + fATilingData->cuSeqlenKvOffset));
+        AscendC::GlobalTensor<uint32_t> gCoreTaskStart;
+        gCoreTaskStart.SetGlobalBuffer((__gm__ uint32_t*)(params.tiling + fATilingData->coreTaskStartOffset));
+        AscendC::GlobalTensor<uint32_t> gTaskList;
+        gTaskList.SetGlobalBuffer((__gm__ uint32_t*)(params.tiling + fATilingData->taskListOffset));
+        uint32_t taskStart = gCoreTaskStart.GetValue(coreIdx);
+        uint32_t taskEnd = gCoreTaskStart.GetValue(coreIdx + 1);
+
+        uint32_t curBatch = batch;
         uint64_t qBOffset = 0;
         uint64_t kBOffset = 0;
         uint64_t vBOffset = 0;
@@ -151,25 +161,18 @@ public:
         int64_t curQSBlockTile;
         uint32_t curQSBlockNum;
 
-        preTotalTaskNum = curTotalTaskNum;
-        qSeqlen = reinterpret_cast<int64_t>(gActualQseqlen.GetValue(curBatch));
-        kvSeqlen = reinterpret_cast<int64_t>(gActualKvseqlen.GetValue(curBatch));
-        curQSBlockTile = GetQSBlockTile(kvSeqlen);
-        curQNBlockTile = GetQNBlockTile(qSeqlen, groupSize);
-        qNBlockNumPerGroup = CeilDiv(groupSize, curQNBlockTile);
-        curQNBlockNum = qNBlockNumPerGroup * kvHeads;
-        curQSBlockNum = CeilDiv(qSeqlen, curQSBlockTile);
-        curTotalTaskNum += curQNBlockNum * curQSBlockNum;
-        for (uint32_t taskIdx = coreIdx; taskIdx < totalTaskNum; taskIdx += uint32_t(coreNum)) {
-            while (taskIdx >= curTotalTaskNum) {
-                ++curBatch;
-                preTotalTaskNum = curTotalTaskNum;
-                qBOffset += qSeqlen * strideQO;
+        for (uint32_t taskIdx = taskStart; taskIdx < taskEnd; taskIdx++) {
+            uint32_t taskBatch = gTaskList.GetValue(taskIdx * TASK_ENTRY_SIZE);
+            uint32_t qSBlockIdx = gTaskList.GetValue(taskIdx * TASK_ENTRY_SIZE + 1);
+            uint32_t qNBlockIdx = gTaskList.GetValue(taskIdx * TASK_ENTRY_SIZE + 2);
+            if (taskBatch != curBatch) {
+                curBatch = taskBatch;
+                qBOffset = gCuSeqlenQ.GetValue(curBatch) * strideQO;
                 if constexpr (!PAGED_CACHE_FLAG) {
-                    kBOffset += kvSeqlen * strideKV;
-                    vBOffset += kvSeqlen * strideKV;
+                    kBOffset = gCuSeqlenKv.GetValue(curBatch) * strideKV;
+                    vBOffset = kBOffset;
                 } else {
-                    blockBOffset += maxNumBlocksPerBatch;
+                    blockBOffset = static_cast<uint64_t>(curBatch) * maxNumBlocksPerBatch;
                 }
                 qSeqlen = reinterpret_cast<int64_t>(gActualQseqlen.GetValue(curBatch));
                 kvSeqlen = reinterpret_cast<int64_t>(gActualKvseqlen.GetValue(curBatch));
@@ -178,11 +181,7 @@ public:
                 qNBlockNumPerGroup = CeilDiv(groupSize, curQNBlockTile);
                 curQNBlockNum = qNBlockNumPerGroup * kvHeads;
                 curQSBlockNum = CeilDiv(qSeqlen, curQSBlockTile);
-                curTotalTaskNum += curQNBlockNum * curQSBlockNum;
             }
-            uint32_t taskIdxCurBatch = taskIdx - preTotalTaskNum;
-            uint32_t qSBlockIdx = taskIdxCurBatch / curQNBlockNum;
-            uint32_t qNBlockIdx = taskIdxCurBatch - qSBlockIdx * curQNBlockNum;
             uint32_t qNBlockIdxCurGroup = qNBlockIdx % qNBlockNumPerGroup;
             uint32_t kvHeadIdx = qNBlockIdx / qNBlockNumPerGroup;
             uint32_t qHeadIdx = kvHeadIdx * groupSize + qNBlockIdxCurGroup * curQNBlockTile;
@@ -199,13 +198,26 @@ public:
             uint32_t noSkipKvS = kvSeqlen;
             uint32_t noMaskKvS = kvSeqlen;
             uint32_t noMaskTailS = 0;
+            uint32_t kvSkipS = 0;
             if (maskType != 0) {
                 uint32_t diffS = kvSeqlen - qSeqlen;
                 noSkipKvS = (qSBlockIdx + 1) * curQSBlockTile + diffS;
                 noSkipKvS = Min((uint32_t)kvSeqlen, noSkipKvS);
                 noMaskKvS = noSkipKvS - qSBlockSize;
+                if ((maskType == MASK_TYPE_SLIDING_WINDOW) || (maskType == MASK_TYPE_CHUNKED_LOCAL)) {
+                    // skip the kv pages that lie entirely before the window of the whole qS block
+                    int64_t windowStartKvS = GetWindowStartKvS(maskType, noMaskKvS, windowSize);
+                    kvSkipS = (windowStartKvS > 0) ? RoundDown((uint32_t)windowStartKvS, pagedBlockSize) : 0;
+                    noSkipKvS -= kvSkipS;
+                    noMaskKvS -= kvSkipS;
+                }
                 noMaskTailS = noMaskKvS % pagedBlockSize;
             }
+            if constexpr (!PAGED_CACHE_FLAG) {
+                gmKOffset += kvSkipS * strideKV;
+                gmVOffset += kvSkipS * strideKV;
+            }
+            uint64_t blockTableOffset = blockBOffset + kvSkipS / pagedBlockSize;
             uint32_t maskedKvS = qSBlockSize;
             uint32_t kvSLoopNumNoMask = CeilDiv(noMaskKvS, pagedBlockSize);
             uint32_t kvSLoopNumTotal = CeilDiv(noSkipKvS, pagedBlockSize);
@@ -236,7 +248,7 @@ public:
             if constexpr (PAGED_CACHE_FLAG) {
                 kvPhysTokenSlots = fATilingData->numBlocks * pagedBlockSize;
             } else {
-                kvPhysTokenSlots = kvSeqlen;
+                kvPhysTokenSlots = kvSeqlen - kvSkipS;
             }
             auto layoutKCube =
                 tla::MakeLayout(MakeShape(embed, kvPhysTokenSlots), MakeStride(Int<1>{}, (int64_t)strideKV));
@@ -264,7 +276,7 @@ public:
                             pagedBlockSize, noMaskKvS, strideKV);
                     } else {
                         blockMmadQK(
-                            tensorQ, tensorK, gS[gmSOffset], gBlockTable[blockBOffset], actualBlockShapeQK, kvSIdx,
+                            tensorQ, tensorK, gS[gmSOffset], gBlockTable[blockTableOffset], actualBlockShapeQK, kvSIdx,
                             kvSLoopNumNoMask, pagedBlockSize, noMaskKvS, strideKV);
                     }
                     Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(qkReady);
@@ -291,7 +303,7 @@ public:
                             pagedBlockSize, noMaskKvS, strideKV, softmaxReady);
                     } else {
                         blockMmadPV(
-                            tensorP, tensorV, tensorOTmp, gBlockTable[blockBOffset], actualBlockShapePV, nowkvSIdx,
+                            tensorP, tensorV, tensorOTmp, gBlockTable[blockTableOffset], actualBlockShapePV, nowkvSIdx,
                             kvSLoopNumNoMask, pagedBlockSize, noMaskKvS, strideKV, softmaxReady);
                     }
                     Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(pvReady);
@@ -330,7 +342,7 @@ public:
                             pagedBlockSize, noSkipKvS, strideKV, noMaskTailS, 1);
                     } else {
                         blockMmadQKTail(
-                            tensorQ, tensorK, gS[gmSOffset], gBlockTable[blockBOffset], actualBlockShapeQK, kvSIdx,
+                            tensorQ, tensorK, gS[gmSOffset], gBlockTable[blockTableOffset], actualBlockShapeQK, kvSIdx,
                             kvSLoopNumTotal, pagedBlockSize, noSkipKvS, strideKV, noMaskTailS, 1);
                     }
                     Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(qkReady);
@@ -363,7 +375,7 @@ public:
                                 kvSLoopNumTotal, pagedBlockSize, noSkipKvS, strideKV, softmaxReady, noMaskTailS, 1);
                         } else {
                             blockMmadPVTail(
-                                tensorP, tensorV, tensorOTmp, gBlockTable[blockBOffset], actualBlockShapePV,
+                                tensorP, tensorV, tensorOTmp, gBlockTable[blockTableOffset], actualBlockShapePV,
                                 delayedKvSIdx, kvSLoopNumTotal, pagedBlockSize, noSkipKvS, strideKV, softmaxReady,
                                 noMaskTailS, 1);
                         }
@@ -374,7 +386,7 @@ public:
                                 kvSLoopNumNoMask, pagedBlockSize, noMaskKvS, strideKV, softmaxReady);
                         } else {
                             blockMmadPV(
-                                tensorP, tensorV, tensorOTmp, gBlockTable[blockBOffset], actualBlockShapePV,
+                                tensorP, tensorV, tensorOTmp, gBlockTable[blockTableOffset], actualBlockShapePV,
                                 delayedKvSIdx, kvSLoopNumNoMask, pagedBlockSize, noMaskKvS, strideKV, softmaxReady);
                         }
                     }
@@ -438,9 +450,8 @@ public:
         uint32_t embed = fATilingData->embeddingSize;
         uint32_t pagedBlockSize = fATilingData->blockSize;
         uint32_t maxNumBlocksPerBatch = fATilingData->maxNumBlocksPerBatch;
-        uint32_t firstBatchTaskNum = fATilingData->firstBatchTaskNum;
-        uint32_t totalTaskNum = fATilingData->totalTaskNum;
         uint32_t maskType = fATilingData->maskType;
+        uint32_t windowSize = fATilingData->windowSize;
         float scaleValue = fATilingData->scaleValue;
         // Get the memory offset address of the input on Global Memory
         AscendC::GlobalTensor<ElementMask> gMask;
@@ -463,31 +474,48 @@ public:
         uint32_t groupSize = qHeads / kvHeads;
         uint32_t embedRound = RoundUp(embed, BLOCK_SIZE);
 
-        EpilogueOnlineSoftmax epilogueOnlineSoftmax(resource, scaleValue);
+        ScoreModParams scoreModParams;
+        if constexpr (std::is_same_v<ScoreMod, Epilogue::FAScoreModSoftcap>) {
+            scoreModParams.softcap = fATilingData->softcap;
+        } else if constexpr (std::is_same_v<ScoreMod, Epilogue::FAScoreModAlibi>) {
+            scoreModParams.slopes = params.scoreModData;
+        } else if constexpr (std::is_same_v<ScoreMod, Epilogue::FAScoreModRelPosBias>) {
+            scoreModParams.relBias = params.scoreModData;
+            scoreModParams.relBiasLen = fATilingData->relBiasLen;
+        }
+        EpilogueOnlineSoftmax epilogueOnlineSoftmax(resource, scaleValue, scoreModParams);
         EpilogueRescaleO epilogueRescaleO(resource);
 
-        // uint32_t curTotalTaskNum = 0;
-        uint32_t preTotalTaskNum = 0;
-        uint32_t curBatch = 0;
+        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        // Walk the same balanced task list as the cube core
+        AscendC::GlobalTensor<int64_t> gCuSeqlenQ;
+        gCuSeqlenQ.SetGlobalBuffer((__gm__ int64_t*)(params.tiling + fATilingData->cuSeqlenQOffset));
+        AscendC::GlobalTensor<uint32_t> gCoreTaskStart;
+        gCoreTaskStart.SetGlobalBuffer((__gm__ uint32_t*)(params.tiling + fATilingData->coreTaskStartOffset));
+        AscendC::GlobalTensor<uint32_t> gTaskList;
+        gTaskList.SetGlobalBuffer((__gm__ uint32_t*)(params.tiling + fATilingData->taskListOffset));
+        uint32_t taskStart = gCoreTaskStart.GetValue(coreIdx);
+        uint32_t taskEnd = gCoreTaskStart.GetValue(coreIdx + 1);
+
+        uint32_t curBatch = batch;
         int64_t oBatchOffset = 0;
-        uint32_t qSeqlen = static_cast<uint32_t>(gActualQseqlen.GetValue(curBatch));
-        uint32_t kvSeqlen = static_cast<uint32_t>(gActualKvseqlen.GetValue(curBatch));
-        uint32_t curQNBlockTile = GetQNBlockTile(qSeqlen, groupSize);
-        uint32_t qNBlockNumPerGroup = CeilDiv(groupSize, curQNBlockTile);
-        uint32_t curQNBlockNum = qNBlockNumPerGroup * kvHeads;
-        uint32_t curQSBlockTile = GetQSBlockTile(kvSeqlen);
-        uint32_t curQSBlockNum = CeilDiv(qSeqlen, curQSBlockTile);
-        uint32_t curTotalTaskNum = firstBatchTaskNum;
+        uint32_t qSeqlen = 0;
+        uint32_t kvSeqlen = 0;
+        uint32_t curQNBlockTile = 0;
+        uint32_t qNBlockNumPerGroup = 0;
+        uint32_t curQNBlockNum = 0;
+        uint32_t curQSBlockTile = 0;
+        uint32_t curQSBlockNum = 0;
 
-        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
-        uint32_t coreNum = AscendC::GetBlockNum();
         // Go through each task.
-        for (uint32_t taskIdx = coreIdx; taskIdx < totalTaskNum; taskIdx += uint32_t(coreNum)) {
+        for (uint32_t taskIdx = taskStart; taskIdx < taskEnd; taskIdx++) {
+            uint32_t taskBatch = gTaskList.GetValue(taskIdx * TASK_ENTRY_SIZE);
+            uint32_t qSBlockIdx = gTaskList.GetValue(taskIdx * TASK_ENTRY_SIZE + 1);
+            uint32_t qNBlockIdx = gTaskList.GetValue(taskIdx * TASK_ENTRY_SIZE + 2);
             // Get the offset of each core on the GM.
-            while (taskIdx >= curTotalTaskNum) {
-                curBatch++;
-                oBatchOffset += static_cast<int64_t>(qSeqlen) * qHeads * embed;
-                preTotalTaskNum = curTotalTaskNum;
+            if (taskBatch != curBatch) {
+                curBatch = taskBatch;
+                oBatchOffset = gCuSeqlenQ.GetValue(curBatch) * qHeads * embed;
                 qSeqlen = static_cast<uint32_t>(gActualQseqlen.GetValue(curBatch));
                 kvSeqlen = static_cast<uint32_t>(gActualKvseqlen.GetValue(curBatch));
                 curQNBlockTile = GetQNBlockTile(qSeqlen, groupSize);
@@ -495,11 +523,7 @@ public:
                 curQNBlockNum = qNBlockNumPerGroup * kvHeads;
                 curQSBlockTile = GetQSBlockTile(kvSeqlen);
                 curQSBlockNum = CeilDiv(qSeqlen, curQSBlockTile);
-                curTotalTaskNum += curQNBlockNum * curQSBlockNum;
             }
-            uint32_t taskIdxCurBatch = taskIdx - preTotalTaskNum;
-            uint32_t qSBlockIdx = taskIdxCurBatch / curQNBlockNum;
-            uint32_t qNBlockIdx = taskIdxCurBatch % curQNBlockNum;
             uint32_t qNBlockIdxCurGroup = qNBlockIdx % qNBlockNumPerGroup;
 
             uint32_t oSOffset = qSBlockIdx * curQSBlockTile * qHeads * embed;
@@ -519,14 +543,30 @@ public:
             uint32_t noSkipKvS = kvSeqlen;
             uint32_t noMaskKvS = kvSeqlen;
             uint32_t noMaskTailS = 0;
+            uint32_t kvSkipS = 0;
+            int32_t windowMaskOffset = 0;
             if (maskType != 0) {
                 uint32_t diffS = kvSeqlen - qSeqlen;
                 noSkipKvS = (qSBlockIdx + 1) * curQSBlockTile + diffS;
                 noSkipKvS = Min(kvSeqlen, noSkipKvS);
                 noMaskKvS = noSkipKvS - qSBlockSize;
+                if ((maskType == MASK_TYPE_SLIDING_WINDOW) || (maskType == MASK_TYPE_CHUNKED_LOCAL)) {
+                    // skip the kv pages that lie entirely before the window of the whole qS block
+                    int64_t windowStartKvS = GetWindowStartKvS(maskType, noMaskKvS, windowSize);
+                    kvSkipS = (windowStartKvS > 0) ? RoundDown((uint32_t)windowStartKvS, pagedBlockSize) : 0;
+                    windowMaskOffset = static_cast<int32_t>(windowStartKvS - kvSkipS);
+                    noSkipKvS -= kvSkipS;
+                    noMaskKvS -= kvSkipS;
+                }
                 noMaskTailS = noMaskKvS % pagedBlockSize;
             }
+            // only the first stack tile holds kv positions left of the window
+            bool applyWindowMask = (maskType == MASK_TYPE_SLIDING_WINDOW) &&
+                                   (windowMaskOffset + static_cast<int32_t>(qSBlockSize) - 1 > 0);
             uint32_t maskedKvS = qSBlockSize;
+            // kv-aligned positions for the score mods, q is right-aligned to kv as in the causal mask
+            Epilogue::Tile::FAScoreModCoord scoreModCoord{
+                qStartNIdx, static_cast<int64_t>(kvSeqlen) - qSeqlen + qSBlockIdx * curQSBlockTile, kvSkipS};
             uint32_t kvSLoopNumTotal = CeilDiv(noSkipKvS, pagedBlockSize);
             uint32_t kvSLoopNumNoMask = CeilDiv(noMaskKvS, pagedBlockSize);
             uint32_t blockStackNum = 4;
@@ -556,9 +596,11 @@ public:
                 // AscendC::printf("stackSeqCount:%d\n", stackSeqCount);
                 Arch::CrossCoreWaitFlag(qkReady);
                 // online softmax
+                scoreModCoord.kvTokenPos = kvSkipS + kvSIdx * pagedBlockSize;
                 epilogueOnlineSoftmax(
                     gP[gmOffsetP], gS[gmOffsetS], layOutP, layOutS, actualBlockShapeQK, (stackSeqCount == 0),
-                    qSBlockSize, qNBlockSize, curStackTileMod);
+                    qSBlockSize, qNBlockSize, curStackTileMod, applyWindowMask && (stackSeqCount == 0),
+                    windowMaskOffset, scoreModCoord);
                 Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(softmaxReady);
 
                 if (kvSIdx >= preLaunch * blockStackNum) {
@@ -612,9 +654,10 @@ public:
                     // vec core offset will be processed within epilogue block
                     uint32_t gmOffsetP = gmOffsetS;
                     // online softmax
+                    scoreModCoord.kvTokenPos = kvSkipS + noMaskKvS;
                     epilogueOnlineSoftmax(
                         gP[gmOffsetP], gS[gmOffsetS], gMask, layOutP, layOutS, layOutMask, actualBlockShapeQK,
-                        (stackSeqCount == 0), qSBlockSize, qNBlockSize, curStackTileMod, qkReady);
+                        (stackSeqCount == 0), qSBlockSize, qNBlockSize, curStackTileMod, qkReady, scoreModCoord);
                     Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(softmaxReady);
                 }
                 if (kvSIdx >= preLaunchStackNum) {
@@ -669,10 +712,11 @@ private:
     Arch::CrossCoreFlag pvReady{PV_READY_ID};
 };
 
-template <class Dtype>
+template <class Dtype, class ScoreMod = Epilogue::FAScoreModNone>
 CATLASS_GLOBAL void FAInferTla(
-    uint64_t hardwareSyncAddr, GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR mask, GM_ADDR blockTables, GM_ADDR o,
-    GM_ADDR actualQseqlen, GM_ADDR actualKvseqlen, GM_ADDR s, GM_ADDR p, GM_ADDR oTemp, GM_ADDR oUpdate, GM_ADDR tiling)
+    uint64_t hardwareSyncAddr, GM_ADDR q, GM_ADDR k, GM_ADDR v, GM_ADDR mask, GM_ADDR scoreModData,
+    GM_ADDR blockTables, GM_ADDR o, GM_ADDR actualQseqlen, GM_ADDR actualKvseqlen, GM_ADDR s, GM_ADDR p,
+    GM_ADDR oTemp, GM_ADDR oUpdate, GM_ADDR tiling)
 {
     AscendC::SetSyncBaseAddr(hardwareSyncAddr);
 
@@ -702,7 +746,7 @@ CATLASS_GLOBAL void FAInferTla(
         DispatchPolicyQKTail, L1TileShape, L0TileShape, ElementQ, ElementK, ElementS, void, TileCopyQK>;
 
     // Epilogue Block模块，实现Flash Attention Infer中当前S基块的softmax
-    using DispatchPolicyOnlineSoftmax = Epilogue::EpilogueAtlasA2OnlineSoftmax;
+    using DispatchPolicyOnlineSoftmax = Epilogue::EpilogueAtlasA2OnlineSoftmax<ScoreMod>;
     using PType = Gemm::GemmType<ElementP, LayoutP>;
     using SType = Gemm::GemmType<ElementS, LayoutS>;
     using maskType = Gemm::GemmType<ElementMask, LayoutMask>;
@@ -729,7 +773,8 @@ CATLASS_GLOBAL void FAInferTla(
     // Kernel level
     using FAInferKernelTla = FAInferKernelTla<
         BlockMmadQK, BlockMmadPV, BlockMmadQKTail, BlockMmadPVTail, EpilogueOnlineSoftmax, EpilogueRescaleO, true>;
-    FAIKernelParams params{q, k, v, mask, blockTables, actualQseqlen, actualKvseqlen, o, s, p, oTemp, oUpdate, tiling};
+    FAIKernelParams params{
+        q, k, v, mask, scoreModData, blockTables, actualQseqlen, actualKvseqlen, o, s, p, oTemp, oUpdate, tiling};
 
     // call kernel
     FAInferKernelTla flashAttnInfer;
@@ -14,6 +14,8 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
+#include <queue>
 #include <string>
 #include <vector>
 
@@ -47,12 +49,16 @@ const int32_t NUM128 = 128;
 const int32_t NUM256 = 256;
 const int32_t NUM512 = 512;
 const int32_t WORKSPACE_BLOCK_SIZE_DB = 131072;
+// Per-task overhead (q load, o write back) counted as this many extra kv positions
+const int64_t TASK_FIXED_KV_COST = 128;
 
 enum class MaskType
 {
     NO_MASK = 0,
     MASK_SPEC = 1,
-    MASK_CAUSUAL = 2
+    MASK_CAUSUAL = 2,
+    MASK_SLIDING_WINDOW = 3,
+    MASK_CHUNKED_LOCAL = 4
 };
 
 struct FAInfo {
@@ -67,6 +73,9 @@ struct FAInfo {
     int64_t* kvSeqlenList{nullptr};
     int64_t* qSeqlen{nullptr};
     MaskType maskType = MaskType::MASK_SPEC;
+    int32_t windowSize = 0;
+    float softcap = 0.0;
+    uint32_t relBiasLen = 0;
 };
 
 void FillBasicTilingData(const FAInfo& faInfo, FATilingData& faTilingData, int64_t maxKvSeqlen)
@@ -82,7 +91,10 @@ void FillBasicTilingData(const FAInfo& faInfo, FATilingData& faTilingData, int64
     faTilingData.maxKvSeqlen = static_cast<uint32_t>(maxKvSeqlen);
     faTilingData.maxNumBlocksPerBatch = maxNumBlocksPerBatch;
     faTilingData.maskType = static_cast<uint32_t>(faInfo.maskType);
+    faTilingData.windowSize = static_cast<uint32_t>(faInfo.windowSize);
     faTilingData.scaleValue = scaleValue;
+    faTilingData.softcap = faInfo.softcap;
+    faTilingData.relBiasLen = faInfo.relBiasLen;
 }
 
 uint32_t GetQNBlockTile(int64_t qSeqlen, uint32_t groupSize)
@@ -125,6 +137,155 @@ void FillSplitCoreTilingData(const FAInfo& faInfo, FATilingData& faTilingData)
     faTilingData.totalTaskNum = totalTaskNum;
 }
 
+struct TaskInfo {
+    uint32_t batchIdx = 0;
+    uint32_t qSBlockIdx = 0;
+    uint32_t qNBlockIdx = 0;
+    int64_t cost = 0;
+};
+
+// Number of kv positions a qS block visits, mirroring the kv loop bounds in the kernel
+int64_t GetTaskKvS(const FAInfo& faInfo, int64_t qSeqlen, int64_t kvSeqlen, int64_t qSEnd, int64_t qSBlockSize)
+{
+    if (faInfo.maskType == MaskType::NO_MASK) {
+        return kvSeqlen;
+    }
+    int64_t noSkipKvS = std::min(kvSeqlen, qSEnd + kvSeqlen - qSeqlen);
+    int64_t noMaskKvS = noSkipKvS - qSBlockSize;
+    int64_t windowStartKvS = 0;
+    if (faInfo.maskType == MaskType::MASK_SLIDING_WINDOW) {
+        windowStartKvS = noMaskKvS - faInfo.windowSize;
+    } else if (faInfo.maskType == MaskType::MASK_CHUNKED_LOCAL) {
+        windowStartKvS = noMaskKvS / faInfo.windowSize * faInfo.windowSize;
+    }
+    int64_t kvSkipS = (windowStartKvS > 0) ? windowStartKvS / faInfo.blockSize * faInfo.blockSize : 0;
+    return noSkipKvS - kvSkipS;
+}
+
+// Flatten every (sequence, head block, qS block) unit of the packed batch into one list and
+// hand it out with longest-processing-time-first, so that short and long sequences mixed in
+// one batch do not leave cores idle at the tail. The cost of a unit is its row count times
+// the kv positions it visits; the causal diagonal tile is counted twice as it also loads the mask.
+void FillBalancedTaskList(
+    const FAInfo& faInfo, uint32_t blockDim, std::vector<uint32_t>& coreTaskStart, std::vector<uint32_t>& taskList)
+{
+    uint32_t groupSize = faInfo.numHeads / faInfo.kvHeads;
+    std::vector<TaskInfo> tasks;
+    for (int32_t batchIdx = 0; batchIdx < faInfo.batch; batchIdx++) {
+        int64_t qSeqlen = *(faInfo.qSeqlenList + batchIdx);
+        int64_t kvSeqlen = *(faInfo.kvSeqlenList + batchIdx);
+        uint32_t curQNBlockTile = GetQNBlockTile(qSeqlen, groupSize);
+        uint32_t qNBlockNumPerGroup = (groupSize + curQNBlockTile - 1) / curQNBlockTile;
+        uint32_t curQNBlockNum = qNBlockNumPerGroup * faInfo.kvHeads;
+        int64_t curQSBlockTile = GetQSBlockTile(kvSeqlen);
+        uint32_t curQSBlockNum = (qSeqlen + curQSBlockTile - 1) / curQSBlockTile;
+        for (uint32_t qSBlockIdx = 0; qSBlockIdx < curQSBlockNum; qSBlockIdx++) {
+            int64_t qSBlockSize = std::min(curQSBlockTile, qSeqlen - qSBlockIdx * curQSBlockTile);
+            int64_t taskKvS = GetTaskKvS(
+                faInfo, qSeqlen, kvSeqlen, qSBlockIdx * curQSBlockTile + qSBlockSize, qSBlockSize);
+            if (faInfo.maskType != MaskType::NO_MASK) {
+                taskKvS += qSBlockSize;
+            }
+            for (uint32_t qNBlockIdx = 0; qNBlockIdx < curQNBlockNum; qNBlockIdx++) {
+                uint32_t qNBlockIdxCurGroup = qNBlockIdx % qNBlockNumPerGroup;
+                uint32_t qNBlockSize = std::min(curQNBlockTile, groupSize - qNBlockIdxCurGroup * curQNBlockTile);
+                int64_t rowNumRound = (qSBlockSize * qNBlockSize + NUM16 - 1) / NUM16 * NUM16;
+                tasks.push_back({static_cast<uint32_t>(batchIdx), qSBlockIdx, qNBlockIdx,
+                                 rowNumRound * (taskKvS + TASK_FIXED_KV_COST)});
+            }
+        }
+    }
+
+    std::vector<uint32_t> order(tasks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&tasks](uint32_t a, uint32_t b) {
+        return tasks[a].cost > tasks[b].cost;
+    });
+    using CoreLoad = std::pair<int64_t, uint32_t>;
+    std::priority_queue<CoreLoad, std::vector<CoreLoad>, std::greater<CoreLoad>> coreLoads;
+    for (uint32_t coreIdx = 0; coreIdx < blockDim; coreIdx++) {
+        coreLoads.push({0, coreIdx});
+    }
+    std::vector<std::vector<uint32_t>> coreTasks(blockDim);
+    for (uint32_t taskIdx : order) {
+        CoreLoad minLoad = coreLoads.top();
+        coreLoads.pop();
+        coreTasks[minLoad.second].push_back(taskIdx);
+        coreLoads.push({minLoad.first + tasks[taskIdx].cost, minLoad.second});
+    }
+
+    coreTaskStart.assign(blockDim + 1, 0);
+    taskList.clear();
+    for (uint32_t coreIdx = 0; coreIdx < blockDim; coreIdx++) {
+        // keep the tasks of one core in packed order so that consecutive tasks share the batch
+        std::sort(coreTasks[coreIdx].begin(), coreTasks[coreIdx].end());
+        for (uint32_t taskIdx : coreTasks[coreIdx]) {
+            taskList.push_back(tasks[taskIdx].batchIdx);
+            taskList.push_back(tasks[taskIdx].qSBlockIdx);
+            taskList.push_back(tasks[taskIdx].qNBlockIdx);
+        }
+        coreTaskStart[coreIdx + 1] = coreTaskStart[coreIdx] + coreTasks[coreIdx].size();
+    }
+}
+
+void FillTilingBuffer(
+    const FAInfo& faInfo, uint32_t blockDim, FATilingData& faTilingData, std::vector<uint8_t>& tilingBuffer)
+{
+    // cu_seqlens of the packed (THD) layout: tokens of all sequences are stored back to back without padding
+    std::vector<int64_t> cuSeqlenQ(faInfo.batch + 1, 0);
+    std::vector<int64_t> cuSeqlenKv(faInfo.batch + 1, 0);
+    for (int32_t batchIdx = 0; batchIdx < faInfo.batch; batchIdx++) {
+        cuSeqlenQ[batchIdx + 1] = cuSeqlenQ[batchIdx] + *(faInfo.qSeqlenList + batchIdx);
+        cuSeqlenKv[batchIdx + 1] = cuSeqlenKv[batchIdx] + *(faInfo.kvSeqlenList + batchIdx);
+    }
+    std::vector<uint32_t> coreTaskStart;
+    std::vector<uint32_t> taskList;
+    FillBalancedTaskList(faInfo, blockDim, coreTaskStart, taskList);
+
+    uint32_t seqTableSize = cuSeqlenQ.size() * sizeof(int64_t);
+    faTilingData.cuSeqlenQOffset = (sizeof(FATilingData) + NUM7) / NUM8 * NUM8;
+    faTilingData.cuSeqlenKvOffset = faTilingData.cuSeqlenQOffset + seqTableSize;
+    faTilingData.coreTaskStartOffset = faTilingData.cuSeqlenKvOffset + seqTableSize;
+    faTilingData.taskListOffset = faTilingData.coreTaskStartOffset + coreTaskStart.size() * sizeof(uint32_t);
+
+    tilingBuffer.assign(faTilingData.taskListOffset + taskList.size() * sizeof(uint32_t), 0);
+    std::memcpy(tilingBuffer.data(), &faTilingData, sizeof(FATilingData));
+    std::memcpy(tilingBuffer.data() + faTilingData.cuSeqlenQOffset, cuSeqlenQ.data(), seqTableSize);
+    std::memcpy(tilingBuffer.data() + faTilingData.cuSeqlenKvOffset, cuSeqlenKv.data(), seqTableSize);
+    std::memcpy(
+        tilingBuffer.data() + faTilingData.coreTaskStartOffset, coreTaskStart.data(),
+        coreTaskStart.size() * sizeof(uint32_t));
+    std::memcpy(
+        tilingBuffer.data() + faTilingData.taskListOffset, taskList.data(), taskList.size() * sizeof(uint32_t));
+}
+
+int32_t CheckWindowMask(const FAInfo& faInfo)
+{
+    if (faInfo.maskType == MaskType::MASK_SLIDING_WINDOW) {
+        // in-block window mask is generated within the first unmasked stack tile,
+        // so the window must not reach into the causal tail tile
+        if (faInfo.windowSize < NUM128) {
+            cerr << "[ERROR] sliding window mask requires windowSize >= 128." << endl;
+            return -1;
+        }
+    } else if (faInfo.maskType == MaskType::MASK_CHUNKED_LOCAL) {
+        // every qS block must lie within a single chunk, so the chunk start is the only kv bound
+        if (faInfo.windowSize <= 0 || faInfo.windowSize % NUM128 != 0) {
+            cerr << "[ERROR] chunked local mask requires windowSize to be a positive multiple of 128." << endl;
+            return -1;
+        }
+        for (int32_t batchIdx = 0; batchIdx < faInfo.batch; batchIdx++) {
+            int64_t qSeqlen = *(faInfo.qSeqlenList + batchIdx);
+            int64_t kvSeqlen = *(faInfo.kvSeqlenList + batchIdx);
+            if (qSeqlen != 1 && (kvSeqlen - qSeqlen) % NUM128 != 0) {
+                cerr << "[ERROR] chunked local mask requires (kvSeqlen - qSeqlen) % 128 == 0 for prefill." << endl;
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
 void FillWorkSpaceTilingData(uint32_t blockDim, FATilingData& faTilingData)
 {
     uint64_t mm1OutSize = blockDim * WORKSPACE_BLOCK_SIZE_DB * NUM4 * NUM3;
@@ -139,7 +300,8 @@ void FillWorkSpaceTilingData(uint32_t blockDim, FATilingData& faTilingData)
     faTilingData.workSpaceSize = workSpaceSize;
 }
 
-int32_t GetFATilingParam(const FAInfo& faInfo, uint32_t blockDim, FATilingData& faTilingData)
+int32_t GetFATilingParam(
+    const FAInfo& faInfo, uint32_t blockDim, FATilingData& faTilingData, std::vector<uint8_t>& tilingBuffer)
 {
     if (faInfo.qSeqlenList == nullptr || faInfo.kvSeqlenList == nullptr) {
         cerr << "[ERROR] pointer tilingData or seq is nullptr." << endl;
@@ -149,6 +311,9 @@ int32_t GetFATilingParam(const FAInfo& faInfo, uint32_t blockDim, FATilingData&
         cerr << "[ERROR] blockSize != 128 is not supported." << endl;
         return -1;
     }
+    if (CheckWindowMask(faInfo) != 0) {
+        return -1;
+    }
     int64_t maxKvSeqlen = 0;
     for (int32_t batchIdx = 0; batchIdx < faInfo.batch; batchIdx++) {
         int64_t qSeqlen = *(faInfo.qSeqlenList + batchIdx);
@@ -158,6 +323,7 @@ int32_t GetFATilingParam(const FAInfo& faInfo, uint32_t blockDim, FATilingData&
     FillBasicTilingData(faInfo, faTilingData, maxKvSeqlen);
     FillSplitCoreTilingData(faInfo, faTilingData);
     FillWorkSpaceTilingData(blockDim, faTilingData);
+    FillTilingBuffer(faInfo, blockDim, faTilingData, tilingBuffer);
     return 0;
 }
 } // namespace FAInferTiling
@@ -41,6 +41,26 @@ def gen_seqlen(max_q_seqlen: int, max_kv_seqlen: int, is_varied_len: int, batch:
     return q_seqlen_list, kv_seqlen_list
 
 
+def gen_alibi_slopes(num_heads: int):
+    # geometric slopes 2^(-8 / num_heads * (h + 1)) as in the ALiBi paper
+    return np.power(2.0, -8.0 / num_heads * np.arange(1, num_heads + 1)).astype(np.float32)
+
+
+def gen_rel_pos_bias(num_heads: int, max_kv_seqlen: int, num_buckets: int = 32, max_distance: int = 128):
+    # T5-style bidirectional buckets, expanded to a dense table indexed by kv_pos - q_pos + max_kv_seqlen - 1
+    rel = np.arange(-(max_kv_seqlen - 1), max_kv_seqlen)
+    half_buckets = num_buckets // 2
+    exact = half_buckets // 2
+    dist = np.abs(rel)
+    log_bucket = exact + (
+        np.log(np.maximum(dist, 1) / exact) / np.log(max_distance / exact) * (half_buckets - exact)
+    ).astype(np.int64)
+    bucket = np.where(dist < exact, dist, np.minimum(log_bucket, half_buckets - 1))
+    bucket = bucket + (rel > 0) * half_buckets
+    bucket_bias = np.random.uniform(-1.0, 1.0, size=(num_heads, num_buckets)).astype(np.float32)
+    return bucket_bias[:, bucket]
+
+
 class TestFlashAttentionInfer:
     @dataclass
     class AttentionInputs:
@@ -71,6 +91,12 @@ class TestFlashAttentionInfer:
         inner_prec: int
         max_q_seqlen: int
         max_kv_seqlen: int
+        window_size: int = 0
+        # 0: none, 1: alibi, 2: softcap, 3: relative position bias
+        score_mod: int = 0
+        softcap: float = 0.0
+        # alibi slopes (num_heads,) or relative position bias table (num_heads, 2 * max_kv_seqlen - 1)
+        score_mod_data: any = None
 
     @classmethod
     def check_attr(
@@ -141,6 +167,22 @@ class TestFlashAttentionInfer:
                 result = result + result_split
         return result
 
+    def apply_score_mod(self, sim, q_offset, kv_start):
+        # sim: (num_heads, q_seqlen, kv_len), q is right-aligned to kv as in the causal mask
+        if gen_data_params.score_mod == 0:
+            return sim
+        if gen_data_params.score_mod == 2:
+            softcap = gen_data_params.softcap
+            return softcap * np.tanh(sim / softcap)
+        q_pos = q_offset + np.arange(sim.shape[1])[:, None]
+        kv_pos = kv_start + np.arange(sim.shape[2])[None, :]
+        rel = kv_pos - q_pos
+        if gen_data_params.score_mod == 1:
+            slopes = gen_data_params.score_mod_data[:, None, None]
+            return sim + slopes * rel[None, :, :].astype(np.float32)
+        center = gen_data_params.score_mod_data.shape[1] // 2
+        return sim + gen_data_params.score_mod_data[:, center + rel]
+
     def ref_flash_attention(
         self, query, key, value, scale, mask, attention_inputs: AttentionInputs
     ):
@@ -172,6 +214,9 @@ class TestFlashAttentionInfer:
             )
             qk_result = qk_result * scale
             qk_result_high = qk_result_high * scale
+            q_offset = context_len - query.shape[1]
+            qk_result = self.apply_score_mod(qk_result, q_offset, kv_start)
+            qk_result_high = self.apply_score_mod(qk_result_high, q_offset, kv_start)
 
             if mask is not None:
                 qk_result += sub_mask
@@ -236,6 +281,11 @@ class TestFlashAttentionInfer:
         )  # (head_num, q_seqlen, k_seqlen)
         sim_low_prec = sim_high.astype(np.float16) * np.float16(scale)
         sim_high = sim_high * scale
+        q_offset = key.shape[2] - query.shape[1]
+        sim_high = self.apply_score_mod(sim_high, q_offset, 0)
+        sim_low_prec = self.apply_score_mod(
+            sim_low_prec.astype(np.float32), q_offset, 0
+        ).astype(np.float16)
         pre_mask_factor = -10000
         if gen_data_params.dtype is ml_dtypes.bfloat16:
             pre_mask_factor = -3e38
@@ -330,7 +380,7 @@ class TestFlashAttentionInfer:
                     keys = attention_inputs.key_cache[i, :, :, :]
                     values = attention_inputs.value_cache[i, :, :, :]
             scale = 1.0 / (head_size_qk**0.5)
-            if attention_inputs.mask_type == 1:
+            if attention_inputs.mask_type in (1, 3, 4):
                 mask = attention_inputs.global_mask[
                     cu_seqlen : (cu_seqlen + q_seqlen), :
                 ]
@@ -472,6 +522,27 @@ class TestFlashAttentionInfer:
                 ] = tri
                 pre_qseqlen += qseqlen
             mask = mask.astype(gen_data_params.dtype)
+        elif gen_data_params.mask_type in (3, 4):
+            # 3: sliding window, query at kv position q sees [q - window_size, q]
+            # 4: chunked local, query at kv position q sees [q // window_size * window_size, q]
+            window_size = gen_data_params.window_size
+            mask = np.zeros(shape=(num_tokens, max_k_seqlen)).astype(
+                gen_data_params.dtype
+            )
+            pre_qseqlen = 0
+            for i in range(batch_size):
+                qseqlen = gen_data_params.q_seqlen_list[i]
+                kseqlen = gen_data_params.k_seqlen_list[i]
+                q_pos = np.arange(kseqlen - qseqlen, kseqlen)[:, None]
+                kv_pos = np.arange(kseqlen)[None, :]
+                if gen_data_params.mask_type == 3:
+                    window_start = q_pos - window_size
+                else:
+                    window_start = q_pos // window_size * window_size
+                masked = (kv_pos > q_pos) | (kv_pos < window_start)
+                mask[pre_qseqlen : (pre_qseqlen + qseqlen), :kseqlen] = masked
+                pre_qseqlen += qseqlen
+            mask = mask.astype(gen_data_params.dtype)
         elif gen_data_params.mask_type == 2:
             mask = np.ones(shape=(max_q_seqlen, max_k_seqlen)).astype(np.float16)
             mask = np.triu(mask, 1)
@@ -545,11 +616,15 @@ class TestFlashAttentionInfer:
         np.array(gen_data_params.k_seqlen_list).astype(np.int64).tofile(
             os.path.join(WORKSPACE, "data", "kv_seqlen.bin")
         )
-        if gen_data_params.mask_type == 1:
+        if gen_data_params.mask_type != 0:
             actual_input_mask_triu = np.triu(np.ones((1024, 1024)), 1).astype(
                 gen_data_params.dtype
             )
             actual_input_mask_triu.tofile(os.path.join(WORKSPACE, "data", "mask.bin"))
+        if gen_data_params.score_mod in (1, 3):
+            gen_data_params.score_mod_data.astype(np.float32).tofile(
+                os.path.join(WORKSPACE, "data", "score_mod.bin")
+            )
         print(gen_data_params.q_seqlen_list)
         print(gen_data_params.k_seqlen_list)
         golden_output.astype(np.float32).tofile(
@@ -592,14 +667,28 @@ if __name__ == "__main__":
         sys.exit()
 
     kv_dtype = int(sys.argv[10])
+    window_size = int(sys.argv[11]) if len(sys.argv) > 11 else 0
+    if mask_type in (3, 4) and window_size <= 0:
+        logging.error("[ERROR] mask_type 3/4 requires a positive window_size")
+        sys.exit()
+    score_mod = int(sys.argv[12]) if len(sys.argv) > 12 else 0
+    softcap = float(sys.argv[13]) if len(sys.argv) > 13 else 0.0
+    if score_mod == 2 and softcap <= 0:
+        logging.error("[ERROR] score_mod 2 requires a positive softcap")
+        sys.exit()
+    score_mod_data = None
+    if score_mod == 1:
+        score_mod_data = gen_alibi_slopes(num_head)
+    elif score_mod == 3:
+        score_mod_data = gen_rel_pos_bias(num_head, kv_seqlen)
     layout_dtype = 1
     inner_prec = 0
     q_seqlen_list, kv_seqlen_list = gen_seqlen(
         q_seqlen, kv_seqlen, is_varied_len, batch
     )
 
-    max_kv_seqlen = max(kv_seqlen_list)
-    num_blocks = batch * ((max_kv_seqlen + block_size - 1) // block_size)
+    # block tables are strided by the command line kv_seqlen, matching maxNumBlocksPerBatch in the tiling
+    num_blocks = batch * ((kv_seqlen + block_size - 1) // block_size)
     testObj = TestFlashAttentionInfer()
     gen_data_params = testObj.GenDataParams(
         q_seqlen_list,
@@ -616,5 +705,9 @@ if __name__ == "__main__":
         inner_prec,
         q_seqlen,
         kv_seqlen,
+        window_size,
+        score_mod,
+        softcap,
+        score_mod_data,
     )
     testObj.calc_data(gen_data_params)
@@ -53,6 +53,12 @@ constexpr uint32_t FLOAT_VECTOR_SIZE = 64;
 
 constexpr uint32_t UNIT_BLOCK_STACK_NUM = 4;
 
+constexpr uint32_t MASK_TYPE_SLIDING_WINDOW = 3;
+constexpr uint32_t MASK_TYPE_CHUNKED_LOCAL = 4;
+
+// One task entry of the balanced task list: {batchIdx, qSBlockIdx, qNBlockIdx}
+constexpr uint32_t TASK_ENTRY_SIZE = 3;
+
 template <typename T>
 CATLASS_DEVICE T AlignUp(T a, T b)
 {
@@ -93,6 +99,17 @@ uint32_t GetQSBlockTile(uint32_t kvSeqlen)
     return qSBlockTile;
 }
 
+// The first kv position visible to the start token (at kv position qStartKvS) of a qS block.
+// Sliding window sees [q - windowSize, q], chunked local sees [q / windowSize * windowSize, q].
+CATLASS_DEVICE
+int64_t GetWindowStartKvS(uint32_t maskType, uint32_t qStartKvS, uint32_t windowSize)
+{
+    if (maskType == MASK_TYPE_SLIDING_WINDOW) {
+        return static_cast<int64_t>(qStartKvS) - static_cast<int64_t>(windowSize);
+    }
+    return static_cast<int64_t>(qStartKvS / windowSize * windowSize);
+}
+
 struct FATilingData {
     uint32_t numHeads = 0;
     uint32_t embeddingSize = 0;
@@ -105,12 +122,23 @@ struct FATilingData {
     uint32_t firstBatchTaskNum = 0;
     uint32_t totalTaskNum = 0;
     uint32_t maskType = 0;
+    uint32_t windowSize = 0;
+    // Byte offsets (from the start of the tiling buffer) of the tables appended after FATilingData:
+    // cu_seqlens of q and kv (int64, batch + 1 each), per-core task start (uint32, coreNum + 1)
+    // and the balanced task list (uint32, TASK_ENTRY_SIZE per task)
+    uint32_t cuSeqlenQOffset = 0;
+    uint32_t cuSeqlenKvOffset = 0;
+    uint32_t coreTaskStartOffset = 0;
+    uint32_t taskListOffset = 0;
     uint64_t mm1OutSize = 0;
     uint64_t smOnlineOutSize = 0;
     uint64_t mm2OutSize = 0;
     uint64_t UpdateSize = 0;
     uint64_t workSpaceSize = 0;
     float scaleValue = 0.0;
+    // Score mod parameters: softcap value, and the per-head length of the relative position bias table
+    float softcap = 0.0;
+    uint32_t relBiasLen = 0;
 };
 
 struct FAIKernelParams {
@@ -118,6 +146,7 @@ struct FAIKernelParams {
     GM_ADDR k;
     GM_ADDR v;
     GM_ADDR mask;
+    GM_ADDR scoreModData;
     GM_ADDR blockTables;
     GM_ADDR actualQseqlen;
     GM_ADDR actualKvseqlen;
@@ -133,12 +162,14 @@ struct FAIKernelParams {
     {}
     CATLASS_DEVICE
     FAIKernelParams(
-        GM_ADDR q_, GM_ADDR k_, GM_ADDR v_, GM_ADDR mask_, GM_ADDR blockTables_, GM_ADDR actualQseqlen_,
-        GM_ADDR actualKvseqlen_, GM_ADDR o_, GM_ADDR s_, GM_ADDR p_, GM_ADDR oTemp_, GM_ADDR oUpdate_, GM_ADDR tiling_)
+        GM_ADDR q_, GM_ADDR k_, GM_ADDR v_, GM_ADDR mask_, GM_ADDR scoreModData_, GM_ADDR blockTables_,
+        GM_ADDR actualQseqlen_, GM_ADDR actualKvseqlen_, GM_ADDR o_, GM_ADDR s_, GM_ADDR p_, GM_ADDR oTemp_,
+        GM_ADDR oUpdate_, GM_ADDR tiling_)
         : q(q_),
           k(k_),
           v(v_),
           mask(mask_),
+          scoreModData(scoreModData_),
           blockTables(blockTables_),
           actualQseqlen(actualQseqlen_),
           actualKvseqlen(actualKvseqlen_),
@@ -28,7 +28,7 @@ struct Options {
     static constexpr auto HELPER =
         "Usage: fai batch qSeqlen kvSeqlen numHeads kvHeads embeddingSize isVariedLen maskType cacheMode [--dtype "
         "DTYPE "
-        "--datapath DATA_PATH --device DEVICE_ID]\n";
+        "--datapath DATA_PATH --device DEVICE_ID --window WINDOW_SIZE]\n";
     static constexpr auto MIN_ARGS = 7;
 
     // Define default value.
@@ -41,6 +41,7 @@ struct Options {
     uint32_t isVariedLen{0};
     uint32_t maskType{0};
     uint32_t cacheMode{0};
+    uint32_t windowSize{0};
     uint32_t deviceId{0};
     uint32_t blockSize{128};
     string dataType = "half";
@@ -76,6 +77,8 @@ struct Options {
                 deviceId = atoi(argv[argIndex++]);
             } else if (flag == "--dtype") {
                 dataType = string(argv[argIndex++]);
+            } else if (flag == "--window") {
+                windowSize = atoi(argv[argIndex++]);
             } else {
                 printf(HELPER);
                 return -1;
@@ -133,6 +136,10 @@ void Run(const Options& options)
         cerr << "[ERROR] isVariedLen must be '0'." << endl;
         return;
     }
+    if (maskType == 3 && options.windowSize == 0) {
+        cerr << "[ERROR] maskType 3 (sliding window) requires '--window WINDOW_SIZE'." << endl;
+        return;
+    }
     if (embeddingSize > 128) {
         cerr << "[ERROR] embeddingSize is only supported up to 128. The current template only implements BlockMmadPV "
                 "output to UB. "
@@ -278,6 +285,11 @@ void Run(const Options& options)
     faInfo.scaleValue = static_cast<float>(1.0 / std::sqrt(1.0 * faInfo.headSize));
     faInfo.blockSize = blockSize;
     faInfo.maxBlockNumPerBatch = (kvSeqlen + blockSize - 1) / blockSize;
+    if (maskType == 3) {
+        // 滑动窗口，窗口外的kv基本块在循环边界中跳过，窗口内仍由mask处理
+        faInfo.maskType = FAInferTiling::SPARSE_MODE_BAND;
+        faInfo.windowSize = options.windowSize;
+    }
 
     FATilingData faTilingData;
     FAInferTiling::GetFATilingParam(faInfo, blockDim, faTilingData);
@@ -99,6 +99,8 @@ public:
         this->constInfo.embed = inputParamsRegbase.embed;
         this->constInfo.attenMaskQSeqlen = inputParamsRegbase.attenMaskQSeqlen;
         this->constInfo.attenMaskKvSeqlen = inputParamsRegbase.attenMaskKvSeqlen;
+        this->constInfo.attenMaskCompressMode = inputParamsRegbase.attenMaskCompressMode;
+        this->constInfo.windowSize = inputParamsRegbase.windowSize;
 
         this->constInfo.headNumRatio = inputParamsRegbase.headNumRatio;
         this->constInfo.actualSeqLengthsSize = inputParamsRegbase.actualSeqLengthsSize;
@@ -24,6 +24,7 @@ using namespace AscendC;
 constexpr uint32_t CV_RATIO = 2;
 constexpr uint32_t NUM2 = 2;
 constexpr uint32_t KERNEL_TASK_NUM = 3;
+constexpr uint8_t ATTEN_MASK_COMPRESS_MODE_BAND = 4; // 与tiling侧SPARSE_MODE_BAND一致
 
 template <typename T>
 CATLASS_DEVICE T Min(T a, T b)
@@ -31,6 +32,12 @@ CATLASS_DEVICE T Min(T a, T b)
     return (a > b) ? b : a;
 }
 
+template <typename T>
+CATLASS_DEVICE T Max(T a, T b)
+{
+    return (a > b) ? a : b;
+}
+
 struct FAIKernelParams {
     GM_ADDR q;
     GM_ADDR k;
@@ -155,6 +162,8 @@ struct ConstInfo {
     /* special params */
     uint32_t attenMaskQSeqlen;
     uint32_t attenMaskKvSeqlen;
+    uint8_t attenMaskCompressMode;
+    int64_t windowSize;
     /* core params */
     volatile int64_t multiCoreInnerOffset; /* 二次赋值的变量需要volatile修饰 */
     volatile int64_t multiCoreInnerLimit;  /* 二次赋值的变量需要volatile修饰 */
@@ -227,6 +236,17 @@ CATLASS_DEVICE void ComputeKvSeqLoopInfo(RunParamStr& runParam, const ConstInfo&
     runParam.kvSeqAxisLineStartIdx = 0;
     runParam.kvSeqAxisLineEndIdx = runParam.actualKvSeqSize;
     runParam.kvSeqLoopStartIdx = 0;
+    if (constInfo.attenMaskCompressMode == ATTEN_MASK_COMPRESS_MODE_BAND) {
+        // 滑动窗口：只遍历与当前qSeq基本块窗口[q - windowSize, q]相交的kvSeq基本块
+        int64_t diffS = runParam.actualKvSeqSize - runParam.actualQSeqSize;
+        int64_t qSeqStart = runParam.qSeqOuterAxisIdx * static_cast<int64_t>(constInfo.qSeqlenBase);
+        int64_t kvSeqStart = Max(qSeqStart + diffS - constInfo.windowSize, static_cast<int64_t>(0));
+        int64_t qSeqEnd = qSeqStart + static_cast<int64_t>(runParam.qSeqRealSize);
+        int64_t kvSeqEnd = Min(qSeqEnd + diffS, runParam.actualKvSeqSize);
+        runParam.kvSeqLoopStartIdx = kvSeqStart / kvSeqlenBase;
+        runParam.kvSeqAxisLineStartIdx = static_cast<int64_t>(runParam.kvSeqLoopStartIdx) * kvSeqlenBase;
+        runParam.kvSeqAxisLineEndIdx = kvSeqEnd;
+    }
     runParam.kvSeqLoopEndIdx = (runParam.kvSeqAxisLineEndIdx + kvSeqlenBase - 1) / kvSeqlenBase;
 }
 
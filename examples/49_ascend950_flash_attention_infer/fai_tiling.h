@@ -27,6 +27,7 @@ constexpr int64_t SPARSE_MODE_INT_MAX = 2147483647;
 constexpr int32_t SPARSE_MODE_NO_MASK = 0;
 constexpr int32_t SPARSE_MODE_LEFT_UP = 1;
 constexpr int32_t SPARSE_MODE_RIGHT_DOWN = 2;
+constexpr int32_t SPARSE_MODE_BAND = 4;
 
 constexpr int32_t BLOCK_BASE_SIZE = 128;
 constexpr uint32_t CV_RATIO = 2;
@@ -45,6 +46,7 @@ struct FAInfo {
     uint32_t maxBlockNumPerBatch = 0;
 
     uint32_t maskType = SPARSE_MODE_NO_MASK;
+    int64_t windowSize = 0;
     float scaleValue = 1.0;
     int64_t* actualSeqLengths{nullptr};
     int64_t* actualSeqLengthsKV{nullptr};
@@ -83,6 +85,10 @@ inline void GetPreNextTokensLeftUp(
     if (baseParams.attenMaskCompressMode == SPARSE_MODE_RIGHT_DOWN) {
         preTokensLeftUp = SPARSE_MODE_INT_MAX;
         nextTokensLeftUp = actualSeqLengthKV - actualSeqLength;
+    } else if (baseParams.attenMaskCompressMode == SPARSE_MODE_BAND) {
+        // 右下对齐的滑动窗口，换算到左上对齐
+        preTokensLeftUp = baseParams.windowSize - (actualSeqLengthKV - actualSeqLength);
+        nextTokensLeftUp = actualSeqLengthKV - actualSeqLength;
     } else {
         preTokensLeftUp = preTokens;
         nextTokensLeftUp = nextTokens;
@@ -270,6 +276,7 @@ inline void FillInputParams(const FAInfo& faInfo, FATilingData& tilingData)
     inputParams.scaleValue = faInfo.scaleValue;
 
     inputParams.attenMaskCompressMode = faInfo.maskType;
+    inputParams.windowSize = faInfo.windowSize;
     inputParams.headNumRatio = static_cast<uint32_t>(faInfo.numOfHeads / faInfo.numOfKVHeads);
     inputParams.blockSize = faInfo.blockSize;
     inputParams.blockTableDim2 = faInfo.maxBlockNumPerBatch;
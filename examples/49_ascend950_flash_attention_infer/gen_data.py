@@ -65,6 +65,7 @@ class TestFlashAttentionInfer:
         mask_type: int
         dtype: any
         kv_dtype: int
+        window_size: int = 0
 
     @classmethod
     def check_attr(
@@ -291,6 +292,14 @@ class TestFlashAttentionInfer:
                     mask[pre_qseqlen : (pre_qseqlen + qseqlen), 0:kseqlen] = tri[
                         0:qseqlen, 0:kseqlen
                     ]  # left up
+                elif gen_data_params.mask_type == 3:
+                    # sliding window, query at kv position q sees [q - window_size, q]
+                    q_pos = np.arange(kseqlen - qseqlen, kseqlen)[:, None]
+                    kv_pos = np.arange(kseqlen)[None, :]
+                    band = (kv_pos > q_pos) | (
+                        kv_pos < q_pos - gen_data_params.window_size
+                    )
+                    mask[pre_qseqlen : (pre_qseqlen + qseqlen), 0:kseqlen] = band
                 else:
                     mask[
                         pre_qseqlen : (pre_qseqlen + qseqlen),
@@ -366,6 +375,10 @@ if __name__ == "__main__":
     mask_type = int(sys.argv[8])
     kv_dtype = int(sys.argv[9])
     str_dtype = str(sys.argv[10])
+    window_size = int(sys.argv[11]) if len(sys.argv) > 11 else 0
+    if mask_type == 3 and window_size <= 0:
+        logging.error("[ERROR] mask_type 3 requires a positive window_size")
+        sys.exit()
     if str_dtype == "half":
         dtype = np.float16
     elif str_dtype == "bf16":
@@ -393,5 +406,6 @@ if __name__ == "__main__":
         mask_type,
         dtype,
         kv_dtype,
+        window_size,
     )
     testObj.calc_data(gen_data_params)
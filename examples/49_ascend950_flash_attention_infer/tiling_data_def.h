@@ -24,7 +24,9 @@ public:
     int64_t kvSeqlen;
     int64_t embed;
     float scaleValue;
-    uint8_t attenMaskCompressMode; // SPARSE_MODE_NO_MASK: 0, SPARSE_MODE_LEFT_UP: 1, SPARSE_MODE_RIGHT_DOWN : 2
+    uint8_t attenMaskCompressMode; // SPARSE_MODE_NO_MASK: 0, SPARSE_MODE_LEFT_UP: 1, SPARSE_MODE_RIGHT_DOWN : 2,
+                                   // SPARSE_MODE_BAND: 4
+    int64_t windowSize;            // SPARSE_MODE_BAND: query at kv position q sees [q - windowSize, q]
 
     // PFA
     uint8_t isActualSeqLengthsNull;
@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/epilogue/block/block_epilogue.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemm/kernel/basic_matmul_tla_visitor.hpp"
+#include "catlass/epilogue/fusion/fusion.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+#include "tla/layout.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+using namespace tla;
+
+using Options = GemmOptions;
+
+static void Run(const Options& options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+
+    // Define element types and layout tags (TLA version)
+    using ElementA = float;
+    using ElementB = float;
+    using ElementC = float;
+
+    using LayoutTagA = layout::RowMajor;
+    using LayoutTagB = layout::RowMajor;
+    using LayoutTagC = layout::RowMajor;
+
+    // Create layouts for capacity calculation (using layout tag's MakeLayout)
+    LayoutTagA tagA = LayoutTagA::MakeLayout<ElementA>(m, k);
+    LayoutTagB tagB = LayoutTagB::MakeLayout<ElementB>(k, n);
+    LayoutTagC tagC = LayoutTagC::MakeLayout<ElementC>(m, n);
+
+    // Compute the length of each matrix and the size of each buffer
+    size_t lenA = tagA.Capacity();
+    size_t lenB = tagB.Capacity();
+    size_t lenD = tagC.Capacity();
+    size_t lenRowSum = n; // 1xN: sum of D along M
+    size_t lenColMax = m; // M values: max of D along N
+
+    size_t sizeA = lenA * sizeof(ElementA);
+    size_t sizeB = lenB * sizeof(ElementB);
+    size_t sizeD = lenD * sizeof(ElementC);
+    size_t sizeRowSum = lenRowSum * sizeof(ElementC);
+    size_t sizeColMax = lenColMax * sizeof(ElementC);
+
+    // Prepare input data A and B
+    std::vector<ElementA> hostA(lenA);
+    std::vector<ElementB> hostB(lenB);
+    golden::FillRandomData<ElementA>(hostA, -5.0f, 5.0f);
+    golden::FillRandomData<ElementB>(hostB, -5.0f, 5.0f);
+
+    // Allocate device memory and copy data from host to device
+    uint8_t* deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    // Allocate device memory for output D
+    uint8_t* deviceD{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceD), sizeD, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // 归约输出通过 GM 原子操作跨 tile / 跨核合并，需预先写入单位元：sum 为 0，max 为最小值
+    uint8_t* deviceRowSum{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceRowSum), sizeRowSum, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemset(deviceRowSum, sizeRowSum, 0, sizeRowSum));
+
+    std::vector<ElementC> hostColMaxInit(lenColMax, std::numeric_limits<ElementC>::lowest());
+    uint8_t* deviceColMax{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceColMax), sizeColMax, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(
+        aclrtMemcpy(deviceColMax, sizeColMax, hostColMaxInit.data(), sizeColMax, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    // Define ArchTag
+    using ArchTag = Arch::Ascend950;
+
+    // Block level, define BlockMmad
+    constexpr bool enableUnitFlag = true;
+    using MmadDispatchPolicy = Gemm::MmadPingpong<ArchTag, enableUnitFlag>;
+    using L1TileShape = Shape<Int<256>, Int<256>, Int<128>>;
+    using L0TileShape = Shape<Int<256>, Int<256>, Int<32>>;
+
+    // Create TLA layouts for kernel usage
+    auto layoutA = MakeLayout<ElementA, LayoutTagA>(m, k);
+    auto layoutB = MakeLayout<ElementB, LayoutTagB>(k, n);
+    auto layoutC = MakeLayout<ElementC, LayoutTagC>(m, n);
+    auto layoutRowSum = MakeLayout<ElementC, LayoutTagC>(1, n); // 1xN row vector
+    auto layoutColMax = MakeLayout<ElementC, LayoutTagC>(1, m); // M values stored contiguously
+
+    using TileCopy =
+        Gemm::Tile::PackedTileCopyTla<ArchTag, ElementA, LayoutTagA, ElementB, LayoutTagB, ElementC, LayoutTagC>;
+    using BlockMmad = Gemm::Block::BlockMmadTla<
+        MmadDispatchPolicy, L1TileShape, L0TileShape, ElementA, ElementB, ElementC, void, TileCopy>;
+
+    // 定义 EVG: D = C, rowSum = sum(C, dim=0), colMax = max(C, dim=1)
+    // C 是 workspace（A*B 的结果），两个归约节点均透传输入，最终由 AuxStore 写出 D
+
+    constexpr uint32_t evgUbNodes = 4;  // AccLoad + RowReduce + ColReduce（工作区 + 结果区）；Store 不占
+    constexpr uint32_t evgUbStages = 2; // epilogue 双缓冲
+    constexpr uint32_t computeLength = RoundDown(
+        ArchTag::UB_SIZE / evgUbNodes / evgUbStages / sizeof(ElementC),
+        BYTE_PER_C0); // 每槽元素上限，向下取 BYTE_PER_C0 整数倍
+
+    using LayoutC = decltype(layoutC);
+    using LayoutRowSum = decltype(layoutRowSum);
+    using LayoutColMax = decltype(layoutColMax);
+    using EVG = Epilogue::Fusion::TreeVisitor<
+        Epilogue::Fusion::VisitorAuxStore<ElementC, LayoutC>,
+        Epilogue::Fusion::TreeVisitor<
+            Epilogue::Fusion::VisitorRowReduce<Epilogue::Fusion::ReduceSum, ElementC, LayoutRowSum>,
+            Epilogue::Fusion::TreeVisitor<
+                Epilogue::Fusion::VisitorColReduce<Epilogue::Fusion::ReduceMax, ElementC, LayoutColMax>,
+                Epilogue::Fusion::VisitorAccLoad<ElementC> // 加载 C (workspace)
+                >>>;
+
+    // Block level, define BlockEpilogue with EVG
+    using BlockEpilogue =
+        Epilogue::Block::BlockEpilogue<Epilogue::EpilogueVisitor<>, ArchTag, Int<computeLength>, EVG, ElementC>;
+
+    // 准备 EVG Arguments - 使用 TLA layout 对象
+    typename EVG::Arguments evg_args{
+        {{{}, {deviceColMax, layoutColMax}}, // VisitorColReduce::Arguments (ptr_col, layout)
+         {deviceRowSum, layoutRowSum}},     // VisitorRowReduce::Arguments (ptr_row, layout)
+        {deviceD, layoutC}};
+
+    std::vector<ElementC> hostD(lenD);
+    std::vector<ElementC> hostRowSum(lenRowSum);
+    std::vector<ElementC> hostColMax(lenColMax);
+    if (m > n) {
+        // Define BlockScheduler
+        // Swizzle offset is 3 and direction is 0.
+        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+        // Kernel level (TLA version)
+        using MatmulKernel = Gemm::Kernel::BasicMatmulTlaVisitor<BlockMmad, BlockEpilogue, BlockScheduler>;
+        // Prepare params
+        typename MatmulKernel::Arguments arguments{
+            options.problemShape, deviceA, layoutA, deviceB, layoutB, nullptr, {}, nullptr, evg_args};
+        using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+        MatmulAdapter matmulOp;
+        size_t sizeWorkspace = matmulOp.GetWorkspaceSize(arguments);
+        uint8_t* deviceWorkspace{nullptr};
+        if (sizeWorkspace > 0) {
+            ACL_CHECK(
+                aclrtMalloc(reinterpret_cast<void**>(&deviceWorkspace), sizeWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+        }
+        matmulOp.Initialize(arguments, deviceWorkspace);
+        matmulOp(stream, aicCoreNum);
+        ACL_CHECK(aclrtSynchronizeStream(stream));
+        if (sizeWorkspace > 0) {
+            ACL_CHECK(aclrtFree(deviceWorkspace));
+        }
+    } else {
+        // Define BlockScheduler
+        // Swizzle offset is 3 and direction is 1.
+        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 1>;
+        // Kernel level (TLA version)
+        using MatmulKernel = Gemm::Kernel::BasicMatmulTlaVisitor<BlockMmad, BlockEpilogue, BlockScheduler>;
+        // Prepare params
+        typename MatmulKernel::Arguments arguments{
+            options.problemShape, deviceA, layoutA, deviceB, layoutB, nullptr, {}, nullptr, evg_args};
+        using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+        MatmulAdapter matmulOp;
+        size_t sizeWorkspace = matmulOp.GetWorkspaceSize(arguments);
+        uint8_t* deviceWorkspace{nullptr};
+        if (sizeWorkspace > 0) {
+            ACL_CHECK(
+                aclrtMalloc(reinterpret_cast<void**>(&deviceWorkspace), sizeWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+        }
+        matmulOp.Initialize(arguments, deviceWorkspace);
+        matmulOp(stream, aicCoreNum);
+        ACL_CHECK(aclrtSynchronizeStream(stream));
+        if (sizeWorkspace > 0) {
+            ACL_CHECK(aclrtFree(deviceWorkspace));
+        }
+    }
+
+    // Copy the results from device to host
+    ACL_CHECK(aclrtMemcpy(hostD.data(), sizeD, deviceD, sizeD, ACL_MEMCPY_DEVICE_TO_HOST));
+    ACL_CHECK(aclrtMemcpy(hostRowSum.data(), sizeRowSum, deviceRowSum, sizeRowSum, ACL_MEMCPY_DEVICE_TO_HOST));
+    ACL_CHECK(aclrtMemcpy(hostColMax.data(), sizeColMax, deviceColMax, sizeColMax, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    // Compute the golden result: D = A*B, rowSum[j] = sum_i D[i][j], colMax[i] = max_j D[i][j]
+    std::vector<float> hostGolden(lenD);
+    golden::ComputeMatmul(options.problemShape, hostA, tagA, hostB, tagB, hostGolden, tagC);
+    std::vector<float> hostGoldenRowSum(lenRowSum, 0.0f);
+    std::vector<float> hostGoldenColMax(lenColMax, std::numeric_limits<float>::lowest());
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            float value = hostGolden[static_cast<size_t>(i) * n + j];
+            hostGoldenRowSum[j] += value;
+            hostGoldenColMax[i] = std::max(hostGoldenColMax[i], value);
+        }
+    }
+
+    // Compare the result
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostD, hostGolden, k);
+    std::vector<uint64_t> errorIndicesRowSum = golden::CompareData(hostRowSum, hostGoldenRowSum, k * m);
+    std::vector<uint64_t> errorIndicesColMax = golden::CompareData(hostColMax, hostGoldenColMax, k);
+    if (errorIndices.empty() && errorIndicesRowSum.empty() && errorIndicesColMax.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size()
+                  << ", rowSum error count: " << errorIndicesRowSum.size()
+                  << ", colMax error count: " << errorIndicesColMax.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceD));
+    ACL_CHECK(aclrtFree(deviceRowSum));
+    ACL_CHECK(aclrtFree(deviceColMax));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/epilogue/block/block_epilogue.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_mul.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_one_blk.hpp"
+#include "catlass/epilogue/tile/tile_swizzle.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemm/kernel/quant_matmul_with_prologue.hpp"
+#include "catlass/gemm/tile/quant_per_token_int8.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+
+using Options = GemmOptions;
+
+// Host reference of TileQuantPerTokenInt8: scale = absmax / 127 stored as half, q = rint(x / scale)
+static void QuantPerToken(
+    uint32_t m, uint32_t k, const std::vector<fp16_t>& dataA, std::vector<int8_t>& dataQuantA,
+    std::vector<fp16_t>& dataPerTokenScale)
+{
+    constexpr float quantMax = 127.0f;
+    constexpr float minAbsMax = 1e-6f;
+    for (uint32_t i = 0; i < m; ++i) {
+        float absMax = 0.0f;
+        for (uint32_t j = 0; j < k; ++j) {
+            absMax = std::max(absMax, std::fabs(static_cast<float>(dataA[static_cast<size_t>(i) * k + j])));
+        }
+        absMax = std::max(absMax, minAbsMax);
+        // The kernel reloads the stored half scale for every N block and quantizes with its reciprocal
+        fp16_t scale = static_cast<fp16_t>(absMax / quantMax);
+        float invScale = 1.0f / std::max(static_cast<float>(scale), minAbsMax / quantMax);
+        for (uint32_t j = 0; j < k; ++j) {
+            size_t offset = static_cast<size_t>(i) * k + j;
+            float value = std::nearbyint(static_cast<float>(dataA[offset]) * invScale);
+            dataQuantA[offset] = static_cast<int8_t>(std::min(std::max(value, -quantMax), quantMax));
+        }
+        dataPerTokenScale[i] = scale;
+    }
+}
+
+static void Run(const Options& options)
+{
+    aclrtStream stream{nullptr};
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenB = static_cast<size_t>(k) * n;
+    size_t lenScale = static_cast<size_t>(n);
+    size_t lenPerTokenScale = static_cast<size_t>(m);
+    size_t lenD = static_cast<size_t>(m) * n;
+
+    size_t sizeA = lenA * sizeof(fp16_t);
+    size_t sizeB = lenB * sizeof(int8_t);
+    size_t sizeScale = lenScale * sizeof(fp16_t);
+    size_t sizePerTokenScale = lenPerTokenScale * sizeof(fp16_t);
+    size_t sizeD = lenD * sizeof(fp16_t);
+
+    std::vector<fp16_t> hostA(lenA);
+    std::vector<int8_t> hostB(lenB);
+    std::vector<fp16_t> hostScale(lenScale);
+    golden::FillRandomData(hostA, -5.0f, 5.0f);  // Fill with random data, ranging from -5.0 to 5.0
+    golden::FillRandomData(hostB, -16, 16);      // Fill with random data, ranging from -16 to 16.
+    golden::FillRandomData(hostScale, 0.0, 1.0); // Fill with random data, ranging from 0.0 to 1.0
+
+    uint8_t* deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceScale{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceScale), sizeScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceScale, sizeScale, hostScale.data(), sizeScale, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    // Output of the prologue
+    uint8_t* devicePerTokenScale{nullptr};
+    ACL_CHECK(
+        aclrtMalloc(reinterpret_cast<void**>(&devicePerTokenScale), sizePerTokenScale, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    uint8_t* deviceD{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceD), sizeD, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    using LayoutA = layout::RowMajor;
+    using LayoutB = layout::ColumnMajor;
+    LayoutA layoutA = LayoutA::MakeLayout<int8_t>(m, k);
+    LayoutB layoutB = LayoutB::MakeLayout<int8_t>(k, n);
+    layout::VectorLayout layoutScale{n};
+    layout::VectorLayout layoutPerTokenScale{m};
+    layout::RowMajor layoutD{m, n};
+
+    // Prepare hardware sync address
+    uint64_t hardwareSyncAddr{0};
+    ACL_CHECK(aclrtGetHardwareSyncAddr(reinterpret_cast<void**>(&hardwareSyncAddr)));
+
+    using ArchTag = Arch::AtlasA2;
+    constexpr bool enableUnitFlag = true;
+    using DispatchPolicy = Gemm::MmadAtlasA2PingPongWithPrologue<enableUnitFlag>;
+    using L1TileShape = GemmShape<128, 256, 512>;
+    using L0TileShape = GemmShape<128, 256, 128>;
+
+    using PrologueSrcType = Gemm::GemmType<half, LayoutA>;
+    using PrologueDstType = Gemm::GemmType<int8_t, LayoutA>;
+    using PerTokenScaleType = Gemm::GemmType<half, layout::VectorLayout>;
+    using AType = PrologueDstType;
+    using BType = Gemm::GemmType<int8_t, LayoutB>;
+    using CType = Gemm::GemmType<int32_t, layout::RowMajor>;
+
+    // Prologue shares the AIV with the per-token dequant epilogue, which takes the event ids 0~5 of V_MTE2
+    constexpr uint32_t computeLen = 8 * 1024;
+    constexpr uint32_t prologueStages = 2;
+    constexpr int32_t prologueEventIdBase = 6;
+    using PrologueA = Gemm::Tile::TileQuantPerTokenInt8<
+        ArchTag, PrologueSrcType, PrologueDstType, PerTokenScaleType, computeLen, L1TileShape::M, prologueStages,
+        prologueEventIdBase>;
+    using PrologueB = void;
+
+    using TileCopy = Gemm::Tile::TileCopyWithPrologue<ArchTag, AType, BType, CType, PrologueA, PrologueB>;
+    using BlockMmad =
+        Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType, void, TileCopy>;
+
+    constexpr uint32_t ubStages = 2;
+    using EpilogueDispatchPolicy = Epilogue::EpilogueAtlasA2PerTokenDequant<ubStages>;
+    using ScaleType = Gemm::GemmType<half, layout::VectorLayout>;
+    using DType = Gemm::GemmType<half, layout::RowMajor>;
+
+    using RowBroadcastMulType = Gemm::GemmType<float, layout::RowMajor>;
+    using BroadcastOneBlkType = Gemm::GemmType<float, layout::RowMajor>;
+    using OneBlkColumnBroadcastMulType = Gemm::GemmType<float, layout::RowMajor>;
+
+    using EpilogueTileShape = MatrixShape<32, 256>;
+    using TileRowBroadcastMul = Epilogue::Tile::TileRowBroadcastMul<ArchTag, RowBroadcastMulType, EpilogueTileShape>;
+    using TileBroadcastOneBlk =
+        Epilogue::Tile::TileBroadcastOneBlk<ArchTag, BroadcastOneBlkType, EpilogueTileShape::ROW>;
+    using TileOneBlkColumnBroadcastMul =
+        Epilogue::Tile::TileOneBlkColumnBroadcastMul<ArchTag, OneBlkColumnBroadcastMulType, EpilogueTileShape>;
+    using EpilogueTileCopy = Epilogue::Tile::TileCopy<ArchTag, CType, ScaleType, PerTokenScaleType, DType>;
+    using TileScheduler = Epilogue::Tile::EpilogueHorizontalTileSwizzle;
+
+    using BlockEpilogue = Epilogue::Block::BlockEpilogue<
+        EpilogueDispatchPolicy, CType, ScaleType, PerTokenScaleType, DType, TileRowBroadcastMul, TileBroadcastOneBlk,
+        TileOneBlkColumnBroadcastMul, EpilogueTileCopy, TileScheduler>;
+
+    bool canImplement = false;
+    if (m > n) {
+        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+        using MatmulKernel = Gemm::Kernel::QuantMatmulWithPrologue<BlockMmad, BlockEpilogue, BlockScheduler>;
+        typename MatmulKernel::Arguments arguments{options.problemShape, aicCoreNum,          deviceA, deviceB,
+                                                   deviceScale,          devicePerTokenScale, deviceD};
+        using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+        MatmulAdapter matmulOp;
+        canImplement = (matmulOp.CanImplement(arguments) == Status::kSuccess);
+        if (canImplement) {
+            RunAdapter(matmulOp, arguments, stream, aicCoreNum, hardwareSyncAddr);
+        }
+    } else {
+        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 1>;
+        using MatmulKernel = Gemm::Kernel::QuantMatmulWithPrologue<BlockMmad, BlockEpilogue, BlockScheduler>;
+        typename MatmulKernel::Arguments arguments{options.problemShape, aicCoreNum,          deviceA, deviceB,
+                                                   deviceScale,          devicePerTokenScale, deviceD};
+        using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+        MatmulAdapter matmulOp;
+        canImplement = (matmulOp.CanImplement(arguments) == Status::kSuccess);
+        if (canImplement) {
+            RunAdapter(matmulOp, arguments, stream, aicCoreNum, hardwareSyncAddr);
+        }
+    }
+
+    if (!canImplement) {
+        std::cerr << "[ERROR]Dynamic per-token quant matmul cannot be implemented, k must be a multiple of 32!"
+                  << std::endl;
+    } else {
+        std::vector<fp16_t> hostD(lenD);
+        ACL_CHECK(aclrtMemcpy(hostD.data(), sizeD, deviceD, sizeD, ACL_MEMCPY_DEVICE_TO_HOST));
+
+        std::vector<int8_t> hostQuantA(lenA);
+        std::vector<fp16_t> hostPerTokenScale(lenPerTokenScale);
+        QuantPerToken(m, k, hostA, hostQuantA, hostPerTokenScale);
+
+        std::vector<float> hostGolden(lenD);
+        golden::QuantMatmul(
+            options.problemShape, hostQuantA, layoutA, hostB, layoutB, hostScale, layoutScale, hostPerTokenScale,
+            layoutPerTokenScale, hostGolden, layoutD);
+
+        std::vector<uint64_t> errorIndices = golden::CompareData(hostD, hostGolden, k);
+        if (errorIndices.empty()) {
+            std::cout << "Compare success." << std::endl;
+        } else {
+            std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+        }
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceScale));
+    ACL_CHECK(aclrtFree(devicePerTokenScale));
+    ACL_CHECK(aclrtFree(deviceD));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) == 0) {
+        Run(options);
+    }
+    return 0;
+}
@@ -0,0 +1,361 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/epilogue/block/block_epilogue.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemm/kernel/flash_attention_backward.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+
+struct Options {
+    const std::string HELPER = "batch seqlen_q seqlen_kv num_heads head_dim [causal] [deterministic] [device_id]";
+
+    uint32_t batch{1};
+    uint32_t seqlenQ{256};
+    uint32_t seqlenKv{256};
+    uint32_t numHeads{2};
+    uint32_t headDim{128};
+    bool causal{false};
+    bool deterministic{false};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char** argv)
+    {
+        enum class ArgsIndex
+        {
+            BATCH_INDEX = 1,
+            SEQLEN_Q_INDEX,
+            SEQLEN_KV_INDEX,
+            NUM_HEADS_INDEX,
+            HEAD_DIM_INDEX,
+            CAUSAL_INDEX,
+            DETERMINISTIC_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > static_cast<uint32_t>(ArgsIndex::ARGS_MAX) ||
+            argc < static_cast<uint32_t>(ArgsIndex::CAUSAL_INDEX)) {
+            std::cerr << TOSTRING(CATLASS_EXAMPLE_NAME) << " " << HELPER << std::endl;
+            return -1;
+        }
+
+        batch = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::BATCH_INDEX)]);
+        seqlenQ = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::SEQLEN_Q_INDEX)]);
+        seqlenKv = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::SEQLEN_KV_INDEX)]);
+        numHeads = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::NUM_HEADS_INDEX)]);
+        headDim = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::HEAD_DIM_INDEX)]);
+        if (argc > static_cast<uint32_t>(ArgsIndex::CAUSAL_INDEX)) {
+            causal = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::CAUSAL_INDEX)]) != 0;
+        }
+        if (argc > static_cast<uint32_t>(ArgsIndex::DETERMINISTIC_INDEX)) {
+            deterministic = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DETERMINISTIC_INDEX)]) != 0;
+        }
+        if (argc > static_cast<uint32_t>(ArgsIndex::DEVICE_ID_INDEX)) {
+            deviceId = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DEVICE_ID_INDEX)]);
+        }
+        return 0;
+    }
+};
+
+// Host reference of the forward pass for one head: O and LSE of scale * Q * K^T
+static void AttentionForward(
+    const Options& options, float scaleValue, const float* q, const float* k, const float* v, float* o, float* lse,
+    std::vector<float>& p)
+{
+    uint32_t rowStride = options.numHeads * options.headDim;
+    for (uint32_t i = 0; i < options.seqlenQ; ++i) {
+        float rowMax = -std::numeric_limits<float>::infinity();
+        for (uint32_t j = 0; j < options.seqlenKv; ++j) {
+            float score = -std::numeric_limits<float>::infinity();
+            if (!options.causal || j <= i) {
+                score = 0.0f;
+                for (uint32_t d = 0; d < options.headDim; ++d) {
+                    score += q[i * rowStride + d] * k[j * rowStride + d];
+                }
+                score *= scaleValue;
+            }
+            p[static_cast<size_t>(i) * options.seqlenKv + j] = score;
+            rowMax = std::max(rowMax, score);
+        }
+        float rowSum = 0.0f;
+        for (uint32_t j = 0; j < options.seqlenKv; ++j) {
+            rowSum += std::exp(p[static_cast<size_t>(i) * options.seqlenKv + j] - rowMax);
+        }
+        lse[i] = rowMax + std::log(rowSum);
+        for (uint32_t j = 0; j < options.seqlenKv; ++j) {
+            p[static_cast<size_t>(i) * options.seqlenKv + j] =
+                std::exp(p[static_cast<size_t>(i) * options.seqlenKv + j] - lse[i]);
+        }
+        for (uint32_t d = 0; d < options.headDim; ++d) {
+            float acc = 0.0f;
+            for (uint32_t j = 0; j < options.seqlenKv; ++j) {
+                acc += p[static_cast<size_t>(i) * options.seqlenKv + j] * v[j * rowStride + d];
+            }
+            o[i * rowStride + d] = acc;
+        }
+    }
+}
+
+// Host reference of the backward pass for one head, P is the softmax of the forward pass
+static void AttentionBackward(
+    const Options& options, float scaleValue, const float* q, const float* k, const float* v, const float* o,
+    const float* dO, const std::vector<float>& p, float* dQ, float* dK, float* dV)
+{
+    uint32_t rowStride = options.numHeads * options.headDim;
+    std::vector<float> dS(static_cast<size_t>(options.seqlenQ) * options.seqlenKv);
+    for (uint32_t i = 0; i < options.seqlenQ; ++i) {
+        float rowDot = 0.0f;
+        for (uint32_t d = 0; d < options.headDim; ++d) {
+            rowDot += dO[i * rowStride + d] * o[i * rowStride + d];
+        }
+        for (uint32_t j = 0; j < options.seqlenKv; ++j) {
+            float dP = 0.0f;
+            for (uint32_t d = 0; d < options.headDim; ++d) {
+                dP += dO[i * rowStride + d] * v[j * rowStride + d];
+            }
+            size_t idx = static_cast<size_t>(i) * options.seqlenKv + j;
+            dS[idx] = scaleValue * p[idx] * (dP - rowDot);
+        }
+    }
+    for (uint32_t i = 0; i < options.seqlenQ; ++i) {
+        for (uint32_t d = 0; d < options.headDim; ++d) {
+            float acc = 0.0f;
+            for (uint32_t j = 0; j < options.seqlenKv; ++j) {
+                acc += dS[static_cast<size_t>(i) * options.seqlenKv + j] * k[j * rowStride + d];
+            }
+            dQ[i * rowStride + d] = acc;
+        }
+    }
+    for (uint32_t j = 0; j < options.seqlenKv; ++j) {
+        for (uint32_t d = 0; d < options.headDim; ++d) {
+            float accK = 0.0f;
+            float accV = 0.0f;
+            for (uint32_t i = 0; i < options.seqlenQ; ++i) {
+                size_t idx = static_cast<size_t>(i) * options.seqlenKv + j;
+                accK += dS[idx] * q[i * rowStride + d];
+                accV += p[idx] * dO[i * rowStride + d];
+            }
+            dK[j * rowStride + d] = accK;
+            dV[j * rowStride + d] = accV;
+        }
+    }
+}
+
+template <class Element>
+static std::vector<float> ToFloat(const std::vector<Element>& data)
+{
+    std::vector<float> result(data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        result[i] = static_cast<float>(data[i]);
+    }
+    return result;
+}
+
+static void Run(const Options& options)
+{
+    aclrtStream stream{nullptr};
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    uint32_t rowStride = options.numHeads * options.headDim;
+    size_t lenQ = static_cast<size_t>(options.batch) * options.seqlenQ * rowStride;
+    size_t lenKV = static_cast<size_t>(options.batch) * options.seqlenKv * rowStride;
+    size_t lenLse = static_cast<size_t>(options.batch) * options.numHeads * options.seqlenQ;
+    float scaleValue = 1.0f / std::sqrt(static_cast<float>(options.headDim));
+
+    std::vector<fp16_t> hostQ(lenQ);
+    std::vector<fp16_t> hostK(lenKV);
+    std::vector<fp16_t> hostV(lenKV);
+    std::vector<fp16_t> hostdO(lenQ);
+    golden::FillRandomData(hostQ, -1.0f, 1.0f);
+    golden::FillRandomData(hostK, -1.0f, 1.0f);
+    golden::FillRandomData(hostV, -1.0f, 1.0f);
+    golden::FillRandomData(hostdO, -1.0f, 1.0f);
+
+    // The forward pass provides O and LSE
+    std::vector<float> q = ToFloat(hostQ);
+    std::vector<float> k = ToFloat(hostK);
+    std::vector<float> v = ToFloat(hostV);
+    std::vector<float> o(lenQ);
+    std::vector<float> hostLse(lenLse);
+    std::vector<std::vector<float>> probs(static_cast<size_t>(options.batch) * options.numHeads);
+    for (uint32_t b = 0; b < options.batch; ++b) {
+        for (uint32_t h = 0; h < options.numHeads; ++h) {
+            size_t headIdx = static_cast<size_t>(b) * options.numHeads + h;
+            size_t qOffset = static_cast<size_t>(b) * options.seqlenQ * rowStride + h * options.headDim;
+            size_t kvOffset = static_cast<size_t>(b) * options.seqlenKv * rowStride + h * options.headDim;
+            probs[headIdx].resize(static_cast<size_t>(options.seqlenQ) * options.seqlenKv);
+            AttentionForward(
+                options, scaleValue, q.data() + qOffset, k.data() + kvOffset, v.data() + kvOffset, o.data() + qOffset,
+                hostLse.data() + headIdx * options.seqlenQ, probs[headIdx]);
+        }
+    }
+    std::vector<fp16_t> hostO(lenQ);
+    for (size_t i = 0; i < lenQ; ++i) {
+        hostO[i] = static_cast<fp16_t>(o[i]);
+    }
+
+    size_t sizeQ = lenQ * sizeof(fp16_t);
+    size_t sizeKV = lenKV * sizeof(fp16_t);
+    size_t sizeLse = lenLse * sizeof(float);
+
+    uint8_t* deviceQ{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceQ), sizeQ, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceQ, sizeQ, hostQ.data(), sizeQ, ACL_MEMCPY_HOST_TO_DEVICE));
+    uint8_t* deviceK{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceK), sizeKV, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceK, sizeKV, hostK.data(), sizeKV, ACL_MEMCPY_HOST_TO_DEVICE));
+    uint8_t* deviceV{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceV), sizeKV, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceV, sizeKV, hostV.data(), sizeKV, ACL_MEMCPY_HOST_TO_DEVICE));
+    uint8_t* deviceO{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceO), sizeQ, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceO, sizeQ, hostO.data(), sizeQ, ACL_MEMCPY_HOST_TO_DEVICE));
+    uint8_t* devicedO{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&devicedO), sizeQ, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(devicedO, sizeQ, hostdO.data(), sizeQ, ACL_MEMCPY_HOST_TO_DEVICE));
+    uint8_t* deviceLse{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceLse), sizeLse, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceLse, sizeLse, hostLse.data(), sizeLse, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* devicedQ{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&devicedQ), sizeQ, ACL_MEM_MALLOC_HUGE_FIRST));
+    uint8_t* devicedK{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&devicedK), sizeKV, ACL_MEM_MALLOC_HUGE_FIRST));
+    uint8_t* devicedV{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&devicedV), sizeKV, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // Prepare hardware sync address
+    uint64_t hardwareSyncAddr{0};
+    ACL_CHECK(aclrtGetHardwareSyncAddr(reinterpret_cast<void**>(&hardwareSyncAddr)));
+
+    using ArchTag = Arch::AtlasA2;
+    // The gradient matmuls switch the fixpipe to atomic add, which needs the pipeline without unit flag
+    using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<false>;
+    using L1TileShape = GemmShape<128, 128, 128>;
+    using L0TileShape = GemmShape<128, 128, 64>;
+
+    using RowMajorType = Gemm::GemmType<half, layout::RowMajor>;
+    using ColumnMajorType = Gemm::GemmType<half, layout::ColumnMajor>;
+    using AccumulatorType = Gemm::GemmType<float, layout::RowMajor>;
+    // S = Q * K^T, dP = dO * V^T
+    using BlockMmadQK = Gemm::Block::BlockMmad<
+        DispatchPolicy, L1TileShape, L0TileShape, RowMajorType, ColumnMajorType, AccumulatorType>;
+    // dV = P^T * dO, dK = dS^T * Q
+    using BlockMmadKV = Gemm::Block::BlockMmad<
+        DispatchPolicy, L1TileShape, L0TileShape, ColumnMajorType, RowMajorType, AccumulatorType>;
+    // dQ = dS * K
+    using BlockMmadQ =
+        Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, RowMajorType, RowMajorType, AccumulatorType>;
+
+    using LseType = Gemm::GemmType<float, layout::VectorLayout>;
+    using BlockEpilogue =
+        Epilogue::Block::BlockEpilogue<Epilogue::EpilogueAtlasA2FASoftmaxGrad, RowMajorType, AccumulatorType, LseType>;
+
+    using FlashAttentionKernel =
+        Gemm::Kernel::FlashAttentionBackward<BlockMmadQK, BlockMmadKV, BlockMmadQ, BlockEpilogue>;
+    typename FlashAttentionKernel::Arguments arguments{
+        options.batch, options.seqlenQ, options.seqlenKv, options.numHeads, options.headDim,
+        scaleValue,    options.causal,  options.deterministic, aicCoreNum, deviceQ,
+        deviceK,       deviceV,         deviceO,         devicedO,      deviceLse,
+        devicedQ,      devicedK,        devicedV};
+    using FlashAttentionAdapter = Gemm::Device::DeviceGemm<FlashAttentionKernel>;
+    FlashAttentionAdapter flashAttentionOp;
+    if (flashAttentionOp.CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "Unsupported problem shape." << std::endl;
+    } else {
+        RunAdapter(flashAttentionOp, arguments, stream, aicCoreNum, hardwareSyncAddr);
+
+        std::vector<fp16_t> hostdQ(lenQ);
+        std::vector<fp16_t> hostdK(lenKV);
+        std::vector<fp16_t> hostdV(lenKV);
+        ACL_CHECK(aclrtMemcpy(hostdQ.data(), sizeQ, devicedQ, sizeQ, ACL_MEMCPY_DEVICE_TO_HOST));
+        ACL_CHECK(aclrtMemcpy(hostdK.data(), sizeKV, devicedK, sizeKV, ACL_MEMCPY_DEVICE_TO_HOST));
+        ACL_CHECK(aclrtMemcpy(hostdV.data(), sizeKV, devicedV, sizeKV, ACL_MEMCPY_DEVICE_TO_HOST));
+
+        // The reference uses the O of the device precision
+        std::vector<float> oHalf = ToFloat(hostO);
+        std::vector<float> dO = ToFloat(hostdO);
+        std::vector<float> goldendQ(lenQ);
+        std::vector<float> goldendK(lenKV);
+        std::vector<float> goldendV(lenKV);
+        for (uint32_t b = 0; b < options.batch; ++b) {
+            for (uint32_t h = 0; h < options.numHeads; ++h) {
+                size_t headIdx = static_cast<size_t>(b) * options.numHeads + h;
+                size_t qOffset = static_cast<size_t>(b) * options.seqlenQ * rowStride + h * options.headDim;
+                size_t kvOffset = static_cast<size_t>(b) * options.seqlenKv * rowStride + h * options.headDim;
+                AttentionBackward(
+                    options, scaleValue, q.data() + qOffset, k.data() + kvOffset, v.data() + kvOffset,
+                    oHalf.data() + qOffset, dO.data() + qOffset, probs[headIdx], goldendQ.data() + qOffset,
+                    goldendK.data() + kvOffset, goldendV.data() + kvOffset);
+            }
+        }
+
+        std::vector<uint64_t> errorIndicesdQ = golden::CompareData(hostdQ, goldendQ, options.seqlenKv);
+        std::vector<uint64_t> errorIndicesdK = golden::CompareData(hostdK, goldendK, options.seqlenQ);
+        std::vector<uint64_t> errorIndicesdV = golden::CompareData(hostdV, goldendV, options.seqlenQ);
+        if (errorIndicesdQ.empty() && errorIndicesdK.empty() && errorIndicesdV.empty()) {
+            std::cout << "Compare success." << std::endl;
+        } else {
+            std::cerr << "Compare failed. Error count of dQ: " << errorIndicesdQ.size()
+                      << ", dK: " << errorIndicesdK.size() << ", dV: " << errorIndicesdV.size() << std::endl;
+        }
+    }
+
+    ACL_CHECK(aclrtFree(deviceQ));
+    ACL_CHECK(aclrtFree(deviceK));
+    ACL_CHECK(aclrtFree(deviceV));
+    ACL_CHECK(aclrtFree(deviceO));
+    ACL_CHECK(aclrtFree(devicedO));
+    ACL_CHECK(aclrtFree(deviceLse));
+    ACL_CHECK(aclrtFree(devicedQ));
+    ACL_CHECK(aclrtFree(devicedK));
+    ACL_CHECK(aclrtFree(devicedV));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) == 0) {
+        Run(options);
+    }
+    return 0;
+}
@@ -0,0 +1,342 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include "catlass/conv/kernel/conv2d_dgrad.hpp"
+#include "catlass/conv/kernel/conv2d_wgrad.hpp"
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/conv/block/block_conv.hpp"
+#include "catlass/conv/block/block_swizzle.hpp"
+#include "catlass/conv/device/device_conv.hpp"
+#include "catlass/conv/dispatch_policy.hpp"
+#include "catlass/conv_coord.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemm/kernel/splitk_matmul.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+
+struct Options {
+    const std::string HELPER =
+        "77_conv2d_backward batch, hi, wi, cin, cout, kh, kw, padLeft, padRight, padTop, "
+        "padBottom, strideH, strideW, dilationH, dilationW [device_id]";
+
+    uint32_t dataSizes[5] = {2, 33, 43, 112, 80}; // {batch, hi, wi, cin, cout}
+    uint8_t filterSizes[2] = {3, 3};              // {kh, kw}
+    uint8_t pads[4] = {2, 2, 2, 2};               // {padLeft, padRight, padTop, padBottom}
+    uint8_t strides[2] = {2, 2};                  // {strideH, strideW}
+    uint8_t dilations[2] = {1, 1};                // {dilationH, dilationW}
+    int32_t deviceId{0};
+
+    Catlass::Conv2dParams problemParams{};
+
+    Options() = default;
+
+    int Parse(int argc, const char** argv)
+    {
+        enum class ArgsIndex
+        {
+            BATCH_INDEX = 1,
+            HI_INDEX,
+            WI_INDEX,
+            CIN_INDEX,
+            COUT_INDEX,
+            KH_INDEX,
+            KW_INDEX,
+            PADLEFT_INDEX,
+            PADRIGHT_INDEX,
+            PADTOP_INDEX,
+            PADBOTTOM_INDEX,
+            STRIDEH_INDEX,
+            STRIDEW_INDEX,
+            DILATIONH_INDEX,
+            DILATIONW_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > static_cast<uint32_t>(ArgsIndex::ARGS_MAX) ||
+            argc <= static_cast<uint32_t>(ArgsIndex::DILATIONW_INDEX)) {
+            std::cerr << HELPER << std::endl;
+            return 0;
+        }
+
+        dataSizes[0] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::BATCH_INDEX)]);
+        dataSizes[1] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::HI_INDEX)]);
+        dataSizes[2] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::WI_INDEX)]);
+        dataSizes[3] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::CIN_INDEX)]);
+        dataSizes[4] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::COUT_INDEX)]);
+        filterSizes[0] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::KH_INDEX)]);
+        filterSizes[1] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::KW_INDEX)]);
+        pads[0] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::PADLEFT_INDEX)]);
+        pads[1] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::PADRIGHT_INDEX)]);
+        pads[2] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::PADTOP_INDEX)]);
+        pads[3] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::PADBOTTOM_INDEX)]);
+        strides[0] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::STRIDEH_INDEX)]);
+        strides[1] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::STRIDEW_INDEX)]);
+        dilations[0] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DILATIONH_INDEX)]);
+        dilations[1] = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DILATIONW_INDEX)]);
+
+        problemParams = Catlass::Conv2dParams::MakeConv2dParams(dataSizes, filterSizes, pads, strides, dilations);
+
+        if (argc == static_cast<uint32_t>(ArgsIndex::ARGS_MAX)) {
+            deviceId = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DEVICE_ID_INDEX)]);
+        }
+        return 0;
+    }
+
+    const bool CanImplement() const
+    {
+        if (dilations[0] == 0 || dilations[1] == 0 || strides[0] == 0 || strides[1] == 0) {
+            // dilations and strides should not be 0.
+            return false;
+        }
+
+        if (dataSizes[1] + pads[2] + pads[3] <=
+                dilations[0] * (filterSizes[0] - 1) + 1 /* hi + padTop + padDown <= dilationH * (kh - 1) + 1*/
+            || dataSizes[2] + pads[0] + pads[1] <=
+                   dilations[1] * (filterSizes[1] - 1) + 1 /* wi + padLeft + padRight <= dilationW * (kw - 1) + 1*/) {
+            // filter size should not be larger than map size.
+
+            return false;
+        }
+
+        return true;
+
+static void Run(Options const& options)
+{
+    if (!options.CanImplement()) {
+        std::cerr << "[ERROR]Invalid input parameters!" << std::endl;
+        return;
+    }
+
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    // Prepare hardware sync address
+    uint64_t hardwareSyncAddr{0};
+    ACL_CHECK(aclrtGetHardwareSyncAddr(reinterpret_cast<void**>(&hardwareSyncAddr)));
+
+    uint32_t c0 = options.problemParams.C0;
+    uint32_t batch = options.problemParams.batch();
+    uint32_t hi = options.problemParams.hi();
+    uint32_t wi = options.problemParams.wi();
+    uint32_t cin1 = options.problemParams.cin1();
+    uint32_t ho = options.problemParams.ho();
+    uint32_t wo = options.problemParams.wo();
+    uint32_t cout1 = options.problemParams.cout1();
+    uint32_t cout = options.problemParams.cout();
+    uint32_t kh = options.problemParams.kh();
+    uint32_t kw = options.problemParams.kw();
+
+    size_t lenFmap = static_cast<size_t>(batch) * cin1 * hi * wi * c0;
+    size_t lenFilter = static_cast<size_t>(cin1) * kh * kw * cout * c0;
+    size_t lenGradOutput = static_cast<size_t>(batch) * cout1 * ho * wo * c0;
+
+    size_t sizeFmap = lenFmap * sizeof(fp16_t);
+    size_t sizeFilter = lenFilter * sizeof(fp16_t);
+    size_t sizeGradOutput = lenGradOutput * sizeof(fp16_t);
+
+    using LayoutFmap = layout::NC1HWC0;
+    using LayoutFilter = layout::CI1KHKWCOCI0;
+    using LayoutGradOutput = layout::NC1HWC0;
+    LayoutFmap layoutFmap{batch, cin1, hi, wi, c0};
+    LayoutFilter layoutFilter{cin1, kh, kw, cout, c0};
+    LayoutGradOutput layoutGradOutput{batch, cout1, ho, wo, c0};
+
+    std::vector<fp16_t> hostFmap(lenFmap);
+    std::vector<fp16_t> hostFilter(lenFilter);
+    std::vector<fp16_t> hostGradOutput(lenGradOutput);
+    golden::FillRandomData<fp16_t>(hostFmap, -5.0f, 5.0f);
+    golden::FillRandomData<fp16_t>(hostFilter, -5.0f, 5.0f);
+    golden::FillRandomData<fp16_t>(hostGradOutput, -5.0f, 5.0f);
+    // The padded channels of gradOutput carry no gradient
+    golden::ClearInvalidOutput(hostGradOutput, options.problemParams);
+
+    uint8_t* deviceFmap{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceFmap), sizeFmap, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceFmap, sizeFmap, hostFmap.data(), sizeFmap, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceFilter{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceFilter), sizeFilter, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceFilter, sizeFilter, hostFilter.data(), sizeFilter, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceGradOutput{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceGradOutput), sizeGradOutput, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(
+        deviceGradOutput, sizeGradOutput, hostGradOutput.data(), sizeGradOutput, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceGradFmap{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceGradFmap), sizeFmap, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    uint8_t* deviceGradFilter{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceGradFilter), sizeFilter, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    using ArchTag = Arch::AtlasA2;
+    constexpr uint32_t L1A_STAGES = 2;
+    constexpr uint32_t L1B_STAGES = 2;
+    constexpr uint32_t L0A_STAGES = 2;
+    constexpr uint32_t L0B_STAGES = 2;
+    constexpr uint32_t L0C_STAGES = 1;
+    constexpr bool ENABLE_UNIT_FLAG = false;
+    using DispatchPolicy =
+        Conv::ConvAtlasA2Pingpong<L1A_STAGES, L1B_STAGES, L0A_STAGES, L0B_STAGES, L0C_STAGES, ENABLE_UNIT_FLAG>;
+
+    // Data gradient: stride-1 conv of the zero-inserted gradOutput with the flipped filter
+    using DgradFmapL1TileShape = Catlass::Conv2dFmapL1Shape<8, 12, 8>;  // (hoBlock, woBlock, cin1BlockSmall)
+    using DgradFilterL1TileShape = Catlass::Conv2dFilterL1Shape<96, 8>; // (coutBlock, cin1BlockBig)
+    using DgradL0TileShape = Catlass::Conv2dL0Shape<16, 96, 16>;        // (mL0, nL0, kL0)
+
+    using GradOutputType = Gemm::GemmType<half, LayoutGradOutput>;
+    using FilterType = Gemm::GemmType<half, LayoutFilter>;
+    using GradFmapType = Gemm::GemmType<half, LayoutFmap>;
+
+    using BlockConv2dDgrad = Conv::Block::BlockConv2d<
+        DispatchPolicy, DgradFmapL1TileShape, DgradFilterL1TileShape, DgradL0TileShape, GradOutputType, FilterType,
+        GradFmapType>;
+    using BlockEpilogue = void;
+
+    // Swizzle offset is 3 and direction is 0.
+    using BlockScheduler = typename Conv::Block::Conv2dIdentityBlockSwizzle<3, 0>;
+
+    using DgradKernel = Conv::Kernel::Conv2dDgrad<BlockConv2dDgrad, BlockEpilogue, BlockScheduler>;
+    using DgradAdapter = Conv::Device::DeviceConv<DgradKernel>;
+
+    // Weight gradient: gradOutput^T x img2col(fmap), split-k over the output rows
+    using WgradFmapL1TileShape = Catlass::Conv2dFmapL1Shape<8, 1, 2>;   // (hoChunk, unused, cin1Block)
+    using WgradFilterL1TileShape = Catlass::Conv2dFilterL1Shape<64, 1>; // (coutBlock, unused)
+    using WgradL0TileShape = Catlass::Conv2dL0Shape<64, 144, 64>;       // (unused, nL0, kL0)
+
+    using FmapType = Gemm::GemmType<half, LayoutFmap>;
+    using GradFilterType = Gemm::GemmType<float, LayoutFilter>;
+
+    using BlockConv2dWgrad = Conv::Block::BlockConv2dWgrad<
+        DispatchPolicy, WgradFmapL1TileShape, WgradFilterL1TileShape, WgradL0TileShape, FmapType, GradOutputType,
+        GradFilterType>;
+
+    // After the partial gradFilters are computed, the AIV cores accumulate the split-k slices.
+    constexpr uint32_t computeLength = 192 * 1024 / sizeof(float);
+    using ReduceAdd = Catlass::Gemm::Kernel::SplitkReduceAdd<ArchTag, float, half, 1, computeLength>;
+
+    using WgradKernel = Conv::Kernel::Conv2dWgrad<BlockConv2dWgrad, ReduceAdd>;
+    using WgradAdapter = Conv::Device::DeviceConv<WgradKernel>;
+
+    DgradKernel::Arguments dgradArguments{options.problemParams, deviceGradOutput, deviceFilter, deviceGradFmap};
+    WgradKernel::Arguments wgradArguments{
+        options.problemParams, aicCoreNum, deviceFmap, deviceGradOutput, deviceGradFilter};
+    DgradAdapter dgradOp;
+    WgradAdapter wgradOp;
+    if (dgradOp.CanImplement(dgradArguments) == Status::kInvalid ||
+        wgradOp.CanImplement(wgradArguments) == Status::kInvalid) {
+        std::cerr << "[ERROR]Conv2d backward cannot be implemented: strideH/W or dilationH/W should not be zero, "
+                     "the complementary pads should be in [0, 255], or L1TileShape/L0TileShape exceeds the L1/L0 space!"
+                  << std::endl;
+
+        ACL_CHECK(aclrtFree(deviceFmap));
+        ACL_CHECK(aclrtFree(deviceFilter));
+        ACL_CHECK(aclrtFree(deviceGradOutput));
+        ACL_CHECK(aclrtFree(deviceGradFmap));
+        ACL_CHECK(aclrtFree(deviceGradFilter));
+        ACL_CHECK(aclrtDestroyStream(stream));
+        ACL_CHECK(aclrtResetDevice(options.deviceId));
+        ACL_CHECK(aclFinalize());
+        return;
+    }
+
+    size_t sizeDgradWorkspace = dgradOp.GetWorkspaceSize(dgradArguments);
+    uint8_t* deviceDgradWorkspace = nullptr;
+    if (sizeDgradWorkspace > 0) {
+        ACL_CHECK(aclrtMalloc(
+            reinterpret_cast<void**>(&deviceDgradWorkspace), sizeDgradWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+    }
+    dgradOp.Initialize(dgradArguments, deviceDgradWorkspace);
+    dgradOp(stream, aicCoreNum, hardwareSyncAddr);
+
+    size_t sizeWgradWorkspace = wgradOp.GetWorkspaceSize(wgradArguments);
+    uint8_t* deviceWgradWorkspace = nullptr;
+    if (sizeWgradWorkspace > 0) {
+        ACL_CHECK(aclrtMalloc(
+            reinterpret_cast<void**>(&deviceWgradWorkspace), sizeWgradWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+    }
+    wgradOp.Initialize(wgradArguments, deviceWgradWorkspace);
+    wgradOp(stream, aicCoreNum, hardwareSyncAddr);
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+
+    if (sizeDgradWorkspace > 0) {
+        ACL_CHECK(aclrtFree(deviceDgradWorkspace));
+    }
+    if (sizeWgradWorkspace > 0) {
+        ACL_CHECK(aclrtFree(deviceWgradWorkspace));
+    }
+
+    std::vector<fp16_t> hostGradFmap(lenFmap);
+    ACL_CHECK(aclrtMemcpy(hostGradFmap.data(), sizeFmap, deviceGradFmap, sizeFmap, ACL_MEMCPY_DEVICE_TO_HOST));
+    std::vector<fp16_t> hostGradFilter(lenFilter);
+    ACL_CHECK(
+        aclrtMemcpy(hostGradFilter.data(), sizeFilter, deviceGradFilter, sizeFilter, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    std::vector<float> hostGoldenGradFmap(lenFmap);
+    golden::ComputeConv2dDgrad(
+        options.problemParams, hostGradOutput, layoutGradOutput, hostFilter, layoutFilter, hostGoldenGradFmap,
+        layoutFmap);
+    std::vector<float> hostGoldenGradFilter(lenFilter);
+    golden::ComputeConv2dWgrad(
+        options.problemParams, hostFmap, layoutFmap, hostGradOutput, layoutGradOutput, hostGoldenGradFilter,
+        layoutFilter);
+
+    std::vector<uint64_t> dgradErrorIndices =
+        golden::CompareData(hostGradFmap, hostGoldenGradFmap, cout1 * kh * kw * c0);
+    std::vector<uint64_t> wgradErrorIndices =
+        golden::CompareData(hostGradFilter, hostGoldenGradFilter, batch * ho * wo);
+    if (dgradErrorIndices.empty() && wgradErrorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Dgrad error count: " << dgradErrorIndices.size()
+                  << ", wgrad error count: " << wgradErrorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceFmap));
+    ACL_CHECK(aclrtFree(deviceFilter));
+    ACL_CHECK(aclrtFree(deviceGradOutput));
+    ACL_CHECK(aclrtFree(deviceGradFmap));
+    ACL_CHECK(aclrtFree(deviceGradFilter));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
@@ -0,0 +1,244 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include "catlass/gemm/kernel/splitk_matmul.hpp"
+#include "catlass/gemv/kernel/kernel_gemv_splitk_aiv.hpp"
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemv/block/block_gemv.hpp"
+#include "catlass/gemv/device/device_gemv.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+
+enum class WeightType : uint32_t
+{
+    FP16 = 0,
+    INT8,
+    INT4
+};
+
+struct Options {
+    const std::string HELPER =
+        "81_splitk_gemv m n batch splitkFactor(0: auto) deterministic(0: atomic add, 1: ordered reduce) "
+        "groupSize(0: per-channel) weightType(0: fp16, 1: int8, 2: int4) [device_id]";
+
+    GemvCoord problemShape{256, 65536};
+    uint32_t batch{1};
+    uint32_t splitkFactor{0};
+    bool deterministic{false};
+    uint32_t groupSize{0};
+    WeightType weightType{WeightType::FP16};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char** argv)
+    {
+        enum class ArgsIndex
+        {
+            M_INDEX = 1,
+            N_INDEX,
+            BATCH_INDEX,
+            SPLITK_FACTOR_INDEX,
+            DETERMINISTIC_INDEX,
+            GROUP_SIZE_INDEX,
+            WEIGHT_TYPE_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > static_cast<uint32_t>(ArgsIndex::ARGS_MAX) ||
+            argc <= static_cast<uint32_t>(ArgsIndex::WEIGHT_TYPE_INDEX)) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::M_INDEX)]);
+        problemShape.n() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::N_INDEX)]);
+        batch = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::BATCH_INDEX)]);
+        splitkFactor = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::SPLITK_FACTOR_INDEX)]);
+        deterministic = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DETERMINISTIC_INDEX)]) != 0;
+        groupSize = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::GROUP_SIZE_INDEX)]);
+        weightType = static_cast<WeightType>(std::atoi(argv[static_cast<uint32_t>(ArgsIndex::WEIGHT_TYPE_INDEX)]));
+        if (argc == static_cast<uint32_t>(ArgsIndex::ARGS_MAX)) {
+            deviceId = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DEVICE_ID_INDEX)]);
+        }
+        return 0;
+    }
+};
+
+template <class ElementA>
+static void RunSplitkGemv(Options const& options, aclrtStream stream)
+{
+    constexpr bool IS_QUANT = !std::is_same_v<ElementA, half>;
+    constexpr bool IS_INT4 = std::is_same_v<ElementA, AscendC::int4b_t>;
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t batch = options.batch;
+    uint32_t groupSize = (options.groupSize == 0) ? n : options.groupSize;
+    uint32_t groupCount = CeilDiv(n, groupSize);
+
+    size_t lenA = static_cast<size_t>(m) * n;
+    size_t lenX = static_cast<size_t>(batch) * n;
+    size_t lenY = static_cast<size_t>(batch) * m;
+    size_t lenScale = static_cast<size_t>(groupCount) * m;
+
+    // Unpacked weights, int4 weights are packed two per byte (even element in the low nibble) before the copy
+    using ElementHostA = std::conditional_t<IS_QUANT, int8_t, fp16_t>;
+    std::vector<ElementHostA> hostA(lenA);
+    std::vector<fp16_t> hostScale;
+    if constexpr (IS_INT4) {
+        golden::FillRandomData<int8_t, int>(hostA, -8, 7);
+    } else if constexpr (IS_QUANT) {
+        golden::FillRandomData<int8_t, int>(hostA, -128, 127);
+    } else {
+        golden::FillRandomData<fp16_t>(hostA, -1.0f, 1.0f);
+    }
+    if constexpr (IS_QUANT) {
+        hostScale.resize(lenScale);
+        golden::FillRandomData<fp16_t>(hostScale, 0.001f, 0.02f);
+    }
+    std::vector<int8_t> hostAPacked;
+    size_t sizeA = lenA * sizeof(ElementHostA);
+    const void* hostADevice = hostA.data();
+    if constexpr (IS_INT4) {
+        hostAPacked.resize(lenA / 2);
+        for (size_t i = 0; i < hostAPacked.size(); ++i) {
+            hostAPacked[i] = static_cast<int8_t>((hostA[2 * i] & 0x0F) | ((hostA[2 * i + 1] & 0x0F) << 4));
+        }
+        sizeA = hostAPacked.size();
+        hostADevice = hostAPacked.data();
+    }
+
+    std::vector<fp16_t> hostX(lenX);
+    golden::FillRandomData<fp16_t>(hostX, -1.0f, 1.0f);
+
+    size_t sizeX = lenX * sizeof(fp16_t);
+    size_t sizeY = lenY * sizeof(fp16_t);
+    size_t sizeScale = lenScale * sizeof(fp16_t);
+
+    uint8_t* deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostADevice, sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceX{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceX), sizeX, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceX, sizeX, hostX.data(), sizeX, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceScale{nullptr};
+    if constexpr (IS_QUANT) {
+        ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceScale), sizeScale, ACL_MEM_MALLOC_HUGE_FIRST));
+        ACL_CHECK(aclrtMemcpy(deviceScale, sizeScale, hostScale.data(), sizeScale, ACL_MEMCPY_HOST_TO_DEVICE));
+    }
+
+    uint8_t* deviceY{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceY), sizeY, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // Get the number of cube cores of the current hardware, every cube core comes with two AIVs
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+    auto aivCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAiv();
+
+    using ArchTag = Arch::AtlasA2;
+    constexpr uint32_t MAX_BATCH = 8;
+    using DispatchPolicy = Gemm::GemvAtlasA2Batched<MAX_BATCH>;
+    using UBTileShape = GemvShape<32, 512>;
+    using AType = Gemm::GemmType<ElementA, layout::RowMajor>;
+    using XType = Gemm::GemmType<half, layout::RowMajor>;
+    // The blocks write fp32 partial sums
+    using PartialType = Gemm::GemmType<float, layout::RowMajor>;
+    using ScaleType = std::conditional_t<IS_QUANT, Gemm::GemmType<half, layout::RowMajor>, void>;
+
+    using GemvBlock = Gemv::Block::BlockGemv<DispatchPolicy, UBTileShape, AType, XType, PartialType, ScaleType>;
+
+    // Sum the partial sums of every slice and cast them to fp16
+    constexpr uint32_t computeLength = 192 * 1024 / sizeof(float);
+    using ReduceAdd = Catlass::Gemm::Kernel::SplitkReduceAdd<ArchTag, float, half, 1, computeLength>;
+
+    // kernel level
+    using GemvKernel = Gemv::Kernel::KernelGemvSplitkAiv<GemvBlock, ReduceAdd>;
+    typename GemvKernel::Arguments arguments{
+        options.problemShape, batch, options.groupSize, options.splitkFactor, aivCoreNum, options.deterministic,
+        deviceA, deviceX, deviceScale, deviceY};
+
+    using GemvAdapter = Gemv::Device::DeviceGemv<GemvKernel>;
+    GemvAdapter gemvOp;
+    if (gemvOp.CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "[ERROR]Split-k gemv cannot be implemented, check batch, groupSize and n!" << std::endl;
+    } else {
+        std::cout << "splitkFactor: " << CeilDiv(n, GemvKernel::GetKSlice(arguments)) << std::endl;
+        RunAdapter(gemvOp, arguments, stream, aicCoreNum);
+
+        std::vector<fp16_t> hostY(lenY);
+        ACL_CHECK(aclrtMemcpy(hostY.data(), sizeY, deviceY, sizeY, ACL_MEMCPY_DEVICE_TO_HOST));
+
+        // The golden applies the scale of every group, so a slice reading the wrong scale row fails the compare
+        std::vector<float> hostGolden(lenY);
+        golden::ComputeBatchedGemv(options.problemShape, batch, groupSize, hostA, hostX, hostScale, hostGolden);
+        std::vector<uint64_t> errorIndices = golden::CompareData(hostY, hostGolden, n);
+        if (errorIndices.empty()) {
+            std::cout << "Compare success." << std::endl;
+        } else {
+            std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+        }
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceX));
+    if (deviceScale != nullptr) {
+        ACL_CHECK(aclrtFree(deviceScale));
+    }
+    ACL_CHECK(aclrtFree(deviceY));
+}
+
+static void Run(Options const& options)
+{
+    aclrtStream stream{nullptr};
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    if (options.weightType == WeightType::INT4) {
+        RunSplitkGemv<AscendC::int4b_t>(options, stream);
+    } else if (options.weightType == WeightType::INT8) {
+        RunSplitkGemv<int8_t>(options, stream);
+    } else {
+        RunSplitkGemv<half>(options, stream);
+    }
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include "catlass/gemm/kernel/w4a16_matmul.hpp"
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemm/tile/cast_int4_to_fp16.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+
+struct Options {
+    const std::string HELPER = "82_w4a16_matmul m n k groupSize [device_id]";
+
+    GemmCoord problemShape{256, 4096, 4096};
+    uint32_t groupSize{128};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char** argv)
+    {
+        enum class ArgsIndex
+        {
+            M_INDEX = 1,
+            N_INDEX,
+            K_INDEX,
+            GROUP_SIZE_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > static_cast<uint32_t>(ArgsIndex::ARGS_MAX) ||
+            argc <= static_cast<uint32_t>(ArgsIndex::GROUP_SIZE_INDEX)) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::M_INDEX)]);
+        problemShape.n() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::N_INDEX)]);
+        problemShape.k() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::K_INDEX)]);
+        groupSize = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::GROUP_SIZE_INDEX)]);
+        if (argc == static_cast<uint32_t>(ArgsIndex::ARGS_MAX)) {
+            deviceId = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DEVICE_ID_INDEX)]);
+        }
+        return 0;
+    }
+};
+
+static void Run(const Options& options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+    uint32_t groupSize = options.groupSize;
+    uint32_t groupNum = CeilDiv(k, groupSize);
+
+    using ElementA = half;
+    using ElementPrologueB = AscendC::int4b_t;
+    using ElementB = half;
+    using ElementC = half;
+
+    using LayoutA = layout::RowMajor;
+    using LayoutPrologueB = layout::RowMajor;
+    using LayoutB = layout::RowMajor;
+    using LayoutC = layout::RowMajor;
+    LayoutA layoutA = LayoutA::MakeLayout<ElementA>(m, k);
+    // Int4 rows are padded to whole bytes
+    LayoutPrologueB layoutPrologueB{k, n, (n + 1) / 2 * 2};
+    LayoutB layoutB = LayoutB::MakeLayout<ElementB>(k, n);
+    LayoutC layoutC = LayoutC::MakeLayout<ElementC>(m, n);
+
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenB = static_cast<size_t>(k) * n;
+    size_t lenScale = static_cast<size_t>(groupNum) * n;
+    size_t lenC = static_cast<size_t>(m) * n;
+
+    size_t sizeA = lenA * sizeof(fp16_t);
+    size_t sizeB = layoutPrologueB.Capacity() / 2 * sizeof(int8_t);
+    size_t sizeScale = lenScale * sizeof(fp16_t);
+    size_t sizeC = lenC * sizeof(fp16_t);
+
+    std::vector<fp16_t> hostA(lenA);
+    std::vector<int8_t> hostB(lenB);
+    std::vector<fp16_t> hostScale(lenScale);
+    std::vector<int8_t> hostZero(lenScale);
+    golden::FillRandomData<fp16_t>(hostA, -1.0f, 1.0f);
+    golden::FillRandomData<int8_t>(hostB, -8, 7);
+    golden::FillRandomData<fp16_t>(hostScale, 0.01f, 0.1f);
+    golden::FillRandomData<int8_t>(hostZero, -2, 2);
+
+    // Pack two int4 per byte, the even element in the low nibble
+    size_t rowBytes = layoutPrologueB.stride(0) / 2;
+    std::vector<int8_t> hostBPacked(sizeB, 0);
+    for (size_t row = 0; row < k; ++row) {
+        for (size_t col = 0; col < n; ++col) {
+            uint8_t nibble = static_cast<uint8_t>(hostB[row * n + col]) & 0x0F;
+            hostBPacked[row * rowBytes + col / 2] |= static_cast<int8_t>((col % 2 == 0) ? nibble : (nibble << 4));
+        }
+    }
+    std::vector<fp16_t> hostZeroFp16(hostZero.begin(), hostZero.end());
+
+    uint8_t* deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostBPacked.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceScale{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceScale), sizeScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceScale, sizeScale, hostScale.data(), sizeScale, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceZero{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceZero), sizeScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceZero, sizeScale, hostZeroFp16.data(), sizeScale, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceC{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceC), sizeC, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    // Prepare hardware sync address
+    uint64_t hardwareSyncAddr{0};
+    ACL_CHECK(aclrtGetHardwareSyncAddr(reinterpret_cast<void**>(&hardwareSyncAddr)));
+
+    using ArchTag = Arch::AtlasA2;
+    constexpr bool ENABLE_UNIT_FLAG = true;
+
+    // L1TileShape::K must be a multiple of groupSize, so that every K tile starts at a group boundary
+    using L1TileShape = GemmShape<128, 256, 256>;
+    using L0TileShape = GemmShape<128, 256, 64>;
+
+    using PrologueSrcType = Gemm::GemmType<ElementPrologueB, LayoutPrologueB>;
+    using PrologueDstType = Gemm::GemmType<ElementB, LayoutB>;
+    using AType = Gemm::GemmType<ElementA, LayoutA>;
+    using BType = PrologueDstType;
+    using CType = Gemm::GemmType<ElementC, LayoutC>;
+    using DispatchPolicy = Gemm::MmadAtlasA2PingPongWithPrologue<ENABLE_UNIT_FLAG>;
+
+    using PrologueA = void;
+    constexpr uint32_t computeLen = 32 * 1024;
+    using PrologueB =
+        Gemm::Tile::TileCastInt4ToFp16GroupDequant<ArchTag, PrologueSrcType, PrologueDstType, computeLen>;
+
+    using TileCopy = Gemm::Tile::TileCopyWithPrologue<ArchTag, AType, BType, CType, PrologueA, PrologueB>;
+    using BlockMmadOpt =
+        Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType, void, TileCopy>;
+    using BlockEpilogue = void;
+
+    if (m > n) {
+        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+        using MatmulKernel = Gemm::Kernel::W4A16Matmul<BlockMmadOpt, BlockEpilogue, BlockScheduler>;
+        typename MatmulKernel::Arguments arguments{options.problemShape, deviceA,    layoutA,   deviceB,
+                                                   layoutPrologueB,      deviceScale, deviceZero, groupSize,
+                                                   deviceC,              layoutC,     aicCoreNum};
+        using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+        MatmulAdapter matmulOp;
+        if (matmulOp.CanImplement(arguments) != Status::kSuccess) {
+            std::cerr << "[ERROR]W4A16 matmul cannot be implemented, check groupSize!" << std::endl;
+        } else {
+            RunAdapter(matmulOp, arguments, stream, aicCoreNum, hardwareSyncAddr);
+        }
+    } else {
+        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 1>;
+        using MatmulKernel = Gemm::Kernel::W4A16Matmul<BlockMmadOpt, BlockEpilogue, BlockScheduler>;
+        typename MatmulKernel::Arguments arguments{options.problemShape, deviceA,    layoutA,   deviceB,
+                                                   layoutPrologueB,      deviceScale, deviceZero, groupSize,
+                                                   deviceC,              layoutC,     aicCoreNum};
+        using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+        MatmulAdapter matmulOp;
+        if (matmulOp.CanImplement(arguments) != Status::kSuccess) {
+            std::cerr << "[ERROR]W4A16 matmul cannot be implemented, check groupSize!" << std::endl;
+        } else {
+            RunAdapter(matmulOp, arguments, stream, aicCoreNum, hardwareSyncAddr);
+        }
+    }
+
+    // Dequantize B on the host the same way as the AIV: w = (q - zero) * scale in fp16
+    std::vector<fp16_t> hostBFp16(lenB);
+    for (size_t row = 0; row < k; ++row) {
+        for (size_t col = 0; col < n; ++col) {
+            size_t scaleIdx = row / groupSize * n + col;
+            fp16_t q = static_cast<fp16_t>(hostB[row * n + col]);
+            hostBFp16[row * n + col] = static_cast<fp16_t>((q - hostZeroFp16[scaleIdx]) * hostScale[scaleIdx]);
+        }
+    }
+
+    std::vector<fp16_t> hostC(lenC);
+    ACL_CHECK(aclrtMemcpy(hostC.data(), sizeC, deviceC, sizeC, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    std::vector<float> hostGolden(lenC);
+    golden::ComputeMatmul(options.problemShape, hostA, layoutA, hostBFp16, layoutB, hostGolden, layoutC);
+
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostC, hostGolden, k);
+    if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceScale));
+    ACL_CHECK(aclrtFree(deviceZero));
+    ACL_CHECK(aclrtFree(deviceC));
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
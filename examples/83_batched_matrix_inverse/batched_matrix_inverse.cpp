@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include "catlass/gemm/kernel/batched_matrix_inverse.hpp"
+#include "catlass/gemm/kernel/batched_trsm.hpp"
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+
+struct Options {
+    const std::string HELPER = "83_batched_matrix_inverse batch n nrhs mode [device_id]\n"
+                               "mode: 0 inverse, 1 lower triangular solve, 2 upper triangular solve";
+
+    uint32_t batch{1024};
+    uint32_t n{128};
+    uint32_t nrhs{64};
+    uint32_t mode{0};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char** argv)
+    {
+        enum class ArgsIndex
+        {
+            BATCH_INDEX = 1,
+            N_INDEX,
+            NRHS_INDEX,
+            MODE_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > static_cast<uint32_t>(ArgsIndex::ARGS_MAX) ||
+            argc <= static_cast<uint32_t>(ArgsIndex::MODE_INDEX)) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        batch = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::BATCH_INDEX)]);
+        n = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::N_INDEX)]);
+        nrhs = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::NRHS_INDEX)]);
+        mode = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::MODE_INDEX)]);
+        if (mode > 2) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+        if (argc == static_cast<uint32_t>(ArgsIndex::ARGS_MAX)) {
+            deviceId = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DEVICE_ID_INDEX)]);
+        }
+        return 0;
+    }
+};
+
+static void Run(const Options& options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t batch = options.batch;
+    uint32_t n = options.n;
+    uint32_t nrhs = options.nrhs;
+    bool isInverse = (options.mode == 0);
+    bool lower = (options.mode == 1);
+
+    using Element = float;
+    using Layout = layout::RowMajor;
+
+    size_t lenA = static_cast<size_t>(batch) * n * n;
+    size_t lenB = static_cast<size_t>(batch) * n * nrhs;
+    size_t sizeA = lenA * sizeof(Element);
+    size_t sizeB = lenB * sizeof(Element);
+
+    // Diagonally dominant matrices, so that no pivoting is needed
+    std::vector<Element> hostA(lenA);
+    golden::FillRandomData<Element>(hostA, -1.0f, 1.0f);
+    for (size_t matrixIdx = 0; matrixIdx < batch; ++matrixIdx) {
+        size_t offset = matrixIdx * n * n;
+        for (uint32_t row = 0; row < n; ++row) {
+            hostA[offset + row * n + row] += static_cast<Element>(n);
+            if (isInverse) {
+                continue;
+            }
+            // Zero the opposite triangle for the triangular solve
+            for (uint32_t col = 0; col < n; ++col) {
+                if ((lower && col > row) || (!lower && col < row)) {
+                    hostA[offset + row * n + col] = 0;
+                }
+            }
+        }
+    }
+    std::vector<Element> hostB(isInverse ? 0 : lenB);
+    golden::FillRandomData<Element>(hostB, -1.0f, 1.0f);
+
+    uint8_t* deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceB{nullptr};
+    if (!isInverse) {
+        ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+        ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+    }
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    // Prepare hardware sync address
+    uint64_t hardwareSyncAddr{0};
+    ACL_CHECK(aclrtGetHardwareSyncAddr(reinterpret_cast<void**>(&hardwareSyncAddr)));
+
+    using ArchTag = Arch::AtlasA2;
+    constexpr bool ENABLE_UNIT_FLAG = true;
+    using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<ENABLE_UNIT_FLAG>;
+    using L1TileShape = GemmShape<128, 128, 64>;
+    using L0TileShape = GemmShape<128, 128, 32>;
+
+    using AType = Gemm::GemmType<Element, Layout>;
+    using BType = Gemm::GemmType<Element, Layout>;
+    using CType = Gemm::GemmType<Element, Layout>;
+    using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+
+    if (isInverse) {
+        using InverseKernel = Gemm::Kernel::BatchedMatrixInverse<BlockMmad>;
+        typename InverseKernel::Arguments arguments{batch, n, deviceA, aicCoreNum};
+        using InverseAdapter = Gemm::Device::DeviceGemm<InverseKernel>;
+        InverseAdapter inverseOp;
+        if (inverseOp.CanImplement(arguments) != Status::kSuccess) {
+            std::cerr << "[ERROR]Batched matrix inverse cannot be implemented, check n!" << std::endl;
+        } else {
+            RunAdapter(inverseOp, arguments, stream, aicCoreNum, hardwareSyncAddr);
+        }
+    } else {
+        using TrsmKernel = Gemm::Kernel::BatchedTrsm<BlockMmad>;
+        typename TrsmKernel::Arguments arguments{batch, n, nrhs, lower, deviceA, deviceB, aicCoreNum};
+        using TrsmAdapter = Gemm::Device::DeviceGemm<TrsmKernel>;
+        TrsmAdapter trsmOp;
+        if (trsmOp.CanImplement(arguments) != Status::kSuccess) {
+            std::cerr << "[ERROR]Batched trsm cannot be implemented, check n and nrhs!" << std::endl;
+        } else {
+            RunAdapter(trsmOp, arguments, stream, aicCoreNum, hardwareSyncAddr);
+        }
+    }
+
+    std::vector<Element> hostResult(isInverse ? lenA : lenB);
+    std::vector<Element> hostGolden(isInverse ? lenA : lenB);
+    if (isInverse) {
+        ACL_CHECK(aclrtMemcpy(hostResult.data(), sizeA, deviceA, sizeA, ACL_MEMCPY_DEVICE_TO_HOST));
+        for (size_t matrixIdx = 0; matrixIdx < batch; ++matrixIdx) {
+            auto matrixBegin = hostA.begin() + matrixIdx * n * n;
+            std::vector<Element> matrix(matrixBegin, matrixBegin + n * n);
+            golden::ComputeInverseInplace(static_cast<int>(n), matrix);
+            std::copy(matrix.begin(), matrix.end(), hostGolden.begin() + matrixIdx * n * n);
+        }
+    } else {
+        ACL_CHECK(aclrtMemcpy(hostResult.data(), sizeB, deviceB, sizeB, ACL_MEMCPY_DEVICE_TO_HOST));
+        hostGolden = hostB;
+        for (size_t matrixIdx = 0; matrixIdx < batch; ++matrixIdx) {
+            golden::ComputeTrsmInplace(
+                static_cast<int>(n), static_cast<int>(nrhs), lower, hostA, matrixIdx * n * n, hostGolden,
+                matrixIdx * n * nrhs);
+        }
+    }
+
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostResult, hostGolden, n);
+    if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    if (deviceB != nullptr) {
+        ACL_CHECK(aclrtFree(deviceB));
+    }
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
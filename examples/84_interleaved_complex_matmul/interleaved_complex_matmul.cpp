@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include "catlass/gemm/kernel/interleaved_complex_gemm.hpp"
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+
+struct Options {
+    const std::string HELPER = "84_interleaved_complex_matmul m n k algorithm [device_id]\n"
+                               "algorithm: 0 4M, 1 3M (Karatsuba)";
+
+    GemmCoord problemShape{1024, 1024, 1024};
+    uint32_t algorithm{0};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char** argv)
+    {
+        enum class ArgsIndex
+        {
+            M_INDEX = 1,
+            N_INDEX,
+            K_INDEX,
+            ALGORITHM_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > static_cast<uint32_t>(ArgsIndex::ARGS_MAX) ||
+            argc <= static_cast<uint32_t>(ArgsIndex::ALGORITHM_INDEX)) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::M_INDEX)]);
+        problemShape.n() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::N_INDEX)]);
+        problemShape.k() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::K_INDEX)]);
+        algorithm = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::ALGORITHM_INDEX)]);
+        if (algorithm > 1) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+        if (argc == static_cast<uint32_t>(ArgsIndex::ARGS_MAX)) {
+            deviceId = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DEVICE_ID_INDEX)]);
+        }
+        return 0;
+    }
+};
+
+template <class Kernel>
+static void RunKernel(typename Kernel::Arguments const& arguments, aclrtStream stream, uint64_t hardwareSyncAddr)
+{
+    using Adapter = Gemm::Device::DeviceGemm<Kernel>;
+    Adapter complexOp;
+    if (complexOp.CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "[ERROR]Interleaved complex matmul cannot be implemented, check the shape!" << std::endl;
+        return;
+    }
+    RunAdapter(complexOp, arguments, stream, arguments.aicoreNum, hardwareSyncAddr);
+}
+
+static void Run(const Options& options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+
+    using ElementA = half;
+    using ElementB = half;
+    using ElementC = float;
+    using Layout = layout::RowMajor;
+
+    // Every complex element is a (re, im) pair
+    size_t lenA = static_cast<size_t>(m) * k * 2;
+    size_t lenB = static_cast<size_t>(k) * n * 2;
+    size_t lenC = static_cast<size_t>(m) * n * 2;
+    size_t sizeA = lenA * sizeof(fp16_t);
+    size_t sizeB = lenB * sizeof(fp16_t);
+    size_t sizeC = lenC * sizeof(float);
+
+    std::vector<fp16_t> hostA(lenA);
+    std::vector<fp16_t> hostB(lenB);
+    golden::FillRandomData<fp16_t>(hostA, -1.0f, 1.0f);
+    golden::FillRandomData<fp16_t>(hostB, -1.0f, 1.0f);
+
+    uint8_t* deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceC{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceC), sizeC, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    // Prepare hardware sync address
+    uint64_t hardwareSyncAddr{0};
+    ACL_CHECK(aclrtGetHardwareSyncAddr(reinterpret_cast<void**>(&hardwareSyncAddr)));
+
+    using ArchTag = Arch::AtlasA2;
+    constexpr bool ENABLE_UNIT_FLAG = true;
+    using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<ENABLE_UNIT_FLAG>;
+    using L1TileShape = GemmShape<128, 256, 256>;
+    using L0TileShape = GemmShape<128, 256, 64>;
+
+    using AType = Gemm::GemmType<ElementA, Layout>;
+    using BType = Gemm::GemmType<ElementB, Layout>;
+    using CType = Gemm::GemmType<ElementC, Layout>;
+    using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+    using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+
+    if (options.algorithm == 0) {
+        using ComplexKernel = Gemm::Kernel::InterleavedComplexGemm<
+            Gemm::Kernel::ComplexGemmAlgorithm::FOUR_M, BlockMmad, BlockScheduler>;
+        typename ComplexKernel::Arguments arguments{options.problemShape, deviceA, deviceB, deviceC, aicCoreNum};
+        RunKernel<ComplexKernel>(arguments, stream, hardwareSyncAddr);
+    } else {
+        using ComplexKernel = Gemm::Kernel::InterleavedComplexGemm<
+            Gemm::Kernel::ComplexGemmAlgorithm::THREE_M, BlockMmad, BlockScheduler>;
+        typename ComplexKernel::Arguments arguments{options.problemShape, deviceA, deviceB, deviceC, aicCoreNum};
+        RunKernel<ComplexKernel>(arguments, stream, hardwareSyncAddr);
+    }
+
+    std::vector<float> hostC(lenC);
+    ACL_CHECK(aclrtMemcpy(hostC.data(), sizeC, deviceC, sizeC, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    std::vector<float> hostGolden(lenC);
+    golden::ComputeComplexMatmulInterleaved(options.problemShape, hostA, hostB, hostGolden);
+
+    // Every complex product accumulates 2k real terms, and 3M also rounds Ar + Ai and Br + Bi to half
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostC, hostGolden, k * 4);
+    if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceC));
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
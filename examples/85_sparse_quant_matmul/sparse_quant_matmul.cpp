@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include "catlass/gemm/kernel/sparse_quant_matmul_tla.hpp"
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/epilogue/block/block_epilogue.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_mul.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_one_blk.hpp"
+#include "catlass/epilogue/tile/tile_swizzle.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/device/sparse_compressor.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+#include "tla/layout.hpp"
+#include "tla/tensor.hpp"
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+using namespace tla;
+
+constexpr uint32_t workspaceStages = 2;
+
+using Options = GemmOptions;
+
+static void Run(const Options& options)
+{
+    aclrtStream stream{nullptr};
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+
+    using Compressor = Gemm::Device::SparseCompressor<int8_t>;
+    if (!Compressor::CanImplement(n, k)) {
+        std::cerr << "[ERROR]Sparse quant matmul requires k to be a multiple of 8." << std::endl;
+        return;
+    }
+
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenDenseB = static_cast<size_t>(k) * n;
+    size_t lenB = Compressor::GetValuesLen(n, k);
+    size_t lenIndex = Compressor::GetIndexLen(n, k);
+    size_t lenScale = static_cast<size_t>(n);
+    size_t lenPerTokenScale = static_cast<size_t>(m);
+    size_t lenD = static_cast<size_t>(m) * n;
+
+    size_t sizeA = lenA * sizeof(int8_t);
+    size_t sizeB = lenB * sizeof(int8_t);
+    size_t sizeIndex = lenIndex * sizeof(uint8_t);
+    size_t sizeScale = lenScale * sizeof(fp16_t);
+    size_t sizePerTokenScale = lenPerTokenScale * sizeof(fp16_t);
+    size_t sizeD = lenD * sizeof(fp16_t);
+
+    std::vector<int8_t> hostA(lenA);
+    std::vector<int8_t> hostDenseB(lenDenseB);
+    std::vector<fp16_t> hostScale(lenScale);
+    std::vector<fp16_t> hostPerTokenScale(lenPerTokenScale);
+    golden::FillRandomData(hostA, -16, 16);
+    golden::FillRandomData(hostDenseB, -16, 16);
+    golden::FillRandomData(hostScale, 0.0, 1.0);
+    golden::FillRandomData(hostPerTokenScale, 0.0, 1.0);
+
+    // Prune the dense weight (n x k, k contiguous) to 2:4 and compress it into values and index
+    std::vector<int8_t> hostB(lenB);
+    std::vector<uint8_t> hostIndex(lenIndex);
+    std::vector<int8_t> hostPrunedB(lenDenseB);
+    Compressor::Compress(n, k, hostDenseB.data(), hostB.data(), hostIndex.data(), hostPrunedB.data());
+
+    uint8_t* deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceIndex{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceIndex), sizeIndex, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceIndex, sizeIndex, hostIndex.data(), sizeIndex, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceScale{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceScale), sizeScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceScale, sizeScale, hostScale.data(), sizeScale, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* devicePerTokenScale{nullptr};
+    ACL_CHECK(
+        aclrtMalloc(reinterpret_cast<void**>(&devicePerTokenScale), sizePerTokenScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(
+        devicePerTokenScale, sizePerTokenScale, hostPerTokenScale.data(), sizePerTokenScale,
+        ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceD{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceD), sizeD, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    using LayoutA = layout::RowMajor;
+    using LayoutB = layout::ColumnMajor;
+    LayoutA layoutA = LayoutA::MakeLayout<int8_t>(m, k);
+    LayoutB layoutB = LayoutB::MakeLayout<int8_t>(k, n);
+    layout::VectorLayout layoutScale{n};
+    layout::VectorLayout layoutPerTokenScale{m};
+    layout::RowMajor layoutD{m, n};
+
+    // Prepare hardware sync address
+    uint64_t hardwareSyncAddr{0};
+    ACL_CHECK(aclrtGetHardwareSyncAddr(reinterpret_cast<void**>(&hardwareSyncAddr)));
+
+    using ArchTag = Arch::AtlasA2;
+    using DispatchPolicy = Gemm::SparseMatmulMultiBlockOnKAxis<ArchTag, false>;
+    using L1TileShape = Shape<_128, _256, _128>;
+    using L0TileShape = Shape<_128, _256, _64>;
+
+    using TileCopyMmad =
+        Gemm::Tile::SparseTileCopyTla<ArchTag, int8_t, LayoutA, int8_t, LayoutB, int32_t, layout::RowMajor>;
+    using BlockMmad = Gemm::Block::BlockMmadSparseTla<
+        DispatchPolicy, L1TileShape, L0TileShape, int8_t, int8_t, int32_t, void, TileCopyMmad>;
+
+    constexpr uint32_t ubStages = 2;
+    using EpilogueDispatchPolicy = Epilogue::EpilogueAtlasA2PerTokenDequant<ubStages>;
+    using CType = Gemm::GemmType<int32_t, layout::RowMajor>;
+    using ScaleType = Gemm::GemmType<half, layout::VectorLayout>;
+    using PerTokenScaleType = Gemm::GemmType<half, layout::VectorLayout>;
+    using DType = Gemm::GemmType<half, layout::RowMajor>;
+
+    using RowBroadcastMulType = Gemm::GemmType<float, layout::RowMajor>;
+    using BroadcastOneBlkType = Gemm::GemmType<float, layout::RowMajor>;
+    using OneBlkColumnBroadcastMulType = Gemm::GemmType<float, layout::RowMajor>;
+
+    using EpilogueTileShape = MatrixShape<32, 256>;
+    using TileRowBroadcastMul = Epilogue::Tile::TileRowBroadcastMul<ArchTag, RowBroadcastMulType, EpilogueTileShape>;
+    using TileBroadcastOneBlk =
+        Epilogue::Tile::TileBroadcastOneBlk<ArchTag, BroadcastOneBlkType, EpilogueTileShape::ROW>;
+    using TileOneBlkColumnBroadcastMul =
+        Epilogue::Tile::TileOneBlkColumnBroadcastMul<ArchTag, OneBlkColumnBroadcastMulType, EpilogueTileShape>;
+    using TileCopy = Epilogue::Tile::TileCopy<ArchTag, CType, ScaleType, PerTokenScaleType, DType>;
+    using TileScheduler = Epilogue::Tile::EpilogueHorizontalTileSwizzle;
+
+    using BlockEpilogue = Epilogue::Block::BlockEpilogue<
+        EpilogueDispatchPolicy, CType, ScaleType, PerTokenScaleType, DType, TileRowBroadcastMul, TileBroadcastOneBlk,
+        TileOneBlkColumnBroadcastMul, TileCopy, TileScheduler>;
+
+    using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+
+    // kernel level
+    using MatmulKernel =
+        Gemm::Kernel::SparseQuantMatmulTla<BlockMmad, BlockEpilogue, BlockScheduler, workspaceStages>;
+
+    using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+    MatmulKernel::Arguments arguments{options.problemShape, aicCoreNum,  deviceA,             deviceB,
+                                      deviceIndex,          deviceScale, devicePerTokenScale, deviceD};
+
+    MatmulAdapter matmulOp;
+    if (matmulOp.CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "[ERROR]Sparse quant matmul cannot be implemented, check the shape!" << std::endl;
+        return;
+    }
+    size_t sizeWorkspace = matmulOp.GetWorkspaceSize(arguments);
+    uint8_t* deviceWorkspace{nullptr};
+    if (sizeWorkspace > 0) {
+        ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceWorkspace), sizeWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+    }
+    matmulOp.Initialize(arguments, deviceWorkspace);
+    matmulOp(stream, aicCoreNum, hardwareSyncAddr);
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+
+    std::vector<fp16_t> hostD(lenD);
+    ACL_CHECK(aclrtMemcpy(hostD.data(), sizeD, deviceD, sizeD, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    // The reference runs a dense quant matmul on the pruned weight
+    std::vector<float> hostGolden(lenD);
+    golden::QuantMatmul(
+        options.problemShape, hostA, layoutA, hostPrunedB, layoutB, hostScale, layoutScale, hostPerTokenScale,
+        layoutPerTokenScale, hostGolden, layoutD);
+
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostD, hostGolden, k);
+    if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceIndex));
+    ACL_CHECK(aclrtFree(deviceScale));
+    ACL_CHECK(aclrtFree(devicePerTokenScale));
+    ACL_CHECK(aclrtFree(deviceD));
+    if (sizeWorkspace > 0) {
+        ACL_CHECK(aclrtFree(deviceWorkspace));
+    }
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) == 0) {
+        Run(options);
+    }
+    return 0;
+}
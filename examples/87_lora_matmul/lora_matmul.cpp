@@ -0,0 +1,236 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include "catlass/gemm/kernel/lora_matmul.hpp"
+
+#include "catlass/arch/arch.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/status.hpp"
+
+#include "golden.hpp"
+#include "helper.hpp"
+
+using namespace Catlass;
+
+struct Options {
+    const std::string HELPER = "87_lora_matmul adapter_count m n k rank [device_id]";
+
+    uint32_t adapterCount{4};
+    GemmCoord problemShape{1024, 1024, 1024};
+    uint32_t rank{16};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char** argv)
+    {
+        enum class ArgsIndex
+        {
+            ADAPTER_COUNT_INDEX = 1,
+            M_INDEX,
+            N_INDEX,
+            K_INDEX,
+            RANK_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > static_cast<uint32_t>(ArgsIndex::ARGS_MAX) ||
+            argc <= static_cast<uint32_t>(ArgsIndex::RANK_INDEX)) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        adapterCount = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::ADAPTER_COUNT_INDEX)]);
+        problemShape.m() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::M_INDEX)]);
+        problemShape.n() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::N_INDEX)]);
+        problemShape.k() = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::K_INDEX)]);
+        rank = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::RANK_INDEX)]);
+        if (argc == static_cast<uint32_t>(ArgsIndex::ARGS_MAX)) {
+            deviceId = std::atoi(argv[static_cast<uint32_t>(ArgsIndex::DEVICE_ID_INDEX)]);
+        }
+        return 0;
+    }
+};
+
+static void Run(const Options& options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t adapterCount = options.adapterCount;
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+    uint32_t rank = options.rank;
+
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenB = static_cast<size_t>(k) * n;
+    size_t lenLoraDown = static_cast<size_t>(k) * rank * adapterCount;
+    size_t lenLoraUp = static_cast<size_t>(rank) * n * adapterCount;
+    size_t lenC = static_cast<size_t>(m) * n;
+
+    size_t sizeA = lenA * sizeof(fp16_t);
+    size_t sizeB = lenB * sizeof(fp16_t);
+    size_t sizeLoraDown = lenLoraDown * sizeof(fp16_t);
+    size_t sizeLoraUp = lenLoraUp * sizeof(fp16_t);
+    size_t sizeLoraScale = adapterCount * sizeof(float);
+    size_t sizeC = lenC * sizeof(fp16_t);
+
+    using LayoutA = layout::RowMajor;
+    using LayoutB = layout::RowMajor;
+    using LayoutC = layout::RowMajor;
+    LayoutA layoutA{m, k};
+    LayoutB layoutB{k, n};
+    LayoutB layoutLoraDown{k, rank};
+    LayoutB layoutLoraUp{rank, n};
+    LayoutC layoutC{m, n};
+
+    std::vector<fp16_t> hostA(lenA);
+    std::vector<fp16_t> hostB(lenB);
+    std::vector<fp16_t> hostLoraDown(lenLoraDown);
+    std::vector<fp16_t> hostLoraUp(lenLoraUp);
+    std::vector<float> hostLoraScale(adapterCount);
+    golden::FillRandomData<fp16_t>(hostA, -5.0f, 5.0f);
+    golden::FillRandomData<fp16_t>(hostB, -5.0f, 5.0f);
+    golden::FillRandomData<fp16_t>(hostLoraDown, -1.0f, 1.0f);
+    golden::FillRandomData<fp16_t>(hostLoraUp, -1.0f, 1.0f);
+    golden::FillRandomData<float>(hostLoraScale, 0.0f, 2.0f);
+    // Rows after the last segment run without an adapter
+    std::vector<int64_t> groupList = golden::GenerateGroupList<int64_t>(m, adapterCount);
+
+    size_t sizeGroupList = adapterCount * sizeof(int64_t);
+    uint8_t* deviceGroupList{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceGroupList), sizeGroupList, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceGroupList, sizeGroupList, groupList.data(), sizeGroupList, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceLoraDown{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceLoraDown), sizeLoraDown, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceLoraDown, sizeLoraDown, hostLoraDown.data(), sizeLoraDown, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceLoraUp{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceLoraUp), sizeLoraUp, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceLoraUp, sizeLoraUp, hostLoraUp.data(), sizeLoraUp, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceLoraScale{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceLoraScale), sizeLoraScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(
+        aclrtMemcpy(deviceLoraScale, sizeLoraScale, hostLoraScale.data(), sizeLoraScale, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t* deviceC{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceC), sizeC, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    // Prepare hardware sync address
+    uint64_t hardwareSyncAddr{0};
+    ACL_CHECK(aclrtGetHardwareSyncAddr(reinterpret_cast<void**>(&hardwareSyncAddr)));
+
+    using ArchTag = Arch::AtlasA2;
+    constexpr bool enableUnitFlag = true;
+    using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<enableUnitFlag>;
+    using L1TileShape = GemmShape<128, 256, 256>;
+    using L0TileShape = GemmShape<128, 256, 64>;
+
+    using AType = Gemm::GemmType<half, LayoutA>;
+    using BType = Gemm::GemmType<half, LayoutB>;
+    using CType = Gemm::GemmType<half, LayoutC>;
+    using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+    using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+
+    // kernel level
+    using ElementGroupList = int64_t;
+    using MatmulKernel = Gemm::Kernel::LoraMatmul<BlockMmad, BlockScheduler, ElementGroupList>;
+    using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+    MatmulKernel::Arguments arguments{
+        options.problemShape, adapterCount, rank,           deviceGroupList, deviceA, deviceB,
+        deviceLoraDown,       deviceLoraUp, deviceLoraScale, deviceC};
+
+    MatmulAdapter matmulOp;
+    if (matmulOp.CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "[ERROR]LoRA matmul cannot be implemented, check the rank!" << std::endl;
+        return;
+    }
+    size_t sizeWorkspace = matmulOp.GetWorkspaceSize(arguments);
+    uint8_t* deviceWorkspace{nullptr};
+    if (sizeWorkspace > 0) {
+        ACL_CHECK(aclrtMalloc(reinterpret_cast<void**>(&deviceWorkspace), sizeWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+    }
+    matmulOp.Initialize(arguments, deviceWorkspace);
+    matmulOp(stream, aicCoreNum, hardwareSyncAddr);
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+
+    std::vector<fp16_t> hostC(lenC);
+    ACL_CHECK(aclrtMemcpy(hostC.data(), sizeC, deviceC, sizeC, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    std::vector<float> hostGolden(lenC);
+    golden::ComputeLoraMatmul(
+        options.problemShape, adapterCount, rank, groupList, hostA, layoutA, hostB, layoutB, hostLoraDown,
+        layoutLoraDown, hostLoraUp, layoutLoraUp, hostLoraScale, hostGolden, layoutC);
+
+    // Every output accumulates k base terms and rank low-rank terms
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostC, hostGolden, k + rank);
+    if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceLoraDown));
+    ACL_CHECK(aclrtFree(deviceLoraUp));
+    ACL_CHECK(aclrtFree(deviceLoraScale));
+    ACL_CHECK(aclrtFree(deviceC));
+    if (sizeWorkspace > 0) {
+        ACL_CHECK(aclrtFree(deviceWorkspace));
+    }
+    ACL_CHECK(aclrtFree(deviceGroupList));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
@@ -12,6 +12,7 @@
 #ifndef EXAMPLES_COMMON_GOLDEN_CONV2D_HPP
 #define EXAMPLES_COMMON_GOLDEN_CONV2D_HPP
 
+#include <algorithm>
 #include <vector>
 
 #include "catlass/conv_coord.hpp"
@@ -68,6 +69,216 @@ void ComputeConv2d(
     }
 }
 
+// simple conv2d data gradient, scatters every forward product back onto the fmap position it came from
+template <
+    class ElementGradOutput, class LayoutGradOutput, class ElementFilter, class LayoutFilter, class ElementGolden,
+    class LayoutGolden>
+void ComputeConv2dDgrad(
+    const Conv2dParams& params, const std::vector<ElementGradOutput>& dataGradOutput,
+    const LayoutGradOutput& layoutGradOutput, const std::vector<ElementFilter>& dataFilter,
+    const LayoutFilter& layoutFilter, std::vector<ElementGolden>& dataGolden, const LayoutGolden& layoutGolden)
+{
+    std::fill(dataGolden.begin(), dataGolden.end(), static_cast<ElementGolden>(0));
+    for (uint32_t batch = 0; batch < params.batch(); batch++) {
+        for (uint32_t ho = 0; ho < params.ho(); ho++) {
+            for (uint32_t wo = 0; wo < params.wo(); wo++) {
+                for (uint32_t kh = 0; kh < params.kh(); kh++) {
+                    for (uint32_t kw = 0; kw < params.kw(); kw++) {
+                        int32_t hi = static_cast<int32_t>(ho * params.strideH() + kh * params.dilationH()) -
+                                     static_cast<int32_t>(params.padTop());
+                        int32_t wi = static_cast<int32_t>(wo * params.strideW() + kw * params.dilationW()) -
+                                     static_cast<int32_t>(params.padLeft());
+                        if (hi < 0 || hi > static_cast<int32_t>(params.hi()) - 1 || wi < 0 ||
+                            wi > static_cast<int32_t>(params.wi()) - 1)
+                            continue;
+                        for (uint32_t cin1 = 0; cin1 < params.cin1(); cin1++) {
+                            for (uint32_t c0 = 0; c0 < params.C0; c0++) {
+                                ElementGolden accumulator = 0;
+                                for (uint32_t cout = 0; cout < params.cout(); cout++) {
+                                    uint32_t cout1 = cout / params.C0;
+                                    uint32_t coutC0 = cout - cout1 * params.C0;
+                                    Conv2dFmapCoord coordGradOutput{batch, cout1, ho, wo, coutC0};
+                                    Conv2dFilterCoord coordFilter{cin1, kh, kw, cout, c0};
+                                    accumulator += static_cast<ElementGolden>(
+                                                       dataGradOutput[layoutGradOutput.GetOffset(coordGradOutput)]) *
+                                                   static_cast<ElementGolden>(
+                                                       dataFilter[layoutFilter.GetOffset(coordFilter)]);
+                                }
+                                Conv2dFmapCoord coordGolden{
+                                    batch, cin1, static_cast<uint32_t>(hi), static_cast<uint32_t>(wi), c0};
+                                dataGolden[layoutGolden.GetOffset(coordGolden)] += accumulator;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// simple conv2d weight gradient
+template <
+    class ElementFmap, class LayoutFmap, class ElementGradOutput, class LayoutGradOutput, class ElementGolden,
+    class LayoutGolden>
+void ComputeConv2dWgrad(
+    const Conv2dParams& params, const std::vector<ElementFmap>& dataFmap, const LayoutFmap& layoutFmap,
+    const std::vector<ElementGradOutput>& dataGradOutput, const LayoutGradOutput& layoutGradOutput,
+    std::vector<ElementGolden>& dataGolden, const LayoutGolden& layoutGolden)
+{
+    std::fill(dataGolden.begin(), dataGolden.end(), static_cast<ElementGolden>(0));
+    for (uint32_t batch = 0; batch < params.batch(); batch++) {
+        for (uint32_t ho = 0; ho < params.ho(); ho++) {
+            for (uint32_t wo = 0; wo < params.wo(); wo++) {
+                for (uint32_t kh = 0; kh < params.kh(); kh++) {
+                    for (uint32_t kw = 0; kw < params.kw(); kw++) {
+                        int32_t hi = static_cast<int32_t>(ho * params.strideH() + kh * params.dilationH()) -
+                                     static_cast<int32_t>(params.padTop());
+                        int32_t wi = static_cast<int32_t>(wo * params.strideW() + kw * params.dilationW()) -
+                                     static_cast<int32_t>(params.padLeft());
+                        if (hi < 0 || hi > static_cast<int32_t>(params.hi()) - 1 || wi < 0 ||
+                            wi > static_cast<int32_t>(params.wi()) - 1)
+                            continue;
+                        for (uint32_t cout = 0; cout < params.cout(); cout++) {
+                            uint32_t cout1 = cout / params.C0;
+                            uint32_t coutC0 = cout - cout1 * params.C0;
+                            Conv2dFmapCoord coordGradOutput{batch, cout1, ho, wo, coutC0};
+                            ElementGolden gradOutput =
+                                static_cast<ElementGolden>(dataGradOutput[layoutGradOutput.GetOffset(coordGradOutput)]);
+                            for (uint32_t cin1 = 0; cin1 < params.cin1(); cin1++) {
+                                for (uint32_t c0 = 0; c0 < params.C0; c0++) {
+                                    Conv2dFmapCoord coordFmap{
+                                        batch, cin1, static_cast<uint32_t>(hi), static_cast<uint32_t>(wi), c0};
+                                    Conv2dFilterCoord coordGolden{cin1, kh, kw, cout, c0};
+                                    dataGolden[layoutGolden.GetOffset(coordGolden)] +=
+                                        gradOutput *
+                                        static_cast<ElementGolden>(dataFmap[layoutFmap.GetOffset(coordFmap)]);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// simple grouped conv2d, params is the shape of one group and the channels of every group are padded to C0
+template <class ElementFmap, class ElementFilter, class ElementGolden>
+void ComputeGroupedConv2d(
+    const Conv2dParams& params, uint32_t groupCount, const std::vector<ElementFmap>& dataFmap,
+    const std::vector<ElementFilter>& dataFilter, std::vector<ElementGolden>& dataGolden)
+{
+    layout::NC1HWC0 layoutFmap{params.batch(), groupCount * params.cin1(), params.hi(), params.wi(), params.C0};
+    layout::CI1KHKWCOCI0 layoutFilter{params.cin1(), params.kh(), params.kw(), params.cout(), params.C0};
+    layout::NC1HWC0 layoutGolden{params.batch(), groupCount * params.cout1(), params.ho(), params.wo(), params.C0};
+    size_t groupFilterSize = layoutFilter.Capacity();
+    for (uint32_t group = 0; group < groupCount; group++) {
+        for (uint32_t batch = 0; batch < params.batch(); batch++) {
+            for (uint32_t ho = 0; ho < params.ho(); ho++) {
+                for (uint32_t wo = 0; wo < params.wo(); wo++) {
+                    for (uint32_t cout = 0; cout < params.cout(); cout++) {
+                        ElementGolden accumulator = 0;
+                        for (uint32_t kh = 0; kh < params.kh(); kh++) {
+                            for (uint32_t kw = 0; kw < params.kw(); kw++) {
+                                int32_t hi = static_cast<int32_t>(ho * params.strideH() + kh * params.dilationH()) -
+                                             static_cast<int32_t>(params.padTop());
+                                int32_t wi = static_cast<int32_t>(wo * params.strideW() + kw * params.dilationW()) -
+                                             static_cast<int32_t>(params.padLeft());
+                                if (hi < 0 || hi > static_cast<int32_t>(params.hi()) - 1 || wi < 0 ||
+                                    wi > static_cast<int32_t>(params.wi()) - 1)
+                                    continue;
+                                for (uint32_t cin1 = 0; cin1 < params.cin1(); cin1++) {
+                                    for (uint32_t c0 = 0; c0 < params.C0; c0++) {
+                                        Conv2dFmapCoord coordFmap{
+                                            batch, group * params.cin1() + cin1, static_cast<uint32_t>(hi),
+                                            static_cast<uint32_t>(wi), c0};
+                                        Conv2dFilterCoord coordFilter{cin1, kh, kw, cout, c0};
+                                        size_t offsetFilter =
+                                            group * groupFilterSize + layoutFilter.GetOffset(coordFilter);
+                                        accumulator +=
+                                            static_cast<ElementGolden>(dataFmap[layoutFmap.GetOffset(coordFmap)]) *
+                                            static_cast<ElementGolden>(dataFilter[offsetFilter]);
+                                    }
+                                }
+                            }
+                        }
+                        Conv2dFmapCoord coordGolden{
+                            batch, group * params.cout1() + cout / params.C0, ho, wo, cout % params.C0};
+                        dataGolden[layoutGolden.GetOffset(coordGolden)] = accumulator;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// simple depthwise conv2d, the filter is (Cin1, Kh, Kw, C0)
+template <class ElementFmap, class ElementFilter, class ElementGolden>
+void ComputeDepthwiseConv2d(
+    const Conv2dParams& params, const std::vector<ElementFmap>& dataFmap, const std::vector<ElementFilter>& dataFilter,
+    std::vector<ElementGolden>& dataGolden)
+{
+    layout::NC1HWC0 layoutFmap{params.batch(), params.cin1(), params.hi(), params.wi(), params.C0};
+    layout::CI1KHKWCOCI0 layoutFilter{params.cin1(), params.kh(), params.kw(), 1, params.C0};
+    layout::NC1HWC0 layoutGolden{params.batch(), params.cin1(), params.ho(), params.wo(), params.C0};
+    for (uint32_t batch = 0; batch < params.batch(); batch++) {
+        for (uint32_t c1 = 0; c1 < params.cin1(); c1++) {
+            for (uint32_t ho = 0; ho < params.ho(); ho++) {
+                for (uint32_t wo = 0; wo < params.wo(); wo++) {
+                    for (uint32_t c0 = 0; c0 < params.C0; c0++) {
+                        ElementGolden accumulator = 0;
+                        for (uint32_t kh = 0; kh < params.kh(); kh++) {
+                            for (uint32_t kw = 0; kw < params.kw(); kw++) {
+                                int32_t hi = static_cast<int32_t>(ho * params.strideH() + kh * params.dilationH()) -
+                                             static_cast<int32_t>(params.padTop());
+                                int32_t wi = static_cast<int32_t>(wo * params.strideW() + kw * params.dilationW()) -
+                                             static_cast<int32_t>(params.padLeft());
+                                if (hi < 0 || hi > static_cast<int32_t>(params.hi()) - 1 || wi < 0 ||
+                                    wi > static_cast<int32_t>(params.wi()) - 1)
+                                    continue;
+                                Conv2dFmapCoord coordFmap{
+                                    batch, c1, static_cast<uint32_t>(hi), static_cast<uint32_t>(wi), c0};
+                                Conv2dFilterCoord coordFilter{c1, kh, kw, 0, c0};
+                                accumulator +=
+                                    static_cast<ElementGolden>(dataFmap[layoutFmap.GetOffset(coordFmap)]) *
+                                    static_cast<ElementGolden>(dataFilter[layoutFilter.GetOffset(coordFilter)]);
+                            }
+                        }
+                        dataGolden[layoutGolden.GetOffset(Conv2dFmapCoord{batch, c1, ho, wo, c0})] = accumulator;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Fused Conv2d epilogue, dataGolden holds the Conv2d output and becomes act(output * scale + shift + residual).
+// scale and shift are per output channel, an empty dataResidual means no residual.
+template <class ElementResidual, class ElementGolden, class Activation>
+void ComputeConv2dBnAct(
+    const Conv2dParams& params, const std::vector<float>& dataScale, const std::vector<float>& dataShift,
+    const std::vector<ElementResidual>& dataResidual, std::vector<ElementGolden>& dataGolden, Activation activation)
+{
+    layout::NC1HWC0 layoutGolden{params.batch(), params.cout1(), params.ho(), params.wo(), params.C0};
+    for (uint32_t batch = 0; batch < params.batch(); batch++) {
+        for (uint32_t cout = 0; cout < params.cout(); cout++) {
+            uint32_t c1 = cout / params.C0;
+            uint32_t c0 = cout % params.C0;
+            for (uint32_t ho = 0; ho < params.ho(); ho++) {
+                for (uint32_t wo = 0; wo < params.wo(); wo++) {
+                    int64_t offset = layoutGolden.GetOffset(Conv2dFmapCoord{batch, c1, ho, wo, c0});
+                    ElementGolden value = dataGolden[offset] * static_cast<ElementGolden>(dataScale[cout]) +
+                                          static_cast<ElementGolden>(dataShift[cout]);
+                    if (!dataResidual.empty()) {
+                        value += static_cast<ElementGolden>(dataResidual[offset]);
+                    }
+                    dataGolden[offset] = activation(value);
+                }
+            }
+        }
+    }
+}
+
 template <class Element>
 void ClearInvalidOutput(std::vector<Element>& output, const Conv2dParams& params)
 {
@@ -99,6 +99,31 @@ void ComputeGemv(
     }
 }
 
+// batched weight-only quantized gemv, golden[b][i] = sum_k A[i][k] * scale[k / groupSize][i] * X[b][k]
+// dataA holds the unpacked weights, dataScale is empty when A is not quantized
+template <class ElementA, class ElementX, class ElementScale, class ElementGolden>
+void ComputeBatchedGemv(
+    const Catlass::GemvCoord& problemShape, uint32_t batch, uint32_t groupSize, const std::vector<ElementA>& dataA,
+    const std::vector<ElementX>& dataX, const std::vector<ElementScale>& dataScale,
+    std::vector<ElementGolden>& dataGolden)
+{
+    uint32_t m = problemShape.m();
+    uint32_t n = problemShape.n();
+    for (uint32_t b = 0; b < batch; ++b) {
+        for (uint32_t i = 0; i < m; ++i) {
+            ElementGolden accumulator = 0;
+            for (uint32_t k = 0; k < n; ++k) {
+                ElementGolden weight = static_cast<ElementGolden>(dataA[static_cast<size_t>(i) * n + k]);
+                if (!dataScale.empty()) {
+                    weight *= static_cast<ElementGolden>(dataScale[static_cast<size_t>(k / groupSize) * m + i]);
+                }
+                accumulator += weight * static_cast<ElementGolden>(dataX[static_cast<size_t>(b) * n + k]);
+            }
+            dataGolden[static_cast<size_t>(b) * m + i] = accumulator;
+        }
+    }
+}
+
 // simple grouped gemm
 template <
     typename Element, class ElementA, class LayoutA, class ElementB, class LayoutB, class ElementC, class LayoutC,
@@ -403,6 +428,86 @@ void ComputeMatmulElemWiseActivation(
     }
 }
 
+// complex matmul on interleaved (re, im) row-major data, the shape counts complex elements
+template <class ElementA, class ElementB, class ElementGolden>
+void ComputeComplexMatmulInterleaved(
+    const GemmCoord& problemShape, const std::vector<ElementA>& dataA, const std::vector<ElementB>& dataB,
+    std::vector<ElementGolden>& dataGolden)
+{
+    uint32_t n = problemShape.n();
+    uint32_t k = problemShape.k();
+    for (uint32_t i = 0; i < problemShape.m(); ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            ElementGolden accumulatorReal = 0;
+            ElementGolden accumulatorImag = 0;
+            for (uint32_t l = 0; l < k; ++l) {
+                size_t offsetA = (static_cast<size_t>(i) * k + l) * 2;
+                size_t offsetB = (static_cast<size_t>(l) * n + j) * 2;
+                ElementGolden aReal = static_cast<ElementGolden>(dataA[offsetA]);
+                ElementGolden aImag = static_cast<ElementGolden>(dataA[offsetA + 1]);
+                ElementGolden bReal = static_cast<ElementGolden>(dataB[offsetB]);
+                ElementGolden bImag = static_cast<ElementGolden>(dataB[offsetB + 1]);
+                accumulatorReal += aReal * bReal - aImag * bImag;
+                accumulatorImag += aReal * bImag + aImag * bReal;
+            }
+            size_t offsetGolden = (static_cast<size_t>(i) * n + j) * 2;
+            dataGolden[offsetGolden] = accumulatorReal;
+            dataGolden[offsetGolden + 1] = accumulatorImag;
+        }
+    }
+}
+
+// segmented LoRA matmul, C = A * B + scale_g * (A * down_g) * up_g for the rows of adapter segment g,
+// rows after the last segment only get A * B
+template <class ElementA, class ElementB, class LayoutB, class ElementGroupList, class ElementGolden>
+void ComputeLoraMatmul(
+    const GemmCoord& problemShape, uint32_t problemCount, uint32_t rank, const std::vector<ElementGroupList>& groupList,
+    const std::vector<ElementA>& dataA, const layout::RowMajor& layoutA, const std::vector<ElementB>& dataB,
+    const LayoutB& layoutB, const std::vector<ElementB>& dataDown, const LayoutB& layoutDown,
+    const std::vector<ElementB>& dataUp, const LayoutB& layoutUp, const std::vector<float>& dataScale,
+    std::vector<ElementGolden>& dataGolden, const layout::RowMajor& layoutGolden)
+{
+    uint32_t m = problemShape.m();
+    uint32_t n = problemShape.n();
+    uint32_t k = problemShape.k();
+    std::vector<float> lowRank(rank);
+    uint32_t groupIdx = 0;
+    for (uint32_t i = 0; i < m; ++i) {
+        while (groupIdx < problemCount && i >= static_cast<uint32_t>(groupList[groupIdx])) {
+            ++groupIdx;
+        }
+        bool hasLora = (groupIdx < problemCount);
+        if (hasLora) {
+            size_t groupOffsetDown = static_cast<size_t>(groupIdx) * k * rank;
+            for (uint32_t r = 0; r < rank; ++r) {
+                float accumulator = 0;
+                for (uint32_t l = 0; l < k; ++l) {
+                    size_t offsetDown = groupOffsetDown + layoutDown.GetOffset(MakeCoord(l, r));
+                    accumulator += static_cast<float>(dataA[layoutA.GetOffset(MakeCoord(i, l))]) *
+                                   static_cast<float>(dataDown[offsetDown]);
+                }
+                lowRank[r] = accumulator * dataScale[groupIdx];
+            }
+        }
+        for (uint32_t j = 0; j < n; ++j) {
+            ElementGolden accumulator = 0;
+            for (uint32_t l = 0; l < k; ++l) {
+                accumulator += static_cast<ElementGolden>(dataA[layoutA.GetOffset(MakeCoord(i, l))]) *
+                               static_cast<ElementGolden>(dataB[layoutB.GetOffset(MakeCoord(l, j))]);
+            }
+            if (hasLora) {
+                size_t groupOffsetUp = static_cast<size_t>(groupIdx) * rank * n;
+                for (uint32_t r = 0; r < rank; ++r) {
+                    size_t offsetUp = groupOffsetUp + layoutUp.GetOffset(MakeCoord(r, j));
+                    accumulator +=
+                        static_cast<ElementGolden>(lowRank[r]) * static_cast<ElementGolden>(dataUp[offsetUp]);
+                }
+            }
+            dataGolden[layoutGolden.GetOffset(MakeCoord(i, j))] = accumulator;
+        }
+    }
+}
+
 template <class ElementT>
 struct Relu {
     ElementT operator()(ElementT val) const
@@ -185,6 +185,33 @@ int ComputeInverseInplace(int N, std::vector<Element>& A)
     return 0;
 }
 
+// Solve T * X = B for a lower or upper triangular N x N matrix T in row-major layout.
+// T and B start at the given offsets, B is N x nrhs in row-major; result overwrites B.
+// Returns 0 on success, or the row index (+1) where a zero diagonal was encountered.
+template <class Element>
+int ComputeTrsmInplace(
+    int N, int nrhs, bool lower, const std::vector<Element>& T, size_t offsetT, std::vector<Element>& B,
+    size_t offsetB)
+{
+    for (int step = 0; step < N; ++step) {
+        int k = lower ? step : N - 1 - step;
+        Element diag = T[offsetT + k * N + k];
+        if (diag == Element(0)) {
+            return k + 1;
+        }
+        for (int j = 0; j < nrhs; ++j) {
+            Element sum = B[offsetB + k * nrhs + j];
+            int iStart = lower ? 0 : k + 1;
+            int iEnd = lower ? k : N;
+            for (int i = iStart; i < iEnd; ++i) {
+                sum -= T[offsetT + k * N + i] * B[offsetB + i * nrhs + j];
+            }
+            B[offsetB + k * nrhs + j] = sum / diag;
+        }
+    }
+    return 0;
+}
+
 } // namespace Catlass::golden
 
 #endif // EXAMPLES_COMMON_GOLDEN_MATRIX_INVERSE_HPP
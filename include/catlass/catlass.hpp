@@ -34,6 +34,7 @@ constexpr uint32_t BYTE_PER_VECTOR_FRACTAL = BYTE_PER_BLK * BLK_NUM_PER_VECTOR_F
 
 constexpr uint64_t L2_OFFSET = 0;
 constexpr uint32_t STRIDE_LIMIT = 65536;
+constexpr uint32_t MAX_EVENT_ID_NUM = 8; /// number of event ids of each HardEvent type
 
 #if !defined(CATLASS_ARCH) || CATLASS_ARCH == 2201
 constexpr uint32_t BYTE_PER_BLK_FP = 128; /// datablock size of A1->C2PiPE2GM
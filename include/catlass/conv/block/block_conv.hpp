@@ -38,6 +38,21 @@ template <
 struct BlockConv2d {
     static_assert(DEPENDENT_FALSE<DispatchPolicy>, "BlockConv2d is not implemented for this DispatchPolicy");
 };
+
+template <
+    class DispatchPolicy, class FmapL1TileShape, class FilterL1TileShape, class L0TileShape, class FmapType,
+    class GradOutputType, class GradFilterType,
+    class TileCopy =
+        Conv::Tile::TileCopyWgrad<typename DispatchPolicy::ArchTag, FmapType, GradOutputType, GradFilterType>,
+    class TileMmad = Gemm::Tile::TileMmad<typename DispatchPolicy::ArchTag, GradOutputType, FmapType, void>>
+struct BlockConv2dWgrad {
+    static_assert(DEPENDENT_FALSE<DispatchPolicy>, "BlockConv2dWgrad is not implemented for this DispatchPolicy");
+};
+
+template <class DispatchPolicy, class FmapType, class FilterType, class OutputType>
+struct BlockDepthwiseConv2d {
+    static_assert(DEPENDENT_FALSE<DispatchPolicy>, "BlockDepthwiseConv2d is not implemented for this DispatchPolicy");
+};
 #endif
 
 template <
@@ -56,6 +71,8 @@ struct BlockConv2dTla {
 
 #if (defined(CATLASS_ARCH) && CATLASS_ARCH == 2201)
 #include "catlass/conv/block/block_conv2d_pingpong.hpp"
+#include "catlass/conv/block/block_conv2d_wgrad_pingpong.hpp"
+#include "catlass/conv/block/block_depthwise_conv2d_aiv.hpp"
 #include "catlass/conv/block/block_conv3d_pingpong_bias.hpp"
 #endif
 
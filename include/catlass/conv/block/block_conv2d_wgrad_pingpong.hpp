@@ -0,0 +1,349 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_CONV_BLOCK_BLOCK_CONV2D_WGRAD_PINGPONG_HPP
+#define CATLASS_CONV_BLOCK_BLOCK_CONV2D_WGRAD_PINGPONG_HPP
+
+#include "catlass/arch/resource.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/conv/dispatch_policy.hpp"
+#include "catlass/conv_coord.hpp"
+#include "catlass/gemm/helper.hpp"
+
+namespace Catlass::Conv::Block {
+
+/// Weight gradient of Conv2d as an implicit GEMM:
+///   dW(cout, cin1 * Kh * Kw * C0) += dY^T(cout, howo) x img2col(fmap)(howo, cin1 * Kh * Kw * C0)
+/// One call consumes one K chunk (FmapL1TileShape::Ho whole output rows of one batch) and accumulates in L0C,
+/// the tile is written out when the last chunk of the split-k slice is done.
+/// FmapL1TileShape::Cin1 is the cin1 of one output tile, FilterL1TileShape::Cout its cout, FmapL1TileShape::Wo and
+/// FilterL1TileShape::Cin1 are not used since the chunk always covers whole output rows.
+template <
+    uint32_t L1A_STAGES_, uint32_t L1B_STAGES_, uint32_t L0A_STAGES_, uint32_t L0B_STAGES_, uint32_t L0C_STAGES_,
+    bool ENABLE_UNIT_FLAG_, class FmapL1TileShape_, class FilterL1TileShape_, class L0TileShape_, class FmapType_,
+    class GradOutputType_, class GradFilterType_, class TileCopy_, class TileMmad_>
+struct BlockConv2dWgrad<
+    ConvAtlasA2Pingpong<L1A_STAGES_, L1B_STAGES_, L0A_STAGES_, L0B_STAGES_, L0C_STAGES_, ENABLE_UNIT_FLAG_>,
+    FmapL1TileShape_, FilterL1TileShape_, L0TileShape_, FmapType_, GradOutputType_, GradFilterType_, TileCopy_,
+    TileMmad_> {
+public:
+    // Type Aliases
+    using DispatchPolicy =
+        ConvAtlasA2Pingpong<L1A_STAGES_, L1B_STAGES_, L0A_STAGES_, L0B_STAGES_, L0C_STAGES_, ENABLE_UNIT_FLAG_>;
+    using ArchTag = typename DispatchPolicy::ArchTag;
+    using FmapL1TileShape = FmapL1TileShape_;
+    using FilterL1TileShape = FilterL1TileShape_;
+    using L0TileShape = L0TileShape_;
+    using ElementFmap = typename FmapType_::Element;
+    using LayoutFmap = typename FmapType_::Layout;
+    using ElementGradOutput = typename GradOutputType_::Element;
+    using LayoutGradOutput = typename GradOutputType_::Layout;
+    using ElementGradFilter = typename GradFilterType_::Element;
+    using LayoutGradFilter = typename GradFilterType_::Layout;
+    using TileMmad = TileMmad_;
+    using CopyGmToL1Fmap = typename TileCopy_::CopyGmToL1Fmap;
+    using CopyGmToL1GradOutput = typename TileCopy_::CopyGmToL1GradOutput;
+    using CopyL1ToL0A = typename TileCopy_::CopyL1ToL0A;
+    using CopyL1ToL0B = typename TileCopy_::CopyL1ToL0B;
+    using CopyL0CToGm = typename TileCopy_::CopyL0CToGm;
+    using ElementAccumulator =
+        typename Gemm::helper::ElementAccumulatorSelector<ElementFmap, ElementGradOutput>::ElementAccumulator;
+    using LayoutGradOutputInL0 = typename CopyL1ToL0A::LayoutDst;
+    using LayoutFmapInL0 = typename CopyL1ToL0B::LayoutDst;
+    using LayoutGradFilterInL0 = layout::zN;
+
+    static constexpr bool ENABLE_UNIT_FLAG = DispatchPolicy::ENABLE_UNIT_FLAG;
+    static constexpr uint32_t MAX_STAGES = 2;
+    static constexpr uint32_t L1A_STAGES =
+        (DispatchPolicy::L1A_STAGES < MAX_STAGES) ? DispatchPolicy::L1A_STAGES : MAX_STAGES;
+    static constexpr uint32_t L1B_STAGES =
+        (DispatchPolicy::L1B_STAGES < MAX_STAGES) ? DispatchPolicy::L1B_STAGES : MAX_STAGES;
+    static constexpr uint32_t L0A_STAGES =
+        (DispatchPolicy::L0A_STAGES < MAX_STAGES) ? DispatchPolicy::L0A_STAGES : MAX_STAGES;
+    static constexpr uint32_t L0B_STAGES =
+        (DispatchPolicy::L0B_STAGES < MAX_STAGES) ? DispatchPolicy::L0B_STAGES : MAX_STAGES;
+    static constexpr uint32_t L0A_PINGPONG_BUF_SIZE = ArchTag::L0A_SIZE / L0A_STAGES;
+    static constexpr uint32_t L0B_PINGPONG_BUF_SIZE = ArchTag::L0B_SIZE / L0B_STAGES;
+
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(ElementFmap);
+    // load3dv2 addresses the output positions and the (cin1, kh, kw, c0) columns with 16 bits
+    static constexpr uint32_t MAX_LOAD3D_EXTENSION = 65535;
+
+    // Check element dtype
+    static_assert(
+        std::is_same_v<ElementFmap, ElementGradOutput> && sizeof(ElementFmap) == 2,
+        "ElementFmap and ElementGradOutput must be the same 16-bit type.");
+    static_assert(
+        std::is_same_v<LayoutFmap, layout::NC1HWC0> && std::is_same_v<LayoutGradOutput, layout::NC1HWC0> &&
+            std::is_same_v<LayoutGradFilter, layout::CI1KHKWCOCI0>,
+        "Wgrad only supports NC1HWC0 fmap/gradOutput and CI1KHKWCOCI0 gradFilter yet!");
+    static_assert(!ENABLE_UNIT_FLAG, "Wgrad accumulates across calls and does not support the unit flag yet!");
+
+    // Check tile shapes, the whole cout tile is the m of every L0 mmad
+    static_assert(
+        FilterL1TileShape::Cout % C0_NUM_PER_FRACTAL == 0 && L0TileShape::K % C0_NUM_PER_FRACTAL == 0 &&
+            L0TileShape::N % C0_NUM_PER_FRACTAL == 0,
+        "Cout of the tile, L0 k and L0 n must be multiples of 16!");
+    static_assert(
+        FilterL1TileShape::Cout * L0TileShape::K * sizeof(ElementGradOutput) <= L0A_PINGPONG_BUF_SIZE,
+        "Cout tile x L0TileShape::K exceeding the L0A space!");
+    static_assert(
+        L0TileShape::K * L0TileShape::N * sizeof(ElementFmap) <= L0B_PINGPONG_BUF_SIZE,
+        "L0TileShape exceeding the L0B space!");
+
+    static bool CanImplement(Conv2dParams const& problemShape)
+    {
+        uint32_t hiBlock = (FmapL1TileShape::Ho - 1) * problemShape.strideH() +
+                           (problemShape.kh() - 1) * problemShape.dilationH() + 1;
+        uint32_t howoRound = RoundUp<C0_NUM_PER_FRACTAL>(FmapL1TileShape::Ho * problemShape.wo());
+        uint32_t l1DataSize = L1A_STAGES * FilterL1TileShape::Cout * howoRound * sizeof(ElementGradOutput) +
+                              L1B_STAGES * FmapL1TileShape::Cin1 * hiBlock * problemShape.wi() * BYTE_PER_C0;
+        uint32_t l0cDataSize = FilterL1TileShape::Cout * FmapL1TileShape::Cin1 * problemShape.kh() *
+                               problemShape.kw() * ELE_NUM_PER_C0 * sizeof(ElementAccumulator);
+        uint32_t l0bColumns = FmapL1TileShape::Cin1 * problemShape.kh() * problemShape.kw() * ELE_NUM_PER_C0;
+        if (l1DataSize > ArchTag::L1_SIZE || l0cDataSize > ArchTag::L0C_SIZE || howoRound > MAX_LOAD3D_EXTENSION ||
+            l0bColumns > MAX_LOAD3D_EXTENSION) {
+            return false;
+        }
+        return true;
+    }
+
+    /// Construct
+    CATLASS_DEVICE
+    BlockConv2dWgrad(
+        Arch::Resource<ArchTag>& resource, Conv2dParams const& problemShape_, uint32_t l1BufAddrStart = 0)
+        : problemShape(problemShape_), copyL1ToL0B(problemShape_.getFilterParams())
+    {
+        uint32_t hiBlock = (FmapL1TileShape::Ho - 1) * problemShape.strideH() +
+                           (problemShape.kh() - 1) * problemShape.dilationH() + 1;
+        uint32_t howoRound = RoundUp<C0_NUM_PER_FRACTAL>(FmapL1TileShape::Ho * problemShape.wo());
+        l1A_size = FilterL1TileShape::Cout * howoRound * sizeof(ElementGradOutput);
+        l1B_size = FmapL1TileShape::Cin1 * hiBlock * problemShape.wi() * BYTE_PER_C0;
+
+        uint32_t l1AOffset = l1BufAddrStart;
+        uint32_t l1BOffset = l1BufAddrStart + l1A_size * L1A_STAGES;
+
+        // Init buffers
+        for (uint32_t i = 0; i < MAX_STAGES; i++) {
+            if (i < L1A_STAGES) {
+                l1ATensorList[i] =
+                    resource.l1Buf.template GetBufferByByte<ElementGradOutput>(l1AOffset + l1A_size * i);
+                l1AEventList[i] = i;
+                AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[i]);
+            }
+            if (i < L1B_STAGES) {
+                l1BTensorList[i] = resource.l1Buf.template GetBufferByByte<ElementFmap>(l1BOffset + l1B_size * i);
+                l1BEventList[i] = i + L1A_STAGES;
+                AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[i]);
+            }
+            if (i < L0A_STAGES) {
+                l0ATensorList[i] =
+                    resource.l0ABuf.template GetBufferByByte<ElementGradOutput>(L0A_PINGPONG_BUF_SIZE * i);
+                l0AEventList[i] = i;
+                AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[i]);
+            }
+            if (i < L0B_STAGES) {
+                l0BTensorList[i] = resource.l0BBuf.template GetBufferByByte<ElementFmap>(L0B_PINGPONG_BUF_SIZE * i);
+                l0BEventList[i] = i + L0A_STAGES;
+                AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[i]);
+            }
+        }
+        l0CTensor = resource.l0CBuf.template GetBufferByByte<ElementAccumulator>(0);
+        AscendC::SetFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
+    }
+
+    /// Destructor
+    CATLASS_DEVICE
+    ~BlockConv2dWgrad()
+    {
+        for (uint32_t i = 0; i < MAX_STAGES; i++) {
+            if (i < L1A_STAGES) {
+                AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[i]);
+            }
+            if (i < L1B_STAGES) {
+                AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[i]);
+            }
+            if (i < L0A_STAGES) {
+                AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[i]);
+            }
+            if (i < L0B_STAGES) {
+                AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[i]);
+            }
+        }
+        AscendC::WaitFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
+    }
+
+    /// Accumulate one K chunk of the weight gradient tile
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementFmap> const& gmFmap, LayoutFmap const& layoutFmap,
+        AscendC::GlobalTensor<ElementGradOutput> const& gmGradOutput, LayoutGradOutput const& layoutGradOutput,
+        AscendC::GlobalTensor<ElementGradFilter> const& gmGradFilter, LayoutGradFilter const& layoutGradFilter,
+        Conv2dCoord const& actualShape, uint8_t* blockPadList, bool isFirstChunk, bool isLastChunk)
+    {
+        uint32_t hiActual = actualShape.h();
+        uint32_t wiActual = actualShape.w();
+        uint32_t coutActual = actualShape.cout();
+        uint32_t cin1Actual = actualShape.cin1();
+        int32_t hiActualOrg = hiActual + blockPadList[2] + blockPadList[3];
+        uint32_t hoActual =
+            (hiActualOrg - 1 - (problemShape.kh() - 1) * problemShape.dilationH()) / problemShape.strideH() + 1;
+        uint32_t howoActual = hoActual * problemShape.wo();
+        uint32_t howoRound = RoundUp<C0_NUM_PER_FRACTAL>(howoActual);
+        uint32_t cout1Actual = CeilDiv<ELE_NUM_PER_C0>(coutActual);
+        uint32_t coutRound = cout1Actual * ELE_NUM_PER_C0;
+        uint32_t nActual = cin1Actual * problemShape.kh() * problemShape.kw() * ELE_NUM_PER_C0;
+
+        LayoutGradOutput layoutGradOutputInL1{
+            1, cout1Actual, 1, howoRound, ELE_NUM_PER_C0, cout1Actual * howoRound * ELE_NUM_PER_C0,
+            howoRound * ELE_NUM_PER_C0, howoRound * ELE_NUM_PER_C0, ELE_NUM_PER_C0, 1};
+        LayoutFmap layoutFmapInL1{1, cin1Actual, hiActual, wiActual, ELE_NUM_PER_C0};
+
+        // load the output gradient rows, one howoRound plane per cout1, and zero the k tail of every plane
+        auto l1ATensor = l1ATensorList[l1AListId];
+        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[l1AListId]);
+        auto layoutTileGradOutput = layoutGradOutput.GetTileLayout(
+            MakeCoord((uint32_t)1, (uint32_t)1, hoActual, problemShape.wo(), ELE_NUM_PER_C0));
+        LayoutGradOutput layoutGradOutputPlane{1, 1, hoActual, problemShape.wo(), ELE_NUM_PER_C0};
+        for (uint32_t cout1Idx = 0; cout1Idx < cout1Actual; cout1Idx++) {
+            Conv2dFmapCoord gmPlaneOffset{0, cout1Idx, 0, 0, 0};
+            copyGmToL1GradOutput(
+                l1ATensor[cout1Idx * layoutGradOutputInL1.stride(1)],
+                gmGradOutput[layoutGradOutput.GetOffset(gmPlaneOffset)], layoutGradOutputPlane,
+                layoutTileGradOutput);
+        }
+        if (howoRound > howoActual) {
+            AscendC::InitConstValueParams<uint16_t> initConstValueParams;
+            initConstValueParams.repeatTimes = cout1Actual;
+            initConstValueParams.blockNum = howoRound - howoActual;
+            initConstValueParams.dstGap = howoActual;
+            initConstValueParams.initValue = 0;
+            auto l1ATail = l1ATensor[howoActual * ELE_NUM_PER_C0].template ReinterpretCast<uint16_t>();
+            AscendC::InitConstValue(l1ATail, initConstValueParams);
+        }
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[l1AListId]);
+
+        // load the fmap rows covered by the chunk
+        auto l1BTensor = l1BTensorList[l1BListId];
+        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1BListId]);
+        auto layoutTileFmap =
+            layoutFmap.GetTileLayout(MakeCoord((uint32_t)1, cin1Actual, hiActual, wiActual, ELE_NUM_PER_C0));
+        copyGmToL1Fmap(l1BTensor, gmFmap, layoutFmapInL1, layoutTileFmap);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1BListId]);
+
+        if (isFirstChunk) {
+            AscendC::WaitFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
+        }
+
+        uint32_t kL0 = Min(L0TileShape::K, howoRound);
+        uint32_t kPartLoop = CeilDiv(howoRound, kL0);
+        uint32_t nL0 = Min(L0TileShape::N, nActual);
+        uint32_t nPartLoop = CeilDiv(nActual, nL0);
+        auto layoutInL0C = LayoutGradFilterInL0::MakeLayoutInL0C(MakeCoord(coutRound, nActual));
+
+        for (uint32_t kPartIdx = 0; kPartIdx < kPartLoop; kPartIdx++) {
+            uint32_t kPartActual = (kPartIdx < kPartLoop - 1) ? kL0 : (howoRound - kPartIdx * kL0);
+
+            // Load the transposed output gradient of the current k part to L0A
+            auto l0ATile = l0ATensorList[l0AListId];
+            LayoutGradOutputInL0 layoutGradOutputInL0 =
+                LayoutGradOutputInL0::template MakeLayout<ElementGradOutput>(coutRound, kPartActual);
+            AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[l0AListId]);
+            if (kPartIdx == 0) {
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[l1AListId]);
+            }
+            copyL1ToL0A(
+                l0ATile, l1ATensor[kPartIdx * kL0 * ELE_NUM_PER_C0], layoutGradOutputInL0, layoutGradOutputInL1);
+            if (kPartIdx == kPartLoop - 1) {
+                AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[l1AListId]);
+            }
+
+            for (uint32_t nPartIdx = 0; nPartIdx < nPartLoop; nPartIdx++) {
+                uint32_t nPartActual = (nPartIdx < nPartLoop - 1) ? nL0 : (nActual - nPartIdx * nL0);
+
+                // img2col the fmap of the current (k, n) part to L0B
+                auto l0BTile = l0BTensorList[l0BListId];
+                LayoutFmapInL0 layoutFmapInL0 =
+                    LayoutFmapInL0::template MakeLayout<ElementFmap>(kPartActual, nPartActual);
+                AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[l0BListId]);
+                if ((kPartIdx == 0) && (nPartIdx == 0)) {
+                    AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1BListId]);
+                }
+                copyL1ToL0B(
+                    l0BTile, l1BTensor, layoutFmapInL0, layoutFmapInL1, blockPadList, kPartIdx * kL0,
+                    nPartIdx * nL0);
+                if ((kPartIdx == kPartLoop - 1) && (nPartIdx == nPartLoop - 1)) {
+                    AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1BListId]);
+                }
+
+                AscendC::SetFlag<AscendC::HardEvent::MTE1_M>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE1_M>(EVENT_ID0);
+
+                MatrixCoord l0COffset{0, nPartIdx * nL0};
+                auto l0CTile = l0CTensor[layoutInL0C.GetOffset(l0COffset)];
+                // The accumulator is reset only by the first k part of the first chunk of the split-k slice
+                bool initC = isFirstChunk && (kPartIdx == 0);
+                tileMmad(l0CTile, l0ATile, l0BTile, coutRound, nPartActual, kPartActual, initC);
+
+                AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[l0BListId]);
+                l0BListId = (l0BListId + 1 < L0B_STAGES) ? (l0BListId + 1) : 0;
+            }
+            AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[l0AListId]);
+            l0AListId = (l0AListId + 1 < L0A_STAGES) ? (l0AListId + 1) : 0;
+        }
+        l1AListId = (l1AListId + 1 < L1A_STAGES) ? (l1AListId + 1) : 0;
+        l1BListId = (l1BListId + 1 < L1B_STAGES) ? (l1BListId + 1) : 0;
+
+        if (isLastChunk) {
+            // copy block out
+            LayoutGradFilter layoutBlock = layoutGradFilter.GetTileLayout(MakeCoord(
+                cin1Actual, (uint32_t)problemShape.kh(), (uint32_t)problemShape.kw(), coutActual, ELE_NUM_PER_C0));
+            AscendC::SetFlag<AscendC::HardEvent::M_FIX>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::M_FIX>(EVENT_ID0);
+            copyL0CToGm(gmGradFilter, l0CTensor, layoutBlock, coutRound);
+            AscendC::SetFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
+        }
+    }
+
+protected:
+    Conv2dParams problemShape;
+    uint32_t l1A_size, l1B_size;
+
+    // Multi-stage tensors list, L1A holds the output gradient and L1B the fmap
+    AscendC::LocalTensor<ElementGradOutput> l1ATensorList[L1A_STAGES];
+    AscendC::LocalTensor<ElementFmap> l1BTensorList[L1B_STAGES];
+    AscendC::LocalTensor<ElementGradOutput> l0ATensorList[L0A_STAGES];
+    AscendC::LocalTensor<ElementFmap> l0BTensorList[L0B_STAGES];
+    AscendC::LocalTensor<ElementAccumulator> l0CTensor;
+
+    // Multi-stage event id list
+    int32_t l1AEventList[L1A_STAGES];
+    int32_t l1BEventList[L1B_STAGES];
+    int32_t l0AEventList[L0A_STAGES];
+    int32_t l0BEventList[L0B_STAGES];
+
+    // The id of current stage
+    uint32_t l1AListId{0};
+    uint32_t l1BListId{0};
+    uint32_t l0AListId{0};
+    uint32_t l0BListId{0};
+
+    TileMmad tileMmad;
+    CopyGmToL1Fmap copyGmToL1Fmap;
+    CopyGmToL1GradOutput copyGmToL1GradOutput;
+    CopyL1ToL0A copyL1ToL0A;
+    CopyL1ToL0B copyL1ToL0B;
+    CopyL0CToGm copyL0CToGm;
+};
+
+} // namespace Catlass::Conv::Block
+
+#endif // CATLASS_CONV_BLOCK_BLOCK_CONV2D_WGRAD_PINGPONG_HPP
@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_CONV_BLOCK_BLOCK_DEPTHWISE_CONV2D_AIV_HPP
+#define CATLASS_CONV_BLOCK_BLOCK_DEPTHWISE_CONV2D_AIV_HPP
+
+#include "catlass/arch/resource.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/conv/dispatch_policy.hpp"
+#include "catlass/conv_coord.hpp"
+
+namespace Catlass::Conv::Block {
+
+/// Depthwise Conv2d of one (batch, c1) plane on a vector core:
+///   output(ho, wo, c0) = sum_{kh, kw} fmap(ho * strideH + kh * dilationH, wo * strideW + kw * dilationW, c0) *
+///                        filter(kh, kw, c0)
+/// The fmap rows are cast to fp32 once into a ring of (kh - 1) * dilationH + 1 rows, with the left/right pads kept
+/// as zero columns, so consecutive output rows only load the rows entering the window. One output row is
+/// accumulated with strided MulAddDst, one repeat covers 8 output columns per half of C0.
+template <class FmapType_, class FilterType_, class OutputType_>
+struct BlockDepthwiseConv2d<ConvAtlasA2DepthwiseAiv, FmapType_, FilterType_, OutputType_> {
+public:
+    // Type Aliases
+    using DispatchPolicy = ConvAtlasA2DepthwiseAiv;
+    using ArchTag = typename DispatchPolicy::ArchTag;
+    using ElementFmap = typename FmapType_::Element;
+    using LayoutFmap = typename FmapType_::Layout;
+    using ElementFilter = typename FilterType_::Element;
+    using LayoutFilter = typename FilterType_::Layout;
+    using ElementOutput = typename OutputType_::Element;
+    using LayoutOutput = typename OutputType_::Layout;
+    using ElementAccumulator = float;
+
+    static constexpr uint32_t C0 = Conv2dParams::C0;
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(ElementAccumulator);
+    static constexpr uint32_t WO_NUM_PER_REPEAT = BYTE_PER_VECTOR_FRACTAL / BYTE_PER_BLK;
+    static constexpr uint32_t MAX_REPEAT_TIMES = 255;
+    static constexpr uint32_t MAX_REPEAT_STRIDE = 255;
+
+    static_assert(
+        std::is_same_v<ElementFmap, half> && std::is_same_v<ElementFilter, half> &&
+            std::is_same_v<ElementOutput, half>,
+        "Depthwise conv on the vector cores only supports half fmap/filter/output yet!");
+    static_assert(
+        std::is_same_v<LayoutFmap, layout::NC1HWC0> && std::is_same_v<LayoutFilter, layout::CI1KHKWCOCI0> &&
+            std::is_same_v<LayoutOutput, layout::NC1HWC0>,
+        "Depthwise conv only supports NC1HWC0 fmap/output and CI1KHKWCOCI0 filter with cout 1 yet!");
+
+    struct UbPlan {
+        uint32_t ringRows;
+        uint32_t rowLen;
+        uint32_t woRound;
+        uint32_t filterLen;
+        uint32_t totalSize;
+    };
+
+    CATLASS_HOST_DEVICE
+    static UbPlan GetUbPlan(Conv2dParams const& problemShape)
+    {
+        UbPlan plan;
+        plan.ringRows = (problemShape.kh() - 1) * problemShape.dilationH() + 1;
+        plan.woRound = RoundUp<WO_NUM_PER_REPEAT>(problemShape.wo());
+        // The last repeat may read past the right pad, keep the row long enough for it
+        uint32_t rowCols = problemShape.wi() + problemShape.padLeft() + problemShape.padRight();
+        uint32_t readCols =
+            (plan.woRound - 1) * problemShape.strideW() + (problemShape.kw() - 1) * problemShape.dilationW() + 1;
+        plan.rowLen = ((rowCols > readCols) ? rowCols : readCols) * C0;
+        plan.filterLen = problemShape.kh() * problemShape.kw() * C0;
+        plan.totalSize = plan.ringRows * plan.rowLen * sizeof(ElementAccumulator) +
+                         plan.filterLen * (sizeof(ElementAccumulator) + sizeof(ElementFilter)) +
+                         problemShape.wi() * C0 * sizeof(ElementFmap) +
+                         plan.woRound * C0 * (sizeof(ElementAccumulator) + sizeof(ElementOutput));
+        return plan;
+    }
+
+    static bool CanImplement(Conv2dParams const& problemShape)
+    {
+        UbPlan plan = GetUbPlan(problemShape);
+        return plan.totalSize <= ArchTag::UB_SIZE && plan.woRound / WO_NUM_PER_REPEAT <= MAX_REPEAT_TIMES &&
+               WO_NUM_PER_REPEAT * problemShape.strideW() * C0 / ELE_NUM_PER_BLK <= MAX_REPEAT_STRIDE;
+    }
+
+    /// Construct
+    CATLASS_DEVICE
+    BlockDepthwiseConv2d(Arch::Resource<ArchTag>& resource, Conv2dParams const& problemShape_)
+        : problemShape(problemShape_)
+    {
+        plan = GetUbPlan(problemShape);
+        uint32_t ubOffset = 0;
+        ringUb = resource.ubBuf.template GetBufferByByte<ElementAccumulator>(ubOffset);
+        ubOffset += plan.ringRows * plan.rowLen * sizeof(ElementAccumulator);
+        filterUb = resource.ubBuf.template GetBufferByByte<ElementAccumulator>(ubOffset);
+        ubOffset += plan.filterLen * sizeof(ElementAccumulator);
+        filterInUb = resource.ubBuf.template GetBufferByByte<ElementFilter>(ubOffset);
+        ubOffset += plan.filterLen * sizeof(ElementFilter);
+        rowInUb = resource.ubBuf.template GetBufferByByte<ElementFmap>(ubOffset);
+        ubOffset += problemShape.wi() * C0 * sizeof(ElementFmap);
+        accUb = resource.ubBuf.template GetBufferByByte<ElementAccumulator>(ubOffset);
+        ubOffset += plan.woRound * C0 * sizeof(ElementAccumulator);
+        outUb = resource.ubBuf.template GetBufferByByte<ElementOutput>(ubOffset);
+
+        // The pad columns of the ring are never written by the row loads
+        AscendC::Duplicate<ElementAccumulator>(ringUb, 0, plan.ringRows * plan.rowLen);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    /// Destructor
+    CATLASS_DEVICE
+    ~BlockDepthwiseConv2d()
+    {
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    /// Compute output rows [hoStart, hoStart + hoActual) of one plane, gmFmap and gmFilter point at the plane,
+    /// gmOutput at its row hoStart
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementFmap> const& gmFmap, LayoutFmap const& layoutFmap,
+        AscendC::GlobalTensor<ElementFilter> const& gmFilter, AscendC::GlobalTensor<ElementOutput> const& gmOutput,
+        LayoutOutput const& layoutOutput, uint32_t hoStart, uint32_t hoActual)
+    {
+        uint32_t kh = problemShape.kh();
+        uint32_t kw = problemShape.kw();
+        uint32_t hi = problemShape.hi();
+        uint32_t wiLen = problemShape.wi() * C0;
+        uint32_t woLen = problemShape.wo() * C0;
+
+        // Load the kh * kw * C0 weights of the plane
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::DataCopy(filterInUb, gmFilter, plan.filterLen);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+        AscendC::Cast(filterUb, filterInUb, AscendC::RoundMode::CAST_NONE, plan.filterLen);
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+
+        AscendC::BinaryRepeatParams repeatParams;
+        repeatParams.dstBlkStride = C0 / ELE_NUM_PER_BLK;
+        repeatParams.src0BlkStride = problemShape.strideW() * C0 / ELE_NUM_PER_BLK;
+        repeatParams.src1BlkStride = 0;
+        repeatParams.dstRepStride = WO_NUM_PER_REPEAT * C0 / ELE_NUM_PER_BLK;
+        repeatParams.src0RepStride = WO_NUM_PER_REPEAT * problemShape.strideW() * C0 / ELE_NUM_PER_BLK;
+        repeatParams.src1RepStride = 0;
+        uint8_t repeatTimes = plan.woRound / WO_NUM_PER_REPEAT;
+
+        // First fmap row that is not in the ring yet
+        int32_t nextHi = 0;
+        for (uint32_t hoIdx = hoStart; hoIdx < hoStart + hoActual; hoIdx++) {
+            int32_t windowStart = static_cast<int32_t>(hoIdx * problemShape.strideH()) - problemShape.padTop();
+            int32_t windowEnd = windowStart + static_cast<int32_t>(plan.ringRows) - 1;
+            int32_t loadStart = (nextHi > windowStart) ? nextHi : windowStart;
+            loadStart = (loadStart > 0) ? loadStart : 0;
+            int32_t loadEnd = (windowEnd < static_cast<int32_t>(hi) - 1) ? windowEnd : static_cast<int32_t>(hi) - 1;
+            for (int32_t hiIdx = loadStart; hiIdx <= loadEnd; hiIdx++) {
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+                AscendC::DataCopy(rowInUb, gmFmap[hiIdx * layoutFmap.stride(2)], wiLen);
+                AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+                uint32_t ringOffset = hiIdx % plan.ringRows * plan.rowLen + problemShape.padLeft() * C0;
+                AscendC::Cast(ringUb[ringOffset], rowInUb, AscendC::RoundMode::CAST_NONE, wiLen);
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+            }
+            nextHi = (loadEnd + 1 > nextHi) ? loadEnd + 1 : nextHi;
+            AscendC::PipeBarrier<PIPE_V>();
+
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+            AscendC::Duplicate<ElementAccumulator>(accUb, 0, plan.woRound * C0);
+            AscendC::PipeBarrier<PIPE_V>();
+            for (uint32_t khIdx = 0; khIdx < kh; khIdx++) {
+                int32_t hiIdx = windowStart + static_cast<int32_t>(khIdx * problemShape.dilationH());
+                if (hiIdx < 0 || hiIdx > static_cast<int32_t>(hi) - 1) {
+                    continue;
+                }
+                uint32_t rowOffset = hiIdx % plan.ringRows * plan.rowLen;
+                for (uint32_t kwIdx = 0; kwIdx < kw; kwIdx++) {
+                    uint32_t srcOffset = rowOffset + kwIdx * problemShape.dilationW() * C0;
+                    uint32_t filterOffset = (khIdx * kw + kwIdx) * C0;
+                    for (uint32_t c0Idx = 0; c0Idx < C0; c0Idx += ELE_NUM_PER_BLK) {
+                        AscendC::MulAddDst<ElementAccumulator, ElementAccumulator, true>(
+                            accUb[c0Idx], ringUb[srcOffset + c0Idx], filterUb[filterOffset + c0Idx],
+                            static_cast<uint64_t>(WO_NUM_PER_REPEAT * ELE_NUM_PER_BLK), repeatTimes, repeatParams);
+                    }
+                    AscendC::PipeBarrier<PIPE_V>();
+                }
+            }
+            AscendC::Cast(outUb, accUb, AscendC::RoundMode::CAST_RINT, woLen);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+            AscendC::DataCopy(gmOutput[(hoIdx - hoStart) * layoutOutput.stride(2)], outUb, woLen);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        }
+    }
+
+protected:
+    Conv2dParams problemShape;
+    UbPlan plan;
+    AscendC::LocalTensor<ElementAccumulator> ringUb;
+    AscendC::LocalTensor<ElementAccumulator> filterUb;
+    AscendC::LocalTensor<ElementFilter> filterInUb;
+    AscendC::LocalTensor<ElementFmap> rowInUb;
+    AscendC::LocalTensor<ElementAccumulator> accUb;
+    AscendC::LocalTensor<ElementOutput> outUb;
+};
+
+} // namespace Catlass::Conv::Block
+
+#endif // CATLASS_CONV_BLOCK_BLOCK_DEPTHWISE_CONV2D_AIV_HPP
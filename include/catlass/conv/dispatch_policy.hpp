@@ -27,6 +27,9 @@ struct ConvBase {
 using ConvAtlasA2 = ConvBase<Arch::AtlasA2, false>;
 using ConvAtlasA2Async = ConvBase<Arch::AtlasA2, true>;
 
+/// Depthwise conv (groups == channels) on the vector cores, rows of fmap are kept in UB as a sliding window
+struct ConvAtlasA2DepthwiseAiv : public ConvAtlasA2 {};
+
 template <
     uint32_t L1A_STAGES_, uint32_t L1B_STAGES_, uint32_t L0A_STAGES_, uint32_t L0B_STAGES_, uint32_t L0C_STAGES_,
     bool ENABLE_UNIT_FLAG_>
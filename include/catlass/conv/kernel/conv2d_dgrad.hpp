@@ -0,0 +1,349 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_CONV_KERNEL_CONV2D_DGRAD_HPP
+#define CATLASS_CONV_KERNEL_CONV2D_DGRAD_HPP
+
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/conv/kernel/basic_conv2d.hpp"
+#include "catlass/conv_coord.hpp"
+
+namespace Catlass::Conv::Kernel {
+
+// Template for the data gradient of Conv2d. Compute gradFmap = transposed conv(gradOutput, filter)
+// The AIV cores zero-insert gradOutput by the strides (only when a stride is larger than 1) and flip the filter
+// into (Cout1, Kh, Kw, Cin, C0) in the workspace, then the AIC cores run BasicConv2d with stride 1, the same
+// dilations and the complementary pads, whose output is exactly (Batch, Cin1, Hi, Wi, C0).
+template <class BlockConv2d_, class BlockEpilogue_, class BlockScheduler_>
+class Conv2dDgrad {
+public:
+    using Conv2dKernel = BasicConv2d<BlockConv2d_, BlockEpilogue_, BlockScheduler_>;
+    using BlockConv2d = BlockConv2d_;
+    using ArchTag = typename BlockConv2d::ArchTag;
+    using ElementGradOutput = typename BlockConv2d::ElementFmap;
+    using LayoutGradOutput = typename BlockConv2d::LayoutFmap;
+    using ElementFilter = typename BlockConv2d::ElementFilter;
+    using LayoutFilter = typename BlockConv2d::LayoutFilter;
+
+    static constexpr uint32_t C0 = Conv2dParams::C0;
+    static constexpr int32_t MAX_PAD = 255;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        Conv2dParams problemShape;
+        GM_ADDR ptrGradOutput;
+        LayoutGradOutput layoutGradOutput;
+        GM_ADDR ptrFilter;
+        LayoutFilter layoutFilter;
+        GM_ADDR ptrGradOutputDilated;
+        LayoutGradOutput layoutGradOutputDilated;
+        GM_ADDR ptrFilterFlipped;
+        LayoutFilter layoutFilterFlipped;
+        typename Conv2dKernel::Params conv2dParams;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            Conv2dParams const& problemShape_, GM_ADDR ptrGradOutput_, LayoutGradOutput layoutGradOutput_,
+            GM_ADDR ptrFilter_, LayoutFilter layoutFilter_, GM_ADDR ptrGradOutputDilated_,
+            LayoutGradOutput layoutGradOutputDilated_, GM_ADDR ptrFilterFlipped_, LayoutFilter layoutFilterFlipped_,
+            typename Conv2dKernel::Params const& conv2dParams_)
+            : problemShape(problemShape_),
+              ptrGradOutput(ptrGradOutput_),
+              layoutGradOutput(layoutGradOutput_),
+              ptrFilter(ptrFilter_),
+              layoutFilter(layoutFilter_),
+              ptrGradOutputDilated(ptrGradOutputDilated_),
+              layoutGradOutputDilated(layoutGradOutputDilated_),
+              ptrFilterFlipped(ptrFilterFlipped_),
+              layoutFilterFlipped(layoutFilterFlipped_),
+              conv2dParams(conv2dParams_)
+        {}
+    };
+
+    struct Arguments {
+        Conv2dParams problemShape; // shape of the forward conv
+        GM_ADDR ptrGradOutput;
+        GM_ADDR ptrFilter;
+        GM_ADDR ptrGradFmap;
+    };
+
+    static bool NeedDilate(Conv2dParams const& problemShape)
+    {
+        return problemShape.strideH() > 1 || problemShape.strideW() > 1;
+    }
+
+    /// Pads of the stride-1 conv over the zero-inserted gradOutput, {padLeft, padRight, padTop, padBottom}.
+    /// The far side also takes back the rows and columns the forward conv dropped when the stride did not divide.
+    static void GetDgradPads(Conv2dParams const& problemShape, int32_t* dgradPads)
+    {
+        int32_t filterExtentW = problemShape.dilationW() * (problemShape.kw() - 1);
+        int32_t filterExtentH = problemShape.dilationH() * (problemShape.kh() - 1);
+        int32_t remainW =
+            (problemShape.wi() + problemShape.padLeft() + problemShape.padRight() - filterExtentW - 1) %
+            problemShape.strideW();
+        int32_t remainH =
+            (problemShape.hi() + problemShape.padTop() + problemShape.padBottom() - filterExtentH - 1) %
+            problemShape.strideH();
+        dgradPads[0] = filterExtentW - problemShape.padLeft();
+        dgradPads[1] = filterExtentW - problemShape.padRight() + remainW;
+        dgradPads[2] = filterExtentH - problemShape.padTop();
+        dgradPads[3] = filterExtentH - problemShape.padBottom() + remainH;
+    }
+
+    static Conv2dParams GetDgradProblemShape(Conv2dParams const& problemShape)
+    {
+        int32_t dgradPads[4];
+        GetDgradPads(problemShape, dgradPads);
+        uint32_t hd = (problemShape.ho() - 1) * problemShape.strideH() + 1;
+        uint32_t wd = (problemShape.wo() - 1) * problemShape.strideW() + 1;
+        return Conv2dParams(
+            problemShape.batch(), hd, wd, problemShape.cout1() * C0, problemShape.cin(), problemShape.kh(),
+            problemShape.kw(), static_cast<uint8_t>(dgradPads[0]), static_cast<uint8_t>(dgradPads[1]),
+            static_cast<uint8_t>(dgradPads[2]), static_cast<uint8_t>(dgradPads[3]), 1, 1, problemShape.dilationH(),
+            problemShape.dilationW());
+    }
+
+    static bool CanImplement(const Arguments& args)
+    {
+        if (args.problemShape.strideH() == 0 || args.problemShape.strideW() == 0 ||
+            args.problemShape.dilationH() == 0 || args.problemShape.dilationW() == 0) {
+            return false;
+        }
+        // The complementary pads must fit the pads of the forward conv
+        int32_t dgradPads[4];
+        GetDgradPads(args.problemShape, dgradPads);
+        for (uint32_t i = 0; i < 4; i++) {
+            if (dgradPads[i] < 0 || dgradPads[i] > MAX_PAD) {
+                return false;
+            }
+        }
+        // One filter row (Cout1 fractals) and its transpose, or one zero-inserted row with its zero row, in UB
+        uint32_t wd = (args.problemShape.wo() - 1) * args.problemShape.strideW() + 1;
+        if (args.problemShape.cout1() * BYTE_PER_FRACTAL * 2 > ArchTag::UB_SIZE ||
+            wd * BYTE_PER_C0 * 2 > ArchTag::UB_SIZE) {
+            return false;
+        }
+        typename Conv2dKernel::Arguments conv2dArgs{
+            GetDgradProblemShape(args.problemShape), args.ptrGradOutput, args.ptrFilter, args.ptrGradFmap};
+        return Conv2dKernel::CanImplement(conv2dArgs);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        Conv2dParams dgradShape = GetDgradProblemShape(args.problemShape);
+        size_t sizeFilterFlipped = static_cast<size_t>(dgradShape.cin1()) * dgradShape.kh() * dgradShape.kw() *
+                                   dgradShape.cout() * C0 * sizeof(ElementFilter);
+        size_t sizeGradOutputDilated = 0;
+        if (NeedDilate(args.problemShape)) {
+            sizeGradOutputDilated = static_cast<size_t>(dgradShape.batch()) * dgradShape.cin1() * dgradShape.hi() *
+                                    dgradShape.wi() * C0 * sizeof(ElementGradOutput);
+        }
+        return sizeFilterFlipped + sizeGradOutputDilated;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        Conv2dParams const& problemShape = args.problemShape;
+        Conv2dParams dgradShape = GetDgradProblemShape(problemShape);
+        LayoutGradOutput layoutGradOutput{
+            problemShape.batch(), problemShape.cout1(), problemShape.ho(), problemShape.wo(), C0};
+        LayoutFilter layoutFilter{problemShape.cin1(), problemShape.kh(), problemShape.kw(), problemShape.cout(), C0};
+        LayoutGradOutput layoutGradOutputDilated{
+            dgradShape.batch(), dgradShape.cin1(), dgradShape.hi(), dgradShape.wi(), C0};
+        LayoutFilter layoutFilterFlipped{dgradShape.cin1(), dgradShape.kh(), dgradShape.kw(), dgradShape.cout(), C0};
+
+        GM_ADDR ptrFilterFlipped = workspace;
+        GM_ADDR ptrGradOutputDilated = args.ptrGradOutput;
+        if (NeedDilate(problemShape)) {
+            ptrGradOutputDilated = workspace + layoutFilterFlipped.Capacity() * sizeof(ElementFilter);
+        }
+
+        typename Conv2dKernel::Arguments conv2dArgs{
+            dgradShape, ptrGradOutputDilated, ptrFilterFlipped, args.ptrGradFmap};
+        Params params{problemShape,
+                      args.ptrGradOutput,
+                      layoutGradOutput,
+                      args.ptrFilter,
+                      layoutFilter,
+                      ptrGradOutputDilated,
+                      layoutGradOutputDilated,
+                      ptrFilterFlipped,
+                      layoutFilterFlipped,
+                      Conv2dKernel::ToUnderlyingArguments(conv2dArgs, nullptr)};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    Conv2dDgrad()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    /// Prepares the flipped filter and the zero-inserted gradOutput
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        FlipFilter(params);
+        if (NeedDilate(params.problemShape)) {
+            DilateGradOutput(params);
+        }
+        // 0x0 synchronization control between AI Core
+        Catlass::Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+        Catlass::Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagAivFinishPrepare);
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+    /// Executes the transposed conv
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        Catlass::Arch::CrossCoreWaitFlag(flagAivFinishPrepare);
+
+        Conv2dKernel conv2d;
+        conv2d.template operator()<AscendC::AIC>(params.conv2dParams);
+    }
+
+private:
+    /// filterFlipped[cout1][Kh - 1 - kh][Kw - 1 - kw][cin][cout0] = filter[cin1][kh][kw][cout][cin0]
+    /// Every (cin1, kh, kw) row of the filter is Cout1 fractals of (cout0, cin0), each is transposed by one
+    /// vector Transpose and lands as the (cin0, cout0) fractal of another cout1 plane.
+    CATLASS_DEVICE
+    void FlipFilter(Params const& params)
+    {
+        AscendC::GlobalTensor<ElementFilter> gmFilter;
+        gmFilter.SetGlobalBuffer(reinterpret_cast<__gm__ ElementFilter*>(params.ptrFilter));
+        AscendC::GlobalTensor<ElementFilter> gmFilterFlipped;
+        gmFilterFlipped.SetGlobalBuffer(reinterpret_cast<__gm__ ElementFilter*>(params.ptrFilterFlipped));
+
+        constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL / sizeof(ElementFilter);
+        uint32_t cout = params.problemShape.cout();
+        uint32_t cout1 = params.problemShape.cout1();
+        uint32_t kh = params.problemShape.kh();
+        uint32_t kw = params.problemShape.kw();
+        uint32_t rowNum = params.problemShape.cin1() * kh * kw;
+        uint32_t strideCout1Flipped = params.layoutFilterFlipped.stride(0);
+
+        auto ubSrc = resource.ubBuf.template GetBufferByByte<ElementFilter>(0);
+        auto ubDst = resource.ubBuf.template GetBufferByByte<ElementFilter>(cout1 * BYTE_PER_FRACTAL);
+
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+        for (uint32_t rowIdx = AscendC::GetBlockIdx(); rowIdx < rowNum; rowIdx += aivNum) {
+            uint32_t cin1Idx = rowIdx / (kh * kw);
+            uint32_t khIdx = rowIdx / kw % kh;
+            uint32_t kwIdx = rowIdx % kw;
+
+            // The cout tail of the last fractal is zero in the flipped filter
+            if (cout < cout1 * C0) {
+                AscendC::Duplicate<ElementFilter>(
+                    ubSrc[(cout1 - 1) * ELE_NUM_PER_FRACTAL], (ElementFilter)0, ELE_NUM_PER_FRACTAL);
+            }
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+            Conv2dFilterCoord srcOffset{cin1Idx, khIdx, kwIdx, 0, 0};
+            AscendC::DataCopyPad(
+                ubSrc, gmFilter[params.layoutFilter.GetOffset(srcOffset)],
+                AscendC::DataCopyExtParams(1, cout * C0 * sizeof(ElementFilter), 0, 0, 0),
+                AscendC::DataCopyPadExtParams<ElementFilter>(false, 0, 0, 0));
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+
+            for (uint32_t cout1Idx = 0; cout1Idx < cout1; cout1Idx++) {
+                AscendC::Transpose(ubDst[cout1Idx * ELE_NUM_PER_FRACTAL], ubSrc[cout1Idx * ELE_NUM_PER_FRACTAL]);
+            }
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+
+            Conv2dFilterCoord dstOffset{0, kh - 1 - khIdx, kw - 1 - kwIdx, cin1Idx * C0, 0};
+            AscendC::DataCopyPad(
+                gmFilterFlipped[params.layoutFilterFlipped.GetOffset(dstOffset)], ubDst,
+                AscendC::DataCopyExtParams(
+                    cout1, BYTE_PER_FRACTAL, 0, (strideCout1Flipped - ELE_NUM_PER_FRACTAL) * sizeof(ElementFilter),
+                    0));
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        }
+    }
+
+    /// gradOutputDilated[n][cout1][ho * strideH][wo * strideW][c0] = gradOutput[n][cout1][ho][wo][c0], zero elsewhere.
+    /// A dilated row is either all zero or one gradOutput row scattered by a strided copy into a zeroed row.
+    CATLASS_DEVICE
+    void DilateGradOutput(Params const& params)
+    {
+        AscendC::GlobalTensor<ElementGradOutput> gmGradOutput;
+        gmGradOutput.SetGlobalBuffer(reinterpret_cast<__gm__ ElementGradOutput*>(params.ptrGradOutput));
+        AscendC::GlobalTensor<ElementGradOutput> gmGradOutputDilated;
+        gmGradOutputDilated.SetGlobalBuffer(
+            reinterpret_cast<__gm__ ElementGradOutput*>(params.ptrGradOutputDilated));
+
+        uint32_t strideH = params.problemShape.strideH();
+        uint32_t strideW = params.problemShape.strideW();
+        uint32_t wo = params.problemShape.wo();
+        uint32_t batch = params.layoutGradOutputDilated.shape(0);
+        uint32_t cout1 = params.layoutGradOutputDilated.shape(1);
+        uint32_t hd = params.layoutGradOutputDilated.shape(2);
+        uint32_t wd = params.layoutGradOutputDilated.shape(3);
+        uint32_t rowLen = wd * C0;
+
+        auto ubZero = resource.ubBuf.template GetBufferByByte<ElementGradOutput>(0);
+        auto ubRow = resource.ubBuf.template GetBufferByByte<ElementGradOutput>(rowLen * sizeof(ElementGradOutput));
+        AscendC::Duplicate<ElementGradOutput>(ubZero, (ElementGradOutput)0, rowLen);
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+        uint32_t rowNum = batch * cout1 * hd;
+        for (uint32_t rowIdx = AscendC::GetBlockIdx(); rowIdx < rowNum; rowIdx += aivNum) {
+            uint32_t batchIdx = rowIdx / (cout1 * hd);
+            uint32_t cout1Idx = rowIdx / hd % cout1;
+            uint32_t hdIdx = rowIdx % hd;
+            Conv2dFmapCoord dstOffset{batchIdx, cout1Idx, hdIdx, 0, 0};
+            auto gmDstRow = gmGradOutputDilated[params.layoutGradOutputDilated.GetOffset(dstOffset)];
+            if (hdIdx % strideH != 0) {
+                AscendC::DataCopyPad(
+                    gmDstRow, ubZero, AscendC::DataCopyExtParams(1, rowLen * sizeof(ElementGradOutput), 0, 0, 0));
+                continue;
+            }
+            AscendC::Duplicate<ElementGradOutput>(ubRow, (ElementGradOutput)0, rowLen);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+            Conv2dFmapCoord srcOffset{batchIdx, cout1Idx, hdIdx / strideH, 0, 0};
+            AscendC::DataCopyPad(
+                ubRow, gmGradOutput[params.layoutGradOutput.GetOffset(srcOffset)],
+                AscendC::DataCopyExtParams(wo, BYTE_PER_C0, 0, strideW - 1, 0),
+                AscendC::DataCopyPadExtParams<ElementGradOutput>(false, 0, 0, 0));
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE3>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE3>(EVENT_ID0);
+            AscendC::DataCopyPad(
+                gmDstRow, ubRow, AscendC::DataCopyExtParams(1, rowLen * sizeof(ElementGradOutput), 0, 0, 0));
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        }
+    }
+
+    static constexpr Arch::FlagID FLAG_AIV_FINISH_PREPARE = 0;
+    Arch::CrossCoreFlag flagAivFinishPrepare{FLAG_AIV_FINISH_PREPARE};
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Conv::Kernel
+
+#endif // CATLASS_CONV_KERNEL_CONV2D_DGRAD_HPP
@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_CONV_KERNEL_CONV2D_EPILOGUE_HPP
+#define CATLASS_CONV_KERNEL_CONV2D_EPILOGUE_HPP
+
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/conv_coord.hpp"
+
+namespace Catlass::Conv::Kernel {
+
+// Template for Conv2d with a vector epilogue. Compute output = epilogue(fmap x filter)
+// The cube cores store every output block to a workspace with the NC1HWC0 layout of the output and signal the vector
+// cores, which apply the block epilogue (e.g. folded BatchNorm, activation and residual add) and store the output once.
+template <class BlockConv2d_, class BlockEpilogue_, class BlockScheduler_>
+class Conv2dEpilogue {
+public:
+    using BlockConv2d = BlockConv2d_;
+    using ArchTag = typename BlockConv2d::ArchTag;
+    using FmapL1TileShape = typename BlockConv2d::FmapL1TileShape;
+    using FilterL1TileShape = typename BlockConv2d::FilterL1TileShape;
+    using ElementFmap = typename BlockConv2d::ElementFmap;
+    using LayoutFmap = typename BlockConv2d::LayoutFmap;
+    using ElementFilter = typename BlockConv2d::ElementFilter;
+    using LayoutFilter = typename BlockConv2d::LayoutFilter;
+    using ElementOutput = typename BlockConv2d::ElementOutput;
+    using LayoutOutput = typename BlockConv2d::LayoutOutput;
+
+    using BlockEpilogue = BlockEpilogue_;
+    using ElementD = typename BlockEpilogue::ElementD;
+    using LayoutD = typename BlockEpilogue::LayoutD;
+    using EpilogueParams = typename BlockEpilogue::Params;
+
+    using BlockScheduler = BlockScheduler_;
+
+    static constexpr uint16_t C0 = BYTE_PER_C0 / sizeof(ElementOutput);
+
+    static_assert(
+        std::is_same_v<typename BlockEpilogue::ElementC, ElementOutput> &&
+            std::is_same_v<typename BlockEpilogue::LayoutC, LayoutOutput>,
+        "The output type of Conv2d and the CType of Epilogue should be consistent.");
+    static_assert(
+        FmapL1TileShape::Wo * C0 <= BlockEpilogue::COMPUTE_LENGTH,
+        "One output row of a block must fit the compute length of the epilogue");
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        Conv2dParams problemShape;
+        GM_ADDR ptrFmap;
+        LayoutFmap layoutFmap;
+        GM_ADDR ptrFilter;
+        LayoutFilter layoutFilter;
+        GM_ADDR ptrWorkspace;
+        LayoutOutput layoutOutput;
+        EpilogueParams epilogueParams;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            Conv2dParams const& problemShape_, GM_ADDR ptrFmap_, LayoutFmap layoutFmap_, GM_ADDR ptrFilter_,
+            LayoutFilter layoutFilter_, GM_ADDR ptrWorkspace_, LayoutOutput layoutOutput_,
+            EpilogueParams const& epilogueParams_)
+            : problemShape(problemShape_),
+              ptrFmap(ptrFmap_),
+              layoutFmap(layoutFmap_),
+              ptrFilter(ptrFilter_),
+              layoutFilter(layoutFilter_),
+              ptrWorkspace(ptrWorkspace_),
+              layoutOutput(layoutOutput_),
+              epilogueParams(epilogueParams_)
+        {}
+    };
+
+    struct Arguments {
+        Conv2dParams problemShape;
+        GM_ADDR ptrFmap;
+        GM_ADDR ptrFilter;
+        GM_ADDR ptrScale;    // Cout1 * C0 fp32
+        GM_ADDR ptrShift;    // Cout1 * C0 fp32
+        GM_ADDR ptrResidual; // same shape as the output, nullptr if there is no residual
+        GM_ADDR ptrOutput;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        if (args.problemShape.strideH() == 0 || args.problemShape.strideW() == 0 ||
+            args.problemShape.dilationH() == 0 || args.problemShape.dilationW() == 0) {
+            return false;
+        }
+        return BlockConv2d::CanImplement(args.problemShape.getFilterParams());
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        Conv2dParams const& problemShape = args.problemShape;
+        return static_cast<size_t>(problemShape.batch()) * problemShape.cout1() * problemShape.ho() *
+               problemShape.wo() * C0 * sizeof(ElementOutput);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        Conv2dParams const& problemShape = args.problemShape;
+        LayoutFmap layoutFmap{problemShape.batch(), problemShape.cin1(), problemShape.hi(), problemShape.wi(), C0};
+        LayoutFilter layoutFilter{problemShape.cin1(), problemShape.kh(), problemShape.kw(), problemShape.cout(), C0};
+        LayoutOutput layoutOutput{problemShape.batch(), problemShape.cout1(), problemShape.ho(), problemShape.wo(), C0};
+        EpilogueParams epilogueParams{args.ptrScale,    args.ptrShift, args.ptrResidual,
+                                      layoutOutput,     args.ptrOutput, layoutOutput};
+        Params params{problemShape, args.ptrFmap, layoutFmap,   args.ptrFilter,
+                      layoutFilter, workspace,    layoutOutput, epilogueParams};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    Conv2dEpilogue()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    /// Executes one Conv2d into the workspace
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        Conv2dParams const& problemShape = params.problemShape;
+        BlockScheduler conv2dBlockScheduler(
+            problemShape.getPostIm2colShape(),
+            MakeCoord(FmapL1TileShape::Ho, FmapL1TileShape::Wo, FilterL1TileShape::Cout));
+        uint32_t loops = conv2dBlockScheduler.GetLoops();
+
+        BlockConv2d blockConv2d(resource, problemShape.getFilterParams());
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementFmap> gmFmap;
+        gmFmap.SetGlobalBuffer((__gm__ ElementFmap*)params.ptrFmap);
+        AscendC::GlobalTensor<ElementFilter> gmFilter;
+        gmFilter.SetGlobalBuffer((__gm__ ElementFilter*)params.ptrFilter);
+        AscendC::GlobalTensor<ElementOutput> gmOutput;
+        gmOutput.SetGlobalBuffer((__gm__ ElementOutput*)params.ptrWorkspace);
+
+        for (uint32_t loopIdx = AscendC::GetBlockIdx(); loopIdx < loops; loopIdx += AscendC::GetBlockNum()) {
+            // Compute block location
+            Conv2dCoord blockCoord = conv2dBlockScheduler.GetBlockCoord(loopIdx);
+            Conv2dCoord actualBlockShape = conv2dBlockScheduler.GetActualBlockShape(blockCoord);
+
+            uint8_t blockPadLeft = 0, blockPadRight = 0, blockPadTop = 0, blockPadBottom = 0;
+
+            // Compute indices of hi
+            uint32_t hoStart = blockCoord.h() * FmapL1TileShape::Ho;
+            int32_t hiStart = hoStart * problemShape.strideH() - problemShape.padTop();
+            int32_t hiEnd = hiStart + (actualBlockShape.h() - 1) * problemShape.strideH() +
+                            (problemShape.kh() - 1) * problemShape.dilationH();
+            if (hiStart < 0) {
+                blockPadTop = 0 - hiStart;
+                hiStart = 0;
+            }
+            if (hiEnd > static_cast<int32_t>(problemShape.hi()) - 1) {
+                blockPadBottom = hiEnd - (problemShape.hi() - 1);
+                hiEnd = problemShape.hi() - 1;
+            }
+            uint32_t hiActual = hiEnd - hiStart + 1;
+
+            // Compute indexes of wi
+            uint32_t woStart = blockCoord.w() * FmapL1TileShape::Wo;
+            int32_t wiStart = woStart * problemShape.strideW() - problemShape.padLeft();
+            int32_t wiEnd = wiStart + (actualBlockShape.w() - 1) * problemShape.strideW() +
+                            (problemShape.kw() - 1) * problemShape.dilationW();
+            if (wiStart < 0) {
+                blockPadLeft = 0 - wiStart;
+                wiStart = 0;
+            }
+            if (wiEnd > static_cast<int32_t>(problemShape.wi()) - 1) {
+                blockPadRight = wiEnd - (problemShape.wi() - 1);
+                wiEnd = problemShape.wi() - 1;
+            }
+            uint32_t wiActual = wiEnd - wiStart + 1;
+
+            Conv2dCoord actualConv2dBlockShape(1, hiActual, wiActual, actualBlockShape.cout(), actualBlockShape.cin1());
+            uint8_t blockPadList[4] = {blockPadLeft, blockPadRight, blockPadTop, blockPadBottom};
+
+            // Compute initial location in logical coordinates
+            Conv2dFmapCoord offsetFmap{blockCoord.batch(), 0, (uint32_t)hiStart, (uint32_t)wiStart, 0};
+            Conv2dFilterCoord offsetFilter{0, 0, 0, blockCoord.cout() * FilterL1TileShape::Cout, 0};
+            Conv2dFmapCoord offsetOutput{
+                blockCoord.batch(), blockCoord.cout() * FilterL1TileShape::Cout / C0, hoStart, woStart, 0};
+            int64_t gmOffsetFmap = params.layoutFmap.GetOffset(offsetFmap);
+            int64_t gmOffsetFilter = params.layoutFilter.GetOffset(offsetFilter);
+            int64_t gmOffsetOutput = params.layoutOutput.GetOffset(offsetOutput);
+
+            // Compute block-scoped conv2d
+            blockConv2d(
+                gmFmap[gmOffsetFmap], params.layoutFmap, gmFilter[gmOffsetFilter], params.layoutFilter,
+                gmOutput[gmOffsetOutput], params.layoutOutput, actualConv2dBlockShape, blockPadList);
+
+            Arch::CrossCoreSetFlagWithReverse<0x2, PIPE_FIX>(flagAicFinishStore);
+        }
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+    /// Applies the epilogue to every block the matching cube core stored
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        Conv2dParams const& problemShape = params.problemShape;
+        BlockScheduler conv2dBlockScheduler(
+            problemShape.getPostIm2colShape(),
+            MakeCoord(FmapL1TileShape::Ho, FmapL1TileShape::Wo, FilterL1TileShape::Cout));
+        uint32_t loops = conv2dBlockScheduler.GetLoops();
+
+        BlockEpilogue blockEpilogue(resource, params.epilogueParams);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementOutput> gmOutput;
+        gmOutput.SetGlobalBuffer((__gm__ ElementOutput*)params.ptrWorkspace);
+
+        // Get aicore information
+        uint32_t aicoreIndex = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t aicoreNum = AscendC::GetBlockNum();
+
+        for (uint32_t loopIdx = aicoreIndex; loopIdx < loops; loopIdx += aicoreNum) {
+            // Compute block location, the same as on the cube core
+            Conv2dCoord blockCoord = conv2dBlockScheduler.GetBlockCoord(loopIdx);
+            Conv2dCoord actualBlockShape = conv2dBlockScheduler.GetActualBlockShape(blockCoord);
+
+            Conv2dFmapCoord blockOffset{
+                blockCoord.batch(), blockCoord.cout() * FilterL1TileShape::Cout / C0,
+                blockCoord.h() * FmapL1TileShape::Ho, blockCoord.w() * FmapL1TileShape::Wo, 0};
+            Conv2dFmapCoord actualEpilogueShape{
+                1, CeilDiv(actualBlockShape.cout(), static_cast<uint32_t>(C0)), actualBlockShape.h(),
+                actualBlockShape.w(), C0};
+            auto gmBlockC = gmOutput[params.layoutOutput.GetOffset(blockOffset)];
+
+            // Synchronize cross core
+            Arch::CrossCoreWaitFlagWithReverse<0x2, PIPE_MTE3>(flagAicFinishStore);
+            blockEpilogue(blockOffset, actualEpilogueShape, gmBlockC, params.layoutOutput);
+        }
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+private:
+    // ID used for inter-core synchronization
+    static constexpr Arch::FlagID FLAG_AIC_FINISH_STORE = 0;
+    static constexpr Arch::FlagID RV_FLAG_AIC_FINISH_STORE = 1;
+    Arch::CrossCoreFlagWithReverse<> flagAicFinishStore{FLAG_AIC_FINISH_STORE, RV_FLAG_AIC_FINISH_STORE};
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Conv::Kernel
+
+#endif // CATLASS_CONV_KERNEL_CONV2D_EPILOGUE_HPP
@@ -0,0 +1,285 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_CONV_KERNEL_CONV2D_WGRAD_HPP
+#define CATLASS_CONV_KERNEL_CONV2D_WGRAD_HPP
+
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/conv_coord.hpp"
+
+namespace Catlass::Conv::Kernel {
+
+// Template for the weight gradient of Conv2d. Compute gradFilter = gradOutput^T x img2col(fmap)
+// K = Batch * Ho * Wo is cut into chunks of FmapL1TileShape::Ho output rows and split into splitkFactor slices.
+// Every (cout tile, cin1 tile, slice) task accumulates its chunks in L0C and writes an fp32 partial filter into the
+// workspace, the AIV cores then reduce the slices and cast them into the CI1KHKWCOCI0 gradFilter.
+template <class BlockConv2dWgrad_, class ReduceAdd_>
+class Conv2dWgrad {
+public:
+    using BlockConv2dWgrad = BlockConv2dWgrad_;
+    using ArchTag = typename BlockConv2dWgrad::ArchTag;
+    using FmapL1TileShape = typename BlockConv2dWgrad::FmapL1TileShape;
+    using FilterL1TileShape = typename BlockConv2dWgrad::FilterL1TileShape;
+    using ElementFmap = typename BlockConv2dWgrad::ElementFmap;
+    using LayoutFmap = typename BlockConv2dWgrad::LayoutFmap;
+    using ElementGradOutput = typename BlockConv2dWgrad::ElementGradOutput;
+    using LayoutGradOutput = typename BlockConv2dWgrad::LayoutGradOutput;
+    using ElementAccumulator = typename BlockConv2dWgrad::ElementAccumulator;
+    using ElementGradFilter = typename BlockConv2dWgrad::ElementGradFilter;
+    using LayoutGradFilter = typename BlockConv2dWgrad::LayoutGradFilter;
+    using ReduceAdd = ReduceAdd_;
+    static_assert(
+        std::is_same_v<ElementGradFilter, ElementAccumulator>, "The block must write fp32 partials for the reduction");
+
+    static constexpr uint32_t C0 = Conv2dParams::C0;
+    static constexpr uint32_t MAX_SPLITK_FACTOR = 16;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        Conv2dParams problemShape;
+        GM_ADDR ptrFmap;
+        LayoutFmap layoutFmap;
+        GM_ADDR ptrGradOutput;
+        LayoutGradOutput layoutGradOutput;
+        GM_ADDR ptrGradFilter;
+        LayoutGradFilter layoutGradFilter;
+        GM_ADDR ptrWorkspace;
+        uint32_t splitkFactor = 1;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            Conv2dParams const& problemShape_, GM_ADDR ptrFmap_, LayoutFmap layoutFmap_, GM_ADDR ptrGradOutput_,
+            LayoutGradOutput layoutGradOutput_, GM_ADDR ptrGradFilter_, LayoutGradFilter layoutGradFilter_,
+            GM_ADDR ptrWorkspace_, uint32_t splitkFactor_)
+            : problemShape(problemShape_),
+              ptrFmap(ptrFmap_),
+              layoutFmap(layoutFmap_),
+              ptrGradOutput(ptrGradOutput_),
+              layoutGradOutput(layoutGradOutput_),
+              ptrGradFilter(ptrGradFilter_),
+              layoutGradFilter(layoutGradFilter_),
+              ptrWorkspace(ptrWorkspace_),
+              splitkFactor(splitkFactor_)
+        {}
+    };
+
+    struct Arguments {
+        Conv2dParams problemShape; // shape of the forward conv
+        uint32_t aicCoreNum;
+        GM_ADDR ptrFmap;
+        GM_ADDR ptrGradOutput;
+        GM_ADDR ptrGradFilter;
+    };
+
+    static uint32_t GetTileCount(Conv2dParams const& problemShape)
+    {
+        return CeilDiv(problemShape.cout(), FilterL1TileShape::Cout) *
+               CeilDiv(problemShape.cin1(), FmapL1TileShape::Cin1);
+    }
+
+    static uint32_t GetChunkCount(Conv2dParams const& problemShape)
+    {
+        return problemShape.batch() * CeilDiv(problemShape.ho(), FmapL1TileShape::Ho);
+    }
+
+    /// Split K until every cube core has a task, a slice holds at least one chunk
+    static uint32_t GetSplitkFactor(Conv2dParams const& problemShape, uint32_t aicCoreNum)
+    {
+        uint32_t splitkFactor = CeilDiv(aicCoreNum, GetTileCount(problemShape));
+        splitkFactor = (splitkFactor < MAX_SPLITK_FACTOR) ? splitkFactor : MAX_SPLITK_FACTOR;
+        uint32_t chunkCount = GetChunkCount(problemShape);
+        splitkFactor = (splitkFactor < chunkCount) ? splitkFactor : chunkCount;
+        return (splitkFactor > 1) ? splitkFactor : 1;
+    }
+
+    static uint64_t GetGradFilterElementCount(Conv2dParams const& problemShape)
+    {
+        return static_cast<uint64_t>(problemShape.cin1()) * problemShape.kh() * problemShape.kw() *
+               problemShape.cout() * C0;
+    }
+
+    static bool CanImplement(const Arguments& args)
+    {
+        if (args.problemShape.strideH() == 0 || args.problemShape.strideW() == 0 ||
+            args.problemShape.dilationH() == 0 || args.problemShape.dilationW() == 0) {
+            return false;
+        }
+        return BlockConv2dWgrad::CanImplement(args.problemShape);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        return sizeof(ElementAccumulator) * GetGradFilterElementCount(args.problemShape) *
+               GetSplitkFactor(args.problemShape, args.aicCoreNum);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        Conv2dParams const& problemShape = args.problemShape;
+        LayoutFmap layoutFmap{problemShape.batch(), problemShape.cin1(), problemShape.hi(), problemShape.wi(), C0};
+        LayoutGradOutput layoutGradOutput{
+            problemShape.batch(), problemShape.cout1(), problemShape.ho(), problemShape.wo(), C0};
+        LayoutGradFilter layoutGradFilter{
+            problemShape.cin1(), problemShape.kh(), problemShape.kw(), problemShape.cout(), C0};
+        Params params{problemShape,         args.ptrFmap,     layoutFmap,
+                      args.ptrGradOutput,   layoutGradOutput, args.ptrGradFilter,
+                      layoutGradFilter,     workspace,        GetSplitkFactor(problemShape, args.aicCoreNum)};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    Conv2dWgrad()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    /// Computes the fp32 partial gradFilter of every split-k slice
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        Conv2dParams const& problemShape = params.problemShape;
+        uint32_t coutTiles = CeilDiv(problemShape.cout(), FilterL1TileShape::Cout);
+        uint32_t tileCount = GetTileCount(problemShape);
+        uint32_t hoTiles = CeilDiv(problemShape.ho(), FmapL1TileShape::Ho);
+        uint32_t chunkCount = GetChunkCount(problemShape);
+        uint32_t loops = tileCount * params.splitkFactor;
+        uint64_t gradFilterElementCount = GetGradFilterElementCount(problemShape);
+
+        Arch::Resource<ArchTag> resource;
+        BlockConv2dWgrad blockConv2dWgrad(resource, problemShape);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementFmap> gmFmap;
+        gmFmap.SetGlobalBuffer((__gm__ ElementFmap*)params.ptrFmap);
+        AscendC::GlobalTensor<ElementGradOutput> gmGradOutput;
+        gmGradOutput.SetGlobalBuffer((__gm__ ElementGradOutput*)params.ptrGradOutput);
+        AscendC::GlobalTensor<ElementGradFilter> gmWorkspace;
+        gmWorkspace.SetGlobalBuffer((__gm__ ElementGradFilter*)params.ptrWorkspace);
+
+        // Chunks always cover whole output rows, so the wi range and its pads are the same for every chunk
+        uint8_t blockPadLeft = 0, blockPadRight = 0;
+        int32_t wiStart = 0 - problemShape.padLeft();
+        int32_t wiEnd = wiStart + (problemShape.wo() - 1) * problemShape.strideW() +
+                        (problemShape.kw() - 1) * problemShape.dilationW();
+        if (wiStart < 0) {
+            blockPadLeft = 0 - wiStart;
+            wiStart = 0;
+        }
+        if (wiEnd > static_cast<int32_t>(problemShape.wi()) - 1) {
+            blockPadRight = wiEnd - (problemShape.wi() - 1);
+            wiEnd = problemShape.wi() - 1;
+        }
+        uint32_t wiActual = wiEnd - wiStart + 1;
+
+        for (uint32_t loopIdx = AscendC::GetBlockIdx(); loopIdx < loops; loopIdx += AscendC::GetBlockNum()) {
+            // Compute tile location, cout is the inner loop so neighbouring cores share the fmap rows
+            uint32_t tileIdx = loopIdx % tileCount;
+            uint32_t splitkSliceIdx = loopIdx / tileCount;
+            uint32_t coutStart = tileIdx % coutTiles * FilterL1TileShape::Cout;
+            uint32_t cin1Start = tileIdx / coutTiles * FmapL1TileShape::Cin1;
+            uint32_t coutActual = (problemShape.cout() - coutStart < FilterL1TileShape::Cout) ?
+                                      (problemShape.cout() - coutStart) :
+                                      FilterL1TileShape::Cout;
+            uint32_t cin1Actual = (problemShape.cin1() - cin1Start < FmapL1TileShape::Cin1) ?
+                                      (problemShape.cin1() - cin1Start) :
+                                      FmapL1TileShape::Cin1;
+
+            // Balanced chunk range of the split-k slice, never empty since splitkFactor <= chunkCount
+            uint32_t chunkStart = static_cast<uint64_t>(splitkSliceIdx) * chunkCount / params.splitkFactor;
+            uint32_t chunkEnd = static_cast<uint64_t>(splitkSliceIdx + 1) * chunkCount / params.splitkFactor;
+
+            Conv2dFilterCoord offsetGradFilter{cin1Start, 0, 0, coutStart, 0};
+            int64_t gmOffsetGradFilter = params.layoutGradFilter.GetOffset(offsetGradFilter) +
+                                         static_cast<int64_t>(gradFilterElementCount * splitkSliceIdx);
+
+            for (uint32_t chunkIdx = chunkStart; chunkIdx < chunkEnd; chunkIdx++) {
+                uint32_t batchIdx = chunkIdx / hoTiles;
+                uint32_t hoStart = chunkIdx % hoTiles * FmapL1TileShape::Ho;
+                uint32_t hoActual = (problemShape.ho() - hoStart < FmapL1TileShape::Ho) ?
+                                        (problemShape.ho() - hoStart) :
+                                        FmapL1TileShape::Ho;
+
+                // Compute indices of hi
+                uint8_t blockPadTop = 0, blockPadBottom = 0;
+                int32_t hiStart = hoStart * problemShape.strideH() - problemShape.padTop();
+                int32_t hiEnd = hiStart + (hoActual - 1) * problemShape.strideH() +
+                                (problemShape.kh() - 1) * problemShape.dilationH();
+                if (hiStart < 0) {
+                    blockPadTop = 0 - hiStart;
+                    hiStart = 0;
+                }
+                if (hiEnd > static_cast<int32_t>(problemShape.hi()) - 1) {
+                    blockPadBottom = hiEnd - (problemShape.hi() - 1);
+                    hiEnd = problemShape.hi() - 1;
+                }
+                uint32_t hiActual = hiEnd - hiStart + 1;
+
+                Conv2dCoord actualBlockShape(1, hiActual, wiActual, coutActual, cin1Actual);
+                uint8_t blockPadList[4] = {blockPadLeft, blockPadRight, blockPadTop, blockPadBottom};
+
+                // Compute initial location in logical coordinates
+                Conv2dFmapCoord offsetFmap{batchIdx, cin1Start, (uint32_t)hiStart, (uint32_t)wiStart, 0};
+                Conv2dFmapCoord offsetGradOutput{batchIdx, coutStart / C0, hoStart, 0, 0};
+                int64_t gmOffsetFmap = params.layoutFmap.GetOffset(offsetFmap);
+                int64_t gmOffsetGradOutput = params.layoutGradOutput.GetOffset(offsetGradOutput);
+
+                // Compute block-scoped implicit GEMM of the chunk
+                blockConv2dWgrad(
+                    gmFmap[gmOffsetFmap], params.layoutFmap, gmGradOutput[gmOffsetGradOutput],
+                    params.layoutGradOutput, gmWorkspace[gmOffsetGradFilter], params.layoutGradFilter,
+                    actualBlockShape, blockPadList, chunkIdx == chunkStart, chunkIdx == chunkEnd - 1);
+            }
+        }
+
+        Catlass::Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(flagAicFinish);
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+    /// Reduces the split-k slices into gradFilter
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        using ElementOut = typename ReduceAdd::ElementOut;
+
+        Catlass::Arch::CrossCoreWaitFlag(flagAicFinish);
+        Catlass::Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+
+        AscendC::GlobalTensor<ElementOut> gmGradFilter;
+        AscendC::GlobalTensor<ElementAccumulator> gmWorkspace;
+        gmGradFilter.SetGlobalBuffer(reinterpret_cast<__gm__ ElementOut*>(params.ptrGradFilter));
+        gmWorkspace.SetGlobalBuffer(reinterpret_cast<__gm__ ElementAccumulator*>(params.ptrWorkspace));
+        ReduceAdd reduceAdd(resource);
+        reduceAdd(
+            gmGradFilter, gmWorkspace, GetGradFilterElementCount(params.problemShape), params.splitkFactor);
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+private:
+    static constexpr Arch::FlagID FLAG_AIC_FINISH = 0;
+    Arch::CrossCoreFlag flagAicFinish{FLAG_AIC_FINISH};
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Conv::Kernel
+
+#endif // CATLASS_CONV_KERNEL_CONV2D_WGRAD_HPP
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_CONV_KERNEL_DEPTHWISE_CONV2D_HPP
+#define CATLASS_CONV_KERNEL_DEPTHWISE_CONV2D_HPP
+
+#include "catlass/arch/resource.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/conv_coord.hpp"
+
+namespace Catlass::Conv::Kernel {
+
+// Template for depthwise Conv2d (groups == channels) on the vector cores. Compute output = fmap (*) filter per channel
+// The filter is CI1KHKWCOCI0 with cout 1, i.e. (Cin1, Kh, Kw, C0). Every (batch, c1) plane is cut into row blocks so
+// that all vector cores have work, a larger row block reuses more fmap rows in UB.
+template <class BlockDepthwiseConv2d_>
+class DepthwiseConv2d {
+public:
+    using BlockDepthwiseConv2d = BlockDepthwiseConv2d_;
+    using ArchTag = typename BlockDepthwiseConv2d::ArchTag;
+    using ElementFmap = typename BlockDepthwiseConv2d::ElementFmap;
+    using LayoutFmap = typename BlockDepthwiseConv2d::LayoutFmap;
+    using ElementFilter = typename BlockDepthwiseConv2d::ElementFilter;
+    using LayoutFilter = typename BlockDepthwiseConv2d::LayoutFilter;
+    using ElementOutput = typename BlockDepthwiseConv2d::ElementOutput;
+    using LayoutOutput = typename BlockDepthwiseConv2d::LayoutOutput;
+
+    static constexpr uint32_t C0 = Conv2dParams::C0;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        Conv2dParams problemShape;
+        GM_ADDR ptrFmap;
+        LayoutFmap layoutFmap;
+        GM_ADDR ptrFilter;
+        LayoutFilter layoutFilter;
+        GM_ADDR ptrOutput;
+        LayoutOutput layoutOutput;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            Conv2dParams const& problemShape_, GM_ADDR ptrFmap_, LayoutFmap layoutFmap_, GM_ADDR ptrFilter_,
+            LayoutFilter layoutFilter_, GM_ADDR ptrOutput_, LayoutOutput layoutOutput_)
+            : problemShape(problemShape_),
+              ptrFmap(ptrFmap_),
+              layoutFmap(layoutFmap_),
+              ptrFilter(ptrFilter_),
+              layoutFilter(layoutFilter_),
+              ptrOutput(ptrOutput_),
+              layoutOutput(layoutOutput_)
+        {}
+    };
+
+    struct Arguments {
+        Conv2dParams problemShape; // cin == cout == channels
+        GM_ADDR ptrFmap;
+        GM_ADDR ptrFilter;
+        GM_ADDR ptrOutput;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        if (args.problemShape.strideH() == 0 || args.problemShape.strideW() == 0 ||
+            args.problemShape.dilationH() == 0 || args.problemShape.dilationW() == 0) {
+            return false;
+        }
+        if (args.problemShape.cout1() != args.problemShape.cin1()) {
+            return false;
+        }
+        return BlockDepthwiseConv2d::CanImplement(args.problemShape);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        Conv2dParams const& problemShape = args.problemShape;
+        LayoutFmap layoutFmap{problemShape.batch(), problemShape.cin1(), problemShape.hi(), problemShape.wi(), C0};
+        LayoutFilter layoutFilter{problemShape.cin1(), problemShape.kh(), problemShape.kw(), 1, C0};
+        LayoutOutput layoutOutput{problemShape.batch(), problemShape.cout1(), problemShape.ho(), problemShape.wo(), C0};
+        Params params{problemShape, args.ptrFmap,   layoutFmap,  args.ptrFilter,
+                      layoutFilter, args.ptrOutput, layoutOutput};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    DepthwiseConv2d()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {}
+
+    /// Executes one depthwise Conv2d
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        Conv2dParams const& problemShape = params.problemShape;
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetTaskRation();
+        uint32_t planeCount = problemShape.batch() * problemShape.cin1();
+        uint32_t hoBlockCount = CeilDiv(aivNum, planeCount);
+        hoBlockCount = (hoBlockCount < problemShape.ho()) ? hoBlockCount : problemShape.ho();
+        uint32_t hoBlock = CeilDiv(problemShape.ho(), hoBlockCount);
+        hoBlockCount = CeilDiv(problemShape.ho(), hoBlock);
+        uint32_t loops = planeCount * hoBlockCount;
+
+        Arch::Resource<ArchTag> resource;
+        BlockDepthwiseConv2d blockDepthwiseConv2d(resource, problemShape);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementFmap> gmFmap;
+        gmFmap.SetGlobalBuffer((__gm__ ElementFmap*)params.ptrFmap);
+        AscendC::GlobalTensor<ElementFilter> gmFilter;
+        gmFilter.SetGlobalBuffer((__gm__ ElementFilter*)params.ptrFilter);
+        AscendC::GlobalTensor<ElementOutput> gmOutput;
+        gmOutput.SetGlobalBuffer((__gm__ ElementOutput*)params.ptrOutput);
+
+        for (uint32_t loopIdx = AscendC::GetBlockIdx(); loopIdx < loops; loopIdx += aivNum) {
+            uint32_t planeIdx = loopIdx / hoBlockCount;
+            uint32_t batchIdx = planeIdx / problemShape.cin1();
+            uint32_t c1Idx = planeIdx % problemShape.cin1();
+            uint32_t hoStart = loopIdx % hoBlockCount * hoBlock;
+            uint32_t hoActual = (problemShape.ho() - hoStart < hoBlock) ? (problemShape.ho() - hoStart) : hoBlock;
+
+            Conv2dFmapCoord offsetFmap{batchIdx, c1Idx, 0, 0, 0};
+            Conv2dFilterCoord offsetFilter{c1Idx, 0, 0, 0, 0};
+            Conv2dFmapCoord offsetOutput{batchIdx, c1Idx, hoStart, 0, 0};
+            int64_t gmOffsetFmap = params.layoutFmap.GetOffset(offsetFmap);
+            int64_t gmOffsetFilter = params.layoutFilter.GetOffset(offsetFilter);
+            int64_t gmOffsetOutput = params.layoutOutput.GetOffset(offsetOutput);
+
+            blockDepthwiseConv2d(
+                gmFmap[gmOffsetFmap], params.layoutFmap, gmFilter[gmOffsetFilter], gmOutput[gmOffsetOutput],
+                params.layoutOutput, hoStart, hoActual);
+        }
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+};
+
+} // namespace Catlass::Conv::Kernel
+
+#endif // CATLASS_CONV_KERNEL_DEPTHWISE_CONV2D_HPP
@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_CONV_KERNEL_GROUPED_CONV2D_HPP
+#define CATLASS_CONV_KERNEL_GROUPED_CONV2D_HPP
+
+#include "catlass/arch/resource.hpp"
+#include "catlass/catlass.hpp"
+#include "catlass/conv_coord.hpp"
+
+namespace Catlass::Conv::Kernel {
+
+// Template for grouped Conv2d in one launch. Compute output[g] = fmap[g] x filter[g] for every group g
+// problemShape is the shape of one group. The channels of every group are padded to C0 on their own, so the fmap is
+// (Batch, groupCount * Cin1, Hi, Wi, C0), the output (Batch, groupCount * Cout1, Ho, Wo, C0) and the filter holds
+// groupCount (Cin1, Kh, Kw, Cout, C0) filters back to back. The group index is folded into the batch dimension of the
+// block scheduler, group-major so that consecutive tasks share the filter of one group.
+template <class BlockConv2d_, class BlockEpilogue_, class BlockScheduler_>
+class GroupedConv2d {
+public:
+    using BlockConv2d = BlockConv2d_;
+    using ArchTag = typename BlockConv2d::ArchTag;
+    using FmapL1TileShape = typename BlockConv2d::FmapL1TileShape;
+    using FilterL1TileShape = typename BlockConv2d::FilterL1TileShape;
+    using ElementFmap = typename BlockConv2d::ElementFmap;
+    using LayoutFmap = typename BlockConv2d::LayoutFmap;
+    using ElementFilter = typename BlockConv2d::ElementFilter;
+    using LayoutFilter = typename BlockConv2d::LayoutFilter;
+    using ElementOutput = typename BlockConv2d::ElementOutput;
+    using LayoutOutput = typename BlockConv2d::LayoutOutput;
+    using ElementAccumulator = typename BlockConv2d::ElementAccumulator;
+
+    using BlockScheduler = BlockScheduler_;
+
+    static constexpr uint16_t C0 = BYTE_PER_C0 / sizeof(ElementOutput);
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        Conv2dParams problemShape;
+        uint32_t groupCount;
+        GM_ADDR ptrFmap;
+        LayoutFmap layoutFmap;
+        GM_ADDR ptrFilter;
+        LayoutFilter layoutFilter;
+        GM_ADDR ptrOutput;
+        LayoutOutput layoutOutput;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            Conv2dParams const& problemShape_, uint32_t groupCount_, GM_ADDR ptrFmap_, LayoutFmap layoutFmap_,
+            GM_ADDR ptrFilter_, LayoutFilter layoutFilter_, GM_ADDR ptrOutput_, LayoutOutput layoutOutput_)
+            : problemShape(problemShape_),
+              groupCount(groupCount_),
+              ptrFmap(ptrFmap_),
+              layoutFmap(layoutFmap_),
+              ptrFilter(ptrFilter_),
+              layoutFilter(layoutFilter_),
+              ptrOutput(ptrOutput_),
+              layoutOutput(layoutOutput_)
+        {}
+    };
+
+    struct Arguments {
+        Conv2dParams problemShape; // shape of one group
+        uint32_t groupCount;
+        GM_ADDR ptrFmap;
+        GM_ADDR ptrFilter;
+        GM_ADDR ptrOutput;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        if (args.groupCount == 0 || args.problemShape.strideH() == 0 || args.problemShape.strideW() == 0 ||
+            args.problemShape.dilationH() == 0 || args.problemShape.dilationW() == 0) {
+            return false;
+        }
+        return BlockConv2d::CanImplement(args.problemShape.getFilterParams());
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        Conv2dParams const& problemShape = args.problemShape;
+        LayoutFmap layoutFmap{
+            problemShape.batch(), args.groupCount * problemShape.cin1(), problemShape.hi(), problemShape.wi(), C0};
+        // Layout of the filter of one group, groups are problemShape.cin1() rows apart
+        LayoutFilter layoutFilter{
+            problemShape.cin1(), problemShape.kh(), problemShape.kw(), problemShape.cout(), C0};
+        LayoutOutput layoutOutput{
+            problemShape.batch(), args.groupCount * problemShape.cout1(), problemShape.ho(), problemShape.wo(), C0};
+        Params params{problemShape, args.groupCount, args.ptrFmap,   layoutFmap,
+                      args.ptrFilter, layoutFilter,  args.ptrOutput, layoutOutput};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    GroupedConv2d()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    /// Executes all groups
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        Conv2dParams const& problemShape = params.problemShape;
+        Conv2dCoord const& groupShape = problemShape.getPostIm2colShape();
+        Conv2dCoord schedulerShape(
+            params.groupCount * groupShape.batch(), groupShape.h(), groupShape.w(), groupShape.cout(),
+            groupShape.cin1());
+        BlockScheduler conv2dBlockScheduler(
+            schedulerShape, MakeCoord(FmapL1TileShape::Ho, FmapL1TileShape::Wo, FilterL1TileShape::Cout));
+        uint32_t loops = conv2dBlockScheduler.GetLoops();
+
+        Arch::Resource<ArchTag> resource;
+        BlockConv2d blockConv2d(resource, problemShape.getFilterParams());
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementFmap> gmFmap;
+        gmFmap.SetGlobalBuffer((__gm__ ElementFmap*)params.ptrFmap);
+        AscendC::GlobalTensor<ElementFilter> gmFilter;
+        gmFilter.SetGlobalBuffer((__gm__ ElementFilter*)params.ptrFilter);
+        AscendC::GlobalTensor<ElementOutput> gmOutput;
+        gmOutput.SetGlobalBuffer((__gm__ ElementOutput*)params.ptrOutput);
+
+        int64_t groupFilterSize = params.layoutFilter.stride(0) * problemShape.cin1();
+
+        for (uint32_t loopIdx = AscendC::GetBlockIdx(); loopIdx < loops; loopIdx += AscendC::GetBlockNum()) {
+            // Compute block location
+            Conv2dCoord blockCoord = conv2dBlockScheduler.GetBlockCoord(loopIdx);
+            Conv2dCoord actualBlockShape = conv2dBlockScheduler.GetActualBlockShape(blockCoord);
+            uint32_t groupIdx = blockCoord.batch() / problemShape.batch();
+            uint32_t batchIdx = blockCoord.batch() % problemShape.batch();
+
+            uint8_t blockPadLeft = 0, blockPadRight = 0, blockPadTop = 0, blockPadBottom = 0;
+
+            // Compute indices of hi
+            uint32_t hoStart = blockCoord.h() * FmapL1TileShape::Ho;
+            int32_t hiStart = hoStart * problemShape.strideH() - problemShape.padTop();
+            int32_t hiEnd = hiStart + (actualBlockShape.h() - 1) * problemShape.strideH() +
+                            (problemShape.kh() - 1) * problemShape.dilationH();
+            if (hiStart < 0) {
+                blockPadTop = 0 - hiStart;
+                hiStart = 0;
+            }
+            if (hiEnd > static_cast<int32_t>(problemShape.hi()) - 1) {
+                blockPadBottom = hiEnd - (problemShape.hi() - 1);
+                hiEnd = problemShape.hi() - 1;
+            }
+            uint32_t hiActual = hiEnd - hiStart + 1;
+
+            // Compute indexes of wi
+            uint32_t woStart = blockCoord.w() * FmapL1TileShape::Wo;
+            int32_t wiStart = woStart * problemShape.strideW() - problemShape.padLeft();
+            int32_t wiEnd = wiStart + (actualBlockShape.w() - 1) * problemShape.strideW() +
+                            (problemShape.kw() - 1) * problemShape.dilationW();
+            if (wiStart < 0) {
+                blockPadLeft = 0 - wiStart;
+                wiStart = 0;
+            }
+            if (wiEnd > static_cast<int32_t>(problemShape.wi()) - 1) {
+                blockPadRight = wiEnd - (problemShape.wi() - 1);
+                wiEnd = problemShape.wi() - 1;
+            }
+            uint32_t wiActual = wiEnd - wiStart + 1;
+
+            Conv2dCoord actualConv2dBlockShape(1, hiActual, wiActual, actualBlockShape.cout(), actualBlockShape.cin1());
+            uint8_t blockPadList[4] = {blockPadLeft, blockPadRight, blockPadTop, blockPadBottom};
+
+            // Compute initial location in logical coordinates, the group selects the channel slices
+            Conv2dFmapCoord offsetFmap{
+                batchIdx, groupIdx * problemShape.cin1(), (uint32_t)hiStart, (uint32_t)wiStart, 0};
+            Conv2dFilterCoord offsetFilter{0, 0, 0, blockCoord.cout() * FilterL1TileShape::Cout, 0};
+            Conv2dFmapCoord offsetOutput{
+                batchIdx, groupIdx * problemShape.cout1() + blockCoord.cout() * FilterL1TileShape::Cout / C0, hoStart,
+                woStart, 0};
+            int64_t gmOffsetFmap = params.layoutFmap.GetOffset(offsetFmap);
+            int64_t gmOffsetFilter = groupIdx * groupFilterSize + params.layoutFilter.GetOffset(offsetFilter);
+            int64_t gmOffsetOutput = params.layoutOutput.GetOffset(offsetOutput);
+
+            // Compute block-scoped matrix multiply-add
+            blockConv2d(
+                gmFmap[gmOffsetFmap], params.layoutFmap, gmFilter[gmOffsetFilter], params.layoutFilter,
+                gmOutput[gmOffsetOutput], params.layoutOutput, actualConv2dBlockShape, blockPadList);
+        }
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {}
+};
+
+} // namespace Catlass::Conv::Kernel
+
+#endif // CATLASS_CONV_KERNEL_GROUPED_CONV2D_HPP
@@ -48,6 +48,12 @@ struct CopyL0CToGmQuantMode<Catlass::Arch::AtlasA2, float, bfloat16_t, ScaleGran
     static constexpr auto VALUE = QuantMode_t::F322BF16;
 };
 
+// CopyL0CToGm keeps fp32, used by split-k partial results
+template <>
+struct CopyL0CToGmQuantMode<Catlass::Arch::AtlasA2, float, float, ScaleGranularity::NO_QUANT> {
+    static constexpr auto VALUE = QuantMode_t::NoQuant;
+};
+
 template <
     class ArchTag, class ElementAccumulator, class GmType,
     ScaleGranularity DEQUANT_GRANULARITY = ScaleGranularity::NO_QUANT, bool ReluEnable = false>
@@ -102,6 +108,41 @@ struct CopyL0CToGm<
     }
 };
 
+/// Weight gradient tile: the zN accumulator of (cout, cin1 * Kh * Kw * C0) is already the CI1KHKWCOCI0
+/// layout once every (cin1, kh, kw) fractal column is written as a cout x C0 plane.
+template <class ElementAccumulator_, class ElementDst_, bool ReluEnable_>
+struct CopyL0CToGm<
+    Catlass::Arch::AtlasA2, ElementAccumulator_, Gemm::GemmType<ElementDst_, layout::CI1KHKWCOCI0>,
+    ScaleGranularity::NO_QUANT, ReluEnable_> {
+    using ArchTag = Catlass::Arch::AtlasA2;
+    using ElementDst = ElementDst_;
+    using ElementSrc = ElementAccumulator_;
+    using LayoutSrc = Catlass::layout::zN;
+    using LayoutDst = Catlass::layout::CI1KHKWCOCI0;
+    static constexpr auto quantPre =
+        CopyL0CToGmQuantMode<ArchTag, ElementSrc, ElementDst, ScaleGranularity::NO_QUANT>::VALUE;
+    static constexpr auto reluEn = ReluEnable_;
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementDst> const& dst, AscendC::LocalTensor<ElementSrc> const& src,
+        LayoutDst const& dstLayout, // (Cin1, Kh, Kw, Cout, C0)
+        uint32_t coutRound, uint8_t unitFlag = 0)
+    {
+        AscendC::FixpipeParamsV220 fixPipeParams(
+            dstLayout.shape(0) * dstLayout.shape(1) * dstLayout.shape(2) * dstLayout.shape(4), // nSize
+            dstLayout.shape(3),                                                                // mSize
+            coutRound,                                                                         // srcStride
+            dstLayout.stride(2) * sizeof(ElementDst) / BYTE_PER_C0,                            // dstStride
+            reluEn);
+        fixPipeParams.quantPre = quantPre;
+        fixPipeParams.unitFlag = unitFlag;
+        // Keep C0 = 16 for fp32 too, so the fp32 slices share the element order of the fp16 filter
+        fixPipeParams.isChannelSplit = false;
+        AscendC::Fixpipe<ElementDst, ElementSrc, AscendC::CFG_NZ>(dst, src, fixPipeParams);
+    }
+};
+
 ///////////////////////////////////////////TileCopyTla//////////////////////////////////////////////////////
 template <
     class ArchTag, class TensorSrc, class TensorDst, ScaleGranularity DEQUANT_GRANULARITY = ScaleGranularity::NO_QUANT,
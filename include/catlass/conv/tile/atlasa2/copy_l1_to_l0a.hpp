@@ -74,6 +74,52 @@ struct CopyL1ToL0A<ArchTag, Catlass::Gemm::GemmType<Element, layout::NC1HWC0, As
     }
 };
 
+/// Load the output gradient as the transposed A matrix of the weight gradient GEMM.
+/// In L1 every cout1 plane holds howoRound rows of C0 channels (a zN tile of (howo, cout)), each fractal is
+/// transposed into the zZ tile of (cout, howo) on L0A.
+template <class ArchTag, class L1Type, class L0Type = void>
+struct CopyL1ToL0AWgrad {
+    static_assert(DEPENDENT_FALSE<ArchTag>, "Unsupported copy l1 to l0, can not find the specialization.");
+};
+
+template <class ArchTag, class Element>
+struct CopyL1ToL0AWgrad<ArchTag, Catlass::Gemm::GemmType<Element, layout::NC1HWC0, AscendC::TPosition::A1>> {
+    using LayoutDst = layout::zZ;
+    using LayoutSrc = layout::NC1HWC0;
+
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL / sizeof(Element);
+
+    CATLASS_DEVICE
+    CopyL1ToL0AWgrad() {};
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<Element> dstTensor, // (cout, howo)
+        AscendC::LocalTensor<Element> srcTensor, // (cout1, howo, C0)
+        LayoutDst const& layoutDst,              // {coutRound, kPartRound}
+        LayoutSrc const& layoutSrc)              // {1, cout1Actual, 1, howoRound, C0}
+    {
+        uint32_t cout1Actual = layoutSrc.shape(1);
+        uint32_t kPartRound = layoutDst.orgShape(1);
+
+        AscendC::LoadData2DParams loadDataParams;
+        loadDataParams.startIndex = 0;
+        loadDataParams.repeatTimes = static_cast<uint16_t>(kPartRound / ELE_NUM_PER_C0);
+        loadDataParams.srcStride = 1;
+        loadDataParams.sid = 0;
+        loadDataParams.dstGap = 0;
+        loadDataParams.ifTranspose = true;
+        loadDataParams.addrMode = 0;
+
+        for (uint32_t cout1Idx = 0; cout1Idx < cout1Actual; cout1Idx++) {
+            AscendC::LoadData(
+                dstTensor[cout1Idx * kPartRound * ELE_NUM_PER_C0], srcTensor[cout1Idx * layoutSrc.stride(1)],
+                loadDataParams);
+        }
+    }
+};
+
 ///////////////////////////////////////////TileCopyTla//////////////////////////////////////////////////////
 /// CopyL1ToL0ATla, NC1HWC0 in and zN out.
 template <class Element>
@@ -58,6 +58,61 @@ struct CopyL1ToL0B<ArchTag, Catlass::Gemm::GemmType<Element, layout::CI1KHKWCOCI
     }
 };
 
+/// img2col the fmap into the B matrix of the weight gradient GEMM.
+/// load3dv2 walks the output positions (howo) as rows and (cin1, kh, kw, C0) as columns, the transpose
+/// lands them on L0B as the nZ tile of (howo, cin1 * kh * kw * C0).
+template <class ArchTag, class L1Type, class L0Type = void>
+struct CopyL1ToL0BWgrad {
+    static_assert(DEPENDENT_FALSE<ArchTag>, "Unsupported copy l1 to l0, can not find the specialization.");
+};
+
+template <class ArchTag, class Element>
+struct CopyL1ToL0BWgrad<ArchTag, Catlass::Gemm::GemmType<Element, layout::NC1HWC0, AscendC::TPosition::A1>> {
+    using LayoutDst = layout::nZ;
+    using LayoutSrc = layout::NC1HWC0;
+
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+
+    Conv2dFilterParams params;
+
+    CATLASS_DEVICE
+    CopyL1ToL0BWgrad(const Conv2dFilterParams& params_) : params(params_) {};
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<Element> dstTensor, // (howo, cin1, Kh, Kw, C0)
+        AscendC::LocalTensor<Element> srcTensor, // (cin1, hi, wi, C0)
+        LayoutDst const& layoutDst,              // {kPartRound, nPartActual}
+        LayoutSrc const& layoutSrc,              // {1, cin1Actual, hiActual, wiActual, C0}
+        uint8_t* blockPadList, uint32_t howoStart, uint32_t nStart)
+    {
+        AscendC::LoadData3DParamsV2<Element> loadDataParams;
+
+        loadDataParams.padList[0] = blockPadList[0];
+        loadDataParams.padList[1] = blockPadList[1];
+        loadDataParams.padList[2] = blockPadList[2];
+        loadDataParams.padList[3] = blockPadList[3];
+        loadDataParams.l1H = static_cast<uint16_t>(layoutSrc.shape(2));
+        loadDataParams.l1W = static_cast<uint16_t>(layoutSrc.shape(3));
+        loadDataParams.channelSize = static_cast<uint16_t>(layoutSrc.shape(1) * ELE_NUM_PER_C0);
+        loadDataParams.kExtension = static_cast<uint16_t>(layoutDst.orgShape(1));
+        loadDataParams.mExtension = static_cast<uint16_t>(layoutDst.orgShape(0));
+        loadDataParams.kStartPt = static_cast<uint16_t>(nStart);
+        loadDataParams.mStartPt = static_cast<uint16_t>(howoStart);
+        loadDataParams.strideW = params.strideW();
+        loadDataParams.strideH = params.strideH();
+        loadDataParams.filterW = params.kw();
+        loadDataParams.filterH = params.kh();
+        loadDataParams.dilationFilterW = params.dilationW();
+        loadDataParams.dilationFilterH = params.dilationH();
+        loadDataParams.enTranspose = true;
+        loadDataParams.enSmallK = false;
+        loadDataParams.padValue = (half)(0);
+
+        AscendC::LoadData(dstTensor, srcTensor, loadDataParams);
+    }
+};
+
 ///////////////////////////////////////////TileCopyTla//////////////////////////////////////////////////////
 /// CopyL1ToL0BTla, Ascend950, CI1KHKWCOCI0 in and nZ out.
 template <class Element>
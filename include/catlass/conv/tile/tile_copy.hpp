@@ -49,6 +49,31 @@ struct TileCopy {
     using CopyL1ToL0B = Conv::Tile::CopyL1ToL0B<ArchTag, typename Gemm::helper::L1BTypeSelector<FilterType>::L1BType>;
     using CopyL0CToGm = Conv::Tile::CopyL0CToGm<ArchTag, ElementAccumulator, OutputType>;
 };
+
+/// Tile copies of the weight gradient, dW(cout, cin1 * Kh * Kw * C0) = dY^T(cout, howo) x img2col(fmap)
+template <
+    /// Tag indicating architecture
+    class ArchTag,
+    /// ConvType for Fmap operand, NC1HWC0
+    class FmapType,
+    /// ConvType for output gradient operand, NC1HWC0
+    class GradOutputType,
+    /// ConvType for filter gradient operand, CI1KHKWCOCI0
+    class GradFilterType>
+struct TileCopyWgrad {
+    using ElementFmap = typename FmapType::Element;
+    using ElementGradOutput = typename GradOutputType::Element;
+    using ElementAccumulator =
+        typename Gemm::helper::ElementAccumulatorSelector<ElementFmap, ElementGradOutput>::ElementAccumulator;
+    using FmapL1Type = Gemm::GemmType<ElementFmap, layout::NC1HWC0, AscendC::TPosition::A1>;
+    using GradOutputL1Type = Gemm::GemmType<ElementGradOutput, layout::NC1HWC0, AscendC::TPosition::A1>;
+
+    using CopyGmToL1Fmap = Conv::Tile::CopyGmToL1<ArchTag, FmapType>;
+    using CopyGmToL1GradOutput = Conv::Tile::CopyGmToL1<ArchTag, GradOutputType>;
+    using CopyL1ToL0A = Conv::Tile::CopyL1ToL0AWgrad<ArchTag, GradOutputL1Type>;
+    using CopyL1ToL0B = Conv::Tile::CopyL1ToL0BWgrad<ArchTag, FmapL1Type>;
+    using CopyL0CToGm = Conv::Tile::CopyL0CToGm<ArchTag, ElementAccumulator, GradFilterType>;
+};
 #endif
 
 template <
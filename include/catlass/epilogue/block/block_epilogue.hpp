@@ -39,7 +39,9 @@ class BlockEpilogue {
 #include "catlass/epilogue/block/block_epilogue_amla_tp1_rescale_o.hpp"
 #include "catlass/epilogue/block/block_epilogue_online_softmax_no_mask.hpp"
 #include "catlass/epilogue/block/block_epilogue_rescale_o_no_split_row.hpp"
+#include "catlass/epilogue/block/block_epilogue_fa_softmax_grad.hpp"
 #include "catlass/epilogue/block/block_epilogue_w4a4_per_token_per_channel_dequant.hpp"
+#include "catlass/epilogue/block/block_epilogue_conv_bn_act.hpp"
 
 #if (defined(CATLASS_ARCH) && CATLASS_ARCH == 3510)
 #include "catlass/epilogue/block/block_epilogue_fa_softmax_ascend950.hpp"
@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_BLOCK_EPILOGUE_CONV_BN_ACT_HPP
+#define CATLASS_EPILOGUE_BLOCK_EPILOGUE_CONV_BN_ACT_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/conv_coord.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/layout/layout.hpp"
+
+namespace Catlass::Epilogue::Block {
+
+// D = act(C * scale + shift + X) on one NC1HWC0 output block, computed in fp32 and stored to GM once.
+// scale and shift hold Cout1 * C0 fp32 values, X is skipped when ptrX is nullptr. Activation_ is a unary functor
+// of Epilogue::Fusion (e.g. Fusion::Relu<float>, Fusion::Silu<float>) or void for none.
+template <uint32_t COMPUTE_LENGTH_, class CType_, class ScaleType_, class XType_, class DType_, class Activation_>
+class BlockEpilogue<EpilogueAtlasA2ConvBnAct<COMPUTE_LENGTH_>, CType_, ScaleType_, XType_, DType_, Activation_> {
+public:
+    // Type aliases
+    using DispatchPolicy = EpilogueAtlasA2ConvBnAct<COMPUTE_LENGTH_>;
+    using ArchTag = typename DispatchPolicy::ArchTag;
+    using ElementC = typename CType_::Element;
+    using LayoutC = typename CType_::Layout;
+    using ElementScale = typename ScaleType_::Element;
+    using ElementX = typename XType_::Element;
+    using LayoutX = typename XType_::Layout;
+    using ElementD = typename DType_::Element;
+    using LayoutD = typename DType_::Layout;
+    using Activation = Activation_;
+    using ElementCompute = float;
+
+    static constexpr uint32_t COMPUTE_LENGTH = DispatchPolicy::COMPUTE_LENGTH;
+    static constexpr uint32_t C0 = BYTE_PER_C0 / sizeof(ElementD);
+    static constexpr uint32_t ELE_NUM_PER_VECTOR = BYTE_PER_VECTOR_FRACTAL / sizeof(ElementCompute);
+    // Copies of one C0 channel vector that cover a whole vector repeat
+    static constexpr uint32_t BRC_COUNT = ELE_NUM_PER_VECTOR / C0;
+
+    static_assert(
+        std::is_same_v<ElementC, ElementD> && std::is_same_v<ElementX, ElementD>,
+        "Element type of C, X and D must be the same");
+    static_assert(std::is_same_v<ElementScale, ElementCompute>, "Element type of scale and shift must be float");
+    static_assert(
+        std::is_same_v<LayoutC, layout::NC1HWC0> && std::is_same_v<LayoutX, layout::NC1HWC0> &&
+            std::is_same_v<LayoutD, layout::NC1HWC0>,
+        "Layout type of C, X and D must be NC1HWC0");
+    static_assert(BRC_COUNT * C0 == ELE_NUM_PER_VECTOR, "C0 must divide the elements of one vector repeat");
+    static_assert(
+        COMPUTE_LENGTH % ELE_NUM_PER_VECTOR == 0 && COMPUTE_LENGTH / ELE_NUM_PER_VECTOR <= 255,
+        "COMPUTE_LENGTH must be whole vector repeats and no more than 255 repeats");
+    // ubC, ubX, ubD in ElementD, ubCompute, ubAux in fp32, plus the scale and shift vectors
+    static_assert(
+        COMPUTE_LENGTH * (3 * sizeof(ElementD) + 2 * sizeof(ElementCompute)) +
+                4 * ELE_NUM_PER_VECTOR * sizeof(ElementCompute) <=
+            ArchTag::UB_SIZE,
+        "UB out of bounds");
+
+    // Epilogue params definition
+    struct Params {
+        GM_ADDR ptrScale;
+        GM_ADDR ptrShift;
+        GM_ADDR ptrX;
+        LayoutX layoutX;
+        GM_ADDR ptrD;
+        LayoutD layoutD;
+
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GM_ADDR ptrScale_, GM_ADDR ptrShift_, GM_ADDR ptrX_, LayoutX const& layoutX_, GM_ADDR ptrD_,
+            LayoutD const& layoutD_)
+            : ptrScale(ptrScale_), ptrShift(ptrShift_), ptrX(ptrX_), layoutX(layoutX_), ptrD(ptrD_), layoutD(layoutD_)
+        {}
+    };
+
+    CATLASS_DEVICE
+    BlockEpilogue(Arch::Resource<ArchTag>& resource, Params const& params) : params(params)
+    {
+        uint32_t ubOffset = 0;
+        ubC = resource.ubBuf.template GetBufferByByte<ElementC>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(ElementC);
+        ubX = resource.ubBuf.template GetBufferByByte<ElementX>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(ElementX);
+        ubD = resource.ubBuf.template GetBufferByByte<ElementD>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(ElementD);
+        ubCompute = resource.ubBuf.template GetBufferByByte<ElementCompute>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(ElementCompute);
+        ubAux = resource.ubBuf.template GetBufferByByte<ElementCompute>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(ElementCompute);
+        ubScale = resource.ubBuf.template GetBufferByByte<ElementCompute>(ubOffset);
+        ubOffset += ELE_NUM_PER_VECTOR * sizeof(ElementCompute);
+        ubShift = resource.ubBuf.template GetBufferByByte<ElementCompute>(ubOffset);
+        ubOffset += ELE_NUM_PER_VECTOR * sizeof(ElementCompute);
+        ubScaleBrc = resource.ubBuf.template GetBufferByByte<ElementCompute>(ubOffset);
+        ubOffset += ELE_NUM_PER_VECTOR * sizeof(ElementCompute);
+        ubShiftBrc = resource.ubBuf.template GetBufferByByte<ElementCompute>(ubOffset);
+
+        gmScale.SetGlobalBuffer(reinterpret_cast<__gm__ ElementCompute*>(params.ptrScale));
+        gmShift.SetGlobalBuffer(reinterpret_cast<__gm__ ElementCompute*>(params.ptrShift));
+        gmX.SetGlobalBuffer(reinterpret_cast<__gm__ ElementX*>(params.ptrX));
+        gmD.SetGlobalBuffer(reinterpret_cast<__gm__ ElementD*>(params.ptrD));
+
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    CATLASS_DEVICE
+    ~BlockEpilogue()
+    {
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    /// blockOffset is the (batch, c1, ho, wo, 0) origin of the block in D, actualBlockShape its (1, c1, ho, wo, C0)
+    /// extent. The (c1, ho) rows of the block are split between the subcores and walked in chunks of whole rows, a row
+    /// longer than the compute length is walked in chunks of wo instead.
+    CATLASS_DEVICE
+    void operator()(
+        Conv2dFmapCoord const& blockOffset, Conv2dFmapCoord const& actualBlockShape,
+        AscendC::GlobalTensor<ElementC> const& gmBlockC, LayoutC const& layoutC)
+    {
+        uint32_t hoActual = actualBlockShape.h();
+        uint32_t woActual = actualBlockShape.w();
+        uint32_t woPerChunk = (woActual * C0 <= COMPUTE_LENGTH) ? woActual : (COMPUTE_LENGTH / C0);
+        uint32_t rowsPerChunk = COMPUTE_LENGTH / (woPerChunk * C0);
+
+        uint32_t rowCount = actualBlockShape.c1() * hoActual;
+        uint32_t subblockRows = CeilDiv(rowCount, static_cast<uint32_t>(AscendC::GetSubBlockNum()));
+        uint32_t rowStart = AscendC::GetSubBlockIdx() * subblockRows;
+        uint32_t rowEnd = (rowStart + subblockRows < rowCount) ? (rowStart + subblockRows) : rowCount;
+
+        for (uint32_t row = rowStart; row < rowEnd;) {
+            uint32_t c1Idx = row / hoActual;
+            uint32_t hoIdx = row % hoActual;
+            // A chunk never crosses a c1 plane so that it sees one scale and shift vector
+            uint32_t rows = hoActual - hoIdx;
+            rows = (rows < rowsPerChunk) ? rows : rowsPerChunk;
+            rows = (rows < rowEnd - row) ? rows : (rowEnd - row);
+
+            for (uint32_t woIdx = 0; woIdx < woActual; woIdx += woPerChunk) {
+                uint32_t woChunk = (woActual - woIdx < woPerChunk) ? (woActual - woIdx) : woPerChunk;
+                Conv2dFmapCoord chunkOffset{0, c1Idx, hoIdx, woIdx, 0};
+                Conv2dFmapCoord gmOffset{
+                    blockOffset.batch(), blockOffset.c1() + c1Idx, blockOffset.h() + hoIdx, blockOffset.w() + woIdx,
+                    0};
+                ComputeChunk(
+                    gmBlockC[layoutC.GetOffset(chunkOffset)], layoutC, gmOffset, (blockOffset.c1() + c1Idx) * C0,
+                    rows, woChunk);
+            }
+            row += rows;
+        }
+    }
+
+private:
+    CATLASS_DEVICE
+    void ComputeChunk(
+        AscendC::GlobalTensor<ElementC> const& gmChunkC, LayoutC const& layoutC, Conv2dFmapCoord const& gmOffset,
+        uint32_t channelOffset, uint32_t rows, uint32_t woActual)
+    {
+        uint32_t rowLength = woActual * C0;
+        uint32_t computeLength = rows * rowLength;
+        uint8_t repeat = CeilDiv(computeLength, ELE_NUM_PER_VECTOR);
+        bool hasResidual = params.ptrX != nullptr;
+
+        // Rows of one c1 plane are layout.stride(2) apart in GM and packed back to back in UB
+        uint16_t blockLen = rowLength * sizeof(ElementD) / BYTE_PER_BLK;
+        auto rowGap = [&](int64_t rowStride) {
+            return static_cast<uint16_t>((rowStride - rowLength) * sizeof(ElementD) / BYTE_PER_BLK);
+        };
+
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::DataCopy(ubC, gmChunkC, AscendC::DataCopyParams(rows, blockLen, rowGap(layoutC.stride(2)), 0));
+        if (hasResidual) {
+            AscendC::DataCopy(
+                ubX, gmX[params.layoutX.GetOffset(gmOffset)],
+                AscendC::DataCopyParams(rows, blockLen, rowGap(params.layoutX.stride(2)), 0));
+        }
+        AscendC::DataCopy(ubScale, gmScale[channelOffset], C0);
+        AscendC::DataCopy(ubShift, gmShift[channelOffset], C0);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+
+        // Repeat the C0 channel vector over a full vector repeat, so one Mul/Add repeat covers BRC_COUNT pixels
+        AscendC::CopyRepeatParams brcParams(1, 1, C0 * sizeof(ElementCompute) / BYTE_PER_BLK, 0);
+        AscendC::Copy(ubScaleBrc, ubScale, C0, BRC_COUNT, brcParams);
+        AscendC::Copy(ubShiftBrc, ubShift, C0, BRC_COUNT, brcParams);
+        AscendC::Cast(ubCompute, ubC, AscendC::RoundMode::CAST_NONE, computeLength);
+        if (hasResidual) {
+            AscendC::Cast(ubAux, ubX, AscendC::RoundMode::CAST_NONE, computeLength);
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+
+        // Folded BatchNorm, the channel vector is reread for every repeat
+        AscendC::BinaryRepeatParams brcRepeatParams(1, 1, 1, 8, 8, 0);
+        AscendC::Mul(ubCompute, ubCompute, ubScaleBrc, ELE_NUM_PER_VECTOR, repeat, brcRepeatParams);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Add(ubCompute, ubCompute, ubShiftBrc, ELE_NUM_PER_VECTOR, repeat, brcRepeatParams);
+        AscendC::PipeBarrier<PIPE_V>();
+        if (hasResidual) {
+            AscendC::Add(ubCompute, ubCompute, ubAux, computeLength);
+            AscendC::PipeBarrier<PIPE_V>();
+        }
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        if constexpr (std::is_void_v<Activation>) {
+            AscendC::Cast(ubD, ubCompute, AscendC::RoundMode::CAST_RINT, computeLength);
+        } else {
+            Activation{}(ubAux, computeLength, ubCompute);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Cast(ubD, ubAux, AscendC::RoundMode::CAST_RINT, computeLength);
+        }
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        AscendC::DataCopy(
+            gmD[params.layoutD.GetOffset(gmOffset)], ubD,
+            AscendC::DataCopyParams(rows, blockLen, 0, rowGap(params.layoutD.stride(2))));
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    Params params;
+
+    AscendC::GlobalTensor<ElementCompute> gmScale;
+    AscendC::GlobalTensor<ElementCompute> gmShift;
+    AscendC::GlobalTensor<ElementX> gmX;
+    AscendC::GlobalTensor<ElementD> gmD;
+
+    AscendC::LocalTensor<ElementC> ubC;
+    AscendC::LocalTensor<ElementX> ubX;
+    AscendC::LocalTensor<ElementD> ubD;
+    AscendC::LocalTensor<ElementCompute> ubCompute;
+    AscendC::LocalTensor<ElementCompute> ubAux;
+    AscendC::LocalTensor<ElementCompute> ubScale;
+    AscendC::LocalTensor<ElementCompute> ubShift;
+    AscendC::LocalTensor<ElementCompute> ubScaleBrc;
+    AscendC::LocalTensor<ElementCompute> ubShiftBrc;
+};
+
+} // namespace Catlass::Epilogue::Block
+
+#endif // CATLASS_EPILOGUE_BLOCK_EPILOGUE_CONV_BN_ACT_HPP
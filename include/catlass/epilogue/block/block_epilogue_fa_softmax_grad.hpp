@@ -0,0 +1,330 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_BLOCK_BLOCK_EPILOGUE_FA_SOFTMAX_GRAD_HPP
+#define CATLASS_EPILOGUE_BLOCK_BLOCK_EPILOGUE_FA_SOFTMAX_GRAD_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+
+namespace Catlass::Epilogue::Block {
+
+/// Softmax gradient of one S/dP tile of the flash attention backward pass.
+/// With S = scale * Q * K^T, the forward LSE and D = rowsum(dO * O) of the q rows:
+///   P  = exp(S - LSE)
+///   dS = scale * P * (dP - D)
+/// P and dS are written in OutputType for the dV, dK and dQ matmuls. The rows of a tile are split between the two
+/// sub blocks, the tiles are stored row major with a fixed row stride of TILE_COLS.
+/// The block also carries the clear and ordered reduce-cast passes of the float gradient accumulators.
+template <class OutputType_, class InputType_, class LseType_>
+class BlockEpilogue<EpilogueAtlasA2FASoftmaxGrad, OutputType_, InputType_, LseType_> {
+public:
+    // Type aliases
+    using DispatchPolicy = EpilogueAtlasA2FASoftmaxGrad;
+    using ArchTag = typename DispatchPolicy::ArchTag;
+    using ElementOutput = typename OutputType_::Element;
+    using ElementInput = typename InputType_::Element;
+    using ElementLse = typename LseType_::Element;
+
+    using LayoutOutput = typename OutputType_::Layout;
+    using LayoutInput = typename InputType_::Layout;
+    using LayoutLse = typename LseType_::Layout;
+
+    static_assert(
+        std::is_same_v<ElementOutput, half> || std::is_same_v<ElementOutput, bfloat16_t>,
+        "The output of the softmax gradient only supports half or bfloat16_t");
+    static_assert(
+        std::is_same_v<ElementInput, float> && std::is_same_v<ElementLse, float>,
+        "S, dP and LSE of the softmax gradient must be float");
+    static_assert(
+        std::is_same_v<LayoutOutput, layout::RowMajor> && std::is_same_v<LayoutInput, layout::RowMajor>,
+        "The softmax gradient only supports RowMajor tiles");
+
+    static constexpr uint32_t TILE_ROWS = 128;
+    static constexpr uint32_t TILE_COLS = 128;
+    static constexpr uint32_t MAX_ROWS_PER_SUB_BLOCK = 64;
+    static constexpr uint32_t MAX_HEAD_DIM = 256;
+    static constexpr uint32_t FLOAT_ELENUM_PER_BLK = 8;
+    static constexpr uint32_t FLOAT_ELENUM_PER_VECCALC = 64;
+    static constexpr uint32_t UB_TILE_LEN = MAX_ROWS_PER_SUB_BLOCK * TILE_COLS;
+    static constexpr float MASK_VALUE = -3.0e38f;
+
+    CATLASS_DEVICE
+    BlockEpilogue(Arch::Resource<ArchTag>& resource, float scaleValue_) : scaleValue(scaleValue_)
+    {
+        constexpr uint32_t DP_UB_TENSOR_OFFSET = UB_TILE_LEN * sizeof(float);
+        constexpr uint32_t P_UB_TENSOR_OFFSET = 2 * UB_TILE_LEN * sizeof(float);
+        constexpr uint32_t DS_UB_TENSOR_OFFSET = P_UB_TENSOR_OFFSET + UB_TILE_LEN * sizeof(ElementOutput);
+        constexpr uint32_t LSE_UB_TENSOR_OFFSET = DS_UB_TENSOR_OFFSET + UB_TILE_LEN * sizeof(ElementOutput);
+        constexpr uint32_t D_UB_TENSOR_OFFSET = LSE_UB_TENSOR_OFFSET + MAX_ROWS_PER_SUB_BLOCK * sizeof(float);
+        constexpr uint32_t LSE_BRCB_UB_TENSOR_OFFSET = D_UB_TENSOR_OFFSET + MAX_ROWS_PER_SUB_BLOCK * sizeof(float);
+        constexpr uint32_t D_BRCB_UB_TENSOR_OFFSET =
+            LSE_BRCB_UB_TENSOR_OFFSET + MAX_ROWS_PER_SUB_BLOCK * BYTE_PER_BLK;
+        static_assert(D_BRCB_UB_TENSOR_OFFSET + MAX_ROWS_PER_SUB_BLOCK * BYTE_PER_BLK <= ArchTag::UB_SIZE,
+            "The softmax gradient exceeds the UB size");
+
+        sUbTensor = resource.ubBuf.template GetBufferByByte<float>(0);
+        dpUbTensor = resource.ubBuf.template GetBufferByByte<float>(DP_UB_TENSOR_OFFSET);
+        pUbTensor = resource.ubBuf.template GetBufferByByte<ElementOutput>(P_UB_TENSOR_OFFSET);
+        dsUbTensor = resource.ubBuf.template GetBufferByByte<ElementOutput>(DS_UB_TENSOR_OFFSET);
+        lseUbTensor = resource.ubBuf.template GetBufferByByte<float>(LSE_UB_TENSOR_OFFSET);
+        dUbTensor = resource.ubBuf.template GetBufferByByte<float>(D_UB_TENSOR_OFFSET);
+        lseBrcbUbTensor = resource.ubBuf.template GetBufferByByte<float>(LSE_BRCB_UB_TENSOR_OFFSET);
+        dBrcbUbTensor = resource.ubBuf.template GetBufferByByte<float>(D_BRCB_UB_TENSOR_OFFSET);
+
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    CATLASS_DEVICE
+    ~BlockEpilogue()
+    {
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    /// Loads the LSE of the q rows of this sub block and computes D = rowsum(dO * O).
+    /// gO and gdO point to the first row of the q block, layoutO is the [mActual, headDim] layout of both.
+    CATLASS_DEVICE
+    void UpdateRowStats(
+        AscendC::GlobalTensor<ElementOutput> const& gO, AscendC::GlobalTensor<ElementOutput> const& gdO,
+        layout::RowMajor const& layoutO, AscendC::GlobalTensor<ElementLse> const& gLse)
+    {
+        uint32_t mActual = layoutO.shape(0);
+        uint32_t headDim = layoutO.shape(1);
+        uint32_t subBlockIdx = AscendC::GetSubBlockIdx();
+        uint32_t subBlockNum = AscendC::GetSubBlockNum();
+        uint32_t mActualPerSubBlock = CeilDiv(mActual, subBlockNum);
+        mOffset = subBlockIdx * mActualPerSubBlock;
+        mThisSubBlock = (mActual > mOffset) ? Min(mActualPerSubBlock, mActual - mOffset) : 0;
+        if (mThisSubBlock == 0) {
+            return;
+        }
+
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        // The output tiles are reused for staging, wait for the stores of the previous tile
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID1);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID1);
+        AscendC::DataCopyPad(
+            lseUbTensor, gLse[mOffset], AscendC::DataCopyExtParams(1, mThisSubBlock * sizeof(float), 0, 0, 0),
+            AscendC::DataCopyPadExtParams<float>(false, 0, 0, 0));
+
+        // O and dO are staged in the output tiles and computed in the S and dP tiles
+        uint32_t rowsPerLoop = RoundDown(Min(MAX_ROWS_PER_SUB_BLOCK, UB_TILE_LEN / headDim), FLOAT_ELENUM_PER_BLK);
+        uint32_t loops = CeilDiv(mThisSubBlock, rowsPerLoop);
+        uint32_t headDimBlocks = headDim / FLOAT_ELENUM_PER_BLK;
+        for (uint32_t loopIdx = 0; loopIdx < loops; loopIdx++) {
+            uint32_t rowOffset = loopIdx * rowsPerLoop;
+            uint32_t rows = (loopIdx == loops - 1) ? (mThisSubBlock - rowOffset) : rowsPerLoop;
+            uint32_t calcLen = rows * headDim;
+            int64_t gmOffset = layoutO.GetOffset(MatrixCoord{mOffset + rowOffset, 0});
+            AscendC::DataCopyExtParams copyParams(
+                rows, headDim * sizeof(ElementOutput), (layoutO.stride(0) - headDim) * sizeof(ElementOutput), 0, 0);
+            AscendC::DataCopyPadExtParams<ElementOutput> padParams(false, 0, 0, 0);
+            if (loopIdx > 0) {
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID1);
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID1);
+            }
+            AscendC::DataCopyPad(pUbTensor, gO[gmOffset], copyParams, padParams);
+            AscendC::DataCopyPad(dsUbTensor, gdO[gmOffset], copyParams, padParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+
+            AscendC::Cast(sUbTensor, pUbTensor, AscendC::RoundMode::CAST_NONE, calcLen);
+            AscendC::Cast(dpUbTensor, dsUbTensor, AscendC::RoundMode::CAST_NONE, calcLen);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Mul(sUbTensor, sUbTensor, dpUbTensor, calcLen);
+            AscendC::PipeBarrier<PIPE_V>();
+            // Fold the columns beyond the first repeat, then reduce one repeat per row
+            for (uint32_t colOffset = FLOAT_ELENUM_PER_VECCALC; colOffset < headDim;
+                 colOffset += FLOAT_ELENUM_PER_VECCALC) {
+                AscendC::Add(
+                    sUbTensor, sUbTensor, sUbTensor[colOffset], Min(FLOAT_ELENUM_PER_VECCALC, headDim - colOffset),
+                    rows, AscendC::BinaryRepeatParams(1, 1, 1, headDimBlocks, headDimBlocks, headDimBlocks));
+                AscendC::PipeBarrier<PIPE_V>();
+            }
+            AscendC::RepeatReduceSum<float>(
+                dUbTensor[rowOffset], sUbTensor, rows, Min(FLOAT_ELENUM_PER_VECCALC, headDim), 0, 1, 1,
+                headDimBlocks);
+            AscendC::PipeBarrier<PIPE_V>();
+        }
+
+        // Each row value is broadcast to one block for the row-wise subtraction
+        AscendC::Brcb(
+            lseBrcbUbTensor, lseUbTensor, CeilDiv(mThisSubBlock, FLOAT_ELENUM_PER_BLK),
+            AscendC::BrcbRepeatParams(1, FLOAT_ELENUM_PER_BLK));
+        AscendC::Brcb(
+            dBrcbUbTensor, dUbTensor, CeilDiv(mThisSubBlock, FLOAT_ELENUM_PER_BLK),
+            AscendC::BrcbRepeatParams(1, FLOAT_ELENUM_PER_BLK));
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    /// Computes P and dS of the rows of this sub block. gS/gdP/gP/gdS point to the tiles of the whole q block,
+    /// actualBlockShape is (q rows, kv cols). If causalDiag is set, the tile sits on the diagonal of the causal mask
+    /// and the columns after the row index are masked.
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementOutput> const& gP, AscendC::GlobalTensor<ElementOutput> const& gdS,
+        AscendC::GlobalTensor<ElementInput> const& gS, AscendC::GlobalTensor<ElementInput> const& gdP,
+        MatrixCoord const& actualBlockShape, bool causalDiag)
+    {
+        if (mThisSubBlock == 0) {
+            return;
+        }
+        uint32_t nActual = actualBlockShape.column();
+        uint32_t calcLen = mThisSubBlock * TILE_COLS;
+        uint32_t tileOffset = mOffset * TILE_COLS;
+        constexpr uint32_t TILE_COL_BLOCKS = TILE_COLS / FLOAT_ELENUM_PER_BLK;
+
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::DataCopy(sUbTensor, gS[tileOffset], calcLen);
+        AscendC::DataCopy(dpUbTensor, gdP[tileOffset], calcLen);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+
+        // s = scale * s - lse, dp = dp - d
+        AscendC::Muls(sUbTensor, sUbTensor, scaleValue, calcLen);
+        AscendC::PipeBarrier<PIPE_V>();
+        for (uint32_t colOffset = 0; colOffset < TILE_COLS; colOffset += FLOAT_ELENUM_PER_VECCALC) {
+            AscendC::Sub(
+                sUbTensor[colOffset], sUbTensor[colOffset], lseBrcbUbTensor, FLOAT_ELENUM_PER_VECCALC, mThisSubBlock,
+                AscendC::BinaryRepeatParams(1, 1, 0, TILE_COL_BLOCKS, TILE_COL_BLOCKS, 1));
+            AscendC::Sub(
+                dpUbTensor[colOffset], dpUbTensor[colOffset], dBrcbUbTensor, FLOAT_ELENUM_PER_VECCALC, mThisSubBlock,
+                AscendC::BinaryRepeatParams(1, 1, 0, TILE_COL_BLOCKS, TILE_COL_BLOCKS, 1));
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+        if (causalDiag) {
+            for (uint32_t rowIdx = 0; rowIdx < mThisSubBlock; rowIdx++) {
+                uint32_t maskStart = mOffset + rowIdx + 1;
+                for (uint32_t colOffset = 0; colOffset < nActual; colOffset += FLOAT_ELENUM_PER_VECCALC) {
+                    if (maskStart >= colOffset + FLOAT_ELENUM_PER_VECCALC) {
+                        continue;
+                    }
+                    uint32_t maskSkip = (maskStart > colOffset) ? (maskStart - colOffset) : 0;
+                    uint64_t mask[2] = {static_cast<uint64_t>(-1) << maskSkip, 0};
+                    AscendC::Duplicate(sUbTensor[rowIdx * TILE_COLS + colOffset], MASK_VALUE, mask, 1, 1, 8);
+                }
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+        }
+        // p = exp(s), ds = scale * p * dp
+        AscendC::Exp(sUbTensor, sUbTensor, calcLen);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Mul(dpUbTensor, dpUbTensor, sUbTensor, calcLen);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Muls(dpUbTensor, dpUbTensor, scaleValue, calcLen);
+        AscendC::PipeBarrier<PIPE_V>();
+
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        CastOutput(pUbTensor, sUbTensor, calcLen);
+        CastOutput(dsUbTensor, dpUbTensor, calcLen);
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        AscendC::DataCopy(gP[tileOffset], pUbTensor, calcLen);
+        AscendC::DataCopy(gdS[tileOffset], dsUbTensor, calcLen);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    /// Zeroes len floats of an accumulator
+    CATLASS_DEVICE
+    void Clear(AscendC::GlobalTensor<float> const& gDst, uint64_t len)
+    {
+        if (len == 0) {
+            return;
+        }
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+        AscendC::Duplicate(sUbTensor, 0.0f, UB_TILE_LEN);
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        for (uint64_t offset = 0; offset < len; offset += UB_TILE_LEN) {
+            uint32_t actualLen = static_cast<uint32_t>(Min(static_cast<uint64_t>(UB_TILE_LEN), len - offset));
+            AscendC::DataCopyPad(
+                gDst[offset], sUbTensor, AscendC::DataCopyExtParams(1, actualLen * sizeof(float), 0, 0, 0));
+        }
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID1);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID1);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID1);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID1);
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+    }
+
+    /// gDst = ElementOutput(sum of srcNum float accumulators srcStride apart), summed in a fixed order
+    CATLASS_DEVICE
+    void ReduceCast(
+        AscendC::GlobalTensor<ElementOutput> const& gDst, AscendC::GlobalTensor<float> const& gSrc, uint64_t len,
+        uint32_t srcNum, uint64_t srcStride)
+    {
+        AscendC::DataCopyPadExtParams<float> padParams(false, 0, 0, 0);
+        for (uint64_t offset = 0; offset < len; offset += UB_TILE_LEN) {
+            uint32_t actualLen = static_cast<uint32_t>(Min(static_cast<uint64_t>(UB_TILE_LEN), len - offset));
+            AscendC::DataCopyExtParams copyParams(1, actualLen * sizeof(float), 0, 0, 0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+            AscendC::DataCopyPad(sUbTensor, gSrc[offset], copyParams, padParams);
+            for (uint32_t srcIdx = 1; srcIdx < srcNum; srcIdx++) {
+                if (srcIdx > 1) {
+                    AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID1);
+                    AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID1);
+                }
+                AscendC::DataCopyPad(dpUbTensor, gSrc[srcIdx * srcStride + offset], copyParams, padParams);
+                AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+                AscendC::Add(sUbTensor, sUbTensor, dpUbTensor, actualLen);
+                AscendC::PipeBarrier<PIPE_V>();
+            }
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+            CastOutput(pUbTensor, sUbTensor, actualLen);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID0);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+            AscendC::DataCopyPad(
+                gDst[offset], pUbTensor, AscendC::DataCopyExtParams(1, actualLen * sizeof(ElementOutput), 0, 0, 0));
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        }
+    }
+
+private:
+    CATLASS_DEVICE
+    void CastOutput(
+        AscendC::LocalTensor<ElementOutput> const& dst, AscendC::LocalTensor<float> const& src, uint32_t len)
+    {
+        if constexpr (std::is_same_v<ElementOutput, bfloat16_t>) {
+            AscendC::Cast(dst, src, AscendC::RoundMode::CAST_RINT, len);
+        } else {
+            AscendC::Cast(dst, src, AscendC::RoundMode::CAST_NONE, len);
+        }
+    }
+
+    float scaleValue;
+    uint32_t mOffset{0};
+    uint32_t mThisSubBlock{0};
+    AscendC::LocalTensor<float> sUbTensor;
+    AscendC::LocalTensor<float> dpUbTensor;
+    AscendC::LocalTensor<ElementOutput> pUbTensor;
+    AscendC::LocalTensor<ElementOutput> dsUbTensor;
+    AscendC::LocalTensor<float> lseUbTensor;
+    AscendC::LocalTensor<float> dUbTensor;
+    AscendC::LocalTensor<float> lseBrcbUbTensor;
+    AscendC::LocalTensor<float> dBrcbUbTensor;
+};
+
+} // namespace Catlass::Epilogue::Block
+
+#endif // CATLASS_EPILOGUE_BLOCK_BLOCK_EPILOGUE_FA_SOFTMAX_GRAD_HPP
@@ -296,11 +296,52 @@ public:
         AscendC::PipeBarrier<PIPE_V>();
     }
 
+    CATLASS_DEVICE
+    void ApplyTreeMask(
+        uint32_t sUbOffset, AscendC::GlobalTensor<uint64_t> const& gTreeMask, uint32_t curRowNum, uint32_t kSeqTile,
+        uint32_t kSeqTileRound, uint32_t tokenNumPerHead, int32_t draftStart, uint32_t draftLen)
+    {
+        // *** speculative tree: bit j of the packed mask of token t tells whether t sees draft token j.
+        // Draft token j sits at column draftStart + j of this tile; hidden columns are filled with -3e38
+        uint64_t draftBits = (draftLen >= FLOAT_VECTOR_SIZE) ? (uint64_t)-1 : (((uint64_t)1 << draftLen) - 1);
+        uint32_t chunkNum = (kSeqTile + FLOAT_VECTOR_SIZE - 1) / FLOAT_VECTOR_SIZE;
+        for (uint32_t rowIdx = 0; rowIdx < curRowNum; rowIdx++) {
+            uint64_t hiddenBits = ~gTreeMask.GetValue(rowIdx % tokenNumPerHead) & draftBits;
+            if (hiddenBits == 0) {
+                continue;
+            }
+            uint32_t rowUbOffset = sUbOffset + rowIdx * kSeqTileRound;
+            for (uint32_t chunkIdx = 0; chunkIdx < chunkNum; chunkIdx++) {
+                int32_t shift = draftStart - static_cast<int32_t>(chunkIdx * FLOAT_VECTOR_SIZE);
+                uint64_t fillBits = 0;
+                if (shift >= 0 && shift < static_cast<int32_t>(FLOAT_VECTOR_SIZE)) {
+                    fillBits = hiddenBits << shift;
+                } else if (shift < 0 && -shift < static_cast<int32_t>(FLOAT_VECTOR_SIZE)) {
+                    fillBits = hiddenBits >> (-shift);
+                }
+                uint32_t colLeft = kSeqTile - chunkIdx * FLOAT_VECTOR_SIZE;
+                if (colLeft < FLOAT_VECTOR_SIZE) {
+                    fillBits &= ((uint64_t)1 << colLeft) - 1;
+                }
+                if (fillBits == 0) {
+                    continue;
+                }
+                AscendC::SetVectorMask<int8_t>(0x0, fillBits);
+                AscendC::Duplicate<float, false>(
+                    lsUbTensor[rowUbOffset + chunkIdx * FLOAT_VECTOR_SIZE], (float)-3e38, (uint64_t)0, 1, 1, 8);
+            }
+        }
+        AscendC::SetVectorMask<int8_t>((uint64_t)-1, (uint64_t)-1);
+        AscendC::PipeBarrier<PIPE_V>();
+    }
+
     CATLASS_DEVICE
     void SubCoreCompute(
         AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
         const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, uint32_t nIdx, uint32_t softmaxPingPongFlag,
-        uint32_t* glFlag, uint32_t taskPingPongFlag, uint32_t sUbOffset)
+        uint32_t* glFlag, uint32_t taskPingPongFlag, uint32_t sUbOffset,
+        AscendC::GlobalTensor<uint64_t> const& gTreeMask, uint32_t tokenNumPerHead, int32_t draftStart,
+        uint32_t draftLen)
     {
         uint32_t curRowNum = layoutInput.shape(0);
         uint32_t kSeqTile = layoutInput.shape(1);
@@ -324,6 +365,11 @@ public:
             AscendC::UnaryRepeatParams(1, 1, 8, 8));
         AscendC::PipeBarrier<PIPE_V>();
 
+        if (draftLen > 0) {
+            ApplyTreeMask(
+                sUbOffset, gTreeMask, curRowNum, kSeqTile, kSeqTileRound, tokenNumPerHead, draftStart, draftLen);
+        }
+
         // *** lm = rowmax(ls)
         ReduceMaxRepeatM(lmUbTensor, lsUbTensor[sUbOffset], tvUbTensor, curRowNum, kSeqTile, kSeqTileRound);
 
@@ -402,6 +448,22 @@ public:
         AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
         const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, GemmCoord actualBlockShape, uint32_t nIdx,
         uint32_t curHeadNum, uint32_t softmaxPingPongFlag, uint32_t* glFlag, uint32_t taskPingPongFlag)
+    {
+        AscendC::GlobalTensor<uint64_t> gTreeMask;
+        (*this)(
+            gOutput, gInput, layoutOutput, layoutInput, actualBlockShape, nIdx, curHeadNum, softmaxPingPongFlag, glFlag,
+            taskPingPongFlag, gTreeMask, 0, 0);
+    }
+
+    /// Tree-masked variant for speculative decoding. gTreeMask holds one packed uint64_t per q token of the
+    /// batch; draftStart is the column of draft token 0 relative to this kv tile and may be negative when the
+    /// draft region started in an earlier tile. draftLen == 0 disables the mask.
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
+        const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, GemmCoord actualBlockShape, uint32_t nIdx,
+        uint32_t curHeadNum, uint32_t softmaxPingPongFlag, uint32_t* glFlag, uint32_t taskPingPongFlag,
+        AscendC::GlobalTensor<uint64_t> const& gTreeMask, int32_t draftStart, uint32_t draftLen)
     {
         uint32_t rowActual = actualBlockShape.m();
         uint32_t nActual = actualBlockShape.n();
@@ -426,7 +488,8 @@ public:
             auto layoutOutputThisSubBlock = layoutOutput.GetTileLayout(MatrixCoord(rowActualThisSubBlock, nActual));
             SubCoreCompute(
                 gOutputThisSubBlock, gInputThisSubBlock, layoutOutputThisSubBlock, layoutInputThisSubBlock, nIdx,
-                softmaxPingPongFlag, glFlag, taskPingPongFlag, sUbOffset);
+                softmaxPingPongFlag, glFlag, taskPingPongFlag, sUbOffset, gTreeMask, tokenNumPerHead, draftStart,
+                draftLen);
         }
     }
 
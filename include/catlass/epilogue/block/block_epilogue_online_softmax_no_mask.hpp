@@ -16,16 +16,19 @@
 #include "catlass/arch/resource.hpp"
 #include "catlass/epilogue/dispatch_policy.hpp"
 #include "catlass/epilogue/tile/tile_copy.hpp"
+#include "catlass/epilogue/tile/tile_fa_score_mod.hpp"
 #include "catlass/gemm_coord.hpp"
 #include "catlass/matrix_coord.hpp"
 
 namespace Catlass::Epilogue::Block {
 
-template <class OutputType_, class InputType_, class MaskType_>
-class BlockEpilogue<EpilogueAtlasA2OnlineSoftmax, OutputType_, InputType_, MaskType_> {
+template <class ScoreMod_, class OutputType_, class InputType_, class MaskType_>
+class BlockEpilogue<EpilogueAtlasA2OnlineSoftmax<ScoreMod_>, OutputType_, InputType_, MaskType_> {
 public:
-    using DispatchPolicy = EpilogueAtlasA2OnlineSoftmax;
+    using DispatchPolicy = EpilogueAtlasA2OnlineSoftmax<ScoreMod_>;
     using ArchTag = typename DispatchPolicy::ArchTag;
+    using TileScoreMod = Tile::TileFAScoreMod<ArchTag, ScoreMod_>;
+    using ScoreModParams = typename TileScoreMod::Params;
     using ElementOutput = typename OutputType_::Element;
     using ElementInput = typename InputType_::Element;
     using ElementMask = typename MaskType_::Element;
@@ -54,7 +57,9 @@ public:
         CAUSAL_MASK = 1
     };
     CATLASS_DEVICE
-    BlockEpilogue(Arch::Resource<ArchTag>& resource, float scaleValue_)
+    BlockEpilogue(
+        Arch::Resource<ArchTag>& resource, float scaleValue_, ScoreModParams const& scoreModParams = {})
+        : tileScoreMod(scoreModParams)
     {
         // Allocate UB space
         constexpr uint32_t LS_UB_TENSOR_OFFSET = 0;
@@ -377,6 +382,63 @@ public:
         AscendC::PipeBarrier<PIPE_V>();
     }
 
+    CATLASS_DEVICE
+    void ApplyWindowMask(
+        uint32_t sUbOffset, uint32_t rowOffset, uint32_t rowNumCurLoop, uint32_t columnNum, uint32_t columnNumRound,
+        uint32_t qSBlockSize, int32_t windowMaskOffset)
+    {
+        // *** sliding window: token t of the q block only sees columns >= windowMaskOffset + t,
+        // the left part of each row is filled with -3e38 on the fly instead of loading a mask from gm
+        for (uint32_t rowIdx = 0; rowIdx < rowNumCurLoop; rowIdx++) {
+            int32_t tokenIdx = static_cast<int32_t>((rowOffset + rowIdx) % qSBlockSize);
+            int32_t maskLen = Min(windowMaskOffset + tokenIdx, static_cast<int32_t>(columnNum));
+            if (maskLen <= 0) {
+                continue;
+            }
+            uint32_t rowUbOffset = sUbOffset + rowIdx * columnNumRound;
+            uint32_t fullRepeat = static_cast<uint32_t>(maskLen) / FLOAT_VECTOR_SIZE;
+            uint32_t tailLen = static_cast<uint32_t>(maskLen) % FLOAT_VECTOR_SIZE;
+            if (fullRepeat > 0) {
+                AscendC::Duplicate<float, false>(
+                    lsUbTensor[rowUbOffset], (float)-3e38, (uint64_t)0, fullRepeat, 1, 8);
+            }
+            if (tailLen > 0) {
+                SetVecMask(tailLen);
+                AscendC::Duplicate<float, false>(
+                    lsUbTensor[rowUbOffset + fullRepeat * FLOAT_VECTOR_SIZE], (float)-3e38, (uint64_t)0, 1, 1, 8);
+                AscendC::SetVectorMask<int8_t>((uint64_t)-1, (uint64_t)-1);
+            }
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+    }
+
+    CATLASS_DEVICE
+    void ApplyCausalMask(
+        uint32_t sUbOffset, uint32_t rowOffset, uint32_t rowNumCurLoop, uint32_t columnNum, uint32_t columnNumRound,
+        uint32_t qSBlockSize)
+    {
+        // *** causal diagonal tile: token t of the q block only sees columns <= t, the right part of each row
+        // is filled with -3e38 on the fly, the unaligned head of the part is selected by the vector mask
+        for (uint32_t rowIdx = 0; rowIdx < rowNumCurLoop; rowIdx++) {
+            uint32_t maskStart = (rowOffset + rowIdx) % qSBlockSize + 1;
+            if (maskStart >= columnNum) {
+                continue;
+            }
+            uint32_t rowUbOffset = sUbOffset + rowIdx * columnNumRound;
+            for (uint32_t colIdx = maskStart / FLOAT_VECTOR_SIZE * FLOAT_VECTOR_SIZE; colIdx < columnNum;
+                 colIdx += FLOAT_VECTOR_SIZE) {
+                uint32_t maskLo = (maskStart > colIdx) ? (maskStart - colIdx) : 0;
+                uint32_t maskHi = Min(columnNum - colIdx, FLOAT_VECTOR_SIZE);
+                uint64_t maskBits = (maskHi == FLOAT_VECTOR_SIZE) ? (uint64_t)-1 : (((uint64_t)1 << maskHi) - 1);
+                maskBits &= ~(((uint64_t)1 << maskLo) - 1);
+                AscendC::SetVectorMask<int8_t>(0x0, maskBits);
+                AscendC::Duplicate<float, false>(lsUbTensor[rowUbOffset + colIdx], (float)-3e38, (uint64_t)0, 1, 1, 8);
+            }
+        }
+        AscendC::SetVectorMask<int8_t>((uint64_t)-1, (uint64_t)-1);
+        AscendC::PipeBarrier<PIPE_V>();
+    }
+
     CATLASS_DEVICE
     void UpCastMask(uint32_t rowNumCurLoop, uint32_t columnNumRound)
     {
@@ -624,7 +686,36 @@ public:
     void operator()(
         AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
         const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, GemmCoord actualBlockShape,
-        uint32_t isFirstStackTile, uint32_t qSBlockSize, uint32_t qNBlockSize, uint32_t curStackTileMod)
+        uint32_t isFirstStackTile, uint32_t qSBlockSize, uint32_t qNBlockSize, uint32_t curStackTileMod,
+        bool applyWindowMask = false, int32_t windowMaskOffset = 0, Tile::FAScoreModCoord const& scoreModCoord = {})
+    {
+        ComputeUnmaskedInput(
+            gOutput, gInput, layoutOutput, layoutInput, actualBlockShape, isFirstStackTile, qSBlockSize, qNBlockSize,
+            curStackTileMod, applyWindowMask, windowMaskOffset, false, scoreModCoord);
+    }
+
+    /// Diagonal tile without a mask tensor: the causal mask is generated in ub from the row token index,
+    /// saving the mask load and the mask upcast of every diagonal tile.
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
+        const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, GemmCoord actualBlockShape,
+        uint32_t isFirstStackTile, uint32_t qSBlockSize, uint32_t qNBlockSize, uint32_t curStackTileMod,
+        Arch::CrossCoreFlag qkReady, Tile::FAScoreModCoord const& scoreModCoord = {})
+    {
+        Arch::CrossCoreWaitFlag(qkReady);
+        ComputeUnmaskedInput(
+            gOutput, gInput, layoutOutput, layoutInput, actualBlockShape, isFirstStackTile, qSBlockSize, qNBlockSize,
+            curStackTileMod, false, 0, true, scoreModCoord);
+    }
+
+    CATLASS_DEVICE
+    void ComputeUnmaskedInput(
+        AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
+        const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, GemmCoord actualBlockShape,
+        uint32_t isFirstStackTile, uint32_t qSBlockSize, uint32_t qNBlockSize, uint32_t curStackTileMod,
+        bool applyWindowMask, int32_t windowMaskOffset, bool applyCausalMask,
+        Tile::FAScoreModCoord const& scoreModCoord)
     {
         uint32_t rowNum = actualBlockShape.m();
         uint32_t columnNum = actualBlockShape.n();
@@ -676,6 +767,19 @@ public:
                 auto layoutOutputCurLoop = layoutOutput.GetTileLayout(MatrixCoord(rowNumCurLoop, columnNum));
                 AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(pingpongFlag);
                 ScaleS((pingpongFlag * MAX_UB_S_ELEM_NUM), rowNumCurLoop, columnNumRound);
+                tileScoreMod(
+                    lsUbTensor[pingpongFlag * MAX_UB_S_ELEM_NUM], tvUbTensor, rowOffsetIoGm, rowNumCurLoop, columnNum,
+                    columnNumRound, qSBlockSize, scoreModCoord);
+                if (applyWindowMask) {
+                    ApplyWindowMask(
+                        (pingpongFlag * MAX_UB_S_ELEM_NUM), rowOffsetIoGm, rowNumCurLoop, columnNum, columnNumRound,
+                        qSBlockSize, windowMaskOffset);
+                }
+                if (applyCausalMask) {
+                    ApplyCausalMask(
+                        (pingpongFlag * MAX_UB_S_ELEM_NUM), rowOffsetIoGm, rowNumCurLoop, columnNum, columnNumRound,
+                        qSBlockSize);
+                }
                 SubCoreCompute<MaskCategory::NO_MASK>(
                     gOutputCurLoop, layoutOutputCurLoop, rowOffsetCurLoop, isFirstStackTile, columnNumRound,
                     pingpongFlag, curStackTileMod);
@@ -688,7 +792,8 @@ public:
         AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
         AscendC::GlobalTensor<ElementMask> gMask, const LayoutOutput& layoutOutput, const LayoutInput& layoutInput,
         const LayoutInput& layoutMask, GemmCoord actualBlockShape, uint32_t isFirstStackTile, uint32_t qSBlockSize,
-        uint32_t qNBlockSize, uint32_t curStackTileMod, Arch::CrossCoreFlag qkReady)
+        uint32_t qNBlockSize, uint32_t curStackTileMod, Arch::CrossCoreFlag qkReady,
+        Tile::FAScoreModCoord const& scoreModCoord = {})
     {
         uint32_t rowNum = actualBlockShape.m();
         uint32_t columnNum = actualBlockShape.n();
@@ -768,6 +873,10 @@ public:
                 UpCastMask(rowNumCurLoop, columnNumRound);
                 AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(pingpongFlag);
                 ScaleS((pingpongFlag * MAX_UB_S_ELEM_NUM), rowNumCurLoop, columnNumRound);
+                // score mods go before the mask, softcap would otherwise clamp the masked -3e38 back to -softcap
+                tileScoreMod(
+                    lsUbTensor[pingpongFlag * MAX_UB_S_ELEM_NUM], tvUbTensor, rowOffsetCurLoop + rowOffsetThisSubBlock,
+                    rowNumCurLoop, columnNum, columnNumRound, qSBlockSize, scoreModCoord);
                 ApplyMask((pingpongFlag * MAX_UB_S_ELEM_NUM), rowNumCurLoop, columnNumRound);
                 AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID2);
                 // next loop mask load
@@ -804,6 +913,7 @@ public:
 
 private:
     float scaleValue;
+    TileScoreMod tileScoreMod;
     AscendC::LocalTensor<float> lsUbTensor;
     AscendC::LocalTensor<ElementOutput> lpUbTensor;
     AscendC::LocalTensor<ElementMask> maskUbTensor;
@@ -115,11 +115,31 @@ public:
         }
     }
 
+    CATLASS_DEVICE
+    void CopyLseToGm(
+        AscendC::GlobalTensor<float> gLse, uint32_t curRowNum, uint32_t qSBlockSize, uint32_t qNThisSubBlock,
+        uint32_t qHeads)
+    {
+        // one lse per 32B block in tv, written with the stride of the heads
+        if (qNThisSubBlock == 0) {
+            AscendC::DataCopyPad(
+                gLse, tvUbTensor,
+                AscendC::DataCopyExtParams(curRowNum, sizeof(float), 0, (qHeads - 1) * sizeof(float), 0));
+        } else {
+            for (uint32_t qNIdx = 0; qNIdx < qNThisSubBlock; qNIdx++) {
+                AscendC::DataCopyPad(
+                    gLse[qNIdx], tvUbTensor[qNIdx * qSBlockSize * FLOAT_BLOCK_SIZE],
+                    AscendC::DataCopyExtParams(qSBlockSize, sizeof(float), 0, (qHeads - 1) * sizeof(float), 0));
+            }
+        }
+    }
+
     CATLASS_DEVICE
     void SubCoreCompute(
         AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
         const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, uint32_t qNThisSubBlock,
-        uint32_t isFirstStackTile, uint32_t isLastStackTile, uint32_t curStackTileMod)
+        uint32_t isFirstStackTile, uint32_t isLastStackTile, uint32_t curStackTileMod,
+        AscendC::GlobalTensor<float> gLse, bool lseFlag)
     {
         uint32_t curRowNum = layoutInput.shape(0);
         uint32_t embed = layoutInput.shape(1);
@@ -201,6 +221,22 @@ public:
             }
             AscendC::PipeBarrier<PIPE_V>();
 
+            if (lseFlag) {
+                // *** lse = hm + ln(gl), gl_block is still in tv
+                AscendC::Ln<float, false>(
+                    tvUbTensor, tvUbTensor, (uint64_t)0, curRowNumRound / FLOAT_BLOCK_SIZE,
+                    AscendC::UnaryRepeatParams(1, 1, 8, 8));
+                AscendC::Brcb(
+                    tvUbTensor[curRowNumRound * FLOAT_BLOCK_SIZE].ReinterpretCast<uint32_t>(),
+                    hmUbTensor.ReinterpretCast<uint32_t>(), curRowNumRound / FLOAT_BLOCK_SIZE,
+                    AscendC::BrcbRepeatParams(1, 8));
+                AscendC::PipeBarrier<PIPE_V>();
+                AscendC::Add<float, false>(
+                    tvUbTensor, tvUbTensor, tvUbTensor[curRowNumRound * FLOAT_BLOCK_SIZE], (uint64_t)0,
+                    curRowNumRound / FLOAT_BLOCK_SIZE, AscendC::BinaryRepeatParams(1, 1, 1, 8, 8, 8));
+                AscendC::PipeBarrier<PIPE_V>();
+            }
+
             // *** go = castfp32to16(go)
             if (std::is_same<ElementOutput, bfloat16_t>::value) {
                 AscendC::Cast<ElementOutput, float, false>(
@@ -218,6 +254,12 @@ public:
 
             // ***move O to GM
             CopyOToGm(gOutput, curRowNum, qSBlockSize, embed, embedRound, qNThisSubBlock, oHiddenSize);
+            if (lseFlag) {
+                CopyLseToGm(gLse, curRowNum, qSBlockSize, qNThisSubBlock, oHiddenSize / embed);
+                // tv is rewritten by the next vector stage
+                AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID3);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID3);
+            }
         }
     }
 
@@ -227,6 +269,33 @@ public:
         const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, GemmCoord actualBlockShape,
         uint32_t qSBlockSize, uint32_t qNBlockSize, uint32_t isFirstStackTile, uint32_t isLastStackTile,
         uint32_t curStackTileMod)
+    {
+        Compute(
+            gOutput, gInput, layoutOutput, layoutInput, actualBlockShape, qSBlockSize, qNBlockSize, isFirstStackTile,
+            isLastStackTile, curStackTileMod, {}, false);
+    }
+
+    /// Same as above, and also writes lse = rowmax + ln(rowsum) of every row to gLse ([qSeqlen, qHeads], float)
+    /// with the last stack tile, so that partial results over disjoint kv ranges can be merged.
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
+        const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, GemmCoord actualBlockShape,
+        uint32_t qSBlockSize, uint32_t qNBlockSize, uint32_t isFirstStackTile, uint32_t isLastStackTile,
+        uint32_t curStackTileMod, AscendC::GlobalTensor<float> const& gLse)
+    {
+        Compute(
+            gOutput, gInput, layoutOutput, layoutInput, actualBlockShape, qSBlockSize, qNBlockSize, isFirstStackTile,
+            isLastStackTile, curStackTileMod, gLse, true);
+    }
+
+private:
+    CATLASS_DEVICE
+    void Compute(
+        AscendC::GlobalTensor<ElementOutput> gOutput, AscendC::GlobalTensor<ElementInput> gInput,
+        const LayoutOutput& layoutOutput, const LayoutInput& layoutInput, GemmCoord actualBlockShape,
+        uint32_t qSBlockSize, uint32_t qNBlockSize, uint32_t isFirstStackTile, uint32_t isLastStackTile,
+        uint32_t curStackTileMod, AscendC::GlobalTensor<float> const& gLse, bool lseFlag)
     {
         uint32_t rowNum = actualBlockShape.m();
         uint32_t embed = actualBlockShape.n();
@@ -254,13 +323,14 @@ public:
             int64_t offsetInput = layoutInput.GetOffset(MatrixCoord(inRowOffsetThisSubBlock, 0));
             auto gInputThisSubBlock = gInput[offsetInput];
             auto layoutInputThisSubBlock = layoutInput.GetTileLayout(MatrixCoord(inRowActualThisSubBlock, embed));
+            uint32_t qHeads = layoutOutput.shape(1) / embed;
+            auto gLseThisSubBlock = gLse[outRowOffsetThisSubBlock * qHeads + outColOffsetThisSubBlock / embed];
             SubCoreCompute(
                 gOutputThisSubBlock, gInputThisSubBlock, layoutOutputThisSubBlock, layoutInputThisSubBlock,
-                qNThisSubBlock, isFirstStackTile, isLastStackTile, curStackTileMod);
+                qNThisSubBlock, isFirstStackTile, isLastStackTile, curStackTileMod, gLseThisSubBlock, lseFlag);
         }
     }
 
-private:
     AscendC::LocalTensor<float> loUbTensor;
     AscendC::LocalTensor<float> dmUbTensor;
     AscendC::LocalTensor<float> hmUbTensor;
@@ -44,9 +44,20 @@ struct EpilogueAtlasA2MLASoftmax {
     using ArchTag = Arch::AtlasA2;
 };
 
+// Score modifiers of the FA Infer online Softmax, applied to the scaled S tile in UB before the row max
+struct FAScoreModNone {};
+// Causal ALiBi, s += slope[head] * (kvPos - qPos)
+struct FAScoreModAlibi {};
+// Gemma-2 style tanh softcapping, s = softcap * tanh(s / softcap)
+struct FAScoreModSoftcap {};
+// Relative position bias, s += relBias[head][kvPos - qPos]
+struct FAScoreModRelPosBias {};
+
 // For AtlasA2, FA Infer online Softmax no mask
+template <class ScoreMod_ = FAScoreModNone>
 struct EpilogueAtlasA2OnlineSoftmax {
     using ArchTag = Arch::AtlasA2;
+    using ScoreMod = ScoreMod_;
 };
 
 // For AtlasA2, FA Infer RescaleO no split row
@@ -54,6 +65,11 @@ struct EpilogueAtlasA2RescaleO {
     using ArchTag = Arch::AtlasA2;
 };
 
+// For AtlasA2, FA backward softmax gradient (P and dS recomputed from the saved LSE)
+struct EpilogueAtlasA2FASoftmaxGrad {
+    using ArchTag = Arch::AtlasA2;
+};
+
 // For Ascend950, FA Infer online Softmax
 template <bool ATTENTION_MASK_FLAG_ = false, bool ENABLE_P_SCALE_ = false>
 struct EpilogueAscend950FASoftmax {
@@ -131,6 +147,15 @@ struct BlockEpiloguePertile {
 struct EpilogueAtlasA2W4A4PerTokenPerChannelDequant {
     using ArchTag = Arch::AtlasA2;
 };
+
+// For AtlasA2, Conv2d epilogue on NC1HWC0 of the form D = act(C * scale + shift + X), where scale and shift are per
+// output channel (folded BatchNorm) and X is an optional residual
+template <uint32_t COMPUTE_LENGTH_ = 8192>
+struct EpilogueAtlasA2ConvBnAct {
+    using ArchTag = Arch::AtlasA2;
+    // Number of fp32 elements of one UB compute tile
+    static constexpr uint32_t COMPUTE_LENGTH = COMPUTE_LENGTH_;
+};
 ////////////////////////////
 /// new add
 // For AtlasA2, GEMM
@@ -21,6 +21,10 @@
 #include "catlass/epilogue/fusion/visitor_aux_store.hpp"
 #include "catlass/epilogue/fusion/visitor_cast.hpp"
 #include "catlass/epilogue/fusion/visitor_row_broadcast.hpp"
+#include "catlass/epilogue/fusion/visitor_col_broadcast.hpp"
+#include "catlass/epilogue/fusion/visitor_scalar_load.hpp"
+#include "catlass/epilogue/fusion/visitor_row_reduce.hpp"
+#include "catlass/epilogue/fusion/visitor_col_reduce.hpp"
 #include "catlass/epilogue/fusion/tree_visitor.hpp"
 #include "catlass/epilogue/fusion/topological_visitor.hpp"
 
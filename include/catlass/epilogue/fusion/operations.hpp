@@ -83,6 +83,15 @@ struct Silu {
     }
 };
 
+template <typename T>
+struct Abs {
+    CATLASS_DEVICE
+    void operator()(AscendC::LocalTensor<T>& dst, uint32_t compute_length, AscendC::LocalTensor<T> const& src) const
+    {
+        AscendC::Abs(dst, src, compute_length);
+    }
+};
+
 // 二元
 template <typename T>
 struct Mul {
@@ -232,6 +241,111 @@ struct AddRelu {
     }
 };
 
+// 归约：供 VisitorRowReduce / VisitorColReduce 使用
+// - Combine：两个部分结果逐元素合并（count 模式，或按 repeat 参数跨行合并，mask 由调用方设置）
+// - ReduceRepeat：每个 repeat 内的有效元素归约为一个值，结果按 repeat 连续存放
+// - SetAtomic：跨 tile / 跨核合并时 GM 写出所使用的原子操作
+template <typename T>
+struct ReduceSum {
+    CATLASS_DEVICE
+    static void SetAtomic()
+    {
+        AscendC::SetAtomicAdd<T>();
+    }
+
+    CATLASS_DEVICE
+    void Combine(
+        AscendC::LocalTensor<T> const& dst, AscendC::LocalTensor<T> const& src0, AscendC::LocalTensor<T> const& src1,
+        uint32_t count) const
+    {
+        AscendC::Add(dst, src0, src1, count);
+    }
+
+    CATLASS_DEVICE
+    void Combine(
+        AscendC::LocalTensor<T> const& dst, AscendC::LocalTensor<T> const& src0, AscendC::LocalTensor<T> const& src1,
+        uint8_t repeat, AscendC::BinaryRepeatParams const& repeatParams) const
+    {
+        AscendC::Add<T, false>(dst, src0, src1, (uint64_t)0, repeat, repeatParams);
+    }
+
+    CATLASS_DEVICE
+    void ReduceRepeat(
+        AscendC::LocalTensor<T> const& dst, AscendC::LocalTensor<T> const& src, uint8_t repeat,
+        uint16_t srcRepStride) const
+    {
+        AscendC::RepeatReduceSum<T, false>(dst, src, repeat, 0, 0, 1, 1, srcRepStride);
+    }
+};
+
+template <typename T>
+struct ReduceMax {
+    CATLASS_DEVICE
+    static void SetAtomic()
+    {
+        AscendC::SetAtomicMax<T>();
+    }
+
+    CATLASS_DEVICE
+    void Combine(
+        AscendC::LocalTensor<T> const& dst, AscendC::LocalTensor<T> const& src0, AscendC::LocalTensor<T> const& src1,
+        uint32_t count) const
+    {
+        AscendC::Max(dst, src0, src1, count);
+    }
+
+    CATLASS_DEVICE
+    void Combine(
+        AscendC::LocalTensor<T> const& dst, AscendC::LocalTensor<T> const& src0, AscendC::LocalTensor<T> const& src1,
+        uint8_t repeat, AscendC::BinaryRepeatParams const& repeatParams) const
+    {
+        AscendC::Max<T, false>(dst, src0, src1, (uint64_t)0, repeat, repeatParams);
+    }
+
+    CATLASS_DEVICE
+    void ReduceRepeat(
+        AscendC::LocalTensor<T> const& dst, AscendC::LocalTensor<T> const& src, uint8_t repeat,
+        uint16_t srcRepStride) const
+    {
+        AscendC::WholeReduceMax<T, false>(
+            dst, src, 0, repeat, 1, 1, srcRepStride, AscendC::ReduceOrder::ORDER_ONLY_VALUE);
+    }
+};
+
+template <typename T>
+struct ReduceMin {
+    CATLASS_DEVICE
+    static void SetAtomic()
+    {
+        AscendC::SetAtomicMin<T>();
+    }
+
+    CATLASS_DEVICE
+    void Combine(
+        AscendC::LocalTensor<T> const& dst, AscendC::LocalTensor<T> const& src0, AscendC::LocalTensor<T> const& src1,
+        uint32_t count) const
+    {
+        AscendC::Min(dst, src0, src1, count);
+    }
+
+    CATLASS_DEVICE
+    void Combine(
+        AscendC::LocalTensor<T> const& dst, AscendC::LocalTensor<T> const& src0, AscendC::LocalTensor<T> const& src1,
+        uint8_t repeat, AscendC::BinaryRepeatParams const& repeatParams) const
+    {
+        AscendC::Min<T, false>(dst, src0, src1, (uint64_t)0, repeat, repeatParams);
+    }
+
+    CATLASS_DEVICE
+    void ReduceRepeat(
+        AscendC::LocalTensor<T> const& dst, AscendC::LocalTensor<T> const& src, uint8_t repeat,
+        uint16_t srcRepStride) const
+    {
+        AscendC::WholeReduceMin<T, false>(
+            dst, src, 0, repeat, 1, 1, srcRepStride, AscendC::ReduceOrder::ORDER_ONLY_VALUE);
+    }
+};
+
 #if (defined(CATLASS_ARCH) && CATLASS_ARCH == 3510)
 // Prelu
 template <typename T>
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_FUSION_VISITOR_COL_BROADCAST_HPP
+#define CATLASS_EPILOGUE_FUSION_VISITOR_COL_BROADCAST_HPP
+
+#include "catlass/epilogue/fusion/visitor_impl.hpp"
+#include "catlass/epilogue/tile/copy_gm_to_ub_tla.hpp"
+#include "tla/tensor.hpp"
+#include "tla/layout.hpp"
+#include "catlass/layout/layout.hpp"
+
+namespace Catlass::Epilogue::Fusion {
+
+// 列广播：把 GM 中 M 个值（每行一个，如 per-token scale）广播为当前 MxN tile（与 VisitorRowBroadcast 对偶）
+// - LOAD：读取当前 tile 行范围 [globalOffset.row(), +rows) 的 rows 个值到 UB
+// - COMPUTE：Brcb 把每个值扩展为一个 32B block，再用 srcStride = 0 的 Copy 铺满整行
+// - STORE：无操作，返回缓存的 UB tile
+// GM 输入按 (1, M) 行主序连续存放，与 VisitorColReduce 的输出布局一致
+template <class Element, class Layout>
+struct VisitorColBroadcast : VisitorImpl<> {
+    using VisitorImpl<>::VisitorImpl;
+
+    using ElementOutput = Element;
+
+    static_assert(
+        sizeof(Element) == 2 || sizeof(Element) == 4, "VisitorColBroadcast only supports 16-bit or 32-bit elements.");
+
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_REPEAT = BYTE_PER_VECTOR_FRACTAL / sizeof(Element);
+    static constexpr uint32_t MAX_REPEAT = 255;
+    static constexpr uint32_t MAX_REP_STRIDE = 255;
+    // 每批 Brcb 处理的行数，Brcb 结果区大小为 BRCB_ROWS 个 block
+    static constexpr uint32_t BRCB_ROWS = 64;
+
+    struct Arguments {
+        GM_ADDR ptr_col = nullptr; // M 个值的 GM 地址
+        Layout layout = {};        // (1, M) 布局
+    };
+
+    struct Params {
+        GM_ADDR ptr_col;
+        Layout layout;
+
+        Params()
+        {}
+
+        Params(GM_ADDR ptr_col_, Layout const& layout_) : ptr_col(ptr_col_), layout(layout_)
+        {}
+    };
+
+    template <class ProblemShape>
+    static constexpr Params to_underlying_arguments(ProblemShape const&, Arguments const& args, void*)
+    {
+        return Params(args.ptr_col, args.layout);
+    }
+
+    template <class ProblemShape>
+    static size_t get_workspace_size(ProblemShape const&, Arguments const&)
+    {
+        return 0;
+    }
+
+    template <class ProblemShape>
+    static bool can_implement(ProblemShape const&, Arguments const& args)
+    {
+        return args.ptr_col != nullptr;
+    }
+
+    VisitorColBroadcast()
+    {}
+
+    VisitorColBroadcast(Params const& params_) : params(params_)
+    {}
+
+    struct Callbacks : EmptyCallbacks {
+        AscendC::LocalTensor<Element> ubOut;
+        AscendC::LocalTensor<Element> ubCol;
+        AscendC::LocalTensor<Element> ubBrcb;
+        Params const* params_ptr;
+        uint32_t compute_length;
+
+        CATLASS_DEVICE
+        Callbacks(
+            AscendC::LocalTensor<Element> ubOut_, AscendC::LocalTensor<Element> ubCol_,
+            AscendC::LocalTensor<Element> ubBrcb_, Params const* params_ptr_, uint32_t compute_length_)
+            : ubOut(ubOut_), ubCol(ubCol_), ubBrcb(ubBrcb_), params_ptr(params_ptr_), compute_length(compute_length_)
+        {}
+
+        CATLASS_DEVICE
+        void BroadcastRows(uint32_t rowOffset, uint32_t rows, uint32_t alignedCols)
+        {
+            uint32_t rowStrideBlk = alignedCols / ELE_NUM_PER_BLK;
+            AscendC::CopyRepeatParams repeatParams;
+            if (rowStrideBlk <= MAX_REP_STRIDE) {
+                // 一个 repeat 对应一行：src 每行前进一个 block，block 内 stride 为 0
+                repeatParams.dstStride = 1;
+                repeatParams.srcStride = 0;
+                repeatParams.dstRepeatSize = rowStrideBlk;
+                repeatParams.srcRepeatSize = 1;
+                for (uint32_t c = 0; c < alignedCols; c += ELE_NUM_PER_REPEAT) {
+                    AscendC::Copy(
+                        ubOut[rowOffset * alignedCols + c], ubBrcb, Min(ELE_NUM_PER_REPEAT, alignedCols - c),
+                        static_cast<uint8_t>(rows), repeatParams);
+                }
+                return;
+            }
+            // 行过宽时逐行铺满，repeat 沿列方向推进
+            repeatParams.dstStride = 1;
+            repeatParams.srcStride = 0;
+            repeatParams.dstRepeatSize = BLK_NUM_PER_VECTOR_FRACTAL;
+            repeatParams.srcRepeatSize = 0;
+            uint32_t fullRepeats = alignedCols / ELE_NUM_PER_REPEAT;
+            uint32_t tail = alignedCols % ELE_NUM_PER_REPEAT;
+            for (uint32_t r = 0; r < rows; ++r) {
+                auto ubDstRow = ubOut[(rowOffset + r) * alignedCols];
+                auto ubSrcBlk = ubBrcb[r * ELE_NUM_PER_BLK];
+                for (uint32_t i = 0; i < fullRepeats; i += MAX_REPEAT) {
+                    AscendC::Copy(
+                        ubDstRow[i * ELE_NUM_PER_REPEAT], ubSrcBlk, ELE_NUM_PER_REPEAT,
+                        static_cast<uint8_t>(Min(MAX_REPEAT, fullRepeats - i)), repeatParams);
+                }
+                if (tail > 0) {
+                    AscendC::Copy(ubDstRow[fullRepeats * ELE_NUM_PER_REPEAT], ubSrcBlk, tail, 1, repeatParams);
+                }
+            }
+        }
+
+        template <VisitStage Stage, class ArchTag, class TensorC, typename... Args>
+        CATLASS_DEVICE AscendC::LocalTensor<Element> const& visit(
+            TensorC const& tensorTile, MatrixCoord const& alignedTileShape, MatrixCoord const& globalOffset,
+            Args const&... /*unused*/
+        )
+        {
+            auto actualRows = tla::get<0>(tensorTile.shape());
+            uint32_t alignedCols = alignedTileShape.column();
+
+            if constexpr (Stage == VisitStage::LOAD) {
+                auto layoutUbCol = tla::MakeLayout(
+                    tla::MakeShape(tla::Int<1>{}, actualRows),
+                    tla::MakeStride(RoundUp<ELE_NUM_PER_BLK>(static_cast<uint32_t>(actualRows)), tla::Int<1>{}));
+                auto tensorUbCol = tla::MakeTensor(ubCol, layoutUbCol, Arch::PositionUB{});
+
+                AscendC::GlobalTensor<Element> gmCol;
+                gmCol.SetGlobalBuffer((__gm__ Element*)(params_ptr->ptr_col));
+                auto tensorCol = tla::MakeTensor(gmCol, params_ptr->layout, Arch::PositionGM{});
+                auto tensorTileCol = GetTile(
+                    tensorCol, tla::MakeCoord(uint32_t(0), globalOffset.row()),
+                    tla::MakeShape(tla::Int<1>{}, actualRows));
+
+                using CopyGm2UbTlaT =
+                    Epilogue::Tile::CopyGm2UbTla<ArchTag, decltype(tensorTileCol), decltype(tensorUbCol)>;
+                CopyGm2UbTlaT copyGm2UbTla{};
+                copyGm2UbTla(tensorUbCol, tensorTileCol);
+            }
+            if constexpr (Stage == VisitStage::COMPUTE) {
+                AscendC::BrcbRepeatParams brcbParams;
+                brcbParams.dstBlkStride = 1;
+                brcbParams.dstRepStride = BLK_NUM_PER_VECTOR_FRACTAL;
+                for (uint32_t r = 0; r < actualRows; r += BRCB_ROWS) {
+                    uint32_t batchRows = Min(BRCB_ROWS, actualRows - r);
+                    if (r > 0) {
+                        // 上一批 Copy 读完 ubBrcb 后才能覆盖
+                        AscendC::PipeBarrier<PIPE_V>();
+                    }
+                    AscendC::Brcb(
+                        ubBrcb, ubCol[r], static_cast<uint8_t>(CeilDiv<BLK_NUM_PER_VECTOR_FRACTAL>(batchRows)),
+                        brcbParams);
+                    AscendC::PipeBarrier<PIPE_V>();
+                    BroadcastRows(r, batchRows, alignedCols);
+                }
+            }
+            return ubOut;
+        }
+    };
+
+    template <class ArchTag>
+    CATLASS_DEVICE auto get_callbacks(Arch::Resource<ArchTag>& resource, uint32_t& ub_offset, uint32_t compute_length)
+    {
+        auto ubOut = resource.ubBuf.template GetBufferByByte<Element>(ub_offset);
+        ub_offset += compute_length * sizeof(Element);
+        // 每个 tile 行数不超过 compute_length / ELE_NUM_PER_BLK，Brcb 按 8 个一组读取，尾部多留一组
+        auto ubCol = resource.ubBuf.template GetBufferByByte<Element>(ub_offset);
+        ub_offset += RoundUp<BYTE_PER_BLK>(
+            (compute_length / ELE_NUM_PER_BLK + BLK_NUM_PER_VECTOR_FRACTAL) * static_cast<uint32_t>(sizeof(Element)));
+        auto ubBrcb = resource.ubBuf.template GetBufferByByte<Element>(ub_offset);
+        ub_offset += RoundUp<BLK_NUM_PER_VECTOR_FRACTAL>(BRCB_ROWS) * BYTE_PER_BLK;
+        assert(ub_offset <= ArchTag::UB_SIZE);
+        return Callbacks(ubOut, ubCol, ubBrcb, &params, compute_length);
+    }
+
+    Params params;
+};
+
+} // namespace Catlass::Epilogue::Fusion
+
+#endif
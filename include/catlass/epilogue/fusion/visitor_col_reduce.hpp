@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_FUSION_VISITOR_COL_REDUCE_HPP
+#define CATLASS_EPILOGUE_FUSION_VISITOR_COL_REDUCE_HPP
+
+#include "catlass/epilogue/fusion/visitor_impl.hpp"
+#include "catlass/epilogue/fusion/operations.hpp"
+#include "catlass/epilogue/tile/copy_ub_to_gm_tla.hpp"
+#include "tla/tensor.hpp"
+#include "tla/layout.hpp"
+#include "catlass/layout/layout.hpp"
+
+namespace Catlass::Epilogue::Fusion {
+
+// 列归约：沿 N 方向把 MxN 的输入归约为 M 个值（每行一个）写回 GM
+// - COMPUTE：每行超过一个 repeat 的部分先按 256B 分段合并到紧凑工作区，再一次 repeat 归约得到每行结果
+// - STORE：部分结果以 ReduceFn 对应的原子操作写回 GM，完成跨 tile（N 方向切分）/ 跨核合并
+// - 输入原样透传，节点可放在通往最终 store 的任意位置
+// GM 结果按 (1, M) 行主序连续存放；启动前需初始化为 ReduceFn 的单位元
+template <template <class> class ReduceFn, class Element, class Layout>
+struct VisitorColReduce : VisitorImpl<> {
+    using VisitorImpl<>::VisitorImpl;
+
+    using ElementOutput = Element;
+
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_REPEAT = BYTE_PER_VECTOR_FRACTAL / sizeof(Element);
+    static constexpr uint32_t BLK_NUM_PER_REPEAT = BYTE_PER_VECTOR_FRACTAL / BYTE_PER_BLK;
+    static constexpr uint32_t MAX_REPEAT = 255;
+    static constexpr uint32_t MAX_REP_STRIDE = 255;
+    // 归约结果按行连续写出，单次发射的行数取 32B 对齐，保证每批 dst 起始地址对齐
+    static constexpr uint32_t REDUCE_ROWS_PER_ISSUE = MAX_REPEAT / ELE_NUM_PER_BLK * ELE_NUM_PER_BLK;
+
+    struct Arguments {
+        GM_ADDR ptr_col = nullptr; // M 个归约结果的 GM 地址
+        Layout layout = {};        // (1, M) 布局
+    };
+
+    struct Params {
+        GM_ADDR ptr_col;
+        Layout layout;
+
+        Params()
+        {}
+
+        Params(GM_ADDR ptr_col_, Layout const& layout_) : ptr_col(ptr_col_), layout(layout_)
+        {}
+    };
+
+    template <class ProblemShape>
+    static constexpr Params to_underlying_arguments(ProblemShape const&, Arguments const& args, void*)
+    {
+        return Params(args.ptr_col, args.layout);
+    }
+
+    template <class ProblemShape>
+    static size_t get_workspace_size(ProblemShape const&, Arguments const&)
+    {
+        return 0;
+    }
+
+    template <class ProblemShape>
+    static bool can_implement(ProblemShape const&, Arguments const& args)
+    {
+        return args.ptr_col != nullptr;
+    }
+
+    VisitorColReduce()
+    {}
+
+    VisitorColReduce(Params const& params_) : params(params_)
+    {}
+
+    struct Callbacks : EmptyCallbacks {
+        AscendC::LocalTensor<Element> ubWork;
+        AscendC::LocalTensor<Element> ubRes;
+        Params const* params_ptr;
+        uint32_t compute_length;
+
+        CATLASS_DEVICE
+        Callbacks(
+            AscendC::LocalTensor<Element> ubWork_, AscendC::LocalTensor<Element> ubRes_, Params const* params_ptr_,
+            uint32_t compute_length_)
+            : ubWork(ubWork_), ubRes(ubRes_), params_ptr(params_ptr_), compute_length(compute_length_)
+        {}
+
+        CATLASS_DEVICE
+        void SetMaskByCount(uint32_t count)
+        {
+            // 单个 repeat 内前 count 个元素有效（normal mask 模式）
+            uint64_t maskLow = (count >= 64) ? ~uint64_t(0) : ((uint64_t(1) << count) - 1);
+            uint64_t maskHigh = 0;
+            if (count >= 128) {
+                maskHigh = ~uint64_t(0);
+            } else if (count > 64) {
+                maskHigh = (uint64_t(1) << (count - 64)) - 1;
+            }
+            AscendC::SetVectorMask<Element>(maskHigh, maskLow);
+        }
+
+        CATLASS_DEVICE
+        void ReduceRows(AscendC::LocalTensor<Element> const& src, uint32_t rows, uint32_t srcRepStride)
+        {
+            ReduceFn<Element> reduceFn{};
+            for (uint32_t r = 0; r < rows; r += REDUCE_ROWS_PER_ISSUE) {
+                uint32_t issueRows = Min(REDUCE_ROWS_PER_ISSUE, rows - r);
+                reduceFn.ReduceRepeat(
+                    ubRes[r], src[r * srcRepStride * ELE_NUM_PER_BLK], static_cast<uint8_t>(issueRows),
+                    static_cast<uint16_t>(srcRepStride));
+            }
+        }
+
+        CATLASS_DEVICE
+        void ReduceTile(AscendC::LocalTensor<Element> const& input, uint32_t rows, uint32_t cols, uint32_t alignedCols)
+        {
+            uint32_t rowStrideBlk = alignedCols / ELE_NUM_PER_BLK;
+            if (cols <= ELE_NUM_PER_REPEAT) {
+                // 每行不超过一个 repeat，直接从输入归约
+                SetMaskByCount(cols);
+                ReduceRows(input, rows, rowStrideBlk);
+            } else {
+                ReduceFn<Element> reduceFn{};
+                // 每行首个 256B 拷入紧凑工作区 ubWork（行跨距 BLK_NUM_PER_REPEAT）
+                AscendC::DataCopy(
+                    ubWork, input,
+                    AscendC::DataCopyParams(
+                        static_cast<uint16_t>(rows), static_cast<uint16_t>(BLK_NUM_PER_REPEAT),
+                        static_cast<uint16_t>(rowStrideBlk - BLK_NUM_PER_REPEAT), 0));
+                AscendC::PipeBarrier<PIPE_V>();
+                // 其余 256B 分段逐段合并进工作区；行跨距超过 repeat stride 上限时逐行发射
+                uint32_t rowsPerIssue = (rowStrideBlk <= MAX_REP_STRIDE) ? MAX_REPEAT : 1;
+                uint8_t src1RepStride = (rowStrideBlk <= MAX_REP_STRIDE) ? static_cast<uint8_t>(rowStrideBlk) : 0;
+                AscendC::BinaryRepeatParams repeatParams(
+                    1, 1, 1, BLK_NUM_PER_REPEAT, BLK_NUM_PER_REPEAT, src1RepStride);
+                for (uint32_t c = ELE_NUM_PER_REPEAT; c < cols; c += ELE_NUM_PER_REPEAT) {
+                    SetMaskByCount(Min(ELE_NUM_PER_REPEAT, cols - c));
+                    for (uint32_t r = 0; r < rows; r += rowsPerIssue) {
+                        uint32_t issueRows = Min(rowsPerIssue, rows - r);
+                        auto ubWorkRows = ubWork[r * ELE_NUM_PER_REPEAT];
+                        reduceFn.Combine(
+                            ubWorkRows, ubWorkRows, input[r * alignedCols + c], static_cast<uint8_t>(issueRows),
+                            repeatParams);
+                    }
+                    AscendC::PipeBarrier<PIPE_V>();
+                }
+                SetMaskByCount(ELE_NUM_PER_REPEAT);
+                ReduceRows(ubWork, rows, BLK_NUM_PER_REPEAT);
+            }
+            AscendC::SetVectorMask<int8_t>((uint64_t)-1, (uint64_t)-1);
+        }
+
+        template <VisitStage Stage, class ArchTag, class TensorC, typename ElementInput>
+        CATLASS_DEVICE AscendC::LocalTensor<ElementInput> const& visit(
+            TensorC const& tensorTile, MatrixCoord const& alignedTileShape, MatrixCoord const& globalOffset,
+            AscendC::LocalTensor<ElementInput> const& input)
+        {
+            static_assert(
+                std::is_same_v<ElementInput, Element>,
+                "VisitorColReduce: element type mismatch. Insert VisitorCast<...> before reduce.");
+
+            auto actualRows = tla::get<0>(tensorTile.shape());
+            auto actualCols = tla::get<1>(tensorTile.shape());
+
+            if constexpr (Stage == VisitStage::COMPUTE) {
+                ReduceTile(input, actualRows, actualCols, alignedTileShape.column());
+            }
+            if constexpr (Stage == VisitStage::STORE) {
+                AscendC::GlobalTensor<Element> gmCol;
+                gmCol.SetGlobalBuffer((__gm__ Element*)(params_ptr->ptr_col));
+                auto tensorCol = tla::MakeTensor(gmCol, params_ptr->layout, Arch::PositionGM{});
+                auto tensorTileCol = GetTile(
+                    tensorCol, tla::MakeCoord(uint32_t(0), globalOffset.row()),
+                    tla::MakeShape(tla::Int<1>{}, actualRows));
+
+                auto layoutUbCol = tla::MakeLayout(
+                    tla::MakeShape(tla::Int<1>{}, actualRows),
+                    tla::MakeStride(RoundUp<ELE_NUM_PER_BLK>(static_cast<uint32_t>(actualRows)), tla::Int<1>{}));
+                auto tensorUbCol = tla::MakeTensor(ubRes, layoutUbCol, Arch::PositionUB{});
+
+                using CopyUb2GmTlaT =
+                    Epilogue::Tile::CopyUb2GmTla<ArchTag, decltype(tensorUbCol), decltype(tensorTileCol)>;
+                CopyUb2GmTlaT copyUb2GmTla{};
+                ReduceFn<Element>::SetAtomic();
+                copyUb2GmTla(tensorTileCol, tensorUbCol);
+                AscendC::SetAtomicNone();
+            }
+            // 透传返回输入以便继续参与 EVG 组合
+            return input;
+        }
+    };
+
+    template <class ArchTag>
+    CATLASS_DEVICE auto get_callbacks(Arch::Resource<ArchTag>& resource, uint32_t& ub_offset, uint32_t compute_length)
+    {
+        // 工作区：行数 * 一个 repeat，仅在列数超过一个 repeat 时使用，不超过 compute_length
+        auto ubWork = resource.ubBuf.template GetBufferByByte<Element>(ub_offset);
+        ub_offset += compute_length * sizeof(Element);
+        // 结果区：每个 tile 行数不超过 compute_length / ELE_NUM_PER_BLK
+        auto ubRes = resource.ubBuf.template GetBufferByByte<Element>(ub_offset);
+        ub_offset += RoundUp<BYTE_PER_BLK>(compute_length / ELE_NUM_PER_BLK * sizeof(Element));
+        assert(ub_offset <= ArchTag::UB_SIZE);
+        return Callbacks(ubWork, ubRes, &params, compute_length);
+    }
+
+    Params params;
+};
+
+} // namespace Catlass::Epilogue::Fusion
+
+#endif
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_FUSION_VISITOR_ROW_REDUCE_HPP
+#define CATLASS_EPILOGUE_FUSION_VISITOR_ROW_REDUCE_HPP
+
+#include "catlass/epilogue/fusion/visitor_impl.hpp"
+#include "catlass/epilogue/fusion/operations.hpp"
+#include "catlass/epilogue/tile/copy_ub_to_gm_tla.hpp"
+#include "tla/tensor.hpp"
+#include "tla/layout.hpp"
+#include "catlass/layout/layout.hpp"
+
+namespace Catlass::Epilogue::Fusion {
+
+// 行归约：沿 M 方向把 MxN 的输入归约为 1xN 行向量写回 GM（与 VisitorRowBroadcast 对偶）
+// - COMPUTE：当前 tile 的各行在 UB 内合并为一行部分结果
+// - STORE：部分结果以 ReduceFn 对应的原子操作写回 GM，完成跨 tile / 跨子核 / 跨核合并
+// - 输入原样透传，节点可放在通往最终 store 的任意位置
+// 注意：启动前 GM 行向量需初始化为 ReduceFn 的单位元（ReduceSum 为 0，ReduceMax 为最小值，ReduceMin 为最大值）
+template <template <class> class ReduceFn, class Element, class Layout>
+struct VisitorRowReduce : VisitorImpl<> {
+    using VisitorImpl<>::VisitorImpl;
+
+    using ElementOutput = Element;
+
+    struct Arguments {
+        GM_ADDR ptr_row = nullptr; // 1xN 行向量 GM 地址
+        Layout layout = {};        // (1, N) 布局
+    };
+
+    struct Params {
+        GM_ADDR ptr_row;
+        Layout layout;
+
+        Params()
+        {}
+
+        Params(GM_ADDR ptr_row_, Layout const& layout_) : ptr_row(ptr_row_), layout(layout_)
+        {}
+    };
+
+    template <class ProblemShape>
+    static constexpr Params to_underlying_arguments(ProblemShape const&, Arguments const& args, void*)
+    {
+        return Params(args.ptr_row, args.layout);
+    }
+
+    template <class ProblemShape>
+    static size_t get_workspace_size(ProblemShape const&, Arguments const&)
+    {
+        return 0;
+    }
+
+    template <class ProblemShape>
+    static bool can_implement(ProblemShape const&, Arguments const& args)
+    {
+        return args.ptr_row != nullptr;
+    }
+
+    VisitorRowReduce()
+    {}
+
+    VisitorRowReduce(Params const& params_) : params(params_)
+    {}
+
+    struct Callbacks : EmptyCallbacks {
+        AscendC::LocalTensor<Element> ubRes;
+        Params const* params_ptr;
+        uint32_t compute_length;
+
+        CATLASS_DEVICE
+        Callbacks(AscendC::LocalTensor<Element> ubRes_, Params const* params_ptr_, uint32_t compute_length_)
+            : ubRes(ubRes_), params_ptr(params_ptr_), compute_length(compute_length_)
+        {}
+
+        template <VisitStage Stage, class ArchTag, class TensorC, typename ElementInput>
+        CATLASS_DEVICE AscendC::LocalTensor<ElementInput> const& visit(
+            TensorC const& tensorTile, MatrixCoord const& alignedTileShape, MatrixCoord const& globalOffset,
+            AscendC::LocalTensor<ElementInput> const& input)
+        {
+            static_assert(
+                std::is_same_v<ElementInput, Element>,
+                "VisitorRowReduce: element type mismatch. Insert VisitorCast<...> before reduce.");
+
+            auto actualRows = tla::get<0>(tensorTile.shape());
+            auto actualCols = tla::get<1>(tensorTile.shape());
+            uint32_t alignedCols = alignedTileShape.column();
+
+            if constexpr (Stage == VisitStage::COMPUTE) {
+                ReduceFn<Element> reduceFn{};
+                // 第 0 行作为部分结果初值，其余行逐行合并
+                AscendC::DataCopy(ubRes, input, alignedCols);
+                AscendC::PipeBarrier<PIPE_V>();
+                for (uint32_t r = 1; r < actualRows; ++r) {
+                    reduceFn.Combine(ubRes, ubRes, input[r * alignedCols], alignedCols);
+                    AscendC::PipeBarrier<PIPE_V>();
+                }
+            }
+            if constexpr (Stage == VisitStage::STORE) {
+                AscendC::GlobalTensor<Element> gmRow;
+                gmRow.SetGlobalBuffer((__gm__ Element*)(params_ptr->ptr_row));
+                auto tensorRow = tla::MakeTensor(gmRow, params_ptr->layout, Arch::PositionGM{});
+                auto tensorTileRow = GetTile(
+                    tensorRow, tla::MakeCoord(uint32_t(0), globalOffset.column()),
+                    tla::MakeShape(tla::Int<1>{}, actualCols));
+
+                auto layoutUbRow = tla::MakeLayout(
+                    tla::MakeShape(tla::Int<1>{}, actualCols), tla::MakeStride(alignedCols, tla::Int<1>{}));
+                auto tensorUbRow = tla::MakeTensor(ubRes, layoutUbRow, Arch::PositionUB{});
+
+                using CopyUb2GmTlaT =
+                    Epilogue::Tile::CopyUb2GmTla<ArchTag, decltype(tensorUbRow), decltype(tensorTileRow)>;
+                CopyUb2GmTlaT copyUb2GmTla{};
+                ReduceFn<Element>::SetAtomic();
+                copyUb2GmTla(tensorTileRow, tensorUbRow);
+                AscendC::SetAtomicNone();
+            }
+            // 透传返回输入以便继续参与 EVG 组合
+            return input;
+        }
+    };
+
+    template <class ArchTag>
+    CATLASS_DEVICE auto get_callbacks(Arch::Resource<ArchTag>& resource, uint32_t& ub_offset, uint32_t compute_length)
+    {
+        auto ubRes = resource.ubBuf.template GetBufferByByte<Element>(ub_offset);
+        ub_offset += compute_length * sizeof(Element);
+        assert(ub_offset <= ArchTag::UB_SIZE);
+        return Callbacks(ubRes, &params, compute_length);
+    }
+
+    Params params;
+};
+
+} // namespace Catlass::Epilogue::Fusion
+
+#endif
@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_FUSION_VISITOR_SCALAR_LOAD_HPP
+#define CATLASS_EPILOGUE_FUSION_VISITOR_SCALAR_LOAD_HPP
+
+#include "catlass/epilogue/fusion/visitor_impl.hpp"
+
+namespace Catlass::Epilogue::Fusion {
+
+// 标量加载：从 GM 读取单个标量（如上一个 kernel 写出的 alpha / beta，无需 host 同步）并广播为 tile
+// - LOAD：首个 tile 从 GM 读取标量到 UB
+// - COMPUTE：首个 tile 用 Brcb + srcStride = 0 的 Copy 把整个 compute_length 缓冲区铺满
+// - 之后的 tile 直接复用已铺满的 UB 缓冲区，不再搬运与计算
+// 每次 get_callbacks 都会重新读取，因此标量可以在 kernel 之间变化
+template <class Element>
+struct VisitorScalarLoad : VisitorImpl<> {
+    using VisitorImpl<>::VisitorImpl;
+
+    using ElementOutput = Element;
+
+    static_assert(
+        sizeof(Element) == 2 || sizeof(Element) == 4, "VisitorScalarLoad only supports 16-bit or 32-bit elements.");
+
+    static constexpr uint32_t ELE_NUM_PER_REPEAT = BYTE_PER_VECTOR_FRACTAL / sizeof(Element);
+    static constexpr uint32_t MAX_REPEAT = 255;
+
+    struct Arguments {
+        GM_ADDR ptr_scalar = nullptr; // 标量的 GM 地址
+    };
+
+    struct Params {
+        GM_ADDR ptr_scalar;
+
+        Params()
+        {}
+
+        Params(GM_ADDR ptr_scalar_) : ptr_scalar(ptr_scalar_)
+        {}
+    };
+
+    template <class ProblemShape>
+    static constexpr Params to_underlying_arguments(ProblemShape const&, Arguments const& args, void*)
+    {
+        return Params(args.ptr_scalar);
+    }
+
+    template <class ProblemShape>
+    static size_t get_workspace_size(ProblemShape const&, Arguments const&)
+    {
+        return 0;
+    }
+
+    template <class ProblemShape>
+    static bool can_implement(ProblemShape const&, Arguments const& args)
+    {
+        return args.ptr_scalar != nullptr;
+    }
+
+    VisitorScalarLoad()
+    {}
+
+    VisitorScalarLoad(Params const& params_) : params(params_)
+    {}
+
+    struct Callbacks : EmptyCallbacks {
+        AscendC::LocalTensor<Element> ubOut;
+        AscendC::LocalTensor<Element> ubScalar;
+        AscendC::LocalTensor<Element> ubBrcb;
+        Params const* params_ptr;
+        uint32_t compute_length;
+        bool filled{false};
+
+        CATLASS_DEVICE
+        Callbacks(
+            AscendC::LocalTensor<Element> ubOut_, AscendC::LocalTensor<Element> ubScalar_,
+            AscendC::LocalTensor<Element> ubBrcb_, Params const* params_ptr_, uint32_t compute_length_)
+            : ubOut(ubOut_),
+              ubScalar(ubScalar_),
+              ubBrcb(ubBrcb_),
+              params_ptr(params_ptr_),
+              compute_length(compute_length_)
+        {}
+
+        template <VisitStage Stage, class ArchTag, class TensorC, typename... Args>
+        CATLASS_DEVICE AscendC::LocalTensor<Element> const& visit(
+            TensorC const& /*tensorTile*/, MatrixCoord const& /*alignedTileShape*/,
+            MatrixCoord const& /*globalOffset*/, Args const&... /*unused*/
+        )
+        {
+            if (filled) {
+                return ubOut;
+            }
+            if constexpr (Stage == VisitStage::LOAD) {
+                AscendC::GlobalTensor<Element> gmScalar;
+                gmScalar.SetGlobalBuffer((__gm__ Element*)(params_ptr->ptr_scalar));
+                AscendC::DataCopyExtParams dataCopyParams(1, sizeof(Element), 0, 0, 0);
+                AscendC::DataCopyPadExtParams<Element> padParams(false, 0, 0, 0);
+                AscendC::DataCopyPad(ubScalar, gmScalar, dataCopyParams, padParams);
+            }
+            if constexpr (Stage == VisitStage::COMPUTE) {
+                // 标量扩展为一个 32B block，再以 srcStride = 0 铺满整个缓冲区
+                AscendC::BrcbRepeatParams brcbParams;
+                brcbParams.dstBlkStride = 1;
+                brcbParams.dstRepStride = BLK_NUM_PER_VECTOR_FRACTAL;
+                AscendC::Brcb(ubBrcb, ubScalar, 1, brcbParams);
+                AscendC::PipeBarrier<PIPE_V>();
+
+                AscendC::CopyRepeatParams repeatParams;
+                repeatParams.dstStride = 1;
+                repeatParams.srcStride = 0;
+                repeatParams.dstRepeatSize = BLK_NUM_PER_VECTOR_FRACTAL;
+                repeatParams.srcRepeatSize = 0;
+                uint32_t fullRepeats = compute_length / ELE_NUM_PER_REPEAT;
+                uint32_t tail = compute_length % ELE_NUM_PER_REPEAT;
+                for (uint32_t i = 0; i < fullRepeats; i += MAX_REPEAT) {
+                    AscendC::Copy(
+                        ubOut[i * ELE_NUM_PER_REPEAT], ubBrcb, ELE_NUM_PER_REPEAT,
+                        static_cast<uint8_t>(Min(MAX_REPEAT, fullRepeats - i)), repeatParams);
+                }
+                if (tail > 0) {
+                    AscendC::Copy(ubOut[fullRepeats * ELE_NUM_PER_REPEAT], ubBrcb, tail, 1, repeatParams);
+                }
+                filled = true;
+            }
+            return ubOut;
+        }
+    };
+
+    template <class ArchTag>
+    CATLASS_DEVICE auto get_callbacks(Arch::Resource<ArchTag>& resource, uint32_t& ub_offset, uint32_t compute_length)
+    {
+        auto ubOut = resource.ubBuf.template GetBufferByByte<Element>(ub_offset);
+        ub_offset += compute_length * sizeof(Element);
+        // Brcb 一次读取 8 个元素，标量区按 8 个元素预留
+        auto ubScalar = resource.ubBuf.template GetBufferByByte<Element>(ub_offset);
+        ub_offset += RoundUp<BYTE_PER_BLK>(BLK_NUM_PER_VECTOR_FRACTAL * static_cast<uint32_t>(sizeof(Element)));
+        auto ubBrcb = resource.ubBuf.template GetBufferByByte<Element>(ub_offset);
+        ub_offset += BYTE_PER_VECTOR_FRACTAL;
+        assert(ub_offset <= ArchTag::UB_SIZE);
+        return Callbacks(ubOut, ubScalar, ubBrcb, &params, compute_length);
+    }
+
+    Params params;
+};
+
+} // namespace Catlass::Epilogue::Fusion
+
+#endif
@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_TILE_TILE_FA_SCORE_MOD_HPP
+#define CATLASS_EPILOGUE_TILE_TILE_FA_SCORE_MOD_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
+#include "catlass/detail/dependent_false.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+
+namespace Catlass::Epilogue::Tile {
+
+/// Position of the S tile handed to a score modifier.
+/// Rows of the tile are head-major (qSBlockSize tokens per head), qTokenPos and kvTokenPos are
+/// the kv-aligned positions of the first query row and the first key column.
+struct FAScoreModCoord {
+    uint32_t qHeadIdx{0};
+    int64_t qTokenPos{0};
+    int64_t kvTokenPos{0};
+};
+
+template <class ArchTag_, class ScoreMod_>
+struct TileFAScoreMod {
+    static_assert(DEPENDENT_FALSE<ArchTag_>, "Unsupported fa score mod, can not find the specialization.");
+};
+
+template <>
+struct TileFAScoreMod<Arch::AtlasA2, FAScoreModNone> {
+    struct Params {};
+
+    CATLASS_DEVICE
+    TileFAScoreMod(Params const& params = {})
+    {}
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<float> sUb, AscendC::LocalTensor<float> tmpUb, uint32_t rowOffset, uint32_t rowNum,
+        uint32_t columnNum, uint32_t columnNumRound, uint32_t qSBlockSize, FAScoreModCoord const& coord)
+    {}
+};
+
+/// s = softcap * tanh(s / softcap), evaluated as softcap - 2 * softcap / (exp(2 * s / softcap) + 1)
+template <>
+struct TileFAScoreMod<Arch::AtlasA2, FAScoreModSoftcap> {
+    struct Params {
+        float softcap{0.0f};
+    };
+
+    CATLASS_DEVICE
+    TileFAScoreMod(Params const& params = {}) : softcap(params.softcap)
+    {}
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<float> sUb, AscendC::LocalTensor<float> tmpUb, uint32_t rowOffset, uint32_t rowNum,
+        uint32_t columnNum, uint32_t columnNumRound, uint32_t qSBlockSize, FAScoreModCoord const& coord)
+    {
+        AscendC::SetMaskCount();
+        AscendC::SetVectorMask<float, AscendC::MaskMode::COUNTER>(rowNum * columnNumRound);
+        AscendC::Muls<float, false>(
+            sUb, sUb, 2.0f / softcap, AscendC::MASK_PLACEHOLDER, 1, AscendC::UnaryRepeatParams{});
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Exp<float, false>(sUb, sUb, AscendC::MASK_PLACEHOLDER, 1, AscendC::UnaryRepeatParams{});
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Adds<float, false>(sUb, sUb, 1.0f, AscendC::MASK_PLACEHOLDER, 1, AscendC::UnaryRepeatParams{});
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Reciprocal<float, false>(sUb, sUb, AscendC::MASK_PLACEHOLDER, 1, AscendC::UnaryRepeatParams{});
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Muls<float, false>(
+            sUb, sUb, -2.0f * softcap, AscendC::MASK_PLACEHOLDER, 1, AscendC::UnaryRepeatParams{});
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Adds<float, false>(sUb, sUb, softcap, AscendC::MASK_PLACEHOLDER, 1, AscendC::UnaryRepeatParams{});
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::SetMaskNorm();
+        AscendC::ResetMask();
+    }
+
+    float softcap;
+};
+
+/// s += slope[head] * (kvPos - qPos), the causal ALiBi bias. Slopes are one float per query head in gm.
+template <>
+struct TileFAScoreMod<Arch::AtlasA2, FAScoreModAlibi> {
+    struct Params {
+        GM_ADDR slopes{nullptr};
+    };
+
+    static constexpr uint32_t FLOAT_BLOCK_SIZE = 8;
+
+    CATLASS_DEVICE
+    TileFAScoreMod(Params const& params = {})
+    {
+        gSlopes.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(params.slopes));
+    }
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<float> sUb, AscendC::LocalTensor<float> tmpUb, uint32_t rowOffset, uint32_t rowNum,
+        uint32_t columnNum, uint32_t columnNumRound, uint32_t qSBlockSize, FAScoreModCoord const& coord)
+    {
+        // *** tmp = [0, 1, ..., columnNumRound - 1], seeded by scalar then doubled by vector adds
+        AscendC::SetFlag<AscendC::HardEvent::V_S>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::V_S>(EVENT_ID0);
+        for (uint32_t i = 0; i < FLOAT_BLOCK_SIZE; ++i) {
+            tmpUb.SetValue(i, static_cast<float>(i));
+        }
+        AscendC::SetFlag<AscendC::HardEvent::S_V>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::S_V>(EVENT_ID0);
+        AscendC::SetMaskCount();
+        for (uint32_t len = FLOAT_BLOCK_SIZE; len < columnNumRound; len *= 2) {
+            uint32_t addLen = (columnNumRound - len < len) ? (columnNumRound - len) : len;
+            AscendC::SetVectorMask<float, AscendC::MaskMode::COUNTER>(addLen);
+            AscendC::Adds<float, false>(
+                tmpUb[len], tmpUb, static_cast<float>(len), AscendC::MASK_PLACEHOLDER, 1,
+                AscendC::UnaryRepeatParams{});
+            AscendC::PipeBarrier<PIPE_V>();
+        }
+        // *** s_row += slope * tmp, then s_row += slope * (kvTokenPos - qPos) of each row
+        AscendC::SetVectorMask<float, AscendC::MaskMode::COUNTER>(columnNum);
+        for (uint32_t rowIdx = 0; rowIdx < rowNum; ++rowIdx) {
+            uint32_t headIdx = coord.qHeadIdx + (rowOffset + rowIdx) / qSBlockSize;
+            AscendC::Axpy<float, float, false>(
+                sUb[rowIdx * columnNumRound], tmpUb, gSlopes.GetValue(headIdx), AscendC::MASK_PLACEHOLDER, 1,
+                AscendC::UnaryRepeatParams{});
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+        for (uint32_t rowIdx = 0; rowIdx < rowNum; ++rowIdx) {
+            uint32_t headIdx = coord.qHeadIdx + (rowOffset + rowIdx) / qSBlockSize;
+            int64_t qPos = coord.qTokenPos + (rowOffset + rowIdx) % qSBlockSize;
+            float rowBias = gSlopes.GetValue(headIdx) * static_cast<float>(coord.kvTokenPos - qPos);
+            AscendC::Adds<float, false>(
+                sUb[rowIdx * columnNumRound], sUb[rowIdx * columnNumRound], rowBias, AscendC::MASK_PLACEHOLDER, 1,
+                AscendC::UnaryRepeatParams{});
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::SetMaskNorm();
+        AscendC::ResetMask();
+    }
+
+    AscendC::GlobalTensor<float> gSlopes;
+};
+
+/// s += relBias[head][kvPos - qPos + relBiasLen / 2]. The table holds relBiasLen floats per query head
+/// (relBiasLen = 2 * maxKvSeqlen - 1 covers every distance), bucketed biases are expanded on the host.
+template <>
+struct TileFAScoreMod<Arch::AtlasA2, FAScoreModRelPosBias> {
+    struct Params {
+        GM_ADDR relBias{nullptr};
+        uint32_t relBiasLen{0};
+    };
+
+    static constexpr uint32_t TMP_UB_FLOAT_NUM = 2048;
+
+    CATLASS_DEVICE
+    TileFAScoreMod(Params const& params = {}) : relBiasLen(params.relBiasLen)
+    {
+        gRelBias.SetGlobalBuffer(reinterpret_cast<__gm__ float*>(params.relBias));
+    }
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<float> sUb, AscendC::LocalTensor<float> tmpUb, uint32_t rowOffset, uint32_t rowNum,
+        uint32_t columnNum, uint32_t columnNumRound, uint32_t qSBlockSize, FAScoreModCoord const& coord)
+    {
+        // rows of one head slide the table window left by one, so every row is a separate contiguous copy
+        uint32_t rowNumPerChunk = TMP_UB_FLOAT_NUM / columnNumRound;
+        for (uint32_t chunkRowStart = 0; chunkRowStart < rowNum; chunkRowStart += rowNumPerChunk) {
+            uint32_t chunkRowNum =
+                (rowNum - chunkRowStart < rowNumPerChunk) ? (rowNum - chunkRowStart) : rowNumPerChunk;
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID5);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_ID5);
+            for (uint32_t rowIdx = 0; rowIdx < chunkRowNum; ++rowIdx) {
+                uint32_t tileRowIdx = rowOffset + chunkRowStart + rowIdx;
+                uint32_t headIdx = coord.qHeadIdx + tileRowIdx / qSBlockSize;
+                int64_t qPos = coord.qTokenPos + tileRowIdx % qSBlockSize;
+                int64_t biasOffset =
+                    static_cast<int64_t>(headIdx) * relBiasLen + relBiasLen / 2 + coord.kvTokenPos - qPos;
+                AscendC::DataCopyPad(
+                    tmpUb[rowIdx * columnNumRound], gRelBias[biasOffset],
+                    AscendC::DataCopyExtParams(1, columnNum * sizeof(float), 0, 0, 0),
+                    AscendC::DataCopyPadExtParams<float>(false, 0, 0, 0));
+            }
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID5);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID5);
+            AscendC::SetMaskCount();
+            AscendC::SetVectorMask<float, AscendC::MaskMode::COUNTER>(columnNum);
+            for (uint32_t rowIdx = 0; rowIdx < chunkRowNum; ++rowIdx) {
+                uint32_t sRowOffset = (chunkRowStart + rowIdx) * columnNumRound;
+                AscendC::Add<float, false>(
+                    sUb[sRowOffset], sUb[sRowOffset], tmpUb[rowIdx * columnNumRound], AscendC::MASK_PLACEHOLDER, 1,
+                    AscendC::BinaryRepeatParams{});
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::SetMaskNorm();
+            AscendC::ResetMask();
+        }
+    }
+
+    uint32_t relBiasLen;
+    AscendC::GlobalTensor<float> gRelBias;
+};
+
+} // namespace Catlass::Epilogue::Tile
+
+#endif // CATLASS_EPILOGUE_TILE_TILE_FA_SCORE_MOD_HPP
@@ -28,8 +28,8 @@ struct MmadPingpongDispatchChecker {
     static constexpr bool value = false;
 };
 
-template <bool ENABLE_UNIT_FLAG>
-struct MmadPingpongDispatchChecker<MmadAtlasA2Pingpong<ENABLE_UNIT_FLAG>> {
+template <bool ENABLE_UNIT_FLAG, uint32_t L1_STAGES, uint32_t L0A_STAGES, uint32_t L0B_STAGES>
+struct MmadPingpongDispatchChecker<MmadAtlasA2Pingpong<ENABLE_UNIT_FLAG, L1_STAGES, L0A_STAGES, L0B_STAGES>> {
     static constexpr bool value = true;
 };
 
@@ -42,27 +42,35 @@ struct MmadPingpongDispatchChecker<MmadPingpong<
     static constexpr bool value = true;
 };
 
-/// helper to determine the ping-pong stages
+/// helper to determine the ping-pong stages of each level
 template <class DispatchPolicy>
 struct DispatchStagesGetter {
     static constexpr uint32_t STAGES = 1; // Fall back
+    static constexpr uint32_t L1_STAGES = 1;
+    static constexpr uint32_t L0A_STAGES = 1;
+    static constexpr uint32_t L0B_STAGES = 1;
 };
 
-template <bool ENABLE_UNIT_FLAG>
-struct DispatchStagesGetter<MmadAtlasA2Pingpong<ENABLE_UNIT_FLAG>> {
-    static constexpr uint32_t STAGES = 2;
+template <bool ENABLE_UNIT_FLAG, uint32_t L1_STAGES_, uint32_t L0A_STAGES_, uint32_t L0B_STAGES_>
+struct DispatchStagesGetter<MmadAtlasA2Pingpong<ENABLE_UNIT_FLAG, L1_STAGES_, L0A_STAGES_, L0B_STAGES_>> {
+    static constexpr uint32_t STAGES = L1_STAGES_;
+    static constexpr uint32_t L1_STAGES = L1_STAGES_;
+    static constexpr uint32_t L0A_STAGES = L0A_STAGES_;
+    static constexpr uint32_t L0B_STAGES = L0B_STAGES_;
 };
 
 template <
     class ArchTag, bool ENABLE_UNIT_FLAG, bool USE_HF32_MODE, uint32_t L0C_STAGES, bool ENABLE_L1_RESIDENT,
-    uint32_t L1A_STAGES, uint32_t L1B_STAGES, uint32_t L0A_STAGES, uint32_t L0B_STAGES>
+    uint32_t L1A_STAGES, uint32_t L1B_STAGES, uint32_t L0A_STAGES_, uint32_t L0B_STAGES_>
 struct DispatchStagesGetter<MmadPingpong<
-    ArchTag, ENABLE_UNIT_FLAG, USE_HF32_MODE, L0C_STAGES, ENABLE_L1_RESIDENT, L1A_STAGES, L1B_STAGES, L0A_STAGES,
-    L0B_STAGES>> {
+    ArchTag, ENABLE_UNIT_FLAG, USE_HF32_MODE, L0C_STAGES, ENABLE_L1_RESIDENT, L1A_STAGES, L1B_STAGES, L0A_STAGES_,
+    L0B_STAGES_>> {
     // Strategy: select the lowest stage as the common STAGES
     static constexpr uint32_t L1_STAGES = L1A_STAGES > L1B_STAGES ? L1B_STAGES : L1A_STAGES;
-    static constexpr uint32_t L0_STAGES = L0A_STAGES > L0B_STAGES ? L0B_STAGES : L0A_STAGES;
+    static constexpr uint32_t L0_STAGES = L0A_STAGES_ > L0B_STAGES_ ? L0B_STAGES_ : L0A_STAGES_;
     static constexpr uint32_t STAGES = L1_STAGES > L0_STAGES ? L0_STAGES : L1_STAGES;
+    static constexpr uint32_t L0A_STAGES = STAGES;
+    static constexpr uint32_t L0B_STAGES = STAGES;
 };
 
 template <
@@ -102,13 +110,16 @@ public:
 
     static constexpr bool ENABLE_UNIT_FLAG = DispatchPolicy::ENABLE_UNIT_FLAG;
     static constexpr uint32_t STAGES = DispatchStagesGetter<DispatchPolicy>::STAGES;
+    static constexpr uint32_t L1_STAGES = DispatchStagesGetter<DispatchPolicy>::L1_STAGES;
+    static constexpr uint32_t L0A_STAGES = DispatchStagesGetter<DispatchPolicy>::L0A_STAGES;
+    static constexpr uint32_t L0B_STAGES = DispatchStagesGetter<DispatchPolicy>::L0B_STAGES;
     static constexpr uint32_t L1A_SIZE = L1TileShape::M * L1TileShape::K * sizeof(ElementA);
     static constexpr uint32_t L1B_SIZE = L1TileShape::N * L1TileShape::K * sizeof(ElementB);
     static constexpr uint32_t L0A_SIZE = ArchTag::L0A_SIZE;
     static constexpr uint32_t L0B_SIZE = ArchTag::L0B_SIZE;
     static constexpr uint32_t L0C_SIZE = ArchTag::L0C_SIZE;
-    static constexpr uint32_t L0A_PINGPONG_BUF_SIZE = L0A_SIZE / STAGES;
-    static constexpr uint32_t L0B_PINGPONG_BUF_SIZE = L0B_SIZE / STAGES;
+    static constexpr uint32_t L0A_PINGPONG_BUF_SIZE = L0A_SIZE / L0A_STAGES;
+    static constexpr uint32_t L0B_PINGPONG_BUF_SIZE = L0B_SIZE / L0B_STAGES;
 
     // Check ArchTag
     static_assert(
@@ -119,14 +130,19 @@ public:
     static_assert(std::is_same_v<LayoutC, layout::RowMajor>, "LayoutC only support RowMajor yet!");
 
     // Check L1TileShape
-    static_assert((L1A_SIZE * STAGES + L1B_SIZE * STAGES) <= ArchTag::L1_SIZE, "L1TileShape exceeding the L1 space!");
+    static_assert(
+        (L1A_SIZE * L1_STAGES + L1B_SIZE * L1_STAGES) <= ArchTag::L1_SIZE, "L1TileShape exceeding the L1 space!");
+
+    // Check event ids, A and B share MTE1_MTE2/MTE2_MTE1 ids and M_MTE1 ids
+    static_assert(L1_STAGES * 2 <= MAX_EVENT_ID_NUM, "L1_STAGES exceeding the event ids!");
+    static_assert(L0A_STAGES + L0B_STAGES <= MAX_EVENT_ID_NUM, "L0A_STAGES + L0B_STAGES exceeding the event ids!");
 
     // Check L0TileShape
     static constexpr uint32_t L0A_TILE_SIZE = L0TileShape::M * L0TileShape::K * sizeof(ElementA);
     static constexpr uint32_t L0B_TILE_SIZE = L0TileShape::K * L0TileShape::N * sizeof(ElementB);
     static constexpr uint32_t L0C_TILE_SIZE = L0TileShape::M * L0TileShape::N * sizeof(ElementAccumulator);
-    static_assert((L0A_TILE_SIZE * STAGES) <= L0A_SIZE, "L0TileShape exceeding the L0A space!");
-    static_assert((L0B_TILE_SIZE * STAGES) <= L0B_SIZE, "L0TileShape exceeding the L0B space!");
+    static_assert((L0A_TILE_SIZE * L0A_STAGES) <= L0A_SIZE, "L0TileShape exceeding the L0A space!");
+    static_assert((L0B_TILE_SIZE * L0B_STAGES) <= L0B_SIZE, "L0TileShape exceeding the L0B space!");
     static_assert(L0C_TILE_SIZE <= L0C_SIZE, "L0TileShape exceeding the L0C space!");
 
     // Check tileshape
@@ -145,25 +161,25 @@ public:
     BlockMmad(Arch::Resource<ArchTag>& resource, uint32_t l1BufAddrStart = 0)
     {
         uint32_t l1AOffset = l1BufAddrStart;
-        uint32_t l1BOffset = l1BufAddrStart + L1A_SIZE * STAGES;
+        uint32_t l1BOffset = l1BufAddrStart + L1A_SIZE * L1_STAGES;
         // Init buffers
-        for (uint32_t i = 0; i < STAGES; i++) {
-            // Assign L1/L0A/L0B space for each stages
+        for (uint32_t i = 0; i < L1_STAGES; i++) {
+            // Assign L1 space and event ID for each stages
             l1ATensorList[i] = resource.l1Buf.template GetBufferByByte<ElementA>(l1AOffset + L1A_SIZE * i);
             l1BTensorList[i] = resource.l1Buf.template GetBufferByByte<ElementB>(l1BOffset + L1B_SIZE * i);
-            l0ATensorList[i] = resource.l0ABuf.template GetBufferByByte<ElementA>(L0A_PINGPONG_BUF_SIZE * i);
-            l0BTensorList[i] = resource.l0BBuf.template GetBufferByByte<ElementB>(L0B_PINGPONG_BUF_SIZE * i);
-
-            // Assign event ID for each stages
             l1AEventList[i] = i;
-            l1BEventList[i] = i + STAGES;
-            l0AEventList[i] = i;
-            l0BEventList[i] = i + STAGES;
-
-            // The event id that needs to be set before the loop
+            l1BEventList[i] = i + L1_STAGES;
             AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[i]);
             AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0A_STAGES; i++) {
+            l0ATensorList[i] = resource.l0ABuf.template GetBufferByByte<ElementA>(L0A_PINGPONG_BUF_SIZE * i);
+            l0AEventList[i] = i;
             AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0B_STAGES; i++) {
+            l0BTensorList[i] = resource.l0BBuf.template GetBufferByByte<ElementB>(L0B_PINGPONG_BUF_SIZE * i);
+            l0BEventList[i] = i + L0A_STAGES;
             AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[i]);
         }
         l0CTensor = resource.l0CBuf.template GetBufferByByte<ElementAccumulator>(0);
@@ -174,10 +190,14 @@ public:
     CATLASS_DEVICE
     ~BlockMmad()
     {
-        for (uint32_t i = 0; i < STAGES; i++) {
+        for (uint32_t i = 0; i < L1_STAGES; i++) {
             AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[i]);
             AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0A_STAGES; i++) {
             AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0B_STAGES; i++) {
             AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[i]);
         }
         AscendC::WaitFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
@@ -189,6 +209,34 @@ public:
         AscendC::GlobalTensor<ElementA> const& gmA, LayoutA const& layoutA, AscendC::GlobalTensor<ElementB> const& gmB,
         LayoutB const& layoutB, AscendC::GlobalTensor<ElementC> const& gmC, LayoutC const& layoutC,
         GemmCoord const& actualShape)
+    {
+        ComputeBlock(gmA, layoutA, gmB, layoutB, gmA, layoutA, gmB, layoutB, gmC, layoutC, actualShape, 0);
+    }
+
+    /// Perform a block-scoped C = A * B + LowRankA * LowRankB, LowRankA is m x rank and LowRankB is rank x n.
+    /// The low-rank product is accumulated into the same L0C as one extra k tile, so C is stored once.
+    /// rank must not exceed L1TileShape::K.
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementA> const& gmA, LayoutA const& layoutA, AscendC::GlobalTensor<ElementB> const& gmB,
+        LayoutB const& layoutB, AscendC::GlobalTensor<ElementA> const& gmLowRankA, LayoutA const& layoutLowRankA,
+        AscendC::GlobalTensor<ElementB> const& gmLowRankB, LayoutB const& layoutLowRankB,
+        AscendC::GlobalTensor<ElementC> const& gmC, LayoutC const& layoutC, GemmCoord const& actualShape,
+        uint32_t rank)
+    {
+        ComputeBlock(
+            gmA, layoutA, gmB, layoutB, gmLowRankA, layoutLowRankA, gmLowRankB, layoutLowRankB, gmC, layoutC,
+            actualShape, rank);
+    }
+
+protected:
+    CATLASS_DEVICE
+    void ComputeBlock(
+        AscendC::GlobalTensor<ElementA> const& gmA, LayoutA const& layoutA, AscendC::GlobalTensor<ElementB> const& gmB,
+        LayoutB const& layoutB, AscendC::GlobalTensor<ElementA> const& gmLowRankA, LayoutA const& layoutLowRankA,
+        AscendC::GlobalTensor<ElementB> const& gmLowRankB, LayoutB const& layoutLowRankB,
+        AscendC::GlobalTensor<ElementC> const& gmC, LayoutC const& layoutC, GemmCoord const& actualShape,
+        uint32_t rank)
     {
         uint32_t mRound = RoundUp<L1AAlignHelper::M_ALIGNED>(actualShape.m());
         uint32_t nRound = RoundUp<L1BAlignHelper::N_ALIGNED>(actualShape.n());
@@ -197,19 +245,24 @@ public:
         auto layoutBInL1 = LayoutBInL1::template MakeLayout<ElementB>(L1TileShape::K, L1TileShape::N);
         auto layoutInL0C = LayoutCInL0::MakeLayoutInL0C(MakeCoord(mRound, nRound));
 
-        uint32_t kActual = min(actualShape.k(), L1TileShape::K);
-
-        // load first matrix A tile from GM to L1
-        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[l1ListId]);
-        auto layoutTileA = layoutA.GetTileLayout(MakeCoord(actualShape.m(), kActual));
-        copyGmToL1A(l1ATensorList[l1ListId], gmA, layoutAInL1, layoutTileA);
-        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[l1ListId]);
-
-        // load first matrix B tile from GM to L1
-        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1ListId]);
-        auto layoutTileB = layoutB.GetTileLayout(MakeCoord(kActual, actualShape.n()));
-        copyGmToL1B(l1BTensorList[l1ListId], gmB, layoutBInL1, layoutTileB);
-        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1ListId]);
+        // The low-rank product, if any, is the last k tile
+        uint32_t kMainTileCount = CeilDiv<L1TileShape::K>(actualShape.k());
+        uint32_t kTileCount = kMainTileCount + ((rank > 0) ? 1 : 0);
+        GemmCoord lowRankShape{actualShape.m(), actualShape.n(), rank};
+
+        // load the first L1_STAGES - 1 tiles of matrix A and B from GM to L1
+        uint32_t preloadCount = (kTileCount < L1_STAGES - 1) ? kTileCount : (L1_STAGES - 1);
+        for (uint32_t kLoopIdx = 0; kLoopIdx < preloadCount; kLoopIdx++) {
+            uint32_t l1ListIdPreload = (l1ListId + kLoopIdx) % L1_STAGES;
+            if (kLoopIdx < kMainTileCount) {
+                CopyTileGmToL1(
+                    gmA, layoutA, gmB, layoutB, layoutAInL1, layoutBInL1, actualShape, kLoopIdx, l1ListIdPreload);
+            } else {
+                CopyTileGmToL1(
+                    gmLowRankA, layoutLowRankA, gmLowRankB, layoutLowRankB, layoutAInL1, layoutBInL1, lowRankShape, 0,
+                    l1ListIdPreload);
+            }
+        }
 
         if constexpr (!ENABLE_UNIT_FLAG) {
             AscendC::WaitFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
@@ -219,36 +272,27 @@ public:
         uint32_t nPartLoop = CeilDiv<L0TileShape::N>(nRound);
 
         // main loop
-        uint32_t kTileCount = CeilDiv<L1TileShape::K>(actualShape.k());
         for (uint32_t kLoopIdx = 0; kLoopIdx < kTileCount; kLoopIdx++) {
-            uint32_t l1ListIdNext = (l1ListId + 1 < STAGES) ? (l1ListId + 1) : 0;
-            uint32_t kActualNext{0};
-            // preload next tile from GM to L1
-            if (kLoopIdx < kTileCount - 1) {
-                uint32_t kLoopIdxNext = kLoopIdx + 1;
-                kActualNext = (kLoopIdxNext < kTileCount - 1) ? L1TileShape::K :
-                                                                (actualShape.k() - kLoopIdxNext * L1TileShape::K);
-
-                // Get L1 tensor for next stage
-                auto l1ATensor = l1ATensorList[l1ListIdNext];
-                auto l1BTensor = l1BTensorList[l1ListIdNext];
-                // Get GM tile for next stage
-                MatrixCoord gmTileAOffset{0, kLoopIdxNext * L1TileShape::K};
-                MatrixCoord gmTileBOffset{kLoopIdxNext * L1TileShape::K, 0};
-                auto gmTileA = gmA[layoutA.GetOffset(gmTileAOffset)];
-                auto gmTileB = gmB[layoutB.GetOffset(gmTileBOffset)];
-
-                // load next matrix A tile from GM to L1
-                AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[l1ListIdNext]);
-                layoutTileA = layoutA.GetTileLayout(MakeCoord(actualShape.m(), kActualNext));
-                copyGmToL1A(l1ATensor, gmTileA, layoutAInL1, layoutTileA);
-                AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[l1ListIdNext]);
-
-                // load next matrix B tile from GM to L1
-                AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1ListIdNext]);
-                layoutTileB = layoutB.GetTileLayout(MakeCoord(kActualNext, actualShape.n()));
-                copyGmToL1B(l1BTensor, gmTileB, layoutBInL1, layoutTileB);
-                AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1ListIdNext]);
+            // preload the tile L1_STAGES - 1 ahead from GM to L1
+            uint32_t kLoopIdxPreload = kLoopIdx + L1_STAGES - 1;
+            if (kLoopIdxPreload < kMainTileCount) {
+                uint32_t l1ListIdPreload = (l1ListId + L1_STAGES - 1) % L1_STAGES;
+                CopyTileGmToL1(
+                    gmA, layoutA, gmB, layoutB, layoutAInL1, layoutBInL1, actualShape, kLoopIdxPreload,
+                    l1ListIdPreload);
+            } else if (kLoopIdxPreload < kTileCount) {
+                uint32_t l1ListIdPreload = (l1ListId + L1_STAGES - 1) % L1_STAGES;
+                CopyTileGmToL1(
+                    gmLowRankA, layoutLowRankA, gmLowRankB, layoutLowRankB, layoutAInL1, layoutBInL1, lowRankShape, 0,
+                    l1ListIdPreload);
+            }
+            uint32_t kActual;
+            if (kLoopIdx < kMainTileCount - 1) {
+                kActual = L1TileShape::K;
+            } else if (kLoopIdx == kMainTileCount - 1) {
+                kActual = actualShape.k() - kLoopIdx * L1TileShape::K;
+            } else {
+                kActual = rank;
             }
 
             // Get L1 tensor for current stage
@@ -338,14 +382,13 @@ public:
 
                         // Notify to move the next L0B tile
                         AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[l0BListId]);
-                        l0BListId = (l0BListId + 1 < STAGES) ? (l0BListId + 1) : 0;
+                        l0BListId = (l0BListId + 1 < L0B_STAGES) ? (l0BListId + 1) : 0;
                     }
                     AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[l0AListId]);
-                    l0AListId = (l0AListId + 1 < STAGES) ? (l0AListId + 1) : 0;
+                    l0AListId = (l0AListId + 1 < L0A_STAGES) ? (l0AListId + 1) : 0;
                 }
             }
-            l1ListId = l1ListIdNext;
-            kActual = kActualNext;
+            l1ListId = (l1ListId + 1 < L1_STAGES) ? (l1ListId + 1) : 0;
         }
 
         // copy block out
@@ -361,19 +404,44 @@ public:
         }
     }
 
-protected:
+    /// Load the kLoopIdx-th k tile of matrix A and B from GM to the given L1 stage
+    CATLASS_DEVICE
+    void CopyTileGmToL1(
+        AscendC::GlobalTensor<ElementA> const& gmA, LayoutA const& layoutA, AscendC::GlobalTensor<ElementB> const& gmB,
+        LayoutB const& layoutB, LayoutAInL1 const& layoutAInL1, LayoutBInL1 const& layoutBInL1,
+        GemmCoord const& actualShape, uint32_t kLoopIdx, uint32_t l1ListIdx)
+    {
+        uint32_t kTileCount = CeilDiv<L1TileShape::K>(actualShape.k());
+        uint32_t kActual =
+            (kLoopIdx < kTileCount - 1) ? L1TileShape::K : (actualShape.k() - kLoopIdx * L1TileShape::K);
+        MatrixCoord gmTileAOffset{0, kLoopIdx * L1TileShape::K};
+        MatrixCoord gmTileBOffset{kLoopIdx * L1TileShape::K, 0};
+
+        // load matrix A tile from GM to L1
+        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[l1ListIdx]);
+        auto layoutTileA = layoutA.GetTileLayout(MakeCoord(actualShape.m(), kActual));
+        copyGmToL1A(l1ATensorList[l1ListIdx], gmA[layoutA.GetOffset(gmTileAOffset)], layoutAInL1, layoutTileA);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[l1ListIdx]);
+
+        // load matrix B tile from GM to L1
+        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1ListIdx]);
+        auto layoutTileB = layoutB.GetTileLayout(MakeCoord(kActual, actualShape.n()));
+        copyGmToL1B(l1BTensorList[l1ListIdx], gmB[layoutB.GetOffset(gmTileBOffset)], layoutBInL1, layoutTileB);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1ListIdx]);
+    }
+
     // Multi-stage tensors list
-    AscendC::LocalTensor<ElementA> l1ATensorList[STAGES];
-    AscendC::LocalTensor<ElementB> l1BTensorList[STAGES];
-    AscendC::LocalTensor<ElementA> l0ATensorList[STAGES];
-    AscendC::LocalTensor<ElementB> l0BTensorList[STAGES];
+    AscendC::LocalTensor<ElementA> l1ATensorList[L1_STAGES];
+    AscendC::LocalTensor<ElementB> l1BTensorList[L1_STAGES];
+    AscendC::LocalTensor<ElementA> l0ATensorList[L0A_STAGES];
+    AscendC::LocalTensor<ElementB> l0BTensorList[L0B_STAGES];
     AscendC::LocalTensor<ElementAccumulator> l0CTensor;
 
     // Multi-stage event id list
-    int32_t l1AEventList[STAGES];
-    int32_t l1BEventList[STAGES];
-    int32_t l0AEventList[STAGES];
-    int32_t l0BEventList[STAGES];
+    int32_t l1AEventList[L1_STAGES];
+    int32_t l1BEventList[L1_STAGES];
+    int32_t l0AEventList[L0A_STAGES];
+    int32_t l0BEventList[L0B_STAGES];
 
     // The id of current stage
     uint32_t l1ListId{0};
@@ -23,14 +23,14 @@
 namespace Catlass::Gemm::Block {
 
 template <
-    bool ENABLE_UNIT_FLAG_, class L1TileShape_, class L0TileShape_, class AType_, class BType_, class CType_,
-    class BiasType_, class TileCopy_, class TileMmad_>
+    bool ENABLE_UNIT_FLAG_, uint32_t L1_STAGES_, uint32_t L0A_STAGES_, uint32_t L0B_STAGES_, class L1TileShape_,
+    class L0TileShape_, class AType_, class BType_, class CType_, class BiasType_, class TileCopy_, class TileMmad_>
 struct BlockMmad<
-    MmadAtlasA2PingpongBias<ENABLE_UNIT_FLAG_>, L1TileShape_, L0TileShape_, AType_, BType_, CType_, BiasType_,
-    TileCopy_, TileMmad_> {
+    MmadAtlasA2PingpongBias<ENABLE_UNIT_FLAG_, L1_STAGES_, L0A_STAGES_, L0B_STAGES_>, L1TileShape_, L0TileShape_,
+    AType_, BType_, CType_, BiasType_, TileCopy_, TileMmad_> {
 public:
     // Type Aliases
-    using DispatchPolicy = MmadAtlasA2PingpongBias<ENABLE_UNIT_FLAG_>;
+    using DispatchPolicy = MmadAtlasA2PingpongBias<ENABLE_UNIT_FLAG_, L1_STAGES_, L0A_STAGES_, L0B_STAGES_>;
     using ArchTag = typename DispatchPolicy::ArchTag;
     using L1TileShape = L1TileShape_;
     using L0TileShape = L0TileShape_;
@@ -63,6 +63,9 @@ public:
 
     static constexpr bool ENABLE_UNIT_FLAG = DispatchPolicy::ENABLE_UNIT_FLAG;
     static constexpr uint32_t STAGES = DispatchPolicy::STAGES;
+    static constexpr uint32_t L1_STAGES = DispatchPolicy::L1_STAGES;
+    static constexpr uint32_t L0A_STAGES = DispatchPolicy::L0A_STAGES;
+    static constexpr uint32_t L0B_STAGES = DispatchPolicy::L0B_STAGES;
     static constexpr uint32_t L1A_SIZE = L1TileShape::M * L1TileShape::K * sizeof(ElementA);
     static constexpr uint32_t L1B_SIZE = L1TileShape::N * L1TileShape::K * sizeof(ElementB);
     static constexpr uint32_t L1BIAS_SIZE = L1TileShape::N * sizeof(ElementBias);
@@ -70,8 +73,8 @@ public:
     static constexpr uint32_t L0B_SIZE = ArchTag::L0B_SIZE;
     static constexpr uint32_t L0C_SIZE = ArchTag::L0C_SIZE;
     static constexpr uint32_t BT_SIZE = ArchTag::BIAS_SIZE;
-    static constexpr uint32_t L0A_PINGPONG_BUF_SIZE = L0A_SIZE / STAGES;
-    static constexpr uint32_t L0B_PINGPONG_BUF_SIZE = L0B_SIZE / STAGES;
+    static constexpr uint32_t L0A_PINGPONG_BUF_SIZE = L0A_SIZE / L0A_STAGES;
+    static constexpr uint32_t L0B_PINGPONG_BUF_SIZE = L0B_SIZE / L0B_STAGES;
     static constexpr uint32_t BIAS_BUF_SIZE = L0TileShape::N * sizeof(ElementAccumulator);
 
     // Check LayoutC
@@ -79,15 +82,20 @@ public:
 
     // Check L1TileShape
     static_assert(
-        (L1A_SIZE * STAGES + L1B_SIZE * STAGES + L1BIAS_SIZE) <= ArchTag::L1_SIZE,
+        (L1A_SIZE * L1_STAGES + L1B_SIZE * L1_STAGES + L1BIAS_SIZE) <= ArchTag::L1_SIZE,
         "L1TileShape exceeding the L1 space!");
 
+    // Check event ids, the bias takes one more MTE1_MTE2 id and M_MTE1 id after A and B
+    static_assert(L1_STAGES * 2 + 1 <= MAX_EVENT_ID_NUM, "L1_STAGES exceeding the event ids!");
+    static_assert(
+        L0A_STAGES + L0B_STAGES + 1 <= MAX_EVENT_ID_NUM, "L0A_STAGES + L0B_STAGES exceeding the event ids!");
+
     // Check L0TileShape
     static constexpr uint32_t L0A_TILE_SIZE = L0TileShape::M * L0TileShape::K * sizeof(ElementA);
     static constexpr uint32_t L0B_TILE_SIZE = L0TileShape::K * L0TileShape::N * sizeof(ElementB);
     static constexpr uint32_t L0C_TILE_SIZE = L0TileShape::M * L0TileShape::N * sizeof(ElementAccumulator);
-    static_assert((L0A_TILE_SIZE * STAGES) <= L0A_SIZE, "L0TileShape exceeding the L0A space!");
-    static_assert((L0B_TILE_SIZE * STAGES) <= L0B_SIZE, "L0TileShape exceeding the L0B space!");
+    static_assert((L0A_TILE_SIZE * L0A_STAGES) <= L0A_SIZE, "L0TileShape exceeding the L0A space!");
+    static_assert((L0B_TILE_SIZE * L0B_STAGES) <= L0B_SIZE, "L0TileShape exceeding the L0B space!");
     static_assert(L0C_TILE_SIZE <= L0C_SIZE, "L0TileShape exceeding the L0C space!");
     static_assert(BIAS_BUF_SIZE <= BT_SIZE, "BIAS_BUF_SIZE exceeding the BT space! Reduce L0TileShape::N");
 
@@ -105,52 +113,57 @@ public:
     BlockMmad(Arch::Resource<ArchTag>& resource, uint32_t l1BufAddrStart = 0)
     {
         uint32_t l1AOffset = l1BufAddrStart;
-        uint32_t l1BOffset = l1BufAddrStart + L1A_SIZE * STAGES;
-        uint32_t l1BiasOffset = l1BufAddrStart + L1A_SIZE * STAGES + L1B_SIZE * STAGES;
+        uint32_t l1BOffset = l1BufAddrStart + L1A_SIZE * L1_STAGES;
+        uint32_t l1BiasOffset = l1BufAddrStart + L1A_SIZE * L1_STAGES + L1B_SIZE * L1_STAGES;
         // Init buffers
-        for (uint32_t i = 0; i < STAGES; i++) {
-            // Assign L1/L0A/L0B space for each stages
+        for (uint32_t i = 0; i < L1_STAGES; i++) {
+            // Assign L1 space and event ID for each stages
             l1ATensorList[i] = resource.l1Buf.template GetBufferByByte<ElementA>(l1AOffset + L1A_SIZE * i);
             l1BTensorList[i] = resource.l1Buf.template GetBufferByByte<ElementB>(l1BOffset + L1B_SIZE * i);
-            l0ATensorList[i] = resource.l0ABuf.template GetBufferByByte<ElementA>(L0A_PINGPONG_BUF_SIZE * i);
-            l0BTensorList[i] = resource.l0BBuf.template GetBufferByByte<ElementB>(L0B_PINGPONG_BUF_SIZE * i);
-
-            // Assign event ID for each stages
             l1AEventList[i] = i;
-            l1BEventList[i] = i + STAGES;
-            l0AEventList[i] = i;
-            l0BEventList[i] = i + STAGES;
-
-            // The event id that needs to be set before the loop
+            l1BEventList[i] = i + L1_STAGES;
             AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[i]);
             AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0A_STAGES; i++) {
+            l0ATensorList[i] = resource.l0ABuf.template GetBufferByByte<ElementA>(L0A_PINGPONG_BUF_SIZE * i);
+            l0AEventList[i] = i;
             AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0B_STAGES; i++) {
+            l0BTensorList[i] = resource.l0BBuf.template GetBufferByByte<ElementB>(L0B_PINGPONG_BUF_SIZE * i);
+            l0BEventList[i] = i + L0A_STAGES;
             AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[i]);
         }
-        EVENT_ID_BIAS = 2 * STAGES;
+        l1BiasEventId = 2 * L1_STAGES;
+        l0BiasEventId = L0A_STAGES + L0B_STAGES;
         l0CTensor = resource.l0CBuf.template GetBufferByByte<ElementAccumulator>(0);
         l1BiasTensor = resource.l1Buf.template GetBufferByByte<ElementBias>(l1BiasOffset);
         l0BiasTensor = resource.btBuf.template GetBufferByByte<ElementAccumulator>(0);
         AscendC::SetFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
         // Initialize bias independent event
-        AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(EVENT_ID_BIAS);
-        AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(EVENT_ID_BIAS);
+        AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1BiasEventId);
+        AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BiasEventId);
     }
 
     /// Destructor
     CATLASS_DEVICE
     ~BlockMmad()
     {
-        for (uint32_t i = 0; i < STAGES; i++) {
+        for (uint32_t i = 0; i < L1_STAGES; i++) {
             AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[i]);
             AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0A_STAGES; i++) {
             AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0B_STAGES; i++) {
             AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[i]);
         }
         AscendC::WaitFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
         // Wait for bias independent event
-        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(EVENT_ID_BIAS);
-        AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(EVENT_ID_BIAS);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BiasEventId);
+        AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0BiasEventId);
     }
 
     /// Perform a block-scoped matrix multiply-accumulate
@@ -169,25 +182,21 @@ public:
         auto layoutBiasInL0 = layout::VectorLayout(L0TileShape::N);
         auto layoutInL0C = LayoutCInL0::MakeLayoutInL0C(MakeCoord(mRound, nRound));
 
-        uint32_t kActual = min(actualShape.k(), L1TileShape::K);
-
-        // load first matrix A tile from GM to L1
-        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[l1ListId]);
-        auto layoutTileA = layoutA.GetTileLayout(MakeCoord(actualShape.m(), kActual));
-        copyGmToL1A(l1ATensorList[l1ListId], gmA, layoutAInL1, layoutTileA);
-        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[l1ListId]);
+        uint32_t kTileCount = CeilDiv<L1TileShape::K>(actualShape.k());
 
-        // load first matrix B tile from GM to L1
-        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1ListId]);
-        auto layoutTileB = layoutB.GetTileLayout(MakeCoord(kActual, actualShape.n()));
-        copyGmToL1B(l1BTensorList[l1ListId], gmB, layoutBInL1, layoutTileB);
-        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1ListId]);
+        // load the first L1_STAGES - 1 tiles of matrix A and B from GM to L1
+        uint32_t preloadCount = (kTileCount < L1_STAGES - 1) ? kTileCount : (L1_STAGES - 1);
+        for (uint32_t kLoopIdx = 0; kLoopIdx < preloadCount; kLoopIdx++) {
+            uint32_t l1ListIdPreload = (l1ListId + kLoopIdx) % L1_STAGES;
+            CopyTileGmToL1(
+                gmA, layoutA, gmB, layoutB, layoutAInL1, layoutBInL1, actualShape, kLoopIdx, l1ListIdPreload);
+        }
 
         // load bias from GM to L1 independently
-        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(EVENT_ID_BIAS);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BiasEventId);
         auto layoutTileBias = layout::VectorLayout(actualShape.n());
         copyGmToL1Bias(l1BiasTensor, gmBias, layoutBiasInL1, layoutTileBias);
-        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(EVENT_ID_BIAS);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BiasEventId);
 
         if constexpr (!ENABLE_UNIT_FLAG) {
             AscendC::WaitFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
@@ -197,37 +206,17 @@ public:
         uint32_t nPartLoop = CeilDiv<L0TileShape::N>(nRound);
 
         // main loop
-        uint32_t kTileCount = CeilDiv<L1TileShape::K>(actualShape.k());
         for (uint32_t kLoopIdx = 0; kLoopIdx < kTileCount; kLoopIdx++) {
-            uint32_t l1ListIdNext = (l1ListId + 1 < STAGES) ? (l1ListId + 1) : 0;
-            uint32_t kActualNext{0};
-            // preload next tile from GM to L1
-            if (kLoopIdx < kTileCount - 1) {
-                uint32_t kLoopIdxNext = kLoopIdx + 1;
-                kActualNext = (kLoopIdxNext < kTileCount - 1) ? L1TileShape::K :
-                                                                (actualShape.k() - kLoopIdxNext * L1TileShape::K);
-
-                // Get L1 tensor for next stage
-                auto l1ATensor = l1ATensorList[l1ListIdNext];
-                auto l1BTensor = l1BTensorList[l1ListIdNext];
-                // Get GM tile for next stage
-                MatrixCoord gmTileAOffset{0, kLoopIdxNext * L1TileShape::K};
-                MatrixCoord gmTileBOffset{kLoopIdxNext * L1TileShape::K, 0};
-                auto gmTileA = gmA[layoutA.GetOffset(gmTileAOffset)];
-                auto gmTileB = gmB[layoutB.GetOffset(gmTileBOffset)];
-
-                // load next matrix A tile from GM to L1
-                AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[l1ListIdNext]);
-                layoutTileA = layoutA.GetTileLayout(MakeCoord(actualShape.m(), kActualNext));
-                copyGmToL1A(l1ATensor, gmTileA, layoutAInL1, layoutTileA);
-                AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[l1ListIdNext]);
-
-                // load next matrix B tile from GM to L1
-                AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1ListIdNext]);
-                layoutTileB = layoutB.GetTileLayout(MakeCoord(kActualNext, actualShape.n()));
-                copyGmToL1B(l1BTensor, gmTileB, layoutBInL1, layoutTileB);
-                AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1ListIdNext]);
+            // preload the tile L1_STAGES - 1 ahead from GM to L1
+            uint32_t kLoopIdxPreload = kLoopIdx + L1_STAGES - 1;
+            if (kLoopIdxPreload < kTileCount) {
+                uint32_t l1ListIdPreload = (l1ListId + L1_STAGES - 1) % L1_STAGES;
+                CopyTileGmToL1(
+                    gmA, layoutA, gmB, layoutB, layoutAInL1, layoutBInL1, actualShape, kLoopIdxPreload,
+                    l1ListIdPreload);
             }
+            uint32_t kActual =
+                (kLoopIdx < kTileCount - 1) ? L1TileShape::K : (actualShape.k() - kLoopIdx * L1TileShape::K);
 
             // Get L1 tensor for current stage
             auto l1ATensor = l1ATensorList[l1ListId];
@@ -296,9 +285,9 @@ public:
                         // Load L0_TILE_N length data in nPartIdx loop, starting from nPartIdx * L0_TILE_N
                         if (initC) {
                             if (nPartIdx == 0) {
-                                AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE1>(EVENT_ID_BIAS);
+                                AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE1>(l1BiasEventId);
                             }
-                            AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(EVENT_ID_BIAS);
+                            AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0BiasEventId);
                             // Create layout for actual nPartActual size
                             auto layoutBiasInL0Actual = layout::VectorLayout(nPartActual);
                             // Get L1 bias tile starting from nPartIdx * L0_TILE_N
@@ -308,7 +297,7 @@ public:
                             auto layoutBiasInL1Offset = layout::VectorLayout(L1TileShape::N);
                             copyL1ToBT(l0BiasTensor, l1BiasTile, layoutBiasInL0Actual, layoutBiasInL1Offset);
                             if (nPartIdx == nPartLoop - 1) {
-                                AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(EVENT_ID_BIAS);
+                                AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1BiasEventId);
                             }
                         }
                         // Notify to do mmad
@@ -336,21 +325,20 @@ public:
                             tileMmad(
                                 l0CTile, l0ATile, l0BTile, l0BiasTensor, mPartActual, nPartActual, kPartActual, initC,
                                 unitFlag);
-                            AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(EVENT_ID_BIAS);
+                            AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BiasEventId);
                         } else {
                             tileMmad(l0CTile, l0ATile, l0BTile, mPartActual, nPartActual, kPartActual, initC, unitFlag);
                         }
 
                         // Notify to move the next L0B tile
                         AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[l0BListId]);
-                        l0BListId = (l0BListId + 1 < STAGES) ? (l0BListId + 1) : 0;
+                        l0BListId = (l0BListId + 1 < L0B_STAGES) ? (l0BListId + 1) : 0;
                     }
                     AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[l0AListId]);
-                    l0AListId = (l0AListId + 1 < STAGES) ? (l0AListId + 1) : 0;
+                    l0AListId = (l0AListId + 1 < L0A_STAGES) ? (l0AListId + 1) : 0;
                 }
             }
-            l1ListId = l1ListIdNext;
-            kActual = kActualNext;
+            l1ListId = (l1ListId + 1 < L1_STAGES) ? (l1ListId + 1) : 0;
         }
 
         // copy block out
@@ -367,23 +355,50 @@ public:
     }
 
 protected:
+    /// Load the kLoopIdx-th k tile of matrix A and B from GM to the given L1 stage
+    CATLASS_DEVICE
+    void CopyTileGmToL1(
+        AscendC::GlobalTensor<ElementA> const& gmA, LayoutA const& layoutA, AscendC::GlobalTensor<ElementB> const& gmB,
+        LayoutB const& layoutB, LayoutAInL1 const& layoutAInL1, LayoutBInL1 const& layoutBInL1,
+        GemmCoord const& actualShape, uint32_t kLoopIdx, uint32_t l1ListIdx)
+    {
+        uint32_t kTileCount = CeilDiv<L1TileShape::K>(actualShape.k());
+        uint32_t kActual =
+            (kLoopIdx < kTileCount - 1) ? L1TileShape::K : (actualShape.k() - kLoopIdx * L1TileShape::K);
+        MatrixCoord gmTileAOffset{0, kLoopIdx * L1TileShape::K};
+        MatrixCoord gmTileBOffset{kLoopIdx * L1TileShape::K, 0};
+
+        // load matrix A tile from GM to L1
+        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[l1ListIdx]);
+        auto layoutTileA = layoutA.GetTileLayout(MakeCoord(actualShape.m(), kActual));
+        copyGmToL1A(l1ATensorList[l1ListIdx], gmA[layoutA.GetOffset(gmTileAOffset)], layoutAInL1, layoutTileA);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[l1ListIdx]);
+
+        // load matrix B tile from GM to L1
+        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1ListIdx]);
+        auto layoutTileB = layoutB.GetTileLayout(MakeCoord(kActual, actualShape.n()));
+        copyGmToL1B(l1BTensorList[l1ListIdx], gmB[layoutB.GetOffset(gmTileBOffset)], layoutBInL1, layoutTileB);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1ListIdx]);
+    }
+
     // Multi-stage tensors list
-    AscendC::LocalTensor<ElementA> l1ATensorList[STAGES];
-    AscendC::LocalTensor<ElementB> l1BTensorList[STAGES];
+    AscendC::LocalTensor<ElementA> l1ATensorList[L1_STAGES];
+    AscendC::LocalTensor<ElementB> l1BTensorList[L1_STAGES];
     AscendC::LocalTensor<ElementBias> l1BiasTensor;
-    AscendC::LocalTensor<ElementA> l0ATensorList[STAGES];
-    AscendC::LocalTensor<ElementB> l0BTensorList[STAGES];
+    AscendC::LocalTensor<ElementA> l0ATensorList[L0A_STAGES];
+    AscendC::LocalTensor<ElementB> l0BTensorList[L0B_STAGES];
     AscendC::LocalTensor<ElementAccumulator> l0CTensor;
     AscendC::LocalTensor<ElementAccumulator> l0BiasTensor;
 
     // Multi-stage event id list
-    int32_t l1AEventList[STAGES];
-    int32_t l1BEventList[STAGES];
-    int32_t l0AEventList[STAGES];
-    int32_t l0BEventList[STAGES];
+    int32_t l1AEventList[L1_STAGES];
+    int32_t l1BEventList[L1_STAGES];
+    int32_t l0AEventList[L0A_STAGES];
+    int32_t l0BEventList[L0B_STAGES];
 
     // Event ID for Bias
-    int32_t EVENT_ID_BIAS;
+    int32_t l1BiasEventId;
+    int32_t l0BiasEventId;
 
     // The id of current stage
     uint32_t l1ListId{0};
@@ -23,14 +23,14 @@
 namespace Catlass::Gemm::Block {
 
 template <
-    bool ENABLE_UNIT_FLAG_, class L1TileShape_, class L0TileShape_, class AType_, class BType_, class CType_,
-    class BiasType_, class TileCopy_, class TileMmad_>
+    bool ENABLE_UNIT_FLAG_, uint32_t L1_STAGES_, uint32_t L0A_STAGES_, uint32_t L0B_STAGES_, class L1TileShape_,
+    class L0TileShape_, class AType_, class BType_, class CType_, class BiasType_, class TileCopy_, class TileMmad_>
 struct BlockMmad<
-    MmadAtlasA2FullLoadA<ENABLE_UNIT_FLAG_>, L1TileShape_, L0TileShape_, AType_, BType_, CType_, BiasType_, TileCopy_,
-    TileMmad_> {
+    MmadAtlasA2FullLoadA<ENABLE_UNIT_FLAG_, L1_STAGES_, L0A_STAGES_, L0B_STAGES_>, L1TileShape_, L0TileShape_, AType_,
+    BType_, CType_, BiasType_, TileCopy_, TileMmad_> {
 public:
     // Type Aliases
-    using DispatchPolicy = MmadAtlasA2FullLoadA<ENABLE_UNIT_FLAG_>;
+    using DispatchPolicy = MmadAtlasA2FullLoadA<ENABLE_UNIT_FLAG_, L1_STAGES_, L0A_STAGES_, L0B_STAGES_>;
     using ArchTag = typename DispatchPolicy::ArchTag;
     using L1TileShape = L1TileShape_;
     using L0TileShape = L0TileShape_;
@@ -59,25 +59,33 @@ public:
 
     static constexpr bool ENABLE_UNIT_FLAG = DispatchPolicy::ENABLE_UNIT_FLAG;
     static constexpr uint32_t STAGES = DispatchPolicy::STAGES;
+    static constexpr uint32_t L1_STAGES = DispatchPolicy::L1_STAGES;
+    static constexpr uint32_t L0A_STAGES = DispatchPolicy::L0A_STAGES;
+    static constexpr uint32_t L0B_STAGES = DispatchPolicy::L0B_STAGES;
     static constexpr uint32_t L1A_SIZE = ArchTag::L1_SIZE / 2;
     static constexpr uint32_t L1B_SIZE = L1TileShape::N * L1TileShape::K * sizeof(ElementB);
     static constexpr uint32_t L0A_SIZE = ArchTag::L0A_SIZE;
     static constexpr uint32_t L0B_SIZE = ArchTag::L0B_SIZE;
     static constexpr uint32_t L0C_SIZE = ArchTag::L0C_SIZE;
-    static constexpr uint32_t L0A_PINGPONG_BUF_SIZE = L0A_SIZE / STAGES;
-    static constexpr uint32_t L0B_PINGPONG_BUF_SIZE = L0B_SIZE / STAGES;
+    static constexpr uint32_t L0A_PINGPONG_BUF_SIZE = L0A_SIZE / L0A_STAGES;
+    static constexpr uint32_t L0B_PINGPONG_BUF_SIZE = L0B_SIZE / L0B_STAGES;
 
     // Check LayoutC
     static_assert(std::is_same_v<LayoutC, layout::RowMajor>, "LayoutC only support RowMajor yet!");
 
-    // Check L1TileShape in example, because problemShape.k() cannot get here.
+    // Check L1TileShape of A in example, because problemShape.k() cannot get here.
+    static_assert((L1A_SIZE + L1B_SIZE * L1_STAGES) <= ArchTag::L1_SIZE, "L1TileShape exceeding the L1 space!");
+
+    // Check event ids, event id 0 of MTE1_MTE2/MTE2_MTE1 is reserved for A
+    static_assert(L1_STAGES + 1 <= MAX_EVENT_ID_NUM, "L1_STAGES exceeding the event ids!");
+    static_assert(L0A_STAGES + L0B_STAGES <= MAX_EVENT_ID_NUM, "L0A_STAGES + L0B_STAGES exceeding the event ids!");
 
     // Check L0TileShape
     static constexpr uint32_t L0A_TILE_SIZE = L0TileShape::M * L0TileShape::K * sizeof(ElementA);
     static constexpr uint32_t L0B_TILE_SIZE = L0TileShape::K * L0TileShape::N * sizeof(ElementB);
     static constexpr uint32_t L0C_TILE_SIZE = L0TileShape::M * L0TileShape::N * sizeof(ElementAccumulator);
-    static_assert((L0A_TILE_SIZE * STAGES) <= L0A_SIZE, "L0TileShape exceeding the L0A space!");
-    static_assert((L0B_TILE_SIZE * STAGES) <= L0B_SIZE, "L0TileShape exceeding the L0B space!");
+    static_assert((L0A_TILE_SIZE * L0A_STAGES) <= L0A_SIZE, "L0TileShape exceeding the L0A space!");
+    static_assert((L0B_TILE_SIZE * L0B_STAGES) <= L0B_SIZE, "L0TileShape exceeding the L0B space!");
     static_assert(L0C_TILE_SIZE <= L0C_SIZE, "L0TileShape exceeding the L0C space!");
 
     static_assert(
@@ -95,24 +103,24 @@ public:
         uint32_t l1AOffset = l1BufAddrStart;
         uint32_t l1BOffset = l1BufAddrStart + L1A_SIZE;
         // Init L1A related
-        l1ATensorList[0] = resource.l1Buf.template GetBufferByByte<ElementA>(l1AOffset);
-        l1AEventList[0] = 0;
+        l1ATensor = resource.l1Buf.template GetBufferByByte<ElementA>(l1AOffset);
+        l1AEventId = 0;
 
         // Init buffers
-        for (uint32_t i = 0; i < STAGES; i++) {
-            // Assign L1/L0A/L0B space for each stages
+        for (uint32_t i = 0; i < L1_STAGES; i++) {
+            // Assign L1 space and event ID for each stages
             l1BTensorList[i] = resource.l1Buf.template GetBufferByByte<ElementB>(l1BOffset + L1B_SIZE * i);
+            l1BEventList[i] = i + 1;
+            AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0A_STAGES; i++) {
             l0ATensorList[i] = resource.l0ABuf.template GetBufferByByte<ElementA>(L0A_PINGPONG_BUF_SIZE * i);
-            l0BTensorList[i] = resource.l0BBuf.template GetBufferByByte<ElementB>(L0B_PINGPONG_BUF_SIZE * i);
-
-            // Assign event ID for each stages
-            l1BEventList[i] = i + STAGES;
             l0AEventList[i] = i;
-            l0BEventList[i] = i + STAGES;
-
-            // The event id that needs to be set before the loop
-            AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[i]);
             AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0B_STAGES; i++) {
+            l0BTensorList[i] = resource.l0BBuf.template GetBufferByByte<ElementB>(L0B_PINGPONG_BUF_SIZE * i);
+            l0BEventList[i] = i + L0A_STAGES;
             AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[i]);
         }
         l0CTensor = resource.l0CBuf.template GetBufferByByte<ElementAccumulator>(0);
@@ -123,9 +131,13 @@ public:
     CATLASS_DEVICE
     ~BlockMmad()
     {
-        for (uint32_t i = 0; i < STAGES; i++) {
+        for (uint32_t i = 0; i < L1_STAGES; i++) {
             AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0A_STAGES; i++) {
             AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[i]);
+        }
+        for (uint32_t i = 0; i < L0B_STAGES; i++) {
             AscendC::WaitFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[i]);
         }
         AscendC::WaitFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
@@ -145,23 +157,24 @@ public:
         auto layoutBInL1 = LayoutBInL1::template MakeLayout<ElementB>(L1TileShape::K, L1TileShape::N);
         auto layoutInL0C = LayoutCInL0::MakeLayoutInL0C(MakeCoord(mRound, nRound));
 
-        uint32_t kActual = min(actualShape.k(), L1TileShape::K);
-
         if (needLoadL1) {
-            // load first matrix A tile from GM to L1
+            // load whole matrix A tile from GM to L1
             auto layoutTileA = layoutA.GetTileLayout(MakeCoord(actualShape.m(), actualShape.k()));
-            AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[0]);
-            AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventList[0]);
-            copyGmToL1A(l1ATensorList[0], gmA, layoutAInL1, layoutTileA);
-            AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[0]);
-            AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventList[0]);
+            AscendC::SetFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventId);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1AEventId);
+            copyGmToL1A(l1ATensor, gmA, layoutAInL1, layoutTileA);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventId);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE1>(l1AEventId);
         }
 
-        // load first matrix B tile from GM to L1
-        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1ListId]);
-        auto layoutTileB = layoutB.GetTileLayout(MakeCoord(kActual, actualShape.n()));
-        copyGmToL1B(l1BTensorList[l1ListId], gmB, layoutBInL1, layoutTileB);
-        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1ListId]);
+        uint32_t kTileCount = CeilDiv<L1TileShape::K>(actualShape.k());
+
+        // load the first L1_STAGES - 1 tiles of matrix B from GM to L1
+        uint32_t preloadCount = (kTileCount < L1_STAGES - 1) ? kTileCount : (L1_STAGES - 1);
+        for (uint32_t kLoopIdx = 0; kLoopIdx < preloadCount; kLoopIdx++) {
+            uint32_t l1ListIdPreload = (l1ListId + kLoopIdx) % L1_STAGES;
+            CopyTileGmToL1B(gmB, layoutB, layoutBInL1, actualShape, kLoopIdx, l1ListIdPreload);
+        }
 
         if constexpr (!ENABLE_UNIT_FLAG) {
             AscendC::WaitFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
@@ -171,31 +184,17 @@ public:
         uint32_t nPartLoop = CeilDiv<L0TileShape::N>(nRound);
 
         // main loop
-        uint32_t kTileCount = CeilDiv<L1TileShape::K>(actualShape.k());
         for (uint32_t kLoopIdx = 0; kLoopIdx < kTileCount; kLoopIdx++) {
-            uint32_t l1ListIdNext = (l1ListId + 1 < STAGES) ? (l1ListId + 1) : 0;
-            uint32_t kActualNext{0};
-            // preload next tile from GM to L1
-            if (kLoopIdx < kTileCount - 1) {
-                uint32_t kLoopIdxNext = kLoopIdx + 1;
-                kActualNext = (kLoopIdxNext < kTileCount - 1) ? L1TileShape::K :
-                                                                (actualShape.k() - kLoopIdxNext * L1TileShape::K);
-
-                // Get L1 tensor for next stage
-                auto l1BTensor = l1BTensorList[l1ListIdNext];
-                // Get GM tile for next stage
-                MatrixCoord gmTileBOffset{kLoopIdxNext * L1TileShape::K, 0};
-                auto gmTileB = gmB[layoutB.GetOffset(gmTileBOffset)];
-
-                // load next matrix B tile from GM to L1
-                AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1ListIdNext]);
-                layoutTileB = layoutB.GetTileLayout(MakeCoord(kActualNext, actualShape.n()));
-                copyGmToL1B(l1BTensor, gmTileB, layoutBInL1, layoutTileB);
-                AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1ListIdNext]);
+            // preload the tile L1_STAGES - 1 ahead from GM to L1
+            uint32_t kLoopIdxPreload = kLoopIdx + L1_STAGES - 1;
+            if (kLoopIdxPreload < kTileCount) {
+                uint32_t l1ListIdPreload = (l1ListId + L1_STAGES - 1) % L1_STAGES;
+                CopyTileGmToL1B(gmB, layoutB, layoutBInL1, actualShape, kLoopIdxPreload, l1ListIdPreload);
             }
+            uint32_t kActual =
+                (kLoopIdx < kTileCount - 1) ? L1TileShape::K : (actualShape.k() - kLoopIdx * L1TileShape::K);
 
             // Get L1 tensor for current stage
-            auto l1ATensor = l1ATensorList[0];
             auto l1BTensor = l1BTensorList[l1ListId];
 
             // Get the loop nums on L0
@@ -275,14 +274,13 @@ public:
 
                         // Notify to move the next L0B tile
                         AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0BEventList[l0BListId]);
-                        l0BListId = (l0BListId + 1 < STAGES) ? (l0BListId + 1) : 0;
+                        l0BListId = (l0BListId + 1 < L0B_STAGES) ? (l0BListId + 1) : 0;
                     }
                     AscendC::SetFlag<AscendC::HardEvent::M_MTE1>(l0AEventList[l0AListId]);
-                    l0AListId = (l0AListId + 1 < STAGES) ? (l0AListId + 1) : 0;
+                    l0AListId = (l0AListId + 1 < L0A_STAGES) ? (l0AListId + 1) : 0;
                 }
             }
-            l1ListId = l1ListIdNext;
-            kActual = kActualNext;
+            l1ListId = (l1ListId + 1 < L1_STAGES) ? (l1ListId + 1) : 0;
         }
 
         // copy block out
@@ -299,18 +297,35 @@ public:
     }
 
 protected:
+    /// Load the kLoopIdx-th k tile of matrix B from GM to the given L1 stage
+    CATLASS_DEVICE
+    void CopyTileGmToL1B(
+        AscendC::GlobalTensor<ElementB> const& gmB, LayoutB const& layoutB, LayoutBInL1 const& layoutBInL1,
+        GemmCoord const& actualShape, uint32_t kLoopIdx, uint32_t l1ListIdx)
+    {
+        uint32_t kTileCount = CeilDiv<L1TileShape::K>(actualShape.k());
+        uint32_t kActual =
+            (kLoopIdx < kTileCount - 1) ? L1TileShape::K : (actualShape.k() - kLoopIdx * L1TileShape::K);
+        MatrixCoord gmTileBOffset{kLoopIdx * L1TileShape::K, 0};
+
+        AscendC::WaitFlag<AscendC::HardEvent::MTE1_MTE2>(l1BEventList[l1ListIdx]);
+        auto layoutTileB = layoutB.GetTileLayout(MakeCoord(kActual, actualShape.n()));
+        copyGmToL1B(l1BTensorList[l1ListIdx], gmB[layoutB.GetOffset(gmTileBOffset)], layoutBInL1, layoutTileB);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE1>(l1BEventList[l1ListIdx]);
+    }
+
     // Multi-stage tensors list
-    AscendC::LocalTensor<ElementA> l1ATensorList[STAGES];
-    AscendC::LocalTensor<ElementB> l1BTensorList[STAGES];
-    AscendC::LocalTensor<ElementA> l0ATensorList[STAGES];
-    AscendC::LocalTensor<ElementB> l0BTensorList[STAGES];
+    AscendC::LocalTensor<ElementA> l1ATensor;
+    AscendC::LocalTensor<ElementB> l1BTensorList[L1_STAGES];
+    AscendC::LocalTensor<ElementA> l0ATensorList[L0A_STAGES];
+    AscendC::LocalTensor<ElementB> l0BTensorList[L0B_STAGES];
     AscendC::LocalTensor<ElementAccumulator> l0CTensor;
 
     // Multi-stage event id list
-    int32_t l1AEventList[STAGES];
-    int32_t l1BEventList[STAGES];
-    int32_t l0AEventList[STAGES];
-    int32_t l0BEventList[STAGES];
+    int32_t l1AEventId;
+    int32_t l1BEventList[L1_STAGES];
+    int32_t l0AEventList[L0A_STAGES];
+    int32_t l0BEventList[L0B_STAGES];
 
     // The id of current stage
     uint32_t l1ListId{0};
@@ -201,6 +201,28 @@ public:
         PrologueImpl(gmSrcA, layoutSrcA, gmDstA, layoutDstA, {}, {}, {}, {}, actualBlockShape);
     }
 
+    /// Block-level scale pass of Prologue A (e.g. dynamic per-token quantization), the scale of the rows is
+    /// computed over the whole K range and stored to gmScaleA, independent of any N block
+    template <class T = PrologueA>
+    CATLASS_DEVICE std::enable_if_t<!std::is_void_v<T>, void> PrologueScale(
+        AscendC::GlobalTensor<typename T::ElementSrc> const& gmSrcA, typename T::LayoutSrc const& layoutSrcA,
+        AscendC::GlobalTensor<typename T::ElementScale> const& gmScaleA)
+    {
+        prologueA.ComputeScale(gmScaleA, gmSrcA, layoutSrcA);
+    }
+
+    /// Prologue A with the block-level scale stored by PrologueScale, the scale of the block rows is reloaded
+    /// from gmScaleA before the K tiles are converted
+    template <class T = PrologueA, class U = PrologueB>
+    CATLASS_DEVICE std::enable_if_t<!std::is_void_v<T> && std::is_void_v<U>, void> Prologue(
+        AscendC::GlobalTensor<typename T::ElementSrc> const& gmSrcA, typename T::LayoutSrc const& layoutSrcA,
+        AscendC::GlobalTensor<typename T::ElementDst> const& gmDstA, typename T::LayoutDst const& layoutDstA,
+        AscendC::GlobalTensor<typename T::ElementScale> const& gmScaleA, GemmCoord const& actualBlockShape)
+    {
+        prologueA.LoadScale(gmScaleA, actualBlockShape.m());
+        PrologueImpl(gmSrcA, layoutSrcA, gmDstA, layoutDstA, {}, {}, {}, {}, actualBlockShape);
+    }
+
     template <class T = PrologueA, class U = PrologueB>
     CATLASS_DEVICE std::enable_if_t<std::is_void_v<T> && !std::is_void_v<U>, void> Prologue(
         AscendC::GlobalTensor<typename U::ElementSrc> const& gmSrcB, typename U::LayoutSrc const& layoutSrcB,
@@ -210,6 +232,44 @@ public:
         PrologueImpl({}, {}, {}, {}, gmSrcB, layoutSrcB, gmDstB, layoutDstB, actualBlockShape);
     }
 
+    /// Prologue B with group-wise dequantization (e.g. W4A16), the scale and zero point rows of every K tile
+    /// are located by the K offset of the tile, L1TileShape::K must be a multiple of the group size
+    template <class T = PrologueA, class U = PrologueB>
+    CATLASS_DEVICE std::enable_if_t<std::is_void_v<T> && !std::is_void_v<U>, void> Prologue(
+        AscendC::GlobalTensor<typename U::ElementSrc> const& gmSrcB, typename U::LayoutSrc const& layoutSrcB,
+        AscendC::GlobalTensor<typename U::ElementDst> const& gmDstB, typename U::LayoutDst const& layoutDstB,
+        AscendC::GlobalTensor<typename U::ElementScale> const& gmScaleB,
+        AscendC::GlobalTensor<typename U::ElementScale> const& gmZeroB, typename U::LayoutScale const& layoutScaleB,
+        GemmCoord const& actualBlockShape)
+    {
+        uint32_t groupSize = params.prologueB.groupSize;
+        uint32_t kTileCount = CeilDiv<L1TileShape::K>(actualBlockShape.k());
+        for (uint32_t kLoopIdx = 0; kLoopIdx < kTileCount; kLoopIdx++) {
+            uint32_t kOffset = kLoopIdx * L1TileShape::K;
+            uint32_t kActual = (kLoopIdx == kTileCount - 1) ? (actualBlockShape.k() - kOffset) : L1TileShape::K;
+
+            MatrixCoord offsetCoordB{kOffset, 0};
+            MatrixCoord actualTileShapeB{kActual, actualBlockShape.n()};
+            auto gmTileSrcB = gmSrcB[layoutSrcB.GetOffset(offsetCoordB)];
+            auto layoutTileSrcB = layoutSrcB.GetTileLayout(actualTileShapeB);
+            auto gmTileDstB = gmDstB[l1ListId * layoutDstB.Capacity()];
+            auto layoutTileDstB = layoutDstB.GetTileLayout(actualTileShapeB);
+
+            MatrixCoord offsetCoordScale{kOffset / groupSize, 0};
+            MatrixCoord actualTileShapeScale{CeilDiv(kActual, groupSize), actualBlockShape.n()};
+            auto gmTileScaleB = gmScaleB[layoutScaleB.GetOffset(offsetCoordScale)];
+            auto gmTileZeroB = gmZeroB[layoutScaleB.GetOffset(offsetCoordScale)];
+            auto layoutTileScaleB = layoutScaleB.GetTileLayout(actualTileShapeScale);
+
+            Catlass::Arch::CrossCoreWaitFlag(flagCopyBFinish[l1ListId]);
+            prologueB(
+                gmTileDstB, layoutTileDstB, gmTileSrcB, layoutTileSrcB, gmTileScaleB, gmTileZeroB, layoutTileScaleB);
+            Catlass::Arch::CrossCoreSetFlag<0x02, PIPE_MTE3>(flagPrologueBFinish[l1ListId]);
+
+            l1ListId = (l1ListId + 1 == STAGES) ? 0 : (l1ListId + 1);
+        }
+    }
+
     /// Perform a block-scoped matrix multiply-accumulate
     CATLASS_DEVICE
     void operator()(
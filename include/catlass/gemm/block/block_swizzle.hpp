@@ -13,8 +13,10 @@
 
 #include "catlass/catlass.hpp"
 #include "catlass/detail/alignment.hpp"
+#include "catlass/gemm/block/block_swizzle_l2_aware.hpp"
 #include "catlass/gemm_coord.hpp"
 #include "catlass/matrix_coord.hpp"
+#include "catlass/numeric_size.hpp"
 
 namespace Catlass::Gemm::Block {
 
@@ -192,6 +194,55 @@ struct DynamicGemmIdentityBlockSwizzle : public GemmIdentityBlockSwizzle<> {
     }
 };
 
+/// Block swizzling function whose band is derived from the L2 footprint of each wave instead of being fixed,
+/// see GetL2AwareSwizzleParams. L2_BUDGET defaults to half of the 192 MB Atlas A2 L2 cache, leaving room for
+/// the C writeback and the other operand stream.
+template <class ElementA, class ElementB = ElementA, uint64_t L2_BUDGET = 96 * 1024 * 1024>
+struct GemmL2AwareBlockSwizzle : public DynamicGemmIdentityBlockSwizzle {
+    CATLASS_DEVICE
+    GemmL2AwareBlockSwizzle()
+    {}
+
+    CATLASS_DEVICE
+    GemmL2AwareBlockSwizzle(GemmCoord const& problemShape_, MatrixCoord const& tileMN_)
+        : DynamicGemmIdentityBlockSwizzle(problemShape_, tileMN_)
+    {
+        UpdateSwizzleParams();
+    }
+
+    CATLASS_DEVICE
+    GemmL2AwareBlockSwizzle(GemmCoord const& problemShape_, MatrixCoord const& tileMN_, MatrixCoord const& loopsMN_)
+    {
+        Update(problemShape_, tileMN_, loopsMN_);
+    }
+
+    CATLASS_DEVICE
+    void Update(GemmCoord const& problemShape_, MatrixCoord const& tileMN_)
+    {
+        DynamicGemmIdentityBlockSwizzle::Update(problemShape_, tileMN_);
+        UpdateSwizzleParams();
+    }
+
+    CATLASS_DEVICE
+    void Update(GemmCoord const& problemShape_, MatrixCoord const& tileMN_, MatrixCoord const& loopsMN_)
+    {
+        DynamicGemmIdentityBlockSwizzle::Update(problemShape_, tileMN_, loopsMN_);
+        UpdateSwizzleParams();
+    }
+
+    CATLASS_DEVICE
+    void UpdateSwizzleParams()
+    {
+        uint64_t rowBytes = BitsToBytes<uint64_t>(
+            static_cast<uint64_t>(tileMN.row()) * problemShape.k() * SizeOfBits<ElementA>::value);
+        uint64_t colBytes = BitsToBytes<uint64_t>(
+            static_cast<uint64_t>(tileMN.column()) * problemShape.k() * SizeOfBits<ElementB>::value);
+        GetL2AwareSwizzleParams(
+            loopsMN.row(), loopsMN.column(), rowBytes, colBytes, AscendC::GetBlockNum(), L2_BUDGET, swizzleOffset,
+            swizzleDirection);
+    }
+};
+
 /// Block swizzling function for Splitk Gemms
 template <uint32_t SwizzleOffset = 1, uint32_t SwizzleDirection = 0>
 struct SplitkGemmIdentityBlockSwizzle {
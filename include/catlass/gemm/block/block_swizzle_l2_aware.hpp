@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_BLOCK_BLOCK_SWIZZLE_L2_AWARE_HPP
+#define CATLASS_GEMM_BLOCK_BLOCK_SWIZZLE_L2_AWARE_HPP
+
+#include <cstdint>
+
+#include "catlass/detail/alignment.hpp"
+
+namespace Catlass::Gemm::Block {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Selects the serpentine band (swizzleOffset, swizzleDirection) from the L2 footprint of a wave.
+/// A Zn band of `offset` tile rows keeps offset * rowBytes of A resident while the coreNum concurrent tiles
+/// touch CeilDiv(coreNum, offset) tile columns of B, and B is streamed once per band (Nz is symmetric).
+/// The band with the least GM traffic whose wave footprint stays within l2Budget is chosen; if no band fits,
+/// the one with the smallest wave footprint is used.
+CATLASS_HOST_DEVICE inline
+void GetL2AwareSwizzleParams(
+    uint32_t loopsM, uint32_t loopsN, uint64_t rowBytes, uint64_t colBytes, uint32_t coreNum, uint64_t l2Budget,
+    uint32_t& swizzleOffset, uint32_t& swizzleDirection)
+{
+    // swizzleOffset is carried as uint8_t in the dynamic tiling data
+    constexpr uint32_t MAX_SWIZZLE_OFFSET = 255;
+    bool found = false;
+    bool bestFits = false;
+    uint64_t bestTraffic = 0;
+    uint64_t bestFootprint = 0;
+    swizzleOffset = 1;
+    swizzleDirection = 0;
+    for (uint32_t direction = 0; direction < 2; ++direction) {
+        uint32_t bandLoops = (direction == 0) ? loopsM : loopsN;
+        uint32_t crossLoops = (direction == 0) ? loopsN : loopsM;
+        uint64_t bandBytes = (direction == 0) ? rowBytes : colBytes;
+        uint64_t crossBytes = (direction == 0) ? colBytes : rowBytes;
+        uint32_t maxOffset = Min(bandLoops, MAX_SWIZZLE_OFFSET);
+        for (uint32_t offset = 1; offset <= maxOffset; ++offset) {
+            uint32_t waveCross = Min(CeilDiv(coreNum, offset), crossLoops);
+            uint64_t footprint = offset * bandBytes + waveCross * crossBytes;
+            uint64_t traffic =
+                bandLoops * bandBytes + static_cast<uint64_t>(CeilDiv(bandLoops, offset)) * crossLoops * crossBytes;
+            bool fits = footprint <= l2Budget;
+            bool better = !found || (fits && (!bestFits || traffic < bestTraffic)) ||
+                          (!fits && !bestFits && footprint < bestFootprint);
+            if (better) {
+                found = true;
+                bestFits = fits;
+                bestTraffic = traffic;
+                bestFootprint = footprint;
+                swizzleOffset = offset;
+                swizzleDirection = direction;
+            }
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace Catlass::Gemm::Block
+
+#endif // CATLASS_GEMM_BLOCK_BLOCK_SWIZZLE_L2_AWARE_HPP
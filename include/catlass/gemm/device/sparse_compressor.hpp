@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_DEVICE_SPARSE_COMPRESSOR_HPP
+#define CATLASS_GEMM_DEVICE_SPARSE_COMPRESSOR_HPP
+
+#include <algorithm>
+#include <cstdint>
+
+#include "catlass/catlass.hpp"
+#include "catlass/status.hpp"
+
+namespace Catlass::Gemm::Device {
+
+/// Host side 2:4 pruner and compressor for the weight of the sparse matmul family.
+///
+/// The dense weight is n x k with k contiguous (ColumnMajor k x n, i.e. transposed B). In every group of 4
+/// consecutive k elements the 2 of largest magnitude are kept. The result is
+/// - values: n x k/2, k contiguous, the kept elements in ascending k order;
+/// - index: 2 bits per kept element, 4 per byte with the first one in the low bits, a kept pair at positions
+///   p0 < p1 in its group is encoded as (p0, p1 - 1). The n x k/8 byte matrix is stored in the nZ fractal layout
+///   of 16 x 8 bytes that the sparse L1 to L0B load consumes, with n padded to 16 and k/8 padded to 8.
+template <class Element>
+class SparseCompressor {
+public:
+    static constexpr uint32_t GROUP_LEN = 4;
+    static constexpr uint32_t KEEP_NUM = 2;
+    static constexpr uint32_t INDEX_BITS = 2;
+    static constexpr uint32_t INDEX_PER_BYTE = 8 / INDEX_BITS;
+    static constexpr uint32_t INDEX_FRACTAL_ROW = 16;
+    static constexpr uint32_t INDEX_FRACTAL_COL = 8;
+
+    static bool CanImplement(uint32_t n, uint32_t k)
+    {
+        // Every index byte covers 2 groups, i.e. 8 elements of k
+        return (n > 0) && (k > 0) && (k % (GROUP_LEN * KEEP_NUM) == 0);
+    }
+
+    static size_t GetValuesLen(uint32_t n, uint32_t k)
+    {
+        return static_cast<size_t>(n) * (k / GROUP_LEN * KEEP_NUM);
+    }
+
+    static size_t GetIndexLen(uint32_t n, uint32_t k)
+    {
+        uint32_t indexCols = k / (GROUP_LEN * KEEP_NUM);
+        return static_cast<size_t>(RoundUp(n, INDEX_FRACTAL_ROW)) * RoundUp(indexCols, INDEX_FRACTAL_COL);
+    }
+
+    /// Prune and compress one dense n x k weight. If pruned is not null, it receives the dense weight with the
+    /// dropped elements zeroed, which is what a dense reference computes against.
+    static Status Compress(
+        uint32_t n, uint32_t k, const Element* dense, Element* values, uint8_t* index, Element* pruned = nullptr)
+    {
+        if (!CanImplement(n, k) || dense == nullptr || values == nullptr || index == nullptr) {
+            return Status::kInvalid;
+        }
+        uint32_t valuesCols = k / GROUP_LEN * KEEP_NUM;
+        uint32_t nFractalNum = CeilDiv(n, INDEX_FRACTAL_ROW);
+        std::fill(index, index + GetIndexLen(n, k), static_cast<uint8_t>(0));
+
+        for (uint32_t row = 0; row < n; ++row) {
+            const Element* denseRow = dense + static_cast<size_t>(row) * k;
+            Element* valuesRow = values + static_cast<size_t>(row) * valuesCols;
+            for (uint32_t groupIdx = 0; groupIdx < k / GROUP_LEN; ++groupIdx) {
+                const Element* group = denseRow + groupIdx * GROUP_LEN;
+                uint32_t p0 = 0;
+                uint32_t p1 = 0;
+                SelectLargestPair(group, p0, p1);
+
+                valuesRow[groupIdx * KEEP_NUM] = group[p0];
+                valuesRow[groupIdx * KEEP_NUM + 1] = group[p1];
+                if (pruned != nullptr) {
+                    Element* prunedGroup = pruned + static_cast<size_t>(row) * k + groupIdx * GROUP_LEN;
+                    for (uint32_t i = 0; i < GROUP_LEN; ++i) {
+                        prunedGroup[i] = (i == p0 || i == p1) ? group[i] : static_cast<Element>(0);
+                    }
+                }
+
+                // Position of this group's byte in the nZ index matrix
+                uint32_t col = groupIdx * KEEP_NUM / INDEX_PER_BYTE;
+                size_t offset =
+                    (static_cast<size_t>(col / INDEX_FRACTAL_COL) * nFractalNum + row / INDEX_FRACTAL_ROW) *
+                        (INDEX_FRACTAL_ROW * INDEX_FRACTAL_COL) +
+                    (row % INDEX_FRACTAL_ROW) * INDEX_FRACTAL_COL + col % INDEX_FRACTAL_COL;
+                uint32_t shift = (groupIdx * KEEP_NUM % INDEX_PER_BYTE) * INDEX_BITS;
+                index[offset] |= static_cast<uint8_t>((p0 | ((p1 - 1) << INDEX_BITS)) << shift);
+            }
+        }
+        return Status::kSuccess;
+    }
+
+    /// Compress a batch of weights stored back to back, e.g. the experts of a grouped matmul.
+    static Status CompressBatch(
+        uint32_t batch, uint32_t n, uint32_t k, const Element* dense, Element* values, uint8_t* index,
+        Element* pruned = nullptr)
+    {
+        size_t denseLen = static_cast<size_t>(n) * k;
+        size_t valuesLen = GetValuesLen(n, k);
+        size_t indexLen = GetIndexLen(n, k);
+        for (uint32_t batchIdx = 0; batchIdx < batch; ++batchIdx) {
+            Status status = Compress(
+                n, k, dense + batchIdx * denseLen, values + batchIdx * valuesLen, index + batchIdx * indexLen,
+                (pruned == nullptr) ? nullptr : pruned + batchIdx * denseLen);
+            if (status != Status::kSuccess) {
+                return status;
+            }
+        }
+        return Status::kSuccess;
+    }
+
+private:
+    static double Magnitude(Element value)
+    {
+        double v = static_cast<double>(value);
+        return (v < 0) ? -v : v;
+    }
+
+    /// Pick the 2 positions of largest magnitude, ties resolved to the lower position, returned as p0 < p1.
+    static void SelectLargestPair(const Element* group, uint32_t& p0, uint32_t& p1)
+    {
+        uint32_t first = 0;
+        for (uint32_t i = 1; i < GROUP_LEN; ++i) {
+            if (Magnitude(group[i]) > Magnitude(group[first])) {
+                first = i;
+            }
+        }
+        uint32_t second = (first == 0) ? 1 : 0;
+        for (uint32_t i = 0; i < GROUP_LEN; ++i) {
+            if (i != first && Magnitude(group[i]) > Magnitude(group[second])) {
+                second = i;
+            }
+        }
+        p0 = (first < second) ? first : second;
+        p1 = (first < second) ? second : first;
+    }
+};
+
+} // namespace Catlass::Gemm::Device
+
+#endif // CATLASS_GEMM_DEVICE_SPARSE_COMPRESSOR_HPP
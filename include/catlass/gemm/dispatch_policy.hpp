@@ -28,10 +28,15 @@ using MmadAtlasA2 = MmadBase<Arch::AtlasA2, false>;
 using MmadAtlasA2Async = MmadBase<Arch::AtlasA2, true>;
 
 // Now ENABLE_UNIT_FLAG_ must be false when intput element is int8
-template <bool ENABLE_UNIT_FLAG_ = false>
+// L1_STAGES is the depth of the GM->L1 ring shared by A and B, L0A/L0B_STAGES split L0A/L0B evenly
+template <bool ENABLE_UNIT_FLAG_ = false, uint32_t L1_STAGES_ = 2, uint32_t L0A_STAGES_ = 2, uint32_t L0B_STAGES_ = 2>
 struct MmadAtlasA2Pingpong : public MmadAtlasA2 {
-    static constexpr uint32_t STAGES = 2;
+    static constexpr uint32_t STAGES = L1_STAGES_;
+    static constexpr uint32_t L1_STAGES = L1_STAGES_;
+    static constexpr uint32_t L0A_STAGES = L0A_STAGES_;
+    static constexpr uint32_t L0B_STAGES = L0B_STAGES_;
     static constexpr bool ENABLE_UNIT_FLAG = ENABLE_UNIT_FLAG_;
+    static_assert(L1_STAGES >= 1 && L0A_STAGES >= 1 && L0B_STAGES >= 1, "Stages must be at least 1");
 };
 
 template <bool ENABLE_UNIT_FLAG_ = false>
@@ -71,6 +76,7 @@ struct MmadAtlasA2FAPV : public MmadAtlasA2 {
     static constexpr uint32_t STAGES = 2;
 };
 
+// MLA QK/PV buffers are paired with the cross-core softmax pipeline, so their stages stay fixed at 2
 struct MmadAtlasA2MLAQK : public MmadAtlasA2 {
     static constexpr uint32_t STAGES = 2;
 };
@@ -137,12 +143,22 @@ struct GemmAtlasA2 : public MmadAtlasA2 {
 struct GemvAtlasA2 : public MmadAtlasA2 {
     static constexpr uint32_t STAGES = 2;
 };
+
+// AIV GEMV of up to MAX_BATCH x vectors against one A, with optional weight-only quantized A
+template <uint32_t MAX_BATCH_ = 8>
+struct GemvAtlasA2Batched : public GemvAtlasA2 {
+    static constexpr uint32_t MAX_BATCH = MAX_BATCH_;
+};
 ////////////////////
 
-template <bool ENABLE_UNIT_FLAG_ = false>
+template <bool ENABLE_UNIT_FLAG_ = false, uint32_t L1_STAGES_ = 2, uint32_t L0A_STAGES_ = 2, uint32_t L0B_STAGES_ = 2>
 struct MmadAtlasA2PingpongBias : public MmadAtlasA2 {
-    static constexpr uint32_t STAGES = 2;
+    static constexpr uint32_t STAGES = L1_STAGES_;
+    static constexpr uint32_t L1_STAGES = L1_STAGES_;
+    static constexpr uint32_t L0A_STAGES = L0A_STAGES_;
+    static constexpr uint32_t L0B_STAGES = L0B_STAGES_;
     static constexpr bool ENABLE_UNIT_FLAG = ENABLE_UNIT_FLAG_;
+    static_assert(L1_STAGES >= 1 && L0A_STAGES >= 1 && L0B_STAGES >= 1, "Stages must be at least 1");
 };
 
 template <bool ENABLE_UNIT_FLAG_ = false>
@@ -157,6 +173,7 @@ struct MmadAtlasA2PingpongSymmRight : public MmadAtlasA2 {
     static constexpr bool ENABLE_UNIT_FLAG = ENABLE_UNIT_FLAG_;
 };
 
+// FAI QK/PV buffers are paired with the cross-core softmax pipeline, so their stages stay fixed at 2
 template <bool PAGED_CACHE_FLAG_ = false, bool ENABLE_UNIT_FLAG_ = false>
 struct MmadAtlasA2FAIQK : public MmadAtlasA2 {
     static constexpr uint32_t STAGES = 2;
@@ -185,10 +202,15 @@ struct MmadAtlasA2FAITailPV : public MmadAtlasA2 {
     static constexpr bool ENABLE_UNIT_FLAG = ENABLE_UNIT_FLAG_;
 };
 
-template <bool ENABLE_UNIT_FLAG_ = false>
+// L1_STAGES only applies to B, A is fully loaded into half of L1
+template <bool ENABLE_UNIT_FLAG_ = false, uint32_t L1_STAGES_ = 2, uint32_t L0A_STAGES_ = 2, uint32_t L0B_STAGES_ = 2>
 struct MmadAtlasA2FullLoadA : public MmadAtlasA2 {
-    static constexpr uint32_t STAGES = 2;
+    static constexpr uint32_t STAGES = L1_STAGES_;
+    static constexpr uint32_t L1_STAGES = L1_STAGES_;
+    static constexpr uint32_t L0A_STAGES = L0A_STAGES_;
+    static constexpr uint32_t L0B_STAGES = L0B_STAGES_;
     static constexpr bool ENABLE_UNIT_FLAG = ENABLE_UNIT_FLAG_;
+    static_assert(L1_STAGES >= 1 && L0A_STAGES >= 1 && L0B_STAGES >= 1, "Stages must be at least 1");
 };
 
 template <
@@ -229,6 +251,7 @@ struct MmadAtlasA2W8A16 : public MmadAtlasA2 {
     static constexpr bool ENABLE_SHUFFLE_K = ENABLE_SHUFFLE_K_;
 };
 
+// The host tiling of the dynamic kernels sizes L1 tiles for double buffering, so STAGES stays fixed at 2
 template <bool ENABLE_UNIT_FLAG_ = false, bool ENABLE_SHUFFLE_K_ = false>
 struct MmadAtlasA2DynamicCommon : public MmadAtlasA2 {
     static constexpr uint32_t STAGES = 2;
@@ -0,0 +1,313 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_BATCHED_MATRIX_INVERSE_HPP
+#define CATLASS_GEMM_KERNEL_BATCHED_MATRIX_INVERSE_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/detail/alignment.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/gemm/tile/small_inverse.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// Inverts a batch of independent small RowMajor n x n float matrices in place.
+/// Every matrix is owned by a single core, so thousands of matrices run without any inter-core sync.
+/// When n <= NB the whole matrix stays in UB and every AIV inverts its own matrices by Gauss-Jordan.
+/// Otherwise one block Gauss-Jordan step per NB columns is run: the AIV inverts the diagonal block D in UB,
+/// the AIC computes T = A[:, K] * D, R = D * A[K, :] and U = T * A[K, :] into a per-core workspace,
+/// and the AIVs write A[O, O] -= U, A[O, K] = -T, A[K, :] = R and A[K, K] = D back.
+/// No pivoting is done, so the leading principal minors of every matrix must be nonsingular.
+template <class BlockMmad_, uint32_t NB_ = 64, uint32_t MAX_N_ = 256>
+class BatchedMatrixInverse {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using Element = typename BlockMmad::ElementA;
+    using Layout = layout::RowMajor;
+
+    static_assert(std::is_same_v<Element, float> && std::is_same_v<typename BlockMmad::ElementC, float>,
+        "BatchedMatrixInverse only supports float");
+    static_assert(std::is_same_v<typename BlockMmad::LayoutA, Layout> &&
+        std::is_same_v<typename BlockMmad::LayoutB, Layout> && std::is_same_v<typename BlockMmad::LayoutC, Layout>,
+        "BatchedMatrixInverse only supports RowMajor operands");
+
+    static constexpr uint32_t NB = NB_;
+    static constexpr uint32_t MAX_N = MAX_N_;
+    using TileInverse = Tile::TileSmallInverse<ArchTag, Element, NB>;
+
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(Element);
+    static_assert(NB % ELE_NUM_PER_BLK == 0 && MAX_N % ELE_NUM_PER_BLK == 0, "NB and MAX_N must be 32B aligned");
+
+    // Rows of A, U and T updated per UB round, after the UB taken by the diagonal block inverse
+    static constexpr uint32_t CHUNK_ROWS =
+        (ArchTag::UB_SIZE - TileInverse::UB_SIZE_NEEDED) / ((MAX_N * 2 + NB) * sizeof(Element));
+    static_assert(CHUNK_ROWS > 0, "MAX_N exceeds the UB size");
+
+    static constexpr uint32_t STEP_START_ID = 0;
+    static constexpr uint32_t DIAG_READY_ID = 1;
+    static constexpr uint32_t GEMM_DONE_ID = 2;
+    static constexpr uint32_t UPDATE_DONE_ID = 3;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        uint32_t batch;
+        uint32_t n;
+        GM_ADDR ptrA;
+        GM_ADDR ptrWorkspace;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(uint32_t batch_, uint32_t n_, GM_ADDR ptrA_, GM_ADDR ptrWorkspace_)
+            : batch(batch_), n(n_), ptrA(ptrA_), ptrWorkspace(ptrWorkspace_)
+        {}
+    };
+
+    struct Arguments {
+        uint32_t batch;
+        uint32_t n;
+        // batch x n x n, overwritten by the inverses
+        GM_ADDR deviceA;
+        uint32_t aicoreNum;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        return (args.batch > 0) && (args.n > 0) && (args.n <= MAX_N);
+    }
+
+    CATLASS_HOST_DEVICE
+    static size_t GetWorkspaceElemNum(uint32_t n)
+    {
+        // Diagonal block inverse D, T, R and U
+        return static_cast<size_t>(NB) * NB + static_cast<size_t>(n) * NB * 2 + static_cast<size_t>(n) * n;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        if (args.n <= NB) {
+            return 0;
+        }
+        return GetWorkspaceElemNum(args.n) * sizeof(Element) * args.aicoreNum;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        return Params(args.batch, args.n, args.deviceA, workspace);
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    BatchedMatrixInverse()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        uint32_t n = params.n;
+        if (n <= NB) {
+            return;
+        }
+        uint32_t aicoreIdx = AscendC::GetBlockIdx();
+        uint32_t aicoreNum = AscendC::GetBlockNum();
+
+        BlockMmad blockMmad(resource);
+
+        AscendC::GlobalTensor<Element> gmA;
+        gmA.SetGlobalBuffer(reinterpret_cast<__gm__ Element*>(params.ptrA));
+        AscendC::GlobalTensor<Element> gmDinv;
+        gmDinv.SetGlobalBuffer(
+            reinterpret_cast<__gm__ Element*>(params.ptrWorkspace) + aicoreIdx * GetWorkspaceElemNum(n));
+        auto gmT = gmDinv[NB * NB];
+        auto gmR = gmT[n * NB];
+        auto gmU = gmR[NB * n];
+
+        Layout layoutMatrix{n, n};
+        for (uint32_t matrixIdx = aicoreIdx; matrixIdx < params.batch; matrixIdx += aicoreNum) {
+            auto gmMatrix = gmA[static_cast<int64_t>(matrixIdx) * n * n];
+            for (uint32_t k = 0; k < n; k += NB) {
+                uint32_t nb = Min(NB, n - k);
+                Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(stepStart);
+                Arch::CrossCoreWaitFlag(diagReady);
+
+                Layout layoutDinv{nb, nb, NB};
+                Layout layoutColPanel{n, nb, n};
+                Layout layoutRowPanel{nb, n, n};
+                // T = A[:, K] * D and R = D * A[K, :]
+                RunGemm(blockMmad, gmMatrix[k], layoutColPanel, gmDinv, layoutDinv, gmT, Layout{n, nb, NB});
+                RunGemm(blockMmad, gmDinv, layoutDinv, gmMatrix[k * n], layoutRowPanel, gmR, Layout{nb, n, n});
+                AscendC::PipeBarrier<PIPE_ALL>();
+                // U = T * A[K, :]
+                RunGemm(blockMmad, gmT, Layout{n, nb, NB}, gmMatrix[k * n], layoutRowPanel, gmU, layoutMatrix);
+
+                Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(gemmDone);
+                Arch::CrossCoreWaitFlag(updateDone);
+            }
+        }
+    }
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        uint32_t n = params.n;
+        TileInverse tileInverse(resource);
+
+        AscendC::GlobalTensor<Element> gmA;
+        gmA.SetGlobalBuffer(reinterpret_cast<__gm__ Element*>(params.ptrA));
+
+        if (n <= NB) {
+            // The whole matrix fits in UB, every AIV inverts its own matrices
+            uint32_t aivIdx = AscendC::GetBlockIdx();
+            uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+            for (uint32_t matrixIdx = aivIdx; matrixIdx < params.batch; matrixIdx += aivNum) {
+                auto gmMatrix = gmA[static_cast<int64_t>(matrixIdx) * n * n];
+                tileInverse(gmMatrix, n, gmMatrix, n, n);
+            }
+            return;
+        }
+
+        uint32_t aicoreNum = AscendC::GetBlockNum();
+        uint32_t aicoreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t subBlockIdx = AscendC::GetSubBlockIdx();
+
+        AscendC::GlobalTensor<Element> gmDinv;
+        gmDinv.SetGlobalBuffer(
+            reinterpret_cast<__gm__ Element*>(params.ptrWorkspace) + aicoreIdx * GetWorkspaceElemNum(n));
+        auto gmT = gmDinv[NB * NB];
+        auto gmR = gmT[n * NB];
+        auto gmU = gmR[NB * n];
+
+        for (uint32_t matrixIdx = aicoreIdx; matrixIdx < params.batch; matrixIdx += aicoreNum) {
+            auto gmMatrix = gmA[static_cast<int64_t>(matrixIdx) * n * n];
+            for (uint32_t k = 0; k < n; k += NB) {
+                uint32_t nb = Min(NB, n - k);
+                Arch::CrossCoreWaitFlag(stepStart);
+                if (subBlockIdx == 0) {
+                    tileInverse(gmDinv, NB, gmMatrix[k * n + k], n, nb);
+                }
+                Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(diagReady);
+                Arch::CrossCoreWaitFlag(gemmDone);
+
+                UpdateRows(gmMatrix, gmU, gmT, k, nb, n, 0, k, false);
+                UpdateRows(gmMatrix, gmR, gmDinv, k, nb, n, k, k + nb, true);
+                UpdateRows(gmMatrix, gmU, gmT, k, nb, n, k + nb, n, false);
+
+                Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(updateDone);
+            }
+        }
+    }
+
+private:
+    /// Runs gmC = gmA * gmB on the current core, one L1 tile of C at a time.
+    CATLASS_DEVICE
+    void RunGemm(
+        BlockMmad& blockMmad, AscendC::GlobalTensor<Element> const& gmA, Layout const& layoutA,
+        AscendC::GlobalTensor<Element> const& gmB, Layout const& layoutB, AscendC::GlobalTensor<Element> const& gmC,
+        Layout const& layoutC)
+    {
+        uint32_t m = layoutA.shape(0);
+        uint32_t k = layoutA.shape(1);
+        uint32_t n = layoutB.shape(1);
+        for (uint32_t mOffset = 0; mOffset < m; mOffset += L1TileShape::M) {
+            for (uint32_t nOffset = 0; nOffset < n; nOffset += L1TileShape::N) {
+                GemmCoord actualShape{Min(L1TileShape::M, m - mOffset), Min(L1TileShape::N, n - nOffset), k};
+                blockMmad(
+                    gmA[layoutA.GetOffset(MatrixCoord{mOffset, 0})], layoutA.GetTileLayout(actualShape.GetCoordMK()),
+                    gmB[layoutB.GetOffset(MatrixCoord{0, nOffset})], layoutB.GetTileLayout(actualShape.GetCoordKN()),
+                    gmC[layoutC.GetOffset(MatrixCoord{mOffset, nOffset})],
+                    layoutC.GetTileLayout(actualShape.GetCoordMN()), actualShape);
+            }
+        }
+    }
+
+    /// Writes the block step result for rows [rowStart, rowEnd), which are split between the sub-blocks.
+    /// For the rows of block K, gmRows is R and gmCols is D. For the other rows, gmRows is U and gmCols is T.
+    CATLASS_DEVICE
+    void UpdateRows(
+        AscendC::GlobalTensor<Element> const& gmMatrix, AscendC::GlobalTensor<Element> const& gmRows,
+        AscendC::GlobalTensor<Element> const& gmCols, uint32_t k, uint32_t nb, uint32_t n, uint32_t rowStart,
+        uint32_t rowEnd, bool isPivotRows)
+    {
+        uint32_t rowsPerSubBlock = CeilDiv(rowEnd - rowStart, AscendC::GetSubBlockNum());
+        uint32_t subBlockRowStart = Min(rowEnd, rowStart + AscendC::GetSubBlockIdx() * rowsPerSubBlock);
+        uint32_t subBlockRowEnd = Min(rowEnd, subBlockRowStart + rowsPerSubBlock);
+        uint32_t nRound = RoundUp(n, ELE_NUM_PER_BLK);
+        uint32_t nbRound = RoundUp(nb, ELE_NUM_PER_BLK);
+        uint32_t rowsOffset = isPivotRows ? k : 0;
+
+        auto ubA = resource.ubBuf.template GetBufferByByte<Element>(TileInverse::UB_SIZE_NEEDED);
+        auto ubRows = ubA[CHUNK_ROWS * MAX_N];
+        auto ubCols = ubRows[CHUNK_ROWS * MAX_N];
+        AscendC::DataCopyPadExtParams<Element> padParams(false, 0, 0, 0);
+
+        for (uint32_t rowIdx = subBlockRowStart; rowIdx < subBlockRowEnd; rowIdx += CHUNK_ROWS) {
+            uint32_t rows = Min(CHUNK_ROWS, subBlockRowEnd - rowIdx);
+
+            AscendC::DataCopyExtParams rowsInParams(rows, n * sizeof(Element), 0, (nRound - n) / ELE_NUM_PER_BLK, 0);
+            // D and T are stored with the leading dimension NB
+            AscendC::DataCopyExtParams colsInParams(
+                rows, nb * sizeof(Element), (NB - nb) * sizeof(Element), (NB - nbRound) / ELE_NUM_PER_BLK, 0);
+            AscendC::DataCopyExtParams colsOutParams(
+                rows, nb * sizeof(Element), (NB - nbRound) / ELE_NUM_PER_BLK, (n - nb) * sizeof(Element), 0);
+            AscendC::DataCopyExtParams rowsOutParams(rows, n * sizeof(Element), (nRound - n) / ELE_NUM_PER_BLK, 0, 0);
+
+            AscendC::DataCopyPad(ubCols, gmCols[(rowIdx - rowsOffset) * NB], colsInParams, padParams);
+            AscendC::DataCopyPad(ubRows, gmRows[(rowIdx - rowsOffset) * n], rowsInParams, padParams);
+            if (isPivotRows) {
+                // A[K, :] = R, A[K, K] = D
+                AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE3>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE3>(EVENT_ID0);
+                AscendC::DataCopyPad(gmMatrix[rowIdx * n], ubRows, rowsOutParams);
+            } else {
+                // A[O, :] -= U, A[O, K] = -T
+                AscendC::DataCopyPad(ubA, gmMatrix[rowIdx * n], rowsInParams, padParams);
+                AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+                AscendC::Sub(ubA, ubA, ubRows, rows * nRound);
+                AscendC::Muls(ubCols, ubCols, static_cast<Element>(-1), rows * NB);
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+                AscendC::DataCopyPad(gmMatrix[rowIdx * n], ubA, rowsOutParams);
+            }
+            // The column segment overwrites part of the rows just written
+            AscendC::PipeBarrier<PIPE_MTE3>();
+            AscendC::DataCopyPad(gmMatrix[rowIdx * n + k], ubCols, colsOutParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        }
+    }
+
+    Arch::Resource<ArchTag> resource;
+    Arch::CrossCoreFlag stepStart{STEP_START_ID};
+    Arch::CrossCoreFlag diagReady{DIAG_READY_ID};
+    Arch::CrossCoreFlag gemmDone{GEMM_DONE_ID};
+    Arch::CrossCoreFlag updateDone{UPDATE_DONE_ID};
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_BATCHED_MATRIX_INVERSE_HPP
@@ -0,0 +1,326 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_BATCHED_TRSM_HPP
+#define CATLASS_GEMM_KERNEL_BATCHED_TRSM_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/detail/alignment.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/gemm/tile/small_inverse.hpp"
+#include "catlass/gemm/tile/small_trsm.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// Solves a batch of independent triangular systems L * X = B in place, L is a RowMajor n x n lower or upper
+/// triangular float matrix and B is RowMajor n x nrhs. Every system is owned by a single core.
+/// When n <= NB both L and B stay in UB and every AIV solves its own systems by substitution.
+/// Otherwise the blocks of NB rows are solved in substitution order: the AIV inverts the diagonal block D in UB,
+/// the AIC computes X[K] = D * B[K] and U = L[O, K] * X[K] for the remaining rows O into a per-core workspace,
+/// and the AIVs write B[K] = X[K] and B[O] -= U back.
+/// The opposite triangle of L is read by the diagonal block inverse, so it has to be zero.
+template <class BlockMmad_, uint32_t NB_ = 64, uint32_t MAX_N_ = 256>
+class BatchedTrsm {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using Element = typename BlockMmad::ElementA;
+    using Layout = layout::RowMajor;
+
+    static_assert(std::is_same_v<Element, float> && std::is_same_v<typename BlockMmad::ElementC, float>,
+        "BatchedTrsm only supports float");
+    static_assert(std::is_same_v<typename BlockMmad::LayoutA, Layout> &&
+        std::is_same_v<typename BlockMmad::LayoutB, Layout> && std::is_same_v<typename BlockMmad::LayoutC, Layout>,
+        "BatchedTrsm only supports RowMajor operands");
+
+    static constexpr uint32_t NB = NB_;
+    static constexpr uint32_t MAX_N = MAX_N_;
+    using TileInverse = Tile::TileSmallInverse<ArchTag, Element, NB>;
+    using TileTrsm = Tile::TileSmallTrsm<ArchTag, Element, NB, MAX_N>;
+
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(Element);
+    static_assert(NB % ELE_NUM_PER_BLK == 0 && MAX_N % ELE_NUM_PER_BLK == 0, "NB and MAX_N must be 32B aligned");
+
+    // Rows of B and U updated per UB round, after the UB taken by the diagonal block inverse
+    static constexpr uint32_t CHUNK_ROWS =
+        (ArchTag::UB_SIZE - TileInverse::UB_SIZE_NEEDED) / (MAX_N * 2 * sizeof(Element));
+    static_assert(CHUNK_ROWS > 0, "MAX_N exceeds the UB size");
+
+    static constexpr uint32_t STEP_START_ID = 0;
+    static constexpr uint32_t DIAG_READY_ID = 1;
+    static constexpr uint32_t GEMM_DONE_ID = 2;
+    static constexpr uint32_t UPDATE_DONE_ID = 3;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        uint32_t batch;
+        uint32_t n;
+        uint32_t nrhs;
+        bool lower;
+        GM_ADDR ptrL;
+        GM_ADDR ptrB;
+        GM_ADDR ptrWorkspace;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            uint32_t batch_, uint32_t n_, uint32_t nrhs_, bool lower_, GM_ADDR ptrL_, GM_ADDR ptrB_,
+            GM_ADDR ptrWorkspace_)
+            : batch(batch_), n(n_), nrhs(nrhs_), lower(lower_), ptrL(ptrL_), ptrB(ptrB_), ptrWorkspace(ptrWorkspace_)
+        {}
+    };
+
+    struct Arguments {
+        uint32_t batch;
+        uint32_t n;
+        uint32_t nrhs;
+        bool lower;
+        // batch x n x n
+        GM_ADDR deviceL;
+        // batch x n x nrhs, overwritten by the solutions
+        GM_ADDR deviceB;
+        uint32_t aicoreNum;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        return (args.batch > 0) && (args.n > 0) && (args.n <= MAX_N) && (args.nrhs > 0) && (args.nrhs <= MAX_N);
+    }
+
+    CATLASS_HOST_DEVICE
+    static size_t GetWorkspaceElemNum(uint32_t n, uint32_t nrhs)
+    {
+        // Diagonal block inverse D, X[K] and U
+        return static_cast<size_t>(NB) * NB + static_cast<size_t>(NB) * nrhs + static_cast<size_t>(n) * nrhs;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        if (args.n <= NB) {
+            return 0;
+        }
+        return GetWorkspaceElemNum(args.n, args.nrhs) * sizeof(Element) * args.aicoreNum;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        return Params(args.batch, args.n, args.nrhs, args.lower, args.deviceL, args.deviceB, workspace);
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    BatchedTrsm()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        uint32_t n = params.n;
+        if (n <= NB) {
+            return;
+        }
+        uint32_t nrhs = params.nrhs;
+        uint32_t aicoreIdx = AscendC::GetBlockIdx();
+        uint32_t aicoreNum = AscendC::GetBlockNum();
+
+        BlockMmad blockMmad(resource);
+
+        AscendC::GlobalTensor<Element> gmL;
+        gmL.SetGlobalBuffer(reinterpret_cast<__gm__ Element*>(params.ptrL));
+        AscendC::GlobalTensor<Element> gmB;
+        gmB.SetGlobalBuffer(reinterpret_cast<__gm__ Element*>(params.ptrB));
+        AscendC::GlobalTensor<Element> gmDinv;
+        gmDinv.SetGlobalBuffer(
+            reinterpret_cast<__gm__ Element*>(params.ptrWorkspace) + aicoreIdx * GetWorkspaceElemNum(n, nrhs));
+        auto gmX = gmDinv[NB * NB];
+        auto gmU = gmX[NB * nrhs];
+
+        uint32_t blockNum = CeilDiv(n, NB);
+        for (uint32_t matrixIdx = aicoreIdx; matrixIdx < params.batch; matrixIdx += aicoreNum) {
+            auto gmMatrixL = gmL[static_cast<int64_t>(matrixIdx) * n * n];
+            auto gmMatrixB = gmB[static_cast<int64_t>(matrixIdx) * n * nrhs];
+            for (uint32_t stepIdx = 0; stepIdx < blockNum; ++stepIdx) {
+                uint32_t k = (params.lower ? stepIdx : blockNum - 1 - stepIdx) * NB;
+                uint32_t nb = Min(NB, n - k);
+                // Rows not solved yet: below block K for lower, above block K for upper
+                uint32_t trailStart = params.lower ? k + nb : 0;
+                uint32_t trailRows = params.lower ? n - k - nb : k;
+
+                Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(stepStart);
+                Arch::CrossCoreWaitFlag(diagReady);
+
+                // X[K] = D * B[K]
+                RunGemm(
+                    blockMmad, gmDinv, Layout{nb, nb, NB}, gmMatrixB[k * nrhs], Layout{nb, nrhs}, gmX,
+                    Layout{nb, nrhs});
+                if (trailRows > 0) {
+                    AscendC::PipeBarrier<PIPE_ALL>();
+                    // U = L[O, K] * X[K]
+                    RunGemm(
+                        blockMmad, gmMatrixL[trailStart * n + k], Layout{trailRows, nb, n}, gmX, Layout{nb, nrhs},
+                        gmU, Layout{trailRows, nrhs});
+                }
+
+                Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(gemmDone);
+                Arch::CrossCoreWaitFlag(updateDone);
+            }
+        }
+    }
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        uint32_t n = params.n;
+        uint32_t nrhs = params.nrhs;
+
+        AscendC::GlobalTensor<Element> gmL;
+        gmL.SetGlobalBuffer(reinterpret_cast<__gm__ Element*>(params.ptrL));
+        AscendC::GlobalTensor<Element> gmB;
+        gmB.SetGlobalBuffer(reinterpret_cast<__gm__ Element*>(params.ptrB));
+
+        if (n <= NB) {
+            // L and B fit in UB, every AIV solves its own systems
+            TileTrsm tileTrsm(resource);
+            uint32_t aivIdx = AscendC::GetBlockIdx();
+            uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+            for (uint32_t matrixIdx = aivIdx; matrixIdx < params.batch; matrixIdx += aivNum) {
+                auto gmMatrixB = gmB[static_cast<int64_t>(matrixIdx) * n * nrhs];
+                tileTrsm(gmMatrixB, nrhs, gmL[static_cast<int64_t>(matrixIdx) * n * n], n, n, nrhs, params.lower);
+            }
+            return;
+        }
+
+        uint32_t aicoreNum = AscendC::GetBlockNum();
+        uint32_t aicoreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t subBlockIdx = AscendC::GetSubBlockIdx();
+
+        TileInverse tileInverse(resource);
+        AscendC::GlobalTensor<Element> gmDinv;
+        gmDinv.SetGlobalBuffer(
+            reinterpret_cast<__gm__ Element*>(params.ptrWorkspace) + aicoreIdx * GetWorkspaceElemNum(n, nrhs));
+        auto gmX = gmDinv[NB * NB];
+        auto gmU = gmX[NB * nrhs];
+
+        uint32_t blockNum = CeilDiv(n, NB);
+        for (uint32_t matrixIdx = aicoreIdx; matrixIdx < params.batch; matrixIdx += aicoreNum) {
+            auto gmMatrixL = gmL[static_cast<int64_t>(matrixIdx) * n * n];
+            auto gmMatrixB = gmB[static_cast<int64_t>(matrixIdx) * n * nrhs];
+            for (uint32_t stepIdx = 0; stepIdx < blockNum; ++stepIdx) {
+                uint32_t k = (params.lower ? stepIdx : blockNum - 1 - stepIdx) * NB;
+                uint32_t nb = Min(NB, n - k);
+                uint32_t trailStart = params.lower ? k + nb : 0;
+                uint32_t trailRows = params.lower ? n - k - nb : k;
+
+                Arch::CrossCoreWaitFlag(stepStart);
+                if (subBlockIdx == 0) {
+                    tileInverse(gmDinv, NB, gmMatrixL[k * n + k], n, nb);
+                }
+                Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(diagReady);
+                Arch::CrossCoreWaitFlag(gemmDone);
+
+                UpdateRows(gmMatrixB[k * nrhs], gmX, nb, nrhs, false);
+                UpdateRows(gmMatrixB[trailStart * nrhs], gmU, trailRows, nrhs, true);
+
+                Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(updateDone);
+            }
+        }
+    }
+
+private:
+    /// Runs gmC = gmA * gmB on the current core, one L1 tile of C at a time.
+    CATLASS_DEVICE
+    void RunGemm(
+        BlockMmad& blockMmad, AscendC::GlobalTensor<Element> const& gmA, Layout const& layoutA,
+        AscendC::GlobalTensor<Element> const& gmB, Layout const& layoutB, AscendC::GlobalTensor<Element> const& gmC,
+        Layout const& layoutC)
+    {
+        uint32_t m = layoutA.shape(0);
+        uint32_t k = layoutA.shape(1);
+        uint32_t n = layoutB.shape(1);
+        for (uint32_t mOffset = 0; mOffset < m; mOffset += L1TileShape::M) {
+            for (uint32_t nOffset = 0; nOffset < n; nOffset += L1TileShape::N) {
+                GemmCoord actualShape{Min(L1TileShape::M, m - mOffset), Min(L1TileShape::N, n - nOffset), k};
+                blockMmad(
+                    gmA[layoutA.GetOffset(MatrixCoord{mOffset, 0})], layoutA.GetTileLayout(actualShape.GetCoordMK()),
+                    gmB[layoutB.GetOffset(MatrixCoord{0, nOffset})], layoutB.GetTileLayout(actualShape.GetCoordKN()),
+                    gmC[layoutC.GetOffset(MatrixCoord{mOffset, nOffset})],
+                    layoutC.GetTileLayout(actualShape.GetCoordMN()), actualShape);
+            }
+        }
+    }
+
+    /// gmDst = gmDst - gmSrc if isSubtract, else gmDst = gmSrc, for rows x nrhs matrices split between the sub-blocks.
+    CATLASS_DEVICE
+    void UpdateRows(
+        AscendC::GlobalTensor<Element> const& gmDst, AscendC::GlobalTensor<Element> const& gmSrc, uint32_t rows,
+        uint32_t nrhs, bool isSubtract)
+    {
+        uint32_t nrhsRound = RoundUp(nrhs, ELE_NUM_PER_BLK);
+        uint32_t rowsPerSubBlock = CeilDiv(rows, AscendC::GetSubBlockNum());
+        uint32_t rowStart = Min(rows, AscendC::GetSubBlockIdx() * rowsPerSubBlock);
+        uint32_t rowEnd = Min(rows, rowStart + rowsPerSubBlock);
+
+        auto ubDst = resource.ubBuf.template GetBufferByByte<Element>(TileInverse::UB_SIZE_NEEDED);
+        auto ubSrc = ubDst[CHUNK_ROWS * MAX_N];
+        AscendC::DataCopyPadExtParams<Element> padParams(false, 0, 0, 0);
+
+        for (uint32_t rowIdx = rowStart; rowIdx < rowEnd; rowIdx += CHUNK_ROWS) {
+            uint32_t chunkRows = Min(CHUNK_ROWS, rowEnd - rowIdx);
+            AscendC::DataCopyExtParams copyInParams(
+                chunkRows, nrhs * sizeof(Element), 0, (nrhsRound - nrhs) / ELE_NUM_PER_BLK, 0);
+            AscendC::DataCopyExtParams copyOutParams(
+                chunkRows, nrhs * sizeof(Element), (nrhsRound - nrhs) / ELE_NUM_PER_BLK, 0, 0);
+
+            AscendC::DataCopyPad(ubSrc, gmSrc[rowIdx * nrhs], copyInParams, padParams);
+            if (isSubtract) {
+                AscendC::DataCopyPad(ubDst, gmDst[rowIdx * nrhs], copyInParams, padParams);
+                AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+                AscendC::Sub(ubDst, ubDst, ubSrc, chunkRows * nrhsRound);
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+                AscendC::DataCopyPad(gmDst[rowIdx * nrhs], ubDst, copyOutParams);
+                AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+            } else {
+                AscendC::SetFlag<AscendC::HardEvent::MTE2_MTE3>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_MTE3>(EVENT_ID0);
+                AscendC::DataCopyPad(gmDst[rowIdx * nrhs], ubSrc, copyOutParams);
+            }
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+        }
+    }
+
+    Arch::Resource<ArchTag> resource;
+    Arch::CrossCoreFlag stepStart{STEP_START_ID};
+    Arch::CrossCoreFlag diagReady{DIAG_READY_ID};
+    Arch::CrossCoreFlag gemmDone{GEMM_DONE_ID};
+    Arch::CrossCoreFlag updateDone{UPDATE_DONE_ID};
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_BATCHED_TRSM_HPP
@@ -0,0 +1,488 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_FLASH_ATTENTION_BACKWARD_HPP
+#define CATLASS_GEMM_KERNEL_FLASH_ATTENTION_BACKWARD_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/matrix_coord.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// FlashAttention backward: dQ, dK and dV of Q/K/V/O/dO in BSND layout with the forward LSE in [B, N, Sq].
+/// Tasks are (batch, head, q block group) and are spread over the cores (split-Q). For each (q block i, kv block j):
+///   AIC: S = Q_i * K_j^T and dP = dO_i * V_j^T into a double-buffered per-core workspace
+///   AIV: P = exp(scale * S - LSE_i) and dS = scale * P * (dP - D_i), D_i = rowsum(dO_i * O_i)
+///   AIC: dV_j += P^T * dO_i, dK_j += dS^T * Q_i and dQ_i += dS * K_j, accumulated in float by atomic add
+/// The AIC computes S/dP of the next step while the AIV works on the current one.
+/// dK/dV of all q blocks go to one accumulator, or with the deterministic option to one accumulator per q block
+/// group, each written by a single core in order. The AIV sums the accumulators in a fixed order at the end and
+/// casts all gradients to the output type.
+template <class BlockMmadQK_, class BlockMmadKV_, class BlockMmadQ_, class BlockEpilogue_>
+class FlashAttentionBackward {
+public:
+    using BlockMmadQK = BlockMmadQK_;
+    using BlockMmadKV = BlockMmadKV_;
+    using BlockMmadQ = BlockMmadQ_;
+    using ArchTag = typename BlockMmadQK::ArchTag;
+    using L1TileShape = typename BlockMmadQK::L1TileShape;
+    using Element = typename BlockMmadQK::ElementA;
+    using ElementAccumulator = typename BlockMmadQK::ElementC;
+
+    using BlockEpilogue = BlockEpilogue_;
+    using ElementLse = typename BlockEpilogue::ElementLse;
+
+    static constexpr uint32_t BLOCK_SIZE = BlockEpilogue::TILE_ROWS;
+    static constexpr uint32_t HEAD_DIM_TILE = BlockMmadKV::L1TileShape::N;
+    static constexpr uint32_t WORKSPACE_STAGES = 2;
+    static constexpr uint32_t TILE_LEN = BLOCK_SIZE * BLOCK_SIZE;
+    static constexpr size_t CORE_WORKSPACE_SIZE =
+        static_cast<size_t>(WORKSPACE_STAGES) * TILE_LEN * (sizeof(ElementAccumulator) + sizeof(Element)) * 2;
+
+    static_assert(
+        std::is_same_v<ElementAccumulator, float> && std::is_same_v<typename BlockMmadKV::ElementC, float> &&
+            std::is_same_v<typename BlockMmadQ::ElementC, float>,
+        "The scores and the gradient accumulators must be float");
+    static_assert(
+        L1TileShape::M == BLOCK_SIZE && L1TileShape::N == BLOCK_SIZE && BlockEpilogue::TILE_COLS == BLOCK_SIZE,
+        "The q and kv blocks must match the L1 tile of BlockMmadQK and the tile of the epilogue");
+    static_assert(
+        BlockMmadKV::L1TileShape::M == BLOCK_SIZE && BlockMmadQ::L1TileShape::M == BLOCK_SIZE &&
+            BlockMmadQ::L1TileShape::N == HEAD_DIM_TILE,
+        "The L1 tiles of the gradient matmuls must cover one block by one head dim tile");
+    // The fixpipe switches between plain and atomic stores around the gradient matmuls, which relies on the
+    // FIX_M wait of the non unit flag pipeline when a block is destructed
+    static_assert(
+        !BlockMmadQK::ENABLE_UNIT_FLAG && !BlockMmadKV::ENABLE_UNIT_FLAG && !BlockMmadQ::ENABLE_UNIT_FLAG,
+        "FlashAttentionBackward requires the matmul blocks without unit flag");
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        uint32_t batch;
+        uint32_t seqlenQ;
+        uint32_t seqlenKv;
+        uint32_t numHeads;
+        uint32_t headDim;
+        float scaleValue;
+        uint32_t causal;
+        uint32_t qBlockGroups;
+        uint32_t accumulatorNum;
+        __gm__ Element* ptrQ;
+        __gm__ Element* ptrK;
+        __gm__ Element* ptrV;
+        __gm__ Element* ptrO;
+        __gm__ Element* ptrdO;
+        __gm__ ElementLse* ptrLse;
+        __gm__ Element* ptrdQ;
+        __gm__ Element* ptrdK;
+        __gm__ Element* ptrdV;
+        GM_ADDR ptrWorkspace;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+    };
+
+    struct Arguments {
+        uint32_t batch;
+        uint32_t seqlenQ;
+        uint32_t seqlenKv;
+        uint32_t numHeads;
+        uint32_t headDim;
+        float scaleValue;
+        bool causal;
+        bool deterministic;
+        uint32_t aicCoreNum;
+        uint8_t* ptrQ;
+        uint8_t* ptrK;
+        uint8_t* ptrV;
+        uint8_t* ptrO;
+        uint8_t* ptrdO;
+        uint8_t* ptrLse;
+        uint8_t* ptrdQ;
+        uint8_t* ptrdK;
+        uint8_t* ptrdV;
+    };
+
+    static uint32_t GetQBlockGroups(const Arguments& args)
+    {
+        uint32_t qBlocks = CeilDiv(args.seqlenQ, BLOCK_SIZE);
+        if (!args.deterministic) {
+            return qBlocks;
+        }
+        // Only as many groups as needed to fill the cores, each group keeps its own dK/dV accumulator
+        uint32_t headNum = args.batch * args.numHeads;
+        return Min(qBlocks, CeilDiv(args.aicCoreNum, headNum));
+    }
+
+    static uint32_t GetAccumulatorNum(const Arguments& args)
+    {
+        return args.deterministic ? GetQBlockGroups(args) : 1;
+    }
+
+    static bool CanImplement(const Arguments& args)
+    {
+        constexpr uint32_t MAX_STRIDE = 65536;
+        constexpr uint32_t HEAD_DIM_ALIGN = 16;
+        if (args.batch == 0 || args.seqlenQ == 0 || args.seqlenKv == 0 || args.numHeads == 0) {
+            return false;
+        }
+        if (args.headDim == 0 || args.headDim % HEAD_DIM_ALIGN != 0 || args.headDim > BlockEpilogue::MAX_HEAD_DIM) {
+            return false;
+        }
+        // Rows of one head are numHeads * headDim apart
+        if (static_cast<uint64_t>(args.numHeads) * args.headDim >= MAX_STRIDE) {
+            return false;
+        }
+        // The causal mask is aligned to the top left corner
+        return !args.causal || args.seqlenQ == args.seqlenKv;
+    }
+
+    static size_t GetAccumulatorSize(const Arguments& args)
+    {
+        size_t headSize = static_cast<size_t>(args.numHeads) * args.headDim;
+        size_t dQSize = static_cast<size_t>(args.batch) * args.seqlenQ * headSize;
+        size_t dKVSize = static_cast<size_t>(args.batch) * args.seqlenKv * headSize;
+        return (dQSize + dKVSize * GetAccumulatorNum(args) * 2) * sizeof(ElementAccumulator);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        return GetAccumulatorSize(args) + CORE_WORKSPACE_SIZE * args.aicCoreNum;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        Params params;
+        params.batch = args.batch;
+        params.seqlenQ = args.seqlenQ;
+        params.seqlenKv = args.seqlenKv;
+        params.numHeads = args.numHeads;
+        params.headDim = args.headDim;
+        params.scaleValue = args.scaleValue;
+        params.causal = args.causal ? 1 : 0;
+        params.qBlockGroups = GetQBlockGroups(args);
+        params.accumulatorNum = GetAccumulatorNum(args);
+        params.ptrQ = reinterpret_cast<__gm__ Element*>(args.ptrQ);
+        params.ptrK = reinterpret_cast<__gm__ Element*>(args.ptrK);
+        params.ptrV = reinterpret_cast<__gm__ Element*>(args.ptrV);
+        params.ptrO = reinterpret_cast<__gm__ Element*>(args.ptrO);
+        params.ptrdO = reinterpret_cast<__gm__ Element*>(args.ptrdO);
+        params.ptrLse = reinterpret_cast<__gm__ ElementLse*>(args.ptrLse);
+        params.ptrdQ = reinterpret_cast<__gm__ Element*>(args.ptrdQ);
+        params.ptrdK = reinterpret_cast<__gm__ Element*>(args.ptrdK);
+        params.ptrdV = reinterpret_cast<__gm__ Element*>(args.ptrdV);
+        params.ptrWorkspace = workspace;
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    FlashAttentionBackward()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        InitGlobalTensors(params, AscendC::GetBlockIdx());
+
+        uint32_t coreIdx = AscendC::GetBlockIdx();
+        uint32_t coreNum = AscendC::GetBlockNum();
+        uint32_t qBlocks = CeilDiv(params.seqlenQ, BLOCK_SIZE);
+        uint32_t kvBlocks = CeilDiv(params.seqlenKv, BLOCK_SIZE);
+        uint32_t taskNum = params.batch * params.numHeads * params.qBlockGroups;
+
+        // The accumulators are cleared by the AIV
+        Arch::CrossCoreWaitFlag(flagClearDone);
+
+        uint32_t stepIdx = 0;
+        StepCoord lastStep;
+        for (uint32_t taskIdx = coreIdx; taskIdx < taskNum; taskIdx += coreNum) {
+            StepCoord step = GetTaskCoord(params, taskIdx);
+            for (step.qBlockIdx = step.groupIdx; step.qBlockIdx < qBlocks; step.qBlockIdx += params.qBlockGroups) {
+                uint32_t kvBlockEnd = params.causal ? (step.qBlockIdx + 1) : kvBlocks;
+                for (step.kvBlockIdx = 0; step.kvBlockIdx < kvBlockEnd; step.kvBlockIdx++) {
+                    ComputeScores(params, step, stepIdx % WORKSPACE_STAGES);
+                    Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(flagScoresReady);
+                    // Gradients of the previous step overlap with the softmax gradient of this one
+                    if (stepIdx > 0) {
+                        ComputeGrads(params, lastStep, (stepIdx - 1) % WORKSPACE_STAGES);
+                    }
+                    lastStep = step;
+                    stepIdx++;
+                }
+            }
+        }
+        if (stepIdx > 0) {
+            ComputeGrads(params, lastStep, (stepIdx - 1) % WORKSPACE_STAGES);
+        }
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+        Arch::CrossCoreBarrier<0x0, PIPE_FIX>();
+        Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(flagAicDone);
+    }
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t coreNum = AscendC::GetBlockNum();
+        uint32_t aivIdx = AscendC::GetBlockIdx();
+        uint32_t aivNum = coreNum * AscendC::GetSubBlockNum();
+        InitGlobalTensors(params, coreIdx);
+
+        uint32_t qBlocks = CeilDiv(params.seqlenQ, BLOCK_SIZE);
+        uint32_t kvBlocks = CeilDiv(params.seqlenKv, BLOCK_SIZE);
+        uint32_t taskNum = params.batch * params.numHeads * params.qBlockGroups;
+        uint32_t rowStride = params.numHeads * params.headDim;
+        uint64_t dQLen = static_cast<uint64_t>(params.batch) * params.seqlenQ * rowStride;
+        uint64_t dKVLen = static_cast<uint64_t>(params.batch) * params.seqlenKv * rowStride;
+
+        BlockEpilogue blockEpilogue(resource, params.scaleValue);
+
+        // dQ, dK and dV accumulators are contiguous, clear them over all AIVs
+        uint64_t clearLen = dQLen + dKVLen * params.accumulatorNum * 2;
+        uint64_t clearOffset;
+        uint64_t clearLenThisCore = SplitLength(clearLen, aivIdx, aivNum, clearOffset);
+        blockEpilogue.Clear(gdQAcc[clearOffset], clearLenThisCore);
+        AscendC::PipeBarrier<PIPE_ALL>();
+        Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+        Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagClearDone);
+
+        uint32_t stepIdx = 0;
+        for (uint32_t taskIdx = coreIdx; taskIdx < taskNum; taskIdx += coreNum) {
+            StepCoord step = GetTaskCoord(params, taskIdx);
+            for (step.qBlockIdx = step.groupIdx; step.qBlockIdx < qBlocks; step.qBlockIdx += params.qBlockGroups) {
+                uint32_t qRows = GetBlockRows(params.seqlenQ, step.qBlockIdx);
+                uint64_t qOffset = GetRowOffset(params, params.seqlenQ, step.batchIdx, step.qBlockIdx, step.headIdx);
+                uint64_t lseOffset =
+                    (static_cast<uint64_t>(step.batchIdx) * params.numHeads + step.headIdx) * params.seqlenQ +
+                    step.qBlockIdx * BLOCK_SIZE;
+                blockEpilogue.UpdateRowStats(
+                    gO[qOffset], gdO[qOffset], layout::RowMajor(qRows, params.headDim, rowStride), gLse[lseOffset]);
+
+                uint32_t kvBlockEnd = params.causal ? (step.qBlockIdx + 1) : kvBlocks;
+                for (step.kvBlockIdx = 0; step.kvBlockIdx < kvBlockEnd; step.kvBlockIdx++) {
+                    uint32_t kvRows = GetBlockRows(params.seqlenKv, step.kvBlockIdx);
+                    uint32_t tileOffset = (stepIdx % WORKSPACE_STAGES) * TILE_LEN;
+                    bool causalDiag = params.causal && (step.kvBlockIdx == step.qBlockIdx);
+                    Arch::CrossCoreWaitFlag(flagScoresReady);
+                    blockEpilogue(
+                        gP[tileOffset], gdS[tileOffset], gS[tileOffset], gdP[tileOffset], MatrixCoord{qRows, kvRows},
+                        causalDiag);
+                    Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagGradsReady);
+                    stepIdx++;
+                }
+            }
+        }
+
+        // Reduce and cast once all gradients are accumulated
+        Arch::CrossCoreWaitFlag(flagAicDone);
+        AscendC::PipeBarrier<PIPE_ALL>();
+        uint64_t offset;
+        uint64_t len = SplitLength(dQLen, aivIdx, aivNum, offset);
+        blockEpilogue.ReduceCast(gdQ[offset], gdQAcc[offset], len, 1, 0);
+        len = SplitLength(dKVLen, aivIdx, aivNum, offset);
+        blockEpilogue.ReduceCast(gdK[offset], gdKAcc[offset], len, params.accumulatorNum, dKVLen);
+        blockEpilogue.ReduceCast(gdV[offset], gdVAcc[offset], len, params.accumulatorNum, dKVLen);
+    }
+
+private:
+    struct StepCoord {
+        uint32_t batchIdx{0};
+        uint32_t headIdx{0};
+        uint32_t groupIdx{0};
+        uint32_t accumulatorIdx{0};
+        uint32_t qBlockIdx{0};
+        uint32_t kvBlockIdx{0};
+    };
+
+    CATLASS_DEVICE
+    StepCoord GetTaskCoord(Params const& params, uint32_t taskIdx)
+    {
+        StepCoord step;
+        uint32_t headTaskIdx = taskIdx / params.qBlockGroups;
+        // Groups are handed out from the last one, whose q blocks see the most kv blocks under the causal mask
+        step.groupIdx = params.qBlockGroups - 1 - taskIdx % params.qBlockGroups;
+        step.batchIdx = headTaskIdx / params.numHeads;
+        step.headIdx = headTaskIdx % params.numHeads;
+        step.accumulatorIdx = (params.accumulatorNum > 1) ? step.groupIdx : 0;
+        return step;
+    }
+
+    CATLASS_DEVICE
+    uint32_t GetBlockRows(uint32_t seqlen, uint32_t blockIdx)
+    {
+        return Min(BLOCK_SIZE, seqlen - blockIdx * BLOCK_SIZE);
+    }
+
+    CATLASS_DEVICE
+    uint64_t GetRowOffset(Params const& params, uint32_t seqlen, uint32_t batchIdx, uint32_t blockIdx, uint32_t headIdx)
+    {
+        uint64_t tokenIdx = static_cast<uint64_t>(batchIdx) * seqlen + blockIdx * BLOCK_SIZE;
+        return (tokenIdx * params.numHeads + headIdx) * params.headDim;
+    }
+
+    /// Splits len elements over num cores, the pieces start on a block of both float and the output type
+    CATLASS_DEVICE
+    uint64_t SplitLength(uint64_t len, uint32_t idx, uint32_t num, uint64_t& offset)
+    {
+        constexpr uint64_t ALIGN = BYTE_PER_BLK / sizeof(Element);
+        uint64_t lenPerCore = RoundUp(CeilDiv(len, static_cast<uint64_t>(num)), ALIGN);
+        offset = Min(lenPerCore * idx, len);
+        return Min(lenPerCore, len - offset);
+    }
+
+    CATLASS_DEVICE
+    void InitGlobalTensors(Params const& params, uint32_t coreIdx)
+    {
+        uint64_t rowStride = static_cast<uint64_t>(params.numHeads) * params.headDim;
+        uint64_t dQLen = static_cast<uint64_t>(params.batch) * params.seqlenQ * rowStride;
+        uint64_t dKVLen = static_cast<uint64_t>(params.batch) * params.seqlenKv * rowStride;
+
+        gQ.SetGlobalBuffer(params.ptrQ);
+        gK.SetGlobalBuffer(params.ptrK);
+        gV.SetGlobalBuffer(params.ptrV);
+        gO.SetGlobalBuffer(params.ptrO);
+        gdO.SetGlobalBuffer(params.ptrdO);
+        gLse.SetGlobalBuffer(params.ptrLse);
+        gdQ.SetGlobalBuffer(params.ptrdQ);
+        gdK.SetGlobalBuffer(params.ptrdK);
+        gdV.SetGlobalBuffer(params.ptrdV);
+
+        __gm__ ElementAccumulator* ptrAcc = reinterpret_cast<__gm__ ElementAccumulator*>(params.ptrWorkspace);
+        gdQAcc.SetGlobalBuffer(ptrAcc);
+        gdKAcc.SetGlobalBuffer(ptrAcc + dQLen);
+        gdVAcc.SetGlobalBuffer(ptrAcc + dQLen + dKVLen * params.accumulatorNum);
+
+        GM_ADDR ptrCoreWorkspace = params.ptrWorkspace +
+                                   (dQLen + dKVLen * params.accumulatorNum * 2) * sizeof(ElementAccumulator) +
+                                   coreIdx * CORE_WORKSPACE_SIZE;
+        uint64_t stagesLen = static_cast<uint64_t>(WORKSPACE_STAGES) * TILE_LEN;
+        gS.SetGlobalBuffer(reinterpret_cast<__gm__ ElementAccumulator*>(ptrCoreWorkspace));
+        gdP.SetGlobalBuffer(reinterpret_cast<__gm__ ElementAccumulator*>(ptrCoreWorkspace) + stagesLen);
+        ptrCoreWorkspace += stagesLen * sizeof(ElementAccumulator) * 2;
+        gP.SetGlobalBuffer(reinterpret_cast<__gm__ Element*>(ptrCoreWorkspace));
+        gdS.SetGlobalBuffer(reinterpret_cast<__gm__ Element*>(ptrCoreWorkspace) + stagesLen);
+    }
+
+    /// S = Q_i * K_j^T and dP = dO_i * V_j^T
+    CATLASS_DEVICE
+    void ComputeScores(Params const& params, StepCoord const& step, uint32_t stageIdx)
+    {
+        uint32_t rowStride = params.numHeads * params.headDim;
+        uint32_t qRows = GetBlockRows(params.seqlenQ, step.qBlockIdx);
+        uint32_t kvRows = GetBlockRows(params.seqlenKv, step.kvBlockIdx);
+        uint64_t qOffset = GetRowOffset(params, params.seqlenQ, step.batchIdx, step.qBlockIdx, step.headIdx);
+        uint64_t kvOffset = GetRowOffset(params, params.seqlenKv, step.batchIdx, step.kvBlockIdx, step.headIdx);
+        uint32_t tileOffset = stageIdx * TILE_LEN;
+
+        layout::RowMajor layoutQ(qRows, params.headDim, rowStride);
+        layout::ColumnMajor layoutKT(params.headDim, kvRows, rowStride);
+        layout::RowMajor layoutS(qRows, kvRows, BLOCK_SIZE);
+        GemmCoord actualShape{qRows, kvRows, params.headDim};
+
+        BlockMmadQK blockMmadQK(resource);
+        blockMmadQK(gQ[qOffset], layoutQ, gK[kvOffset], layoutKT, gS[tileOffset], layoutS, actualShape);
+        blockMmadQK(gdO[qOffset], layoutQ, gV[kvOffset], layoutKT, gdP[tileOffset], layoutS, actualShape);
+    }
+
+    /// dV_j += P^T * dO_i, dK_j += dS^T * Q_i and dQ_i += dS * K_j
+    CATLASS_DEVICE
+    void ComputeGrads(Params const& params, StepCoord const& step, uint32_t stageIdx)
+    {
+        uint32_t rowStride = params.numHeads * params.headDim;
+        uint32_t qRows = GetBlockRows(params.seqlenQ, step.qBlockIdx);
+        uint32_t kvRows = GetBlockRows(params.seqlenKv, step.kvBlockIdx);
+        uint64_t qOffset = GetRowOffset(params, params.seqlenQ, step.batchIdx, step.qBlockIdx, step.headIdx);
+        uint64_t kvOffset = GetRowOffset(params, params.seqlenKv, step.batchIdx, step.kvBlockIdx, step.headIdx);
+        uint64_t kvAccOffset =
+            static_cast<uint64_t>(step.accumulatorIdx) * params.batch * params.seqlenKv * rowStride + kvOffset;
+        uint32_t tileOffset = stageIdx * TILE_LEN;
+
+        Arch::CrossCoreWaitFlag(flagGradsReady);
+        // The scores above are plain stores, they must be done before the fixpipe switches to atomic add
+        AscendC::PipeBarrier<PIPE_ALL>();
+        AscendC::SetAtomicAdd<ElementAccumulator>();
+        {
+            layout::ColumnMajor layoutPT(kvRows, qRows, BLOCK_SIZE);
+            BlockMmadKV blockMmadKV(resource);
+            for (uint32_t dOffset = 0; dOffset < params.headDim; dOffset += HEAD_DIM_TILE) {
+                uint32_t dActual = Min(HEAD_DIM_TILE, params.headDim - dOffset);
+                layout::RowMajor layoutQ(qRows, dActual, rowStride);
+                layout::RowMajor layoutKV(kvRows, dActual, rowStride);
+                GemmCoord actualShape{kvRows, dActual, qRows};
+                blockMmadKV(
+                    gP[tileOffset], layoutPT, gdO[qOffset + dOffset], layoutQ, gdVAcc[kvAccOffset + dOffset],
+                    layoutKV, actualShape);
+                blockMmadKV(
+                    gdS[tileOffset], layoutPT, gQ[qOffset + dOffset], layoutQ, gdKAcc[kvAccOffset + dOffset],
+                    layoutKV, actualShape);
+            }
+        }
+        {
+            layout::RowMajor layoutDS(qRows, kvRows, BLOCK_SIZE);
+            BlockMmadQ blockMmadQ(resource);
+            for (uint32_t dOffset = 0; dOffset < params.headDim; dOffset += HEAD_DIM_TILE) {
+                uint32_t dActual = Min(HEAD_DIM_TILE, params.headDim - dOffset);
+                layout::RowMajor layoutQ(qRows, dActual, rowStride);
+                layout::RowMajor layoutKV(kvRows, dActual, rowStride);
+                GemmCoord actualShape{qRows, dActual, kvRows};
+                blockMmadQ(
+                    gdS[tileOffset], layoutDS, gK[kvOffset + dOffset], layoutKV, gdQAcc[qOffset + dOffset], layoutQ,
+                    actualShape);
+            }
+        }
+        AscendC::PipeBarrier<PIPE_ALL>();
+        AscendC::SetAtomicNone();
+    }
+
+    static constexpr Arch::FlagID FLAG_CLEAR_DONE = 0;
+    static constexpr Arch::FlagID FLAG_SCORES_READY = 1;
+    static constexpr Arch::FlagID FLAG_GRADS_READY = 2;
+    static constexpr Arch::FlagID FLAG_AIC_DONE = 3;
+    Arch::CrossCoreFlag flagClearDone{FLAG_CLEAR_DONE};
+    Arch::CrossCoreFlag flagScoresReady{FLAG_SCORES_READY};
+    Arch::CrossCoreFlag flagGradsReady{FLAG_GRADS_READY};
+    Arch::CrossCoreFlag flagAicDone{FLAG_AIC_DONE};
+
+    AscendC::GlobalTensor<Element> gQ;
+    AscendC::GlobalTensor<Element> gK;
+    AscendC::GlobalTensor<Element> gV;
+    AscendC::GlobalTensor<Element> gO;
+    AscendC::GlobalTensor<Element> gdO;
+    AscendC::GlobalTensor<ElementLse> gLse;
+    AscendC::GlobalTensor<Element> gdQ;
+    AscendC::GlobalTensor<Element> gdK;
+    AscendC::GlobalTensor<Element> gdV;
+    AscendC::GlobalTensor<ElementAccumulator> gdQAcc;
+    AscendC::GlobalTensor<ElementAccumulator> gdKAcc;
+    AscendC::GlobalTensor<ElementAccumulator> gdVAcc;
+    AscendC::GlobalTensor<ElementAccumulator> gS;
+    AscendC::GlobalTensor<ElementAccumulator> gdP;
+    AscendC::GlobalTensor<Element> gP;
+    AscendC::GlobalTensor<Element> gdS;
+
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_FLASH_ATTENTION_BACKWARD_HPP
@@ -0,0 +1,579 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_INTERLEAVED_COMPLEX_GEMM_HPP
+#define CATLASS_GEMM_KERNEL_INTERLEAVED_COMPLEX_GEMM_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/detail/alignment.hpp"
+#include "catlass/layout/layout.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+enum class ComplexGemmAlgorithm
+{
+    FOUR_M,
+    THREE_M,
+};
+
+/// Complex GEMM C = A * B on interleaved (re, im) RowMajor operands, A is m x k, B is k x n and C is m x n complex.
+///
+/// FOUR_M: the interleaved A is used as a real m x 2k matrix and C is produced as a real m x 2n matrix by one GEMM
+///   against the real 2k x 2n form of B, whose rows 2i and 2i + 1 are (re, im) and (-im, re) of row i of B.
+///   A and C are never split or recombined, only B is expanded once by the AIVs, the cube work equals 4 real GEMMs.
+/// THREE_M: Karatsuba with 3 real GEMMs per tile, P1 = Ar * Br, P2 = Ai * Bi and P3 = (Ar + Ai) * (Br + Bi).
+///   The AIVs split A and B into planes once, the AIC writes the products of every tile into a per-core ring, and
+///   the AIVs recombine Cr = P1 - P2, Ci = P3 - P1 - P2 and store C interleaved while the AIC computes the next tile.
+template <ComplexGemmAlgorithm ALGORITHM_, class BlockMmad_, class BlockScheduler_>
+class InterleavedComplexGemm {
+public:
+    static constexpr ComplexGemmAlgorithm ALGORITHM = ALGORITHM_;
+
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using ElementA = typename BlockMmad::ElementA;
+    using ElementB = typename BlockMmad::ElementB;
+    using ElementC = typename BlockMmad::ElementC;
+    using Layout = layout::RowMajor;
+
+    using BlockScheduler = BlockScheduler_;
+
+    static_assert(std::is_same_v<ElementA, ElementB>, "A and B must have the same element type");
+    static_assert(std::is_same_v<ElementC, float>, "InterleavedComplexGemm only supports a float C");
+    static_assert(std::is_same_v<typename BlockMmad::LayoutA, Layout> &&
+        std::is_same_v<typename BlockMmad::LayoutB, Layout> && std::is_same_v<typename BlockMmad::LayoutC, Layout>,
+        "InterleavedComplexGemm only supports RowMajor operands");
+
+    static constexpr uint32_t ELE_NUM_PER_BLK_A = BYTE_PER_BLK / sizeof(ElementA);
+    static constexpr uint32_t ELE_NUM_PER_BLK_C = BYTE_PER_BLK / sizeof(ElementC);
+
+    // Interleaved elements of A or B handled per UB round when splitting or expanding
+    static constexpr uint32_t SPLIT_TILE_LEN = 8192;
+    // The split halves a row, so the row pitch keeps both halves 32B aligned
+    static constexpr uint32_t SPLIT_PITCH_ALIGN = ELE_NUM_PER_BLK_A * 2;
+
+    static constexpr uint32_t STAGES = 2;
+    static constexpr uint32_t PRODUCT_NUM = 3;
+    static constexpr uint32_t PRODUCT_TILE_LEN = L1TileShape::M * L1TileShape::N;
+    // Rows of a C tile recombined per UB round: P1, P2, P3, Cr, Ci, the interleaved output and the gather offsets
+    static constexpr uint32_t RECOMBINE_ROWS =
+        (ArchTag::UB_SIZE - L1TileShape::N * 2 * sizeof(uint32_t)) / (L1TileShape::N * 7 * sizeof(ElementC));
+    static_assert(RECOMBINE_ROWS > 0, "L1TileShape::N exceeds the UB size");
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        GM_ADDR ptrB;
+        GM_ADDR ptrC;
+        // THREE_M: Ar, Ai and Ar + Ai planes
+        GM_ADDR ptrWorkspaceA;
+        // THREE_M: Br, Bi and Br + Bi planes, FOUR_M: the 2k x 2n real form of B
+        GM_ADDR ptrWorkspaceB;
+        // THREE_M: per-core ring of the tile products
+        GM_ADDR ptrWorkspaceC;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GemmCoord const& problemShape_, GM_ADDR ptrA_, GM_ADDR ptrB_, GM_ADDR ptrC_, GM_ADDR ptrWorkspaceA_,
+            GM_ADDR ptrWorkspaceB_, GM_ADDR ptrWorkspaceC_)
+            : problemShape(problemShape_),
+              ptrA(ptrA_),
+              ptrB(ptrB_),
+              ptrC(ptrC_),
+              ptrWorkspaceA(ptrWorkspaceA_),
+              ptrWorkspaceB(ptrWorkspaceB_),
+              ptrWorkspaceC(ptrWorkspaceC_)
+        {}
+    };
+
+    struct Arguments {
+        // Complex shape
+        GemmCoord problemShape;
+        GM_ADDR deviceA;
+        GM_ADDR deviceB;
+        GM_ADDR deviceC;
+        uint32_t aicoreNum;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        return (args.problemShape.m() > 0) && (args.problemShape.n() > 0) && (args.problemShape.k() > 0);
+    }
+
+    static size_t GetWorkspaceSizeA(const Arguments& args)
+    {
+        if constexpr (ALGORITHM == ComplexGemmAlgorithm::THREE_M) {
+            size_t planeLen = static_cast<size_t>(args.problemShape.m()) * args.problemShape.k();
+            return RoundUp<BYTE_PER_FRACTAL>(planeLen * PRODUCT_NUM * sizeof(ElementA));
+        } else {
+            return 0;
+        }
+    }
+
+    static size_t GetWorkspaceSizeB(const Arguments& args)
+    {
+        size_t planeLen = static_cast<size_t>(args.problemShape.k()) * args.problemShape.n();
+        if constexpr (ALGORITHM == ComplexGemmAlgorithm::THREE_M) {
+            return RoundUp<BYTE_PER_FRACTAL>(planeLen * PRODUCT_NUM * sizeof(ElementB));
+        } else {
+            return RoundUp<BYTE_PER_FRACTAL>(planeLen * 4 * sizeof(ElementB));
+        }
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        size_t sizeC = 0;
+        if constexpr (ALGORITHM == ComplexGemmAlgorithm::THREE_M) {
+            sizeC = static_cast<size_t>(PRODUCT_TILE_LEN) * PRODUCT_NUM * STAGES * sizeof(ElementC) * args.aicoreNum;
+        }
+        return GetWorkspaceSizeA(args) + GetWorkspaceSizeB(args) + sizeC;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        GM_ADDR ptrWorkspaceA = workspace;
+        GM_ADDR ptrWorkspaceB = ptrWorkspaceA + GetWorkspaceSizeA(args);
+        GM_ADDR ptrWorkspaceC = ptrWorkspaceB + GetWorkspaceSizeB(args);
+        return Params(
+            args.problemShape, args.deviceA, args.deviceB, args.deviceC, ptrWorkspaceA, ptrWorkspaceB,
+            ptrWorkspaceC);
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    InterleavedComplexGemm()
+    {
+        for (uint32_t stageIdx = 0; stageIdx < STAGES; ++stageIdx) {
+            flagProductReady[stageIdx] = Arch::CrossCoreFlag(FLAG_PRODUCT_READY + stageIdx);
+            flagProductFree[stageIdx] = Arch::CrossCoreFlag(FLAG_PRODUCT_FREE + stageIdx);
+        }
+    }
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        Arch::CrossCoreWaitFlag(flagOperandsReady);
+        if constexpr (ALGORITHM == ComplexGemmAlgorithm::FOUR_M) {
+            RunFourM(params);
+        } else {
+            RunThreeM(params);
+        }
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        uint32_t m = params.problemShape.m();
+        uint32_t n = params.problemShape.n();
+        uint32_t k = params.problemShape.k();
+
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer(reinterpret_cast<__gm__ ElementA*>(params.ptrA));
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer(reinterpret_cast<__gm__ ElementB*>(params.ptrB));
+        AscendC::GlobalTensor<ElementA> gmWorkspaceA;
+        gmWorkspaceA.SetGlobalBuffer(reinterpret_cast<__gm__ ElementA*>(params.ptrWorkspaceA));
+        AscendC::GlobalTensor<ElementB> gmWorkspaceB;
+        gmWorkspaceB.SetGlobalBuffer(reinterpret_cast<__gm__ ElementB*>(params.ptrWorkspaceB));
+
+        if constexpr (ALGORITHM == ComplexGemmAlgorithm::FOUR_M) {
+            ExpandB(gmWorkspaceB, gmB, k, n * 2);
+        } else {
+            SplitPlanes(gmWorkspaceA, gmA, m, k * 2);
+            SplitPlanes(gmWorkspaceB, gmB, k, n * 2);
+        }
+        // Every AIV has to finish before any AIC reads the workspace
+        Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+        Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagOperandsReady);
+
+        if constexpr (ALGORITHM == ComplexGemmAlgorithm::THREE_M) {
+            RecombineC(params);
+        }
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+private:
+    static constexpr Arch::FlagID FLAG_OPERANDS_READY = 0;
+    static constexpr Arch::FlagID FLAG_PRODUCT_READY = 1;
+    static constexpr Arch::FlagID FLAG_PRODUCT_FREE = FLAG_PRODUCT_READY + STAGES;
+
+    /// One GEMM over the real forms, A is m x 2k, the expanded B is 2k x 2n and C is m x 2n.
+    CATLASS_DEVICE
+    void RunFourM(Params const& params)
+    {
+        GemmCoord realShape{params.problemShape.m(), params.problemShape.n() * 2, params.problemShape.k() * 2};
+        Layout layoutA{realShape.m(), realShape.k()};
+        Layout layoutB{realShape.k(), realShape.n()};
+        Layout layoutC{realShape.m(), realShape.n()};
+
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer(reinterpret_cast<__gm__ ElementA*>(params.ptrA));
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer(reinterpret_cast<__gm__ ElementB*>(params.ptrWorkspaceB));
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC*>(params.ptrC));
+
+        BlockMmad blockMmad(resource);
+        BlockScheduler matmulBlockScheduler(realShape, MakeCoord(L1TileShape::M, L1TileShape::N));
+        uint32_t coreLoops = matmulBlockScheduler.GetCoreLoops();
+        for (uint32_t loopIdx = AscendC::GetBlockIdx(); loopIdx < coreLoops; loopIdx += AscendC::GetBlockNum()) {
+            GemmCoord blockCoord = matmulBlockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = matmulBlockScheduler.GetActualBlockShape(blockCoord);
+            MatrixCoord offsetA{blockCoord.m() * L1TileShape::M, 0};
+            MatrixCoord offsetB{0, blockCoord.n() * L1TileShape::N};
+            MatrixCoord offsetC{blockCoord.m() * L1TileShape::M, blockCoord.n() * L1TileShape::N};
+            blockMmad(
+                gmA[layoutA.GetOffset(offsetA)], layoutA.GetTileLayout(actualBlockShape.GetCoordMK()),
+                gmB[layoutB.GetOffset(offsetB)], layoutB.GetTileLayout(actualBlockShape.GetCoordKN()),
+                gmC[layoutC.GetOffset(offsetC)], layoutC.GetTileLayout(actualBlockShape.GetCoordMN()),
+                actualBlockShape);
+        }
+    }
+
+    /// Three real GEMMs per tile into the product ring of this core.
+    CATLASS_DEVICE
+    void RunThreeM(Params const& params)
+    {
+        uint32_t m = params.problemShape.m();
+        uint32_t n = params.problemShape.n();
+        uint32_t k = params.problemShape.k();
+        Layout layoutA{m, k};
+        Layout layoutB{k, n};
+        Layout layoutProduct{L1TileShape::M, L1TileShape::N};
+        size_t planeLenA = static_cast<size_t>(m) * k;
+        size_t planeLenB = static_cast<size_t>(k) * n;
+
+        AscendC::GlobalTensor<ElementA> gmPlanesA;
+        gmPlanesA.SetGlobalBuffer(reinterpret_cast<__gm__ ElementA*>(params.ptrWorkspaceA));
+        AscendC::GlobalTensor<ElementB> gmPlanesB;
+        gmPlanesB.SetGlobalBuffer(reinterpret_cast<__gm__ ElementB*>(params.ptrWorkspaceB));
+        AscendC::GlobalTensor<ElementC> gmProduct;
+        gmProduct.SetGlobalBuffer(
+            reinterpret_cast<__gm__ ElementC*>(params.ptrWorkspaceC) +
+            AscendC::GetBlockIdx() * PRODUCT_TILE_LEN * PRODUCT_NUM * STAGES);
+
+        BlockMmad blockMmad(resource);
+        BlockScheduler matmulBlockScheduler(params.problemShape, MakeCoord(L1TileShape::M, L1TileShape::N));
+        uint32_t coreLoops = matmulBlockScheduler.GetCoreLoops();
+        uint32_t stageIdx = 0;
+        uint32_t tileCount = 0;
+        for (uint32_t loopIdx = AscendC::GetBlockIdx(); loopIdx < coreLoops; loopIdx += AscendC::GetBlockNum()) {
+            GemmCoord blockCoord = matmulBlockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = matmulBlockScheduler.GetActualBlockShape(blockCoord);
+            int64_t offsetA = layoutA.GetOffset(MatrixCoord{blockCoord.m() * L1TileShape::M, 0});
+            int64_t offsetB = layoutB.GetOffset(MatrixCoord{0, blockCoord.n() * L1TileShape::N});
+            auto layoutBlockA = layoutA.GetTileLayout(actualBlockShape.GetCoordMK());
+            auto layoutBlockB = layoutB.GetTileLayout(actualBlockShape.GetCoordKN());
+            auto layoutBlockProduct = layoutProduct.GetTileLayout(actualBlockShape.GetCoordMN());
+
+            if (tileCount >= STAGES) {
+                Arch::CrossCoreWaitFlag(flagProductFree[stageIdx]);
+            }
+            auto gmStageProduct = gmProduct[stageIdx * PRODUCT_TILE_LEN * PRODUCT_NUM];
+            // The planes are ordered re, im, re + im, so product i uses plane i of A and of B
+            for (uint32_t productIdx = 0; productIdx < PRODUCT_NUM; ++productIdx) {
+                blockMmad(
+                    gmPlanesA[planeLenA * productIdx + offsetA], layoutBlockA,
+                    gmPlanesB[planeLenB * productIdx + offsetB], layoutBlockB,
+                    gmStageProduct[PRODUCT_TILE_LEN * productIdx], layoutBlockProduct, actualBlockShape);
+            }
+            Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(flagProductReady[stageIdx]);
+
+            stageIdx = (stageIdx + 1 < STAGES) ? (stageIdx + 1) : 0;
+            ++tileCount;
+        }
+        // Drain the free flags of the last tiles, the oldest one is at stageIdx once the ring has wrapped
+        stageIdx = (tileCount >= STAGES) ? stageIdx : 0;
+        for (uint32_t drainIdx = 0; drainIdx < Min(tileCount, STAGES); ++drainIdx) {
+            Arch::CrossCoreWaitFlag(flagProductFree[stageIdx]);
+            stageIdx = (stageIdx + 1 < STAGES) ? (stageIdx + 1) : 0;
+        }
+    }
+
+    /// Tiles of an interleaved rows x cols source, every AIV processes whole tiles of at most SPLIT_TILE_LEN.
+    struct SourceTile {
+        uint32_t rowOffset;
+        uint32_t colOffset;
+        uint32_t rows;
+        uint32_t cols;
+        uint32_t pitch;
+    };
+
+    CATLASS_DEVICE
+    uint32_t GetSourceTileNum(uint32_t rows, uint32_t cols)
+    {
+        uint32_t tileCols = Min(cols, SPLIT_TILE_LEN);
+        uint32_t tileRows = SPLIT_TILE_LEN / RoundUp(tileCols, SPLIT_PITCH_ALIGN);
+        return CeilDiv(rows, tileRows) * CeilDiv(cols, tileCols);
+    }
+
+    CATLASS_DEVICE
+    SourceTile GetSourceTile(uint32_t tileIdx, uint32_t rows, uint32_t cols)
+    {
+        uint32_t tileCols = Min(cols, SPLIT_TILE_LEN);
+        uint32_t pitch = RoundUp(tileCols, SPLIT_PITCH_ALIGN);
+        uint32_t tileRows = SPLIT_TILE_LEN / pitch;
+        uint32_t colTileNum = CeilDiv(cols, tileCols);
+        uint32_t rowOffset = tileIdx / colTileNum * tileRows;
+        uint32_t colOffset = tileIdx % colTileNum * tileCols;
+        return SourceTile{
+            rowOffset, colOffset, Min(tileRows, rows - rowOffset), Min(tileCols, cols - colOffset), pitch};
+    }
+
+    /// gmDst (2 * rows x cols) = the real form of gmSrc (rows x cols interleaved), row 2i is row i of gmSrc and
+    /// row 2i + 1 is row i with every (re, im) pair replaced by (-im, re).
+    CATLASS_DEVICE
+    void ExpandB(
+        AscendC::GlobalTensor<ElementB> const& gmDst, AscendC::GlobalTensor<ElementB> const& gmSrc, uint32_t rows,
+        uint32_t cols)
+    {
+        auto ubSrc = resource.ubBuf.template GetBufferByByte<ElementB>(0);
+        auto ubSwap = resource.ubBuf.template GetBufferByByte<ElementB>(SPLIT_TILE_LEN * sizeof(ElementB));
+        auto ubOffset = resource.ubBuf.template GetBufferByByte<int32_t>(SPLIT_TILE_LEN * sizeof(ElementB) * 2);
+
+        // Byte offsets of the pair swap: element j reads element j ^ 1
+        constexpr uint32_t ELE_NUM_PER_REPEAT_OFFSET = BYTE_PER_VECTOR_FRACTAL / sizeof(int32_t);
+        constexpr uint64_t EVEN_LANES = 0x5555555555555555;
+        constexpr uint64_t ODD_LANES = 0xAAAAAAAAAAAAAAAA;
+        uint64_t evenMask[2] = {EVEN_LANES, 0};
+        uint64_t oddMask[2] = {ODD_LANES, 0};
+        uint8_t offsetRepeats = SPLIT_TILE_LEN / ELE_NUM_PER_REPEAT_OFFSET;
+        AscendC::CreateVecIndex(ubOffset, static_cast<int32_t>(0), SPLIT_TILE_LEN);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Muls(ubOffset, ubOffset, static_cast<int32_t>(sizeof(ElementB)), SPLIT_TILE_LEN);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Adds(
+            ubOffset, ubOffset, static_cast<int32_t>(sizeof(ElementB)), evenMask, offsetRepeats,
+            AscendC::UnaryRepeatParams{});
+        AscendC::Adds(
+            ubOffset, ubOffset, -static_cast<int32_t>(sizeof(ElementB)), oddMask, offsetRepeats,
+            AscendC::UnaryRepeatParams{});
+        AscendC::PipeBarrier<PIPE_V>();
+        auto ubSwapOffset = ubOffset.template ReinterpretCast<uint32_t>();
+
+        // After the swap the even lanes hold im, which is negated
+        constexpr uint32_t ELE_NUM_PER_REPEAT = BYTE_PER_VECTOR_FRACTAL / sizeof(ElementB);
+        uint64_t negateMask[2] = {EVEN_LANES, (ELE_NUM_PER_REPEAT > 64) ? EVEN_LANES : 0};
+        AscendC::DataCopyPadExtParams<ElementB> padParams(false, 0, 0, 0);
+
+        uint32_t aivIdx = AscendC::GetBlockIdx();
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+        uint32_t tileNum = GetSourceTileNum(rows, cols);
+        for (uint32_t tileIdx = aivIdx; tileIdx < tileNum; tileIdx += aivNum) {
+            SourceTile tile = GetSourceTile(tileIdx, rows, cols);
+            uint32_t colsRound = RoundUp(tile.cols, ELE_NUM_PER_BLK_A);
+            uint32_t tileLen = tile.rows * tile.pitch;
+
+            AscendC::DataCopyExtParams copyInParams(
+                tile.rows, tile.cols * sizeof(ElementB), (cols - tile.cols) * sizeof(ElementB),
+                (tile.pitch - colsRound) / ELE_NUM_PER_BLK_A, 0);
+            AscendC::DataCopyPad(ubSrc, gmSrc[tile.rowOffset * cols + tile.colOffset], copyInParams, padParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+            AscendC::Gather(ubSwap, ubSrc, ubSwapOffset, 0, tileLen);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Muls(
+                ubSwap, ubSwap, static_cast<ElementB>(-1), negateMask, CeilDiv(tileLen, ELE_NUM_PER_REPEAT),
+                AscendC::UnaryRepeatParams{});
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+
+            // Even rows of the real form take the source rows, odd rows take the swapped ones
+            AscendC::DataCopyExtParams copyOutParams(
+                tile.rows, tile.cols * sizeof(ElementB), (tile.pitch - colsRound) / ELE_NUM_PER_BLK_A,
+                (cols * 2 - tile.cols) * sizeof(ElementB), 0);
+            int64_t dstOffset = static_cast<int64_t>(tile.rowOffset) * 2 * cols + tile.colOffset;
+            AscendC::DataCopyPad(gmDst[dstOffset], ubSrc, copyOutParams);
+            AscendC::DataCopyPad(gmDst[dstOffset + cols], ubSwap, copyOutParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        }
+    }
+
+    /// Splits gmSrc (rows x cols interleaved) into the re, im and re + im planes of rows x cols / 2 in gmDst.
+    CATLASS_DEVICE
+    void SplitPlanes(
+        AscendC::GlobalTensor<ElementA> const& gmDst, AscendC::GlobalTensor<ElementA> const& gmSrc, uint32_t rows,
+        uint32_t cols)
+    {
+        constexpr uint32_t HALF_TILE_LEN = SPLIT_TILE_LEN / 2;
+        auto ubSrc = resource.ubBuf.template GetBufferByByte<ElementA>(0);
+        auto ubReal = ubSrc[SPLIT_TILE_LEN];
+        auto ubImag = ubReal[HALF_TILE_LEN];
+        auto ubSum = ubImag[HALF_TILE_LEN];
+        AscendC::DataCopyPadExtParams<ElementA> padParams(false, 0, 0, 0);
+
+        constexpr uint32_t ELE_NUM_PER_REPEAT = BYTE_PER_VECTOR_FRACTAL / sizeof(ElementA);
+        constexpr uint8_t EVEN_PATTERN = 1;
+        constexpr uint8_t ODD_PATTERN = 2;
+        size_t planeLen = static_cast<size_t>(rows) * cols / 2;
+        uint64_t rsvdCnt = 0;
+
+        uint32_t aivIdx = AscendC::GetBlockIdx();
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+        uint32_t tileNum = GetSourceTileNum(rows, cols);
+        for (uint32_t tileIdx = aivIdx; tileIdx < tileNum; tileIdx += aivNum) {
+            SourceTile tile = GetSourceTile(tileIdx, rows, cols);
+            uint32_t colsRound = RoundUp(tile.cols, ELE_NUM_PER_BLK_A);
+            uint32_t halfCols = tile.cols / 2;
+            uint32_t halfPitch = tile.pitch / 2;
+            uint32_t tileLen = tile.rows * tile.pitch;
+
+            AscendC::DataCopyExtParams copyInParams(
+                tile.rows, tile.cols * sizeof(ElementA), (cols - tile.cols) * sizeof(ElementA),
+                (tile.pitch - colsRound) / ELE_NUM_PER_BLK_A, 0);
+            AscendC::DataCopyPad(ubSrc, gmSrc[tile.rowOffset * cols + tile.colOffset], copyInParams, padParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+            // The pitch is even, so the even and odd elements of every row stay in the same row of the planes
+            AscendC::GatherMaskParams gatherParams{1, static_cast<uint16_t>(CeilDiv(tileLen, ELE_NUM_PER_REPEAT)),
+                AscendC::DEFAULT_REPEAT_STRIDE, 0};
+            AscendC::GatherMask(ubReal, ubSrc, EVEN_PATTERN, false, 0, gatherParams, rsvdCnt);
+            AscendC::GatherMask(ubImag, ubSrc, ODD_PATTERN, false, 0, gatherParams, rsvdCnt);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Add(ubSum, ubReal, ubImag, tileLen / 2);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+
+            AscendC::DataCopyExtParams copyOutParams(
+                tile.rows, halfCols * sizeof(ElementA),
+                (halfPitch - RoundUp(halfCols, ELE_NUM_PER_BLK_A)) / ELE_NUM_PER_BLK_A,
+                (cols - tile.cols) / 2 * sizeof(ElementA), 0);
+            int64_t dstOffset = static_cast<int64_t>(tile.rowOffset) * cols / 2 + tile.colOffset / 2;
+            AscendC::DataCopyPad(gmDst[dstOffset], ubReal, copyOutParams);
+            AscendC::DataCopyPad(gmDst[planeLen + dstOffset], ubImag, copyOutParams);
+            AscendC::DataCopyPad(gmDst[planeLen * 2 + dstOffset], ubSum, copyOutParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        }
+    }
+
+    /// Cr = P1 - P2 and Ci = P3 - P1 - P2 for every tile of the product ring, stored interleaved into C.
+    CATLASS_DEVICE
+    void RecombineC(Params const& params)
+    {
+        constexpr uint32_t TILE_N = L1TileShape::N;
+        constexpr uint32_t CHUNK_LEN = RECOMBINE_ROWS * TILE_N;
+        uint32_t n = params.problemShape.n();
+        uint32_t aicoreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t aicoreNum = AscendC::GetBlockNum();
+
+        auto ubP1 = resource.ubBuf.template GetBufferByByte<ElementC>(0);
+        auto ubP2 = ubP1[CHUNK_LEN];
+        auto ubP3 = ubP2[CHUNK_LEN];
+        auto ubReal = ubP3[CHUNK_LEN];
+        auto ubImag = ubReal[CHUNK_LEN];
+        auto ubOut = ubImag[CHUNK_LEN];
+        auto ubOffset = resource.ubBuf.template GetBufferByByte<uint32_t>(CHUNK_LEN * 7 * sizeof(ElementC));
+
+        // Byte offsets of the interleave relative to a row of ubReal: even j reads Cr[j / 2], odd j reads Ci[j / 2]
+        for (uint32_t colIdx = 0; colIdx < TILE_N; ++colIdx) {
+            ubOffset.SetValue(colIdx * 2, colIdx * sizeof(ElementC));
+            ubOffset.SetValue(colIdx * 2 + 1, (CHUNK_LEN + colIdx) * sizeof(ElementC));
+        }
+        AscendC::SetFlag<AscendC::HardEvent::S_V>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::S_V>(EVENT_ID0);
+
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC*>(params.ptrC));
+        AscendC::GlobalTensor<ElementC> gmProduct;
+        gmProduct.SetGlobalBuffer(
+            reinterpret_cast<__gm__ ElementC*>(params.ptrWorkspaceC) +
+            aicoreIdx * PRODUCT_TILE_LEN * PRODUCT_NUM * STAGES);
+        AscendC::DataCopyPadExtParams<ElementC> padParams(false, 0, 0, 0);
+
+        BlockScheduler matmulBlockScheduler(params.problemShape, MakeCoord(L1TileShape::M, L1TileShape::N));
+        uint32_t coreLoops = matmulBlockScheduler.GetCoreLoops();
+        uint32_t stageIdx = 0;
+        for (uint32_t loopIdx = aicoreIdx; loopIdx < coreLoops; loopIdx += aicoreNum) {
+            GemmCoord blockCoord = matmulBlockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = matmulBlockScheduler.GetActualBlockShape(blockCoord);
+            uint32_t tileN = actualBlockShape.n();
+            uint32_t tileNRound = RoundUp(tileN, ELE_NUM_PER_BLK_C);
+            uint32_t rowsPerSubBlock = CeilDiv(actualBlockShape.m(), AscendC::GetSubBlockNum());
+            uint32_t rowStart = Min(actualBlockShape.m(), AscendC::GetSubBlockIdx() * rowsPerSubBlock);
+            uint32_t rowEnd = Min(actualBlockShape.m(), rowStart + rowsPerSubBlock);
+            auto gmStageProduct = gmProduct[stageIdx * PRODUCT_TILE_LEN * PRODUCT_NUM];
+
+            Arch::CrossCoreWaitFlag(flagProductReady[stageIdx]);
+            for (uint32_t rowIdx = rowStart; rowIdx < rowEnd; rowIdx += RECOMBINE_ROWS) {
+                uint32_t rows = Min(RECOMBINE_ROWS, rowEnd - rowIdx);
+                uint32_t chunkLen = rows * TILE_N;
+
+                AscendC::DataCopyExtParams copyInParams(
+                    rows, tileN * sizeof(ElementC), (TILE_N - tileN) * sizeof(ElementC),
+                    (TILE_N - tileNRound) / ELE_NUM_PER_BLK_C, 0);
+                auto gmChunkProduct = gmStageProduct[rowIdx * TILE_N];
+                AscendC::DataCopyPad(ubP1, gmChunkProduct, copyInParams, padParams);
+                AscendC::DataCopyPad(ubP2, gmChunkProduct[PRODUCT_TILE_LEN], copyInParams, padParams);
+                AscendC::DataCopyPad(ubP3, gmChunkProduct[PRODUCT_TILE_LEN * 2], copyInParams, padParams);
+                AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+
+                AscendC::Sub(ubReal, ubP1, ubP2, chunkLen);
+                AscendC::Sub(ubImag, ubP3, ubP1, chunkLen);
+                AscendC::PipeBarrier<PIPE_V>();
+                AscendC::Sub(ubImag, ubImag, ubP2, chunkLen);
+                AscendC::PipeBarrier<PIPE_V>();
+                for (uint32_t chunkRowIdx = 0; chunkRowIdx < rows; ++chunkRowIdx) {
+                    AscendC::Gather(
+                        ubOut[chunkRowIdx * TILE_N * 2], ubReal[chunkRowIdx * TILE_N], ubOffset, 0, tileN * 2);
+                }
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+
+                uint32_t rowOffset = blockCoord.m() * L1TileShape::M + rowIdx;
+                uint32_t colOffset = blockCoord.n() * L1TileShape::N;
+                uint32_t outSrcStride = (TILE_N * 2 - RoundUp(tileN * 2, ELE_NUM_PER_BLK_C)) / ELE_NUM_PER_BLK_C;
+                AscendC::DataCopyExtParams copyOutParams(
+                    rows, tileN * 2 * sizeof(ElementC), outSrcStride, (n - tileN) * 2 * sizeof(ElementC), 0);
+                AscendC::DataCopyPad(
+                    gmC[(static_cast<int64_t>(rowOffset) * n + colOffset) * 2], ubOut, copyOutParams);
+                AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+                AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+            }
+            Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagProductFree[stageIdx]);
+            stageIdx = (stageIdx + 1 < STAGES) ? (stageIdx + 1) : 0;
+        }
+    }
+
+    Arch::Resource<ArchTag> resource;
+    Arch::CrossCoreFlag flagOperandsReady{FLAG_OPERANDS_READY};
+    Arch::CrossCoreFlag flagProductReady[STAGES];
+    Arch::CrossCoreFlag flagProductFree[STAGES];
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_INTERLEAVED_COMPLEX_GEMM_HPP
@@ -0,0 +1,385 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_LORA_MATMUL_HPP
+#define CATLASS_GEMM_KERNEL_LORA_MATMUL_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/matrix_coord.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// Segmented LoRA matmul, C = A * B + s_g * (A * LoraDown_g) * LoraUp_g, where the rows of A are split into
+/// adapter segments by a cumulative group list, like the slice-M grouped matmul. Rows after the last segment
+/// only get the base product.
+///
+/// Every adapter has a LoraDown of k x rank, a LoraUp of rank x n and a float scale s_g, stored back to back in
+/// the layout of B. The kernel runs in two phases:
+/// - The AIC computes T = A * LoraDown_g for every m tile of every segment into an m x rank workspace, and the
+///   AIV scales each tile of T by s_g in place.
+/// - For every output tile the AIC accumulates T * LoraUp_g into the same L0C as A * B, as one extra k tile,
+///   and stores C once.
+template <class BlockMmad_, class BlockScheduler_, class ElementGroupList_>
+class LoraMatmul {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using ElementA = typename BlockMmad::ElementA;
+    using LayoutA = typename BlockMmad::LayoutA;
+    using ElementB = typename BlockMmad::ElementB;
+    using LayoutB = typename BlockMmad::LayoutB;
+    using ElementC = typename BlockMmad::ElementC;
+    using LayoutC = typename BlockMmad::LayoutC;
+    using ElementScale = float;
+
+    using BlockScheduler = BlockScheduler_;
+    using ElementGroupList = ElementGroupList_;
+
+    // T is written as C by the first phase and read as A by the second one
+    static_assert(std::is_same_v<ElementA, ElementC>, "LoraMatmul requires the same element type for A and C");
+    static_assert(std::is_same_v<LayoutA, layout::RowMajor>, "LoraMatmul only supports a RowMajor A");
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        uint32_t problemCount;
+        uint32_t rank;
+        __gm__ ElementGroupList* ptrGroupList;
+        __gm__ ElementA* ptrA;
+        LayoutA layoutA;
+        __gm__ ElementB* ptrB;
+        LayoutB layoutB;
+        __gm__ ElementB* ptrLoraDown;
+        LayoutB layoutLoraDown;
+        __gm__ ElementB* ptrLoraUp;
+        LayoutB layoutLoraUp;
+        __gm__ ElementScale* ptrLoraScale;
+        __gm__ ElementC* ptrC;
+        LayoutC layoutC;
+        __gm__ ElementA* ptrWorkspace;
+        LayoutA layoutWorkspace;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GemmCoord const& problemShape_, uint32_t problemCount_, uint32_t rank_, GM_ADDR ptrGroupList_,
+            GM_ADDR ptrA_, LayoutA const& layoutA_, GM_ADDR ptrB_, LayoutB const& layoutB_, GM_ADDR ptrLoraDown_,
+            LayoutB const& layoutLoraDown_, GM_ADDR ptrLoraUp_, LayoutB const& layoutLoraUp_, GM_ADDR ptrLoraScale_,
+            GM_ADDR ptrC_, LayoutC const& layoutC_, GM_ADDR ptrWorkspace_, LayoutA const& layoutWorkspace_)
+            : problemShape(problemShape_),
+              problemCount(problemCount_),
+              rank(rank_),
+              ptrGroupList(reinterpret_cast<__gm__ ElementGroupList*>(ptrGroupList_)),
+              ptrA(reinterpret_cast<__gm__ ElementA*>(ptrA_)),
+              layoutA(layoutA_),
+              ptrB(reinterpret_cast<__gm__ ElementB*>(ptrB_)),
+              layoutB(layoutB_),
+              ptrLoraDown(reinterpret_cast<__gm__ ElementB*>(ptrLoraDown_)),
+              layoutLoraDown(layoutLoraDown_),
+              ptrLoraUp(reinterpret_cast<__gm__ ElementB*>(ptrLoraUp_)),
+              layoutLoraUp(layoutLoraUp_),
+              ptrLoraScale(reinterpret_cast<__gm__ ElementScale*>(ptrLoraScale_)),
+              ptrC(reinterpret_cast<__gm__ ElementC*>(ptrC_)),
+              layoutC(layoutC_),
+              ptrWorkspace(reinterpret_cast<__gm__ ElementA*>(ptrWorkspace_)),
+              layoutWorkspace(layoutWorkspace_)
+        {}
+    };
+
+    struct Arguments {
+        GemmCoord problemShape;
+        uint32_t problemCount; ///< Number of adapters
+        uint32_t rank;         ///< Shared LoRA rank, adapters of a lower rank are zero padded
+        uint8_t* ptrGroupList; ///< Cumulative row count of the adapter segments
+        uint8_t* ptrA;
+        uint8_t* ptrB;
+        uint8_t* ptrLoraDown;
+        uint8_t* ptrLoraUp;
+        uint8_t* ptrLoraScale;
+        uint8_t* ptrC;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        // The low-rank product takes one k tile of L1 in the second phase and one n tile in the first
+        return (args.rank > 0) && (args.rank <= L1TileShape::K) && (args.rank <= L1TileShape::N);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        return static_cast<size_t>(args.problemShape.m()) * args.rank * sizeof(ElementA);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        uint32_t m = args.problemShape.m();
+        uint32_t n = args.problemShape.n();
+        uint32_t k = args.problemShape.k();
+        LayoutA layoutA = LayoutA::template MakeLayout<ElementA>(m, k);
+        LayoutB layoutB = LayoutB::template MakeLayout<ElementB>(k, n);
+        LayoutB layoutLoraDown = LayoutB::template MakeLayout<ElementB>(k, args.rank);
+        LayoutB layoutLoraUp = LayoutB::template MakeLayout<ElementB>(args.rank, n);
+        LayoutC layoutC = LayoutC::template MakeLayout<ElementC>(m, n);
+        LayoutA layoutWorkspace = LayoutA::template MakeLayout<ElementA>(m, args.rank);
+        Params params{
+            args.problemShape, args.problemCount, args.rank,       args.ptrGroupList, args.ptrA,
+            layoutA,           args.ptrB,         layoutB,         args.ptrLoraDown,  layoutLoraDown,
+            args.ptrLoraUp,    layoutLoraUp,      args.ptrLoraScale, args.ptrC,       layoutC,
+            workspace,         layoutWorkspace};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    LoraMatmul()
+    {
+        flagDownReady = Arch::CrossCoreFlag(0);
+        flagDownScaled = Arch::CrossCoreFlag(1);
+    }
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        BlockMmad blockMmad(resource);
+
+        AscendC::GlobalTensor<ElementGroupList> groupList;
+        groupList.SetGlobalBuffer(params.ptrGroupList);
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer(params.ptrA);
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer(params.ptrB);
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(params.ptrC);
+        AscendC::GlobalTensor<ElementA> gmWorkspace;
+        gmWorkspace.SetGlobalBuffer(params.ptrWorkspace);
+
+        RunLoraDown(params, blockMmad, groupList, gmA, gmWorkspace);
+        Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(flagDownReady);
+        Arch::CrossCoreWaitFlag(flagDownScaled);
+
+        // Every tile of T has to be scaled before any AIC reads it
+        AscendC::PipeBarrier<PIPE_ALL>();
+        Arch::CrossCoreBarrier<0x0, PIPE_FIX>();
+
+        uint32_t coreIdx = AscendC::GetBlockIdx();
+        uint32_t coreNum = AscendC::GetBlockNum();
+        uint32_t m = params.problemShape.m();
+        uint32_t n = params.problemShape.n();
+        uint32_t k = params.problemShape.k();
+        BlockScheduler blockScheduler;
+
+        uint32_t startCoreIdx = 0;
+        uint32_t groupRowStart = 0;
+        // The segment after the last adapter holds the rows without LoRA
+        for (uint32_t groupIdx = 0; groupIdx <= params.problemCount; ++groupIdx) {
+            bool hasLora = (groupIdx < params.problemCount);
+            uint32_t currentM = hasLora ? GetGroupM(groupList, groupIdx) : (m - groupRowStart);
+            if (currentM == 0) {
+                continue;
+            }
+            GemmCoord inGroupProblemShape{currentM, n, k};
+
+            LayoutA layoutA = params.layoutA.GetTileLayout(inGroupProblemShape.GetCoordMK());
+            LayoutB layoutB = params.layoutB;
+            LayoutA layoutT = params.layoutWorkspace.GetTileLayout(MakeCoord(currentM, params.rank));
+            LayoutB layoutLoraUp = params.layoutLoraUp;
+            LayoutC layoutC = params.layoutC.GetTileLayout(inGroupProblemShape.GetCoordMN());
+            int64_t gmGroupOffsetA = params.layoutA.GetOffset(MatrixCoord{groupRowStart, 0});
+            int64_t gmGroupOffsetT = params.layoutWorkspace.GetOffset(MatrixCoord{groupRowStart, 0});
+            int64_t gmGroupOffsetC = params.layoutC.GetOffset(MatrixCoord{groupRowStart, 0});
+
+            AscendC::GlobalTensor<ElementB> gmLoraUp;
+            if (hasLora) {
+                gmLoraUp.SetGlobalBuffer(params.ptrLoraUp + static_cast<int64_t>(groupIdx) * params.rank * n);
+            }
+
+            blockScheduler.Update(inGroupProblemShape, MakeCoord(L1TileShape::M, L1TileShape::N));
+            uint32_t coreLoops = blockScheduler.GetCoreLoops();
+
+            // Determine the starting loopIdx of the current core under the current groupIdx
+            uint32_t startLoopIdx = ((coreIdx < startCoreIdx) ? (coreIdx + coreNum) : coreIdx) - startCoreIdx;
+            for (uint32_t loopIdx = startLoopIdx; loopIdx < coreLoops; loopIdx += coreNum) {
+                GemmCoord blockCoord = blockScheduler.GetBlockCoord(loopIdx);
+                GemmCoord actualBlockShape = blockScheduler.GetActualBlockShape(blockCoord);
+
+                MatrixCoord offsetA{blockCoord.m() * L1TileShape::M, 0};
+                MatrixCoord offsetB{0, blockCoord.n() * L1TileShape::N};
+                MatrixCoord offsetC{blockCoord.m() * L1TileShape::M, blockCoord.n() * L1TileShape::N};
+                int64_t gmOffsetA = gmGroupOffsetA + layoutA.GetOffset(offsetA);
+                int64_t gmOffsetB = layoutB.GetOffset(offsetB);
+                int64_t gmOffsetC = gmGroupOffsetC + layoutC.GetOffset(offsetC);
+
+                if (hasLora) {
+                    int64_t gmOffsetT = gmGroupOffsetT + layoutT.GetOffset(offsetA);
+                    int64_t gmOffsetLoraUp = layoutLoraUp.GetOffset(offsetB);
+                    blockMmad(
+                        gmA[gmOffsetA], layoutA, gmB[gmOffsetB], layoutB, gmWorkspace[gmOffsetT], layoutT,
+                        gmLoraUp[gmOffsetLoraUp], layoutLoraUp, gmC[gmOffsetC], layoutC, actualBlockShape,
+                        params.rank);
+                } else {
+                    blockMmad(
+                        gmA[gmOffsetA], layoutA, gmB[gmOffsetB], layoutB, gmC[gmOffsetC], layoutC, actualBlockShape);
+                }
+            }
+
+            groupRowStart += currentM;
+            startCoreIdx = (startCoreIdx + coreLoops) % coreNum;
+        }
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        AscendC::GlobalTensor<ElementGroupList> groupList;
+        groupList.SetGlobalBuffer(params.ptrGroupList);
+        AscendC::GlobalTensor<ElementScale> gmLoraScale;
+        gmLoraScale.SetGlobalBuffer(params.ptrLoraScale);
+        AscendC::GlobalTensor<ElementA> gmWorkspace;
+        gmWorkspace.SetGlobalBuffer(params.ptrWorkspace);
+
+        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t coreNum = AscendC::GetBlockNum();
+        uint32_t subBlockIdx = AscendC::GetSubBlockIdx();
+        uint32_t subBlockNum = AscendC::GetSubBlockNum();
+
+        Arch::CrossCoreWaitFlag(flagDownReady);
+
+        // Scale the tiles of T that the AIC of this core produced, the rows split over the sub blocks
+        uint32_t startCoreIdx = 0;
+        uint32_t groupRowStart = 0;
+        for (uint32_t groupIdx = 0; groupIdx < params.problemCount; ++groupIdx) {
+            uint32_t currentM = GetGroupM(groupList, groupIdx);
+            uint32_t mLoops = CeilDiv(currentM, L1TileShape::M);
+            ElementScale scale = gmLoraScale.GetValue(groupIdx);
+
+            uint32_t startLoopIdx = ((coreIdx < startCoreIdx) ? (coreIdx + coreNum) : coreIdx) - startCoreIdx;
+            for (uint32_t loopIdx = startLoopIdx; loopIdx < mLoops; loopIdx += coreNum) {
+                uint32_t tileRows = Min(L1TileShape::M, currentM - loopIdx * L1TileShape::M);
+                uint32_t subRows = CeilDiv(tileRows, subBlockNum);
+                uint32_t subRowStart = subBlockIdx * subRows;
+                if (subRowStart >= tileRows) {
+                    continue;
+                }
+                uint32_t actualSubRows = Min(subRows, tileRows - subRowStart);
+                uint32_t rowOffset = groupRowStart + loopIdx * L1TileShape::M + subRowStart;
+                int64_t gmOffsetT = params.layoutWorkspace.GetOffset(MatrixCoord{rowOffset, 0});
+                ScaleInPlace(gmWorkspace[gmOffsetT], actualSubRows * params.rank, scale);
+            }
+
+            groupRowStart += currentM;
+            startCoreIdx = (startCoreIdx + mLoops) % coreNum;
+        }
+
+        Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagDownScaled);
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+private:
+    static constexpr uint32_t SCALE_TILE_LEN = 8192;
+
+    CATLASS_DEVICE
+    static uint32_t GetGroupM(AscendC::GlobalTensor<ElementGroupList> const& groupList, uint32_t groupIdx)
+    {
+#ifdef CATLASS_EXPERIMENTAL_GROUPLIST_SEGMENTED
+        return groupList.GetValue(groupIdx);
+#else
+        return (groupIdx == 0) ? groupList.GetValue(groupIdx) :
+                                 (groupList.GetValue(groupIdx) - groupList.GetValue(groupIdx - 1));
+#endif
+    }
+
+    /// T = A * LoraDown_g for every m tile of every adapter segment, the tiles distributed like the slice-M
+    /// grouped matmul so that the AIV of each core knows which tiles to scale.
+    CATLASS_DEVICE
+    void RunLoraDown(
+        Params const& params, BlockMmad& blockMmad, AscendC::GlobalTensor<ElementGroupList> const& groupList,
+        AscendC::GlobalTensor<ElementA> const& gmA, AscendC::GlobalTensor<ElementC> const& gmWorkspace)
+    {
+        uint32_t coreIdx = AscendC::GetBlockIdx();
+        uint32_t coreNum = AscendC::GetBlockNum();
+        uint32_t k = params.problemShape.k();
+
+        uint32_t startCoreIdx = 0;
+        uint32_t groupRowStart = 0;
+        for (uint32_t groupIdx = 0; groupIdx < params.problemCount; ++groupIdx) {
+            uint32_t currentM = GetGroupM(groupList, groupIdx);
+            uint32_t mLoops = CeilDiv(currentM, L1TileShape::M);
+
+            AscendC::GlobalTensor<ElementB> gmLoraDown;
+            gmLoraDown.SetGlobalBuffer(params.ptrLoraDown + static_cast<int64_t>(groupIdx) * k * params.rank);
+
+            uint32_t startLoopIdx = ((coreIdx < startCoreIdx) ? (coreIdx + coreNum) : coreIdx) - startCoreIdx;
+            for (uint32_t loopIdx = startLoopIdx; loopIdx < mLoops; loopIdx += coreNum) {
+                uint32_t tileRows = Min(L1TileShape::M, currentM - loopIdx * L1TileShape::M);
+                MatrixCoord offsetTile{groupRowStart + loopIdx * L1TileShape::M, 0};
+                GemmCoord actualBlockShape{tileRows, params.rank, k};
+                blockMmad(
+                    gmA[params.layoutA.GetOffset(offsetTile)], params.layoutA, gmLoraDown, params.layoutLoraDown,
+                    gmWorkspace[params.layoutWorkspace.GetOffset(offsetTile)], params.layoutWorkspace,
+                    actualBlockShape);
+            }
+
+            groupRowStart += currentM;
+            startCoreIdx = (startCoreIdx + mLoops) % coreNum;
+        }
+    }
+
+    /// gm[0, len) *= scale, computed in float.
+    CATLASS_DEVICE
+    void ScaleInPlace(AscendC::GlobalTensor<ElementA> const& gm, uint32_t len, ElementScale scale)
+    {
+        auto ubIn = resource.ubBuf.template GetBufferByByte<ElementA>(0);
+        auto ubFloat = resource.ubBuf.template GetBufferByByte<float>(SCALE_TILE_LEN * sizeof(ElementA));
+        AscendC::DataCopyPadExtParams<ElementA> padParams(false, 0, 0, 0);
+
+        for (uint32_t offset = 0; offset < len; offset += SCALE_TILE_LEN) {
+            uint32_t tileLen = Min(SCALE_TILE_LEN, len - offset);
+            AscendC::DataCopyExtParams copyParams(1, tileLen * sizeof(ElementA), 0, 0, 0);
+            AscendC::DataCopyPad(ubIn, gm[offset], copyParams, padParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_ID0);
+            AscendC::Cast(ubFloat, ubIn, AscendC::RoundMode::CAST_NONE, tileLen);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Muls(ubFloat, ubFloat, scale, tileLen);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Cast(ubIn, ubFloat, AscendC::RoundMode::CAST_RINT, tileLen);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+            AscendC::DataCopyPad(gm[offset], ubIn, copyParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(EVENT_ID0);
+        }
+    }
+
+    Arch::CrossCoreFlag flagDownReady;
+    Arch::CrossCoreFlag flagDownScaled;
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_LORA_MATMUL_HPP
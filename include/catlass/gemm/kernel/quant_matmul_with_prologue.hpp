@@ -0,0 +1,338 @@
+/**
+ * Copyright (c) 2025-2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_QUANT_MATMUL_WITH_PROLOGUE_HPP
+#define CATLASS_GEMM_KERNEL_QUANT_MATMUL_WITH_PROLOGUE_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/detail/callback.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// Quant matmul with dynamic per-token quantization of A.
+/// AIV: PrologueA first computes the per-token scale of every M block once, then for each block quantizes the
+///      fp16/bf16 A block into the per-core workspace with the stored scale, and the per-token dequant epilogue
+///      consumes the int32 result of the same block.
+/// AIC: int8 x int8 -> int32 from the quantized A slots.
+template <class BlockMmad_, class BlockEpilogue_, class BlockScheduler_>
+class QuantMatmulWithPrologue {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using PrologueA = typename BlockMmad::PrologueA;
+    using ElementPrologueA = typename PrologueA::ElementSrc;
+    using LayoutPrologueA = typename PrologueA::LayoutSrc;
+    using ElementA = typename BlockMmad::ElementA;
+    using LayoutA = typename BlockMmad::LayoutA;
+    using ElementB = typename BlockMmad::ElementB;
+    using LayoutB = typename BlockMmad::LayoutB;
+    using ElementC = typename BlockMmad::ElementC;
+    using LayoutC = typename BlockMmad::LayoutC;
+
+    using BlockEpilogue = BlockEpilogue_;
+    using ElementScale = typename BlockEpilogue::ElementScale;
+    using LayoutScale = typename BlockEpilogue::LayoutScale;
+    using ElementPerTokenScale = typename BlockEpilogue::ElementPerTokenScale;
+    using LayoutPerTokenScale = typename BlockEpilogue::LayoutPerTokenScale;
+    using ElementD = typename BlockEpilogue::ElementD;
+    using LayoutD = typename BlockEpilogue::LayoutD;
+    using EpilogueParams = typename BlockEpilogue::Params;
+
+    using BlockScheduler = BlockScheduler_;
+
+    static_assert(
+        std::is_same_v<typename PrologueA::ElementScale, ElementPerTokenScale>,
+        "The scale written by PrologueA must be the per-token scale read by the epilogue");
+    static_assert(L1TileShape::M <= PrologueA::MAX_ROWS, "L1TileShape::M exceeds the rows supported by PrologueA");
+
+    // Each quantized int8 K tile must fill whole 32-byte blocks of its workspace slot, so the AIC never reads
+    // the tail left in the slot by an earlier tile. CanImplement applies the same alignment to k.
+    static constexpr uint32_t K_ALIGN = BYTE_PER_BLK / sizeof(ElementA);
+    static_assert(L1TileShape::K % K_ALIGN == 0, "L1TileShape::K must be 32-byte aligned for ElementA");
+    // PrologueA quantizes whole rows of a K tile in UB
+    static_assert(L1TileShape::K <= PrologueA::COMPUTE_LEN, "L1TileShape::K exceeds the UB row length of PrologueA");
+
+    friend class AicFinishSync;
+    friend class AivWaitSync;
+
+    struct AicFinishSync {
+        using MatmulKernel = QuantMatmulWithPrologue<BlockMmad, BlockEpilogue, BlockScheduler>;
+
+        CATLASS_DEVICE
+        void operator()() const
+        {
+            Arch::CrossCoreSetFlagWithReverse<0x2, PIPE_FIX>(ptr->flagAicFinishStore);
+        }
+
+        MatmulKernel* ptr;
+    };
+
+    struct AivWaitSync {
+        using MatmulKernel = QuantMatmulWithPrologue<BlockMmad, BlockEpilogue, BlockScheduler>;
+
+        CATLASS_DEVICE
+        void operator()() const
+        {
+            Arch::CrossCoreWaitFlagWithReverse<0x2, PIPE_MTE3>(ptr->flagAicFinishStore);
+        }
+
+        MatmulKernel* ptr;
+    };
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        __gm__ ElementPrologueA* ptrA;
+        LayoutPrologueA layoutA;
+        __gm__ ElementB* ptrB;
+        LayoutB layoutB;
+        __gm__ ElementScale* ptrScale;
+        LayoutScale layoutScale;
+        __gm__ ElementPerTokenScale* ptrPerTokenScale;
+        LayoutPerTokenScale layoutPerTokenScale;
+        __gm__ ElementD* ptrD;
+        LayoutD layoutD;
+        GM_ADDR ptrWorkspaceA;
+        GM_ADDR ptrWorkspaceC;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GemmCoord problemShape_, GM_ADDR ptrA_, LayoutPrologueA layoutA_, GM_ADDR ptrB_, LayoutB layoutB_,
+            GM_ADDR ptrScale_, LayoutScale layoutScale_, GM_ADDR ptrPerTokenScale_,
+            LayoutPerTokenScale layoutPerTokenScale_, GM_ADDR ptrD_, LayoutD layoutD_, GM_ADDR ptrWorkspaceA_,
+            GM_ADDR ptrWorkspaceC_)
+            : problemShape(problemShape_),
+              ptrA(reinterpret_cast<__gm__ ElementPrologueA*>(ptrA_)),
+              layoutA(layoutA_),
+              ptrB(reinterpret_cast<__gm__ ElementB*>(ptrB_)),
+              layoutB(layoutB_),
+              ptrScale(reinterpret_cast<__gm__ ElementScale*>(ptrScale_)),
+              layoutScale(layoutScale_),
+              ptrPerTokenScale(reinterpret_cast<__gm__ ElementPerTokenScale*>(ptrPerTokenScale_)),
+              layoutPerTokenScale(layoutPerTokenScale_),
+              ptrD(reinterpret_cast<__gm__ ElementD*>(ptrD_)),
+              layoutD(layoutD_),
+              ptrWorkspaceA(ptrWorkspaceA_),
+              ptrWorkspaceC(ptrWorkspaceC_)
+        {}
+    };
+
+    struct Arguments {
+        GemmCoord problemShape;
+        uint32_t aicCoreNum;
+        uint8_t* ptrA;
+        uint8_t* ptrB;
+        uint8_t* ptrScale;
+        uint8_t* ptrPerTokenScale; // Output, the per-token scale computed by PrologueA
+        uint8_t* ptrD;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        uint32_t m = args.problemShape.m();
+        uint32_t n = args.problemShape.n();
+        uint32_t k = args.problemShape.k();
+        if (m == 0 || n == 0 || k == 0 || args.aicCoreNum == 0) {
+            return false;
+        }
+        if (k % K_ALIGN != 0) {
+            return false;
+        }
+        return true;
+    }
+
+    static size_t GetWorkspaceSizeA(const Arguments& args)
+    {
+        return static_cast<size_t>(BlockMmad::STAGES) * L1TileShape::M * L1TileShape::K * sizeof(ElementA) *
+               args.aicCoreNum;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        size_t sizeWorkspaceC =
+            static_cast<size_t>(args.problemShape.m()) * args.problemShape.n() * sizeof(ElementC);
+        return GetWorkspaceSizeA(args) + sizeWorkspaceC;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        uint32_t m = args.problemShape.m();
+        uint32_t n = args.problemShape.n();
+        uint32_t k = args.problemShape.k();
+        LayoutPrologueA layoutA = LayoutPrologueA::template MakeLayout<ElementPrologueA>(m, k);
+        LayoutB layoutB = LayoutB::template MakeLayout<ElementB>(k, n);
+        LayoutScale layoutScale{n};
+        LayoutPerTokenScale layoutPerTokenScale{m};
+        LayoutD layoutD = LayoutD::template MakeLayout<ElementD>(m, n);
+        Params params{args.problemShape,
+                      args.ptrA,
+                      layoutA,
+                      args.ptrB,
+                      layoutB,
+                      args.ptrScale,
+                      layoutScale,
+                      args.ptrPerTokenScale,
+                      layoutPerTokenScale,
+                      args.ptrD,
+                      layoutD,
+                      workspace,
+                      workspace + GetWorkspaceSizeA(args)};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    QuantMatmulWithPrologue()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    /// Executes matmul
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        BlockScheduler blockScheduler(params.problemShape, L1TileShape::ToCoordMN());
+        uint32_t coreLoops = blockScheduler.GetCoreLoops();
+
+        BlockMmad blockMmad(resource);
+
+        uint32_t coreIdx = AscendC::GetBlockIdx();
+        uint32_t coreNum = AscendC::GetBlockNum();
+
+        // A is read from the quantized slots of this core
+        LayoutA layoutBlockA{L1TileShape::M, L1TileShape::K};
+        AscendC::GlobalTensor<ElementA> gmBlockA;
+        gmBlockA.SetGlobalBuffer(
+            reinterpret_cast<__gm__ ElementA*>(params.ptrWorkspaceA) +
+            coreIdx * layoutBlockA.Capacity() * BlockMmad::STAGES);
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer(params.ptrB);
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC*>(params.ptrWorkspaceC));
+        layout::RowMajor layoutC(params.problemShape.m(), params.problemShape.n());
+
+        AicFinishSync aicFinishSync{this};
+
+        GemmCoord blockShape = L1TileShape::ToCoord();
+        for (uint32_t loopIdx = coreIdx; loopIdx < coreLoops; loopIdx += coreNum) {
+            // Compute block location
+            GemmCoord blockCoord = blockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = blockScheduler.GetActualBlockShape(blockCoord);
+            GemmCoord offsetCoord = blockCoord * blockShape;
+
+            auto gmBlockB = gmB[params.layoutB.GetOffset(offsetCoord.GetCoordKN())];
+            auto layoutBlockB = params.layoutB.GetTileLayout(actualBlockShape.GetCoordKN());
+            auto gmBlockC = gmC[layoutC.GetOffset(offsetCoord.GetCoordMN())];
+            auto layoutBlockC = layoutC.GetTileLayout(actualBlockShape.GetCoordMN());
+
+            // Compute block-scoped matrix multiply-add
+            blockMmad(gmBlockA, layoutBlockA, gmBlockB, layoutBlockB, gmBlockC, layoutBlockC, actualBlockShape);
+            aicFinishSync();
+        }
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        BlockScheduler blockScheduler(params.problemShape, L1TileShape::ToCoordMN());
+        uint32_t coreLoops = blockScheduler.GetCoreLoops();
+
+        BlockMmad blockMmad(resource);
+        BlockEpilogue blockEpilogue(resource);
+
+        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t coreNum = AscendC::GetBlockNum();
+
+        AscendC::GlobalTensor<ElementPrologueA> gmA;
+        gmA.SetGlobalBuffer(params.ptrA);
+        LayoutA layoutBlockA{L1TileShape::M, L1TileShape::K};
+        AscendC::GlobalTensor<ElementA> gmBlockA;
+        gmBlockA.SetGlobalBuffer(
+            reinterpret_cast<__gm__ ElementA*>(params.ptrWorkspaceA) +
+            coreIdx * layoutBlockA.Capacity() * BlockMmad::STAGES);
+        AscendC::GlobalTensor<ElementPerTokenScale> gmPerTokenScale;
+        gmPerTokenScale.SetGlobalBuffer(params.ptrPerTokenScale);
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC*>(params.ptrWorkspaceC));
+        layout::RowMajor layoutC(params.problemShape.m(), params.problemShape.n());
+
+        AivWaitSync aicFinishSync{this};
+
+        // The per-token scales need a pass over the whole K range, do it once per M block instead of once per
+        // block so that the N blocks of the same rows only reload them
+        uint32_t mLoops = CeilDiv(params.problemShape.m(), L1TileShape::M);
+        for (uint32_t mLoopIdx = coreIdx; mLoopIdx < mLoops; mLoopIdx += coreNum) {
+            uint32_t mOffset = mLoopIdx * L1TileShape::M;
+            uint32_t mActual = Min(params.problemShape.m() - mOffset, L1TileShape::M);
+            auto gmRowsA = gmA[params.layoutA.GetOffset(MatrixCoord{mOffset, 0})];
+            auto layoutRowsA = params.layoutA.GetTileLayout(MatrixCoord{mActual, params.problemShape.k()});
+            blockMmad.PrologueScale(gmRowsA, layoutRowsA, gmPerTokenScale[mOffset]);
+        }
+        // All the scales are stored before any block reloads them
+        Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+
+        LayoutPerTokenScale layoutPerTokenScale =
+            params.layoutPerTokenScale.GetTileLayout(params.problemShape.template GetCoordByAxis<0>());
+        LayoutD layoutD = params.layoutD.GetTileLayout(params.problemShape.GetCoordMN());
+        EpilogueParams epilogueParams{params.ptrScale,     params.layoutScale, params.ptrPerTokenScale,
+                                      layoutPerTokenScale, params.ptrD,        layoutD};
+        blockEpilogue.UpdateParams(epilogueParams);
+
+        GemmCoord blockShape = L1TileShape::ToCoord();
+        for (uint32_t loopIdx = coreIdx; loopIdx < coreLoops; loopIdx += coreNum) {
+            GemmCoord blockCoord = blockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = blockScheduler.GetActualBlockShape(blockCoord);
+            GemmCoord offsetCoord = blockCoord * blockShape;
+
+            auto gmBlockPrologueA = gmA[params.layoutA.GetOffset(offsetCoord.GetCoordMK())];
+            auto layoutBlockPrologueA = params.layoutA.GetTileLayout(actualBlockShape.GetCoordMK());
+
+            // Quantize the block rows with the scales of the M block stored before the barrier
+            blockMmad.Prologue(
+                gmBlockPrologueA, layoutBlockPrologueA, gmBlockA, layoutBlockA, gmPerTokenScale[offsetCoord.m()],
+                actualBlockShape);
+            // Prologue and epilogue share the UB
+            AscendC::PipeBarrier<PIPE_ALL>();
+
+            auto gmBlockC = gmC[layoutC.GetOffset(offsetCoord.GetCoordMN())];
+            auto layoutBlockC = layoutC.GetTileLayout(actualBlockShape.GetCoordMN());
+            blockEpilogue(
+                blockShape, blockCoord, actualBlockShape, gmBlockC, layoutBlockC, MakeCallback(&aicFinishSync));
+            AscendC::PipeBarrier<PIPE_ALL>();
+        }
+    }
+
+private:
+    // The flags before are taken by the prologue of BlockMmad
+    static constexpr Arch::FlagID FLAG_AIC_FINISH_STORE = 2 * BlockMmad::STAGES;
+    static constexpr Arch::FlagID RV_FLAG_AIC_FINISH_STORE = FLAG_AIC_FINISH_STORE + 1;
+    Arch::CrossCoreFlagWithReverse<> flagAicFinishStore{FLAG_AIC_FINISH_STORE, RV_FLAG_AIC_FINISH_STORE};
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_QUANT_MATMUL_WITH_PROLOGUE_HPP
@@ -24,6 +24,37 @@
 
 namespace Catlass::Gemm::Kernel {
 
+/// Layout of the 2:4 sparse index of a transposed n x k weight in GM, n padded to 16 and k / 8 padded to 8,
+/// as produced by Gemm::Device::SparseCompressor.
+struct SparseIndexLayoutHelper {
+    static constexpr uint32_t INDEX_MATRIX_OFFSET = 8; // One index byte covers 8 elements of k
+
+    using Layout = tla::Layout<
+        tla::Shape<tla::Shape<tla::Int<8>, int64_t>, tla::Shape<tla::Int<16>, int64_t>>, // 8 = 32 / (sizeof(uint8) * 4)
+        tla::Stride<tla::Stride<tla::Int<1>, int64_t>, tla::Stride<tla::Int<8>, tla::_128>> // 128 = 16 * 8
+        >;
+
+    CATLASS_HOST_DEVICE
+    static Layout MakeLayout(int64_t n, int64_t k)
+    {
+        return tla::MakeLayout(
+            tla::MakeShape(
+                tla::MakeShape(
+                    tla::Int<INDEX_MATRIX_OFFSET>{}, CeilDiv<int64_t>(k / INDEX_MATRIX_OFFSET, INDEX_MATRIX_OFFSET)),
+                tla::MakeShape(tla::Int<C0_NUM_PER_FRACTAL>{}, CeilDiv<int64_t>(n, C0_NUM_PER_FRACTAL))),
+            tla::MakeStride(
+                tla::MakeStride(tla::Int<1>{}, RoundUp<int64_t>(n, C0_NUM_PER_FRACTAL) * INDEX_MATRIX_OFFSET),
+                tla::MakeStride(
+                    tla::Int<INDEX_MATRIX_OFFSET>{}, tla::Int<INDEX_MATRIX_OFFSET * C0_NUM_PER_FRACTAL>{})));
+    }
+
+    CATLASS_HOST_DEVICE
+    static int64_t GetLen(int64_t n, int64_t k)
+    {
+        return RoundUp<int64_t>(n, C0_NUM_PER_FRACTAL) * RoundUp<int64_t>(k / INDEX_MATRIX_OFFSET, INDEX_MATRIX_OFFSET);
+    }
+};
+
 template <class ProblemShape_, class BlockMmad_, class BlockEpilogue_, class BlockScheduler_>
 class KernelSparseMatmul {
 public:
@@ -54,7 +85,7 @@ public:
     static constexpr uint32_t L1_SIZE = BlockMmad::DispatchPolicy::ArchTag::AtlasA2::L1_SIZE;
     static constexpr uint32_t STAGES = 2;
     static constexpr uint32_t DENSE_MATRIX_B_OFFSET = 2;
-    static constexpr uint32_t INDEX_MATRIX_OFFSET = 8;
+    static constexpr uint32_t INDEX_MATRIX_OFFSET = SparseIndexLayoutHelper::INDEX_MATRIX_OFFSET;
     static constexpr uint32_t MATRIX_INNER_DIM_LIMIT_SIZE = 65536;
 
     using LayoutA = typename BlockMmad::LayoutA;
@@ -109,10 +140,7 @@ public:
     using CTlaTensor = tla::Tensor<CGlobalTensorType, LayoutC, tla::Coord<tla::_0, tla::_0>, AscendC::TPosition::GM>;
 
     // NZ layout for index (B transpose)
-    using BIndexLayout = tla::Layout<
-        tla::Shape<tla::Shape<tla::Int<8>, int64_t>, tla::Shape<tla::Int<16>, int64_t>>, // 8 = 32 / (sizeof(uint8) * 4)
-        tla::Stride<tla::Stride<tla::Int<1>, int64_t>, tla::Stride<tla::Int<8>, tla::_128>> // 128 = 16 * 8
-        >;
+    using BIndexLayout = SparseIndexLayoutHelper::Layout;
 
     using IndexGlobalTensorType = AscendC::GlobalTensor<IndexType>;
     using IndexTensor =
@@ -189,15 +217,7 @@ public:
         cGlobal_.SetGlobalBuffer(reinterpret_cast<__gm__ CType*>(blockMmadParams_.cGmAddr), m * n);
         cTlaTensor_ = tla::MakeTensor(cGlobal_, blockMmadParams_.layoutC, Arch::PositionGM{});
 
-        BIndexLayout indexLayout = tla::MakeLayout(
-            tla::MakeShape(
-                tla::MakeShape(
-                    tla::Int<INDEX_MATRIX_OFFSET>{}, CeilDiv<int64_t>(k / INDEX_MATRIX_OFFSET, INDEX_MATRIX_OFFSET)),
-                tla::MakeShape(tla::Int<C0_NUM_PER_FRACTAL>{}, CeilDiv<int64_t>(n, C0_NUM_PER_FRACTAL))),
-            tla::MakeStride(
-                tla::MakeStride(tla::Int<1>{}, RoundUp<int64_t>(n, C0_NUM_PER_FRACTAL) * INDEX_MATRIX_OFFSET),
-                tla::MakeStride(
-                    tla::Int<INDEX_MATRIX_OFFSET>{}, tla::Int<INDEX_MATRIX_OFFSET * C0_NUM_PER_FRACTAL>{})));
+        BIndexLayout indexLayout = SparseIndexLayoutHelper::MakeLayout(n, k);
         indexGlobal_.SetGlobalBuffer(
             reinterpret_cast<__gm__ IndexType*>(blockMmadParams_.indexGmAddr), n * k / INDEX_MATRIX_OFFSET);
         indexTlaTensor_ = tla::MakeTensor(indexGlobal_, indexLayout, Arch::PositionGM{});
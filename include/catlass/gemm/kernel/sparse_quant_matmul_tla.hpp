@@ -0,0 +1,288 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_SPARSE_QUANT_MATMUL_TLA_HPP
+#define CATLASS_GEMM_KERNEL_SPARSE_QUANT_MATMUL_TLA_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/gemm/kernel/sparse_matmul_tla.hpp"
+#include "tla/layout.hpp"
+#include "tla/tensor.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// Per-token dequantized int8 matmul whose transposed weight is 2:4 sparse. The AIC runs the sparse block mmad
+/// on the compressed weight and its index into a multi-stage int32 workspace, the AIV dequantizes every tile with
+/// the per-channel scale and the per-token scale.
+template <class BlockMmad_, class BlockEpilogue_, class BlockScheduler_, uint32_t WORKSPACE_STAGES_>
+class SparseQuantMatmulTla {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1Shape = typename BlockMmad::L1Shape;
+    using ElementA = typename BlockMmad::ElementA;
+    using ElementB = typename BlockMmad::ElementB;
+    using ElementC = typename BlockMmad::ElementC;
+    using ElementIndex = typename BlockMmad::ElementSparseIndex;
+
+    using BlockEpilogue = BlockEpilogue_;
+    using ElementScale = typename BlockEpilogue::ElementScale;
+    using LayoutScale = typename BlockEpilogue::LayoutScale;
+    using ElementPerTokenScale = typename BlockEpilogue::ElementPerTokenScale;
+    using LayoutPerTokenScale = typename BlockEpilogue::LayoutPerTokenScale;
+    using ElementD = typename BlockEpilogue::ElementD;
+    using LayoutD = typename BlockEpilogue::LayoutD;
+    using EpilogueParams = typename BlockEpilogue::Params;
+
+    using BlockScheduler = BlockScheduler_;
+    static constexpr uint32_t WORKSPACE_STAGES = WORKSPACE_STAGES_;
+
+    static constexpr uint32_t L1_M = tla::get<0>(L1Shape{});
+    static constexpr uint32_t L1_N = tla::get<1>(L1Shape{});
+    static constexpr uint32_t L1_K = tla::get<2>(L1Shape{});
+    static constexpr uint32_t DENSE_MATRIX_B_OFFSET = 2;
+    static constexpr uint32_t SPARSE_K_ALIGN = 8;
+    static constexpr uint32_t MATRIX_INNER_DIM_LIMIT_SIZE = 65536;
+
+    static_assert(std::is_same_v<ElementC, int32_t>, "SparseQuantMatmulTla only supports an int32 accumulator");
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        __gm__ ElementA* ptrA;
+        __gm__ ElementB* ptrB;
+        __gm__ ElementIndex* ptrIndex;
+        __gm__ ElementScale* ptrScale;
+        LayoutScale layoutScale;
+        __gm__ ElementPerTokenScale* ptrPerTokenScale;
+        LayoutPerTokenScale layoutPerTokenScale;
+        __gm__ ElementD* ptrD;
+        LayoutD layoutD;
+        GM_ADDR ptrWorkspace;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GemmCoord problemShape_, GM_ADDR ptrA_, GM_ADDR ptrB_, GM_ADDR ptrIndex_, GM_ADDR ptrScale_,
+            LayoutScale layoutScale_, GM_ADDR ptrPerTokenScale_, LayoutPerTokenScale layoutPerTokenScale_,
+            GM_ADDR ptrD_, LayoutD layoutD_, GM_ADDR ptrWorkspace_)
+            : problemShape(problemShape_),
+              ptrA(reinterpret_cast<__gm__ ElementA*>(ptrA_)),
+              ptrB(reinterpret_cast<__gm__ ElementB*>(ptrB_)),
+              ptrIndex(reinterpret_cast<__gm__ ElementIndex*>(ptrIndex_)),
+              ptrScale(reinterpret_cast<__gm__ ElementScale*>(ptrScale_)),
+              layoutScale(layoutScale_),
+              ptrPerTokenScale(reinterpret_cast<__gm__ ElementPerTokenScale*>(ptrPerTokenScale_)),
+              layoutPerTokenScale(layoutPerTokenScale_),
+              ptrD(reinterpret_cast<__gm__ ElementD*>(ptrD_)),
+              layoutD(layoutD_),
+              ptrWorkspace(ptrWorkspace_)
+        {}
+    };
+
+    struct Arguments {
+        GemmCoord problemShape;
+        uint32_t aicCoreNum;
+        uint8_t* ptrA;
+        uint8_t* ptrB;     ///< Compressed values, n x k/2 with k contiguous
+        uint8_t* ptrIndex; ///< Sparse index from Gemm::Device::SparseCompressor
+        uint8_t* ptrScale;
+        uint8_t* ptrPerTokenScale;
+        uint8_t* ptrD;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        return (args.problemShape.k() % SPARSE_K_ALIGN == 0) && (args.problemShape.k() <= MATRIX_INNER_DIM_LIMIT_SIZE);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        size_t lenWorkspace = static_cast<size_t>(L1_M) * L1_N * args.aicCoreNum * WORKSPACE_STAGES;
+        size_t sizeWorkspace = lenWorkspace * sizeof(ElementC);
+        return sizeWorkspace;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        uint32_t m = args.problemShape.m();
+        uint32_t n = args.problemShape.n();
+        LayoutScale layoutScale{n};
+        LayoutPerTokenScale layoutPerTokenScale{m};
+        LayoutD layoutD = LayoutD::template MakeLayout<ElementD>(m, n);
+        Params params{
+            args.problemShape,     args.ptrA,           args.ptrB, args.ptrIndex, args.ptrScale, layoutScale,
+            args.ptrPerTokenScale, layoutPerTokenScale, args.ptrD, layoutD,       workspace};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    SparseQuantMatmulTla()
+    {
+        Arch::FlagID flagId = 0;
+        for (uint32_t stageId = 0; stageId < WORKSPACE_STAGES; ++stageId) {
+            flagAicFinishStoreList[stageId] = Arch::CrossCoreFlag(flagId++);
+            flagAivFinishComputeList[stageId] = Arch::CrossCoreFlag(flagId++);
+        }
+    }
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params);
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {
+        BlockScheduler blockScheduler;
+        blockScheduler.Update(params.problemShape, MakeCoord(L1_M, L1_N));
+        uint32_t coreLoops = blockScheduler.GetCoreLoops();
+
+        BlockMmad blockMmad;
+
+        int64_t k = params.problemShape.k();
+        auto layoutIndex = SparseIndexLayoutHelper::MakeLayout(params.problemShape.n(), k);
+        auto layoutC =
+            tla::MakeLayout<ElementC, layout::RowMajor>(static_cast<int64_t>(L1_M), static_cast<int64_t>(L1_N));
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer(params.ptrA);
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer(params.ptrB);
+        AscendC::GlobalTensor<ElementIndex> gmIndex;
+        gmIndex.SetGlobalBuffer(params.ptrIndex);
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC*>(params.ptrWorkspace));
+
+        uint32_t coreIdx = AscendC::GetBlockIdx();
+        uint32_t coreNum = AscendC::GetBlockNum();
+
+        uint32_t stageId = 0;
+        uint32_t stageUsed = 0;
+
+        for (uint32_t loopIdx = coreIdx; loopIdx < coreLoops; loopIdx += coreNum) {
+            // Compute block location
+            GemmCoord blockCoord = blockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = blockScheduler.GetActualBlockShape(blockCoord);
+
+            // The block mmad is synchronous, so the workspace slot is claimed before it starts
+            if (stageUsed == WORKSPACE_STAGES) {
+                Arch::CrossCoreWaitFlag(flagAivFinishComputeList[stageId]);
+            } else {
+                ++stageUsed;
+            }
+
+            int64_t rowStart = static_cast<int64_t>(blockCoord.m()) * L1_M;
+            int64_t colStart = static_cast<int64_t>(blockCoord.n()) * L1_N;
+            int64_t gmOffsetA = rowStart * k;
+            int64_t gmOffsetB = colStart * (k / DENSE_MATRIX_B_OFFSET);
+            int64_t gmOffsetIndex = layoutIndex(tla::MakeCoord(static_cast<int64_t>(0), colStart));
+            int64_t gmOffsetC = static_cast<int64_t>(stageId * coreNum + coreIdx) * L1_M * L1_N;
+
+            auto tensorA = tla::MakeTensor(
+                gmA[gmOffsetA],
+                tla::MakeLayout<ElementA, layout::RowMajor>(static_cast<int64_t>(actualBlockShape.m()), k),
+                Arch::PositionGM{});
+            auto tensorB = tla::MakeTensor(
+                gmB[gmOffsetB],
+                tla::MakeLayout<ElementB, layout::ColumnMajor>(
+                    k / DENSE_MATRIX_B_OFFSET, static_cast<int64_t>(actualBlockShape.n())),
+                Arch::PositionGM{});
+            auto tensorIndex = tla::MakeTensor(gmIndex[gmOffsetIndex], layoutIndex, Arch::PositionGM{});
+            auto tensorC = tla::MakeTensor(gmC[gmOffsetC], layoutC, Arch::PositionGM{});
+
+            blockMmad(
+                tensorC, tensorA, tensorB, tensorIndex,
+                tla::MakeShape(
+                    static_cast<int64_t>(actualBlockShape.m()), static_cast<int64_t>(actualBlockShape.n()), k,
+                    static_cast<int64_t>(1)));
+            Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(flagAicFinishStoreList[stageId]);
+
+            stageId = (stageId + 1 < WORKSPACE_STAGES) ? (stageId + 1) : 0;
+        }
+
+        while (stageUsed > 0) {
+            uint32_t aivComputeStageId =
+                (stageId >= stageUsed) ? (stageId - stageUsed) : (stageId + WORKSPACE_STAGES - stageUsed);
+            Arch::CrossCoreWaitFlag(flagAivFinishComputeList[aivComputeStageId]);
+            --stageUsed;
+        }
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        BlockScheduler blockScheduler;
+        BlockEpilogue blockEpilogue(resource);
+
+        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t coreNum = AscendC::GetBlockNum();
+
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC*>(params.ptrWorkspace));
+        auto layoutC = layout::RowMajor{L1_M * coreNum * WORKSPACE_STAGES, L1_N};
+
+        uint32_t stageId = 0;
+
+        LayoutScale layoutScale = params.layoutScale;
+        LayoutPerTokenScale layoutPerTokenScale =
+            params.layoutPerTokenScale.GetTileLayout(params.problemShape.template GetCoordByAxis<0>());
+        LayoutD layoutD = params.layoutD.GetTileLayout(params.problemShape.GetCoordMN());
+
+        EpilogueParams epilogueParams{params.ptrScale,     layoutScale, params.ptrPerTokenScale,
+                                      layoutPerTokenScale, params.ptrD, layoutD};
+
+        blockScheduler.Update(params.problemShape, MakeCoord(L1_M, L1_N));
+        blockEpilogue.UpdateParams(epilogueParams);
+        uint32_t coreLoops = blockScheduler.GetCoreLoops();
+
+        GemmCoord blockShapeMNK{L1_M, L1_N, L1_K};
+        for (uint32_t loopIdx = coreIdx; loopIdx < coreLoops; loopIdx += coreNum) {
+            GemmCoord blockCoordMNK = blockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShapeMNK = blockScheduler.GetActualBlockShape(blockCoordMNK);
+
+            MatrixCoord offsetC{(stageId * coreNum + coreIdx) * L1_M, 0};
+            int64_t gmOffsetC = layoutC.GetOffset(offsetC);
+            auto gmBlockC = gmC[gmOffsetC];
+            auto layoutBlockC = layoutC.GetTileLayout(actualBlockShapeMNK.GetCoordMN());
+
+            Arch::CrossCoreWaitFlag(flagAicFinishStoreList[stageId]);
+            blockEpilogue(blockShapeMNK, blockCoordMNK, actualBlockShapeMNK, gmBlockC, layoutBlockC);
+            Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagAivFinishComputeList[stageId]);
+
+            stageId = (stageId + 1 < WORKSPACE_STAGES) ? (stageId + 1) : 0;
+        }
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+private:
+    Arch::CrossCoreFlag flagAicFinishStoreList[WORKSPACE_STAGES];
+    Arch::CrossCoreFlag flagAivFinishComputeList[WORKSPACE_STAGES];
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_SPARSE_QUANT_MATMUL_TLA_HPP
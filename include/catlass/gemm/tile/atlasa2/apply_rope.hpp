@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_ATLASA2_APPLY_ROPE_HPP
+#define CATLASS_GEMM_TILE_ATLASA2_APPLY_ROPE_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+
+namespace Catlass::Gemm::Tile {
+
+/// Applies rotary position embedding (rotate-half form) to one token row of `heads` heads of size headDim:
+///   dst[:half]  = x[:half] * cos[:half] - x[half:] * sin[:half]
+///   dst[half:]  = x[half:] * cos[half:] + x[:half] * sin[half:]
+/// cos/sin are one row [headDim] of the position table, shared by all heads of the token.
+/// Rows are contiguous in both src and dst; the computation is done in float.
+template <
+    class ArchTag, class Element_,
+    // Float elements of the row chunk processed per loop
+    uint32_t COMPUTE_LEN_ = 8192>
+struct TileApplyRope {
+    using Element = Element_;
+
+    static_assert(
+        std::is_same_v<Element, half> || std::is_same_v<Element, bfloat16_t>,
+        "TileApplyRope only supports half or bfloat16_t");
+
+    static constexpr uint32_t COMPUTE_LEN = COMPUTE_LEN_;
+    static constexpr uint32_t MAX_HEAD_DIM = 512;
+    static constexpr uint32_t UB_SIZE_NEEDED = COMPUTE_LEN * (sizeof(Element) + sizeof(float) * 2) +
+                                               MAX_HEAD_DIM * (sizeof(Element) + sizeof(float)) * 2;
+
+    static_assert(UB_SIZE_NEEDED <= ArchTag::UB_SIZE, "COMPUTE_LEN exceeds the UB size");
+
+    /// Construct. The tile only uses eventId with paired set/wait, so it can run between other UB users.
+    CATLASS_DEVICE
+    TileApplyRope(Arch::Resource<ArchTag> const& resource, uint32_t ubOffset = 0, int32_t eventId_ = 0)
+        : eventId(eventId_)
+    {
+        ubInTensor = resource.ubBuf.template GetBufferByByte<Element>(ubOffset);
+        ubOffset += COMPUTE_LEN * sizeof(Element);
+        ubXTensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += COMPUTE_LEN * sizeof(float);
+        ubOutTensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += COMPUTE_LEN * sizeof(float);
+        ubCosInTensor = resource.ubBuf.template GetBufferByByte<Element>(ubOffset);
+        ubOffset += MAX_HEAD_DIM * sizeof(Element);
+        ubSinInTensor = resource.ubBuf.template GetBufferByByte<Element>(ubOffset);
+        ubOffset += MAX_HEAD_DIM * sizeof(Element);
+        ubCosTensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += MAX_HEAD_DIM * sizeof(float);
+        ubSinTensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+    }
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<Element> const& gmDst, AscendC::GlobalTensor<Element> const& gmSrc,
+        AscendC::GlobalTensor<Element> const& gmCos, AscendC::GlobalTensor<Element> const& gmSin, uint32_t heads,
+        uint32_t headDim)
+    {
+        uint32_t halfDim = headDim / 2;
+
+        // cos / sin row of this token's position
+        AscendC::DataCopy(ubCosInTensor, gmCos, headDim);
+        AscendC::DataCopy(ubSinInTensor, gmSin, headDim);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventId);
+        AscendC::Cast(ubCosTensor, ubCosInTensor, AscendC::RoundMode::CAST_NONE, headDim);
+        AscendC::Cast(ubSinTensor, ubSinInTensor, AscendC::RoundMode::CAST_NONE, headDim);
+        AscendC::PipeBarrier<PIPE_V>();
+
+        uint32_t headsPerLoop = COMPUTE_LEN / headDim;
+        uint32_t loops = CeilDiv(heads, headsPerLoop);
+        for (uint32_t loopIdx = 0; loopIdx < loops; loopIdx++) {
+            uint32_t actualHeads = (loopIdx == loops - 1) ? (heads - loopIdx * headsPerLoop) : headsPerLoop;
+            uint32_t calcLen = actualHeads * headDim;
+            uint64_t gmOffset = static_cast<uint64_t>(loopIdx) * headsPerLoop * headDim;
+
+            // ubInTensor is also the store source of the previous loop
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventId);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+            AscendC::DataCopy(ubInTensor, gmSrc[gmOffset], calcLen);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventId);
+            AscendC::Cast(ubXTensor, ubInTensor, AscendC::RoundMode::CAST_NONE, calcLen);
+            AscendC::PipeBarrier<PIPE_V>();
+
+            for (uint32_t headIdx = 0; headIdx < actualHeads; headIdx++) {
+                uint32_t x1 = headIdx * headDim;
+                uint32_t x2 = x1 + halfDim;
+                // out1 = x1 * cos1 - x2 * sin1
+                AscendC::Mul(ubOutTensor[x1], ubXTensor[x1], ubCosTensor, halfDim);
+                AscendC::Mul(ubOutTensor[x2], ubXTensor[x2], ubSinTensor, halfDim);
+                AscendC::PipeBarrier<PIPE_V>();
+                AscendC::Sub(ubOutTensor[x1], ubOutTensor[x1], ubOutTensor[x2], halfDim);
+                AscendC::PipeBarrier<PIPE_V>();
+                // out2 = x2 * cos2 + x1 * sin2, x1 * sin2 goes to the free x1 slot of the input
+                AscendC::Mul(ubOutTensor[x2], ubXTensor[x2], ubCosTensor[halfDim], halfDim);
+                AscendC::Mul(ubXTensor[x1], ubXTensor[x1], ubSinTensor[halfDim], halfDim);
+                AscendC::PipeBarrier<PIPE_V>();
+                AscendC::Add(ubOutTensor[x2], ubOutTensor[x2], ubXTensor[x1], halfDim);
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+
+            // ubInTensor is free once the input has been cast, reuse it for the output
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventId);
+            if constexpr (std::is_same_v<Element, bfloat16_t>) {
+                AscendC::Cast(ubInTensor, ubOutTensor, AscendC::RoundMode::CAST_RINT, calcLen);
+            } else {
+                AscendC::Cast(ubInTensor, ubOutTensor, AscendC::RoundMode::CAST_NONE, calcLen);
+            }
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(eventId);
+            AscendC::DataCopy(gmDst[gmOffset], ubInTensor, calcLen);
+        }
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventId);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+    }
+
+protected:
+    /// Data members
+    AscendC::LocalTensor<Element> ubInTensor;
+    AscendC::LocalTensor<float> ubXTensor;
+    AscendC::LocalTensor<float> ubOutTensor;
+    AscendC::LocalTensor<Element> ubCosInTensor;
+    AscendC::LocalTensor<Element> ubSinInTensor;
+    AscendC::LocalTensor<float> ubCosTensor;
+    AscendC::LocalTensor<float> ubSinTensor;
+    int32_t eventId;
+};
+
+} // namespace Catlass::Gemm::Tile
+
+#endif // CATLASS_GEMM_TILE_ATLASA2_APPLY_ROPE_HPP
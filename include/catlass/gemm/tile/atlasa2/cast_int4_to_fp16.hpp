@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_ATLASA2_CAST_INT4_TO_FP16_HPP
+#define CATLASS_GEMM_TILE_ATLASA2_CAST_INT4_TO_FP16_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/helper.hpp"
+
+namespace Catlass::Gemm::Tile {
+
+/// Dequantize a RowMajor (k, n) int4 tile to fp16 with group-wise scales and zero points (GPTQ/AWQ format),
+/// w[k][n] = (q[k][n] - zero[k / groupSize][n]) * scale[k / groupSize][n].
+/// The tile must start at a group boundary, the scale and zero point tensors passed in start at its first group.
+template <
+    class ArchTag, class SrcType_, class DstType_,
+    // Length of the compute elements
+    uint32_t COMPUTE_LEN_, uint32_t STAGES = 2>
+struct TileCastInt4ToFp16GroupDequant {
+    using ElementSrc = typename SrcType_::Element;
+    using ElementDst = typename DstType_::Element;
+    using LayoutSrc = typename SrcType_::Layout;
+    using LayoutDst = typename DstType_::Layout;
+    using ElementScale = ElementDst;
+    using LayoutScale = layout::RowMajor;
+
+    static_assert(std::is_same_v<ElementSrc, AscendC::int4b_t>, "ElementSrc must be int4b_t");
+    static_assert(std::is_same_v<ElementDst, half>, "ElementDst must be half");
+    static_assert(
+        std::is_same_v<LayoutSrc, layout::RowMajor> && std::is_same_v<LayoutDst, layout::RowMajor>,
+        "Unsupported layout, only can be RowMajor");
+
+    static constexpr uint32_t ELE_NUM_PER_BLK_INT4 = BYTE_PER_BLK * 2;
+    static constexpr uint32_t ELE_NUM_PER_BLK_HALF = BYTE_PER_BLK / sizeof(ElementDst);
+    static constexpr uint32_t ELE_NUM_PER_REPEAT = BYTE_PER_VECTOR_FRACTAL / sizeof(ElementDst);
+    // Rows are padded to whole int4 blocks, so the int4, fp16 and scale rows in UB share the same length
+    static constexpr uint32_t ROW_ALIGN = ELE_NUM_PER_BLK_INT4;
+    static constexpr uint32_t MIN_GROUP_SIZE = 32;
+    // The repeat count of one vector instruction is 8 bits
+    static constexpr uint32_t MAX_REPEAT_TIMES = 255;
+
+    static constexpr uint32_t COMPUTE_LEN = COMPUTE_LEN_;
+    static_assert(COMPUTE_LEN <= 32 * 1024, "COMPUTE_LEN cannot exceed 32 * 1024");
+
+    struct Params {
+        uint32_t groupSize;
+
+        CATLASS_HOST_DEVICE
+        Params() = default;
+
+        CATLASS_HOST_DEVICE
+        Params(uint32_t groupSize_) : groupSize(groupSize_)
+        {}
+    };
+
+    /// Check that a tile of tileN columns and at least one group fits into COMPUTE_LEN
+    CATLASS_HOST_DEVICE
+    static bool CanImplement(uint32_t tileN, uint32_t groupSize)
+    {
+        return (groupSize >= MIN_GROUP_SIZE) && (groupSize % MIN_GROUP_SIZE == 0) &&
+               (RoundUp(tileN, ROW_ALIGN) * groupSize <= COMPUTE_LEN);
+    }
+
+    /// Construct
+    CATLASS_DEVICE
+    TileCastInt4ToFp16GroupDequant(Arch::Resource<ArchTag> const& resource, Params const& params_) : params(params_)
+    {
+        if constexpr (g_coreType == AscendC::AIV) {
+            uint32_t ubOffset = 0;
+            uint32_t ubInSize = COMPUTE_LEN * sizeof(int8_t) / 2;
+            uint32_t ubOutSize = COMPUTE_LEN * sizeof(ElementDst);
+            uint32_t ubScaleSize = COMPUTE_LEN / MIN_GROUP_SIZE * sizeof(ElementScale);
+            // Init buffers
+            for (uint32_t i = 0; i < STAGES; i++) {
+                ubInTensorList[i] = resource.ubBuf.template GetBufferByByte<ElementSrc>(ubOffset);
+                ubOffset += ubInSize;
+                ubOutTensorList[i] = resource.ubBuf.template GetBufferByByte<ElementDst>(ubOffset);
+                ubOffset += ubOutSize;
+                ubScaleList[i] = resource.ubBuf.template GetBufferByByte<ElementScale>(ubOffset);
+                ubOffset += ubScaleSize;
+                ubZeroList[i] = resource.ubBuf.template GetBufferByByte<ElementScale>(ubOffset);
+                ubOffset += ubScaleSize;
+
+                ubEventList[i] = i;
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubEventList[i]);
+                AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(ubEventList[i]);
+            }
+        }
+    }
+
+    /// Destructor
+    CATLASS_DEVICE
+    ~TileCastInt4ToFp16GroupDequant()
+    {
+        if constexpr (g_coreType == AscendC::AIV) {
+            for (uint32_t i = 0; i < STAGES; i++) {
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubEventList[i]);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(ubEventList[i]);
+            }
+        }
+    }
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementDst> const& gmDst, LayoutDst const& layoutDst,
+        AscendC::GlobalTensor<ElementSrc> const& gmSrc, LayoutSrc const& layoutSrc,
+        AscendC::GlobalTensor<ElementScale> const& gmScale, AscendC::GlobalTensor<ElementScale> const& gmZero,
+        LayoutScale const& layoutScale)
+    {
+        uint32_t groupSize = params.groupSize;
+        uint32_t rowsNum = layoutSrc.shape(0);
+        uint32_t tileLen = layoutSrc.shape(1);
+        uint32_t tileLenRound = RoundUp(tileLen, ROW_ALIGN);
+        uint64_t tileStrideSrc = layoutSrc.stride(0);
+        uint64_t tileStrideDst = layoutDst.stride(0);
+        uint64_t tileStrideScale = layoutScale.stride(0);
+
+        // Split the groups of the tile between the AIVs, so that every AIV owns whole groups
+        uint32_t groupsNum = CeilDiv(rowsNum, groupSize);
+        uint32_t groupsPerAiv = groupsNum / AscendC::GetSubBlockNum();
+        uint32_t groupsRemain = groupsNum % AscendC::GetSubBlockNum();
+        uint32_t groupStart = AscendC::GetSubBlockIdx() * groupsPerAiv;
+        if (AscendC::GetSubBlockIdx() < groupsRemain) {
+            groupsPerAiv++;
+            groupStart += AscendC::GetSubBlockIdx();
+        } else {
+            groupStart += groupsRemain;
+        }
+
+        uint32_t groupsPerLoop = COMPUTE_LEN / (tileLenRound * groupSize);
+        uint32_t loops = CeilDiv(groupsPerAiv, groupsPerLoop);
+        uint32_t repeatStride = tileLenRound / ELE_NUM_PER_BLK_HALF;
+        AscendC::BinaryRepeatParams repeatParams(1, 1, 1, repeatStride, repeatStride, 0);
+        for (uint32_t loopIdx = 0; loopIdx < loops; loopIdx++) {
+            uint32_t groupOffset = groupStart + loopIdx * groupsPerLoop;
+            uint32_t actualGroups = (loopIdx == loops - 1) ? (groupsPerAiv - loopIdx * groupsPerLoop) : groupsPerLoop;
+            uint32_t rowOffset = groupOffset * groupSize;
+            uint32_t actualRows = min(actualGroups * groupSize, rowsNum - rowOffset);
+
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+            AscendC::DataCopyExtParams dataCopyParamsIn(
+                actualRows, (tileLen + 1) / 2 * sizeof(int8_t), (tileStrideSrc - tileLen) * sizeof(int8_t) / 2,
+                (tileLenRound - tileLen) / ELE_NUM_PER_BLK_INT4, 0);
+            AscendC::DataCopyPadExtParams<ElementSrc> padParams(false, 0, 0, 0);
+            AscendC::DataCopyPad(
+                ubInTensorList[pingpong], gmSrc[rowOffset * tileStrideSrc], dataCopyParamsIn, padParams);
+
+            AscendC::DataCopyExtParams dataCopyParamsScale(
+                actualGroups, tileLen * sizeof(ElementScale), (tileStrideScale - tileLen) * sizeof(ElementScale),
+                (tileLenRound - tileLen) / ELE_NUM_PER_BLK_HALF, 0);
+            AscendC::DataCopyPadExtParams<ElementScale> padParamsScale(false, 0, 0, 0);
+            AscendC::DataCopyPad(
+                ubScaleList[pingpong], gmScale[groupOffset * tileStrideScale], dataCopyParamsScale, padParamsScale);
+            AscendC::DataCopyPad(
+                ubZeroList[pingpong], gmZero[groupOffset * tileStrideScale], dataCopyParamsScale, padParamsScale);
+
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(ubEventList[pingpong]);
+
+            AscendC::Cast(
+                ubOutTensorList[pingpong], ubInTensorList[pingpong], AscendC::RoundMode::CAST_NONE,
+                actualRows * tileLenRound);
+            AscendC::PipeBarrier<PIPE_V>();
+
+            // Broadcast the zero point and scale row of every group over its rows
+            for (uint32_t groupIdx = 0; groupIdx < actualGroups; groupIdx++) {
+                uint32_t groupRowOffset = groupIdx * groupSize;
+                uint32_t groupRows = min(groupSize, actualRows - groupRowOffset);
+                for (uint32_t rowIdx = 0; rowIdx < groupRows; rowIdx += MAX_REPEAT_TIMES) {
+                    uint8_t repeatTimes = static_cast<uint8_t>(min(MAX_REPEAT_TIMES, groupRows - rowIdx));
+                    for (uint32_t colOffset = 0; colOffset < tileLenRound; colOffset += ELE_NUM_PER_REPEAT) {
+                        uint64_t mask = min(ELE_NUM_PER_REPEAT, tileLenRound - colOffset);
+                        auto ubTile = ubOutTensorList[pingpong][(groupRowOffset + rowIdx) * tileLenRound + colOffset];
+                        AscendC::Sub(
+                            ubTile, ubTile, ubZeroList[pingpong][groupIdx * tileLenRound + colOffset], mask,
+                            repeatTimes, repeatParams);
+                    }
+                }
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+            for (uint32_t groupIdx = 0; groupIdx < actualGroups; groupIdx++) {
+                uint32_t groupRowOffset = groupIdx * groupSize;
+                uint32_t groupRows = min(groupSize, actualRows - groupRowOffset);
+                for (uint32_t rowIdx = 0; rowIdx < groupRows; rowIdx += MAX_REPEAT_TIMES) {
+                    uint8_t repeatTimes = static_cast<uint8_t>(min(MAX_REPEAT_TIMES, groupRows - rowIdx));
+                    for (uint32_t colOffset = 0; colOffset < tileLenRound; colOffset += ELE_NUM_PER_REPEAT) {
+                        uint64_t mask = min(ELE_NUM_PER_REPEAT, tileLenRound - colOffset);
+                        auto ubTile = ubOutTensorList[pingpong][(groupRowOffset + rowIdx) * tileLenRound + colOffset];
+                        AscendC::Mul(
+                            ubTile, ubTile, ubScaleList[pingpong][groupIdx * tileLenRound + colOffset], mask,
+                            repeatTimes, repeatParams);
+                    }
+                }
+            }
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(ubEventList[pingpong]);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(ubEventList[pingpong]);
+
+            AscendC::DataCopyExtParams dataCopyParamsOut(
+                actualRows, tileLen * sizeof(ElementDst), (tileLenRound - tileLen) / ELE_NUM_PER_BLK_HALF,
+                (tileStrideDst - tileLen) * sizeof(ElementDst), 0);
+            AscendC::DataCopyPad(gmDst[rowOffset * tileStrideDst], ubOutTensorList[pingpong], dataCopyParamsOut);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(ubEventList[pingpong]);
+
+            pingpong = (pingpong + 1) % STAGES;
+        }
+    }
+
+protected:
+    /// Data members
+    AscendC::LocalTensor<ElementSrc> ubInTensorList[STAGES];
+    AscendC::LocalTensor<ElementDst> ubOutTensorList[STAGES];
+    AscendC::LocalTensor<ElementScale> ubScaleList[STAGES];
+    AscendC::LocalTensor<ElementScale> ubZeroList[STAGES];
+    int32_t ubEventList[STAGES];
+    uint32_t pingpong{0};
+
+    Params params;
+};
+
+} // namespace Catlass::Gemm::Tile
+
+#endif // CATLASS_GEMM_TILE_ATLASA2_CAST_INT4_TO_FP16_HPP
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_ATLASA2_DEQUANT_KV_INT8_HPP
+#define CATLASS_GEMM_TILE_ATLASA2_DEQUANT_KV_INT8_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+
+namespace Catlass::Gemm::Tile {
+
+/// Dequantizes an int8 row block (e.g. one page of one kv head in a paged KV cache) into half/bfloat16 with a
+/// single float scale: dst = ElementDst(float(src) * scale).
+/// Rows are read with srcRowStride and written with dstRowStride, both in elements.
+/// The computation goes through float so that bfloat16 output keeps the full scale precision.
+template <
+    class ArchTag, class ElementDst_,
+    // Length of the compute elements of one stage
+    uint32_t COMPUTE_LEN_ = 8192, uint32_t STAGES = 2>
+struct TileDequantKvInt8 {
+    using ElementSrc = int8_t;
+    using ElementDst = ElementDst_;
+
+    static_assert(
+        std::is_same_v<ElementDst, half> || std::is_same_v<ElementDst, bfloat16_t>,
+        "TileDequantKvInt8 only supports half or bfloat16_t output");
+
+    static constexpr uint32_t ELE_NUM_PER_BLK_INT8 = BYTE_PER_BLK / sizeof(ElementSrc);
+    static constexpr uint32_t ELE_NUM_PER_BLK_DST = BYTE_PER_BLK / sizeof(ElementDst);
+    static constexpr uint32_t COMPUTE_LEN = COMPUTE_LEN_;
+    /// UB bytes of one stage: int8 input, 16-bit intermediate (reused for the output) and float intermediate
+    static constexpr uint32_t UB_STAGE_SIZE = COMPUTE_LEN * (sizeof(ElementSrc) + sizeof(half) + sizeof(float));
+
+    static_assert(COMPUTE_LEN % ELE_NUM_PER_BLK_INT8 == 0, "COMPUTE_LEN must be aligned to 32 elements");
+    static_assert(UB_STAGE_SIZE * STAGES <= ArchTag::UB_SIZE, "COMPUTE_LEN * STAGES exceeds the UB size");
+
+    /// Construct. eventIdBase lets the caller keep the tile's events clear of the ones it holds itself.
+    CATLASS_DEVICE
+    TileDequantKvInt8(Arch::Resource<ArchTag> const& resource, uint32_t ubOffset = 0, int32_t eventIdBase = 0)
+    {
+        if constexpr (g_coreType == AscendC::AIV) {
+            for (uint32_t i = 0; i < STAGES; i++) {
+                ubInTensorList[i] = resource.ubBuf.template GetBufferByByte<ElementSrc>(ubOffset);
+                ubOffset += COMPUTE_LEN * sizeof(ElementSrc);
+                ubHalfTensorList[i] = resource.ubBuf.template GetBufferByByte<half>(ubOffset);
+                ubOffset += COMPUTE_LEN * sizeof(half);
+                ubFloatTensorList[i] = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+                ubOffset += COMPUTE_LEN * sizeof(float);
+
+                ubEventList[i] = eventIdBase + static_cast<int32_t>(i);
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubEventList[i]);
+                AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(ubEventList[i]);
+            }
+        }
+    }
+
+    /// Destructor
+    CATLASS_DEVICE
+    ~TileDequantKvInt8()
+    {
+        if constexpr (g_coreType == AscendC::AIV) {
+            for (uint32_t i = 0; i < STAGES; i++) {
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubEventList[i]);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(ubEventList[i]);
+            }
+        }
+    }
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementDst> const& gmDst, AscendC::GlobalTensor<ElementSrc> const& gmSrc, uint32_t rows,
+        uint32_t cols, uint64_t srcRowStride, uint64_t dstRowStride, float scale)
+    {
+        uint32_t colsRound = RoundUp(cols, ELE_NUM_PER_BLK_INT8);
+        uint32_t rowsPerLoop = COMPUTE_LEN / colsRound;
+        uint32_t loops = CeilDiv(rows, rowsPerLoop);
+        for (uint32_t loopIdx = 0; loopIdx < loops; loopIdx++) {
+            uint32_t actualRows = (loopIdx == loops - 1) ? (rows - loopIdx * rowsPerLoop) : rowsPerLoop;
+            uint32_t calcLen = actualRows * colsRound;
+
+            AscendC::DataCopyExtParams dataCopyParamsIn(
+                actualRows, cols * sizeof(ElementSrc), (srcRowStride - cols) * sizeof(ElementSrc),
+                (colsRound - cols) / ELE_NUM_PER_BLK_INT8, 0);
+            AscendC::DataCopyPadExtParams<ElementSrc> padParams(false, 0, 0, 0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+            AscendC::DataCopyPad(
+                ubInTensorList[pingpong], gmSrc[loopIdx * rowsPerLoop * srcRowStride], dataCopyParamsIn, padParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(ubEventList[pingpong]);
+            AscendC::Cast(ubHalfTensorList[pingpong], ubInTensorList[pingpong], AscendC::RoundMode::CAST_NONE, calcLen);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+            AscendC::Cast(
+                ubFloatTensorList[pingpong], ubHalfTensorList[pingpong], AscendC::RoundMode::CAST_NONE, calcLen);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Muls(ubFloatTensorList[pingpong], ubFloatTensorList[pingpong], scale, calcLen);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::LocalTensor<ElementDst> ubOutTensor =
+                ubHalfTensorList[pingpong].template ReinterpretCast<ElementDst>();
+            if constexpr (std::is_same_v<ElementDst, bfloat16_t>) {
+                AscendC::Cast(ubOutTensor, ubFloatTensorList[pingpong], AscendC::RoundMode::CAST_RINT, calcLen);
+            } else {
+                AscendC::Cast(ubOutTensor, ubFloatTensorList[pingpong], AscendC::RoundMode::CAST_NONE, calcLen);
+            }
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(ubEventList[pingpong]);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(ubEventList[pingpong]);
+
+            AscendC::DataCopyExtParams dataCopyParamsOut(
+                actualRows, cols * sizeof(ElementDst), (colsRound - cols) / ELE_NUM_PER_BLK_DST,
+                (dstRowStride - cols) * sizeof(ElementDst), 0);
+            AscendC::DataCopyPad(gmDst[loopIdx * rowsPerLoop * dstRowStride], ubOutTensor, dataCopyParamsOut);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(ubEventList[pingpong]);
+
+            pingpong = (pingpong + 1) % STAGES;
+        }
+    }
+
+protected:
+    /// Data members
+    AscendC::LocalTensor<ElementSrc> ubInTensorList[STAGES];
+    AscendC::LocalTensor<half> ubHalfTensorList[STAGES];
+    AscendC::LocalTensor<float> ubFloatTensorList[STAGES];
+    int32_t ubEventList[STAGES];
+    uint32_t pingpong{0};
+};
+
+} // namespace Catlass::Gemm::Tile
+
+#endif // CATLASS_GEMM_TILE_ATLASA2_DEQUANT_KV_INT8_HPP
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_ATLASA2_MERGE_ATTN_STATE_HPP
+#define CATLASS_GEMM_TILE_ATLASA2_MERGE_ATTN_STATE_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+
+namespace Catlass::Gemm::Tile {
+
+/// Merges two attention results of the same query rows computed over disjoint kv ranges, each given as the
+/// normalized output O and lse = rowmax + ln(rowsum) of its scaled scores:
+///   w_a = exp(lse_a - max(lse_a, lse_b)), w_b = exp(lse_b - max(lse_a, lse_b))
+///   dst = (O_a * w_a + O_b * w_b) / (w_a + w_b)
+/// Rows of headDim elements are contiguous in every output, with one lse per row. dst may alias O_a or O_b.
+template <
+    class ArchTag, class Element_,
+    // Float elements of the row chunk processed per loop
+    uint32_t COMPUTE_LEN_ = 8192>
+struct TileMergeAttnState {
+    using Element = Element_;
+
+    static_assert(
+        std::is_same_v<Element, half> || std::is_same_v<Element, bfloat16_t>,
+        "TileMergeAttnState only supports half or bfloat16_t");
+
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(Element);
+    static constexpr uint32_t FLOAT_ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(float);
+    static constexpr uint32_t FLOAT_ELE_NUM_PER_VECCALC = 64;
+    static constexpr uint32_t COMPUTE_LEN = COMPUTE_LEN_;
+    // A row is one repeat of the broadcast multiply
+    static constexpr uint32_t MAX_ROWS = 255;
+    static constexpr uint32_t MAX_ROWS_ROUND = 256;
+    static constexpr uint32_t UB_SIZE_NEEDED = COMPUTE_LEN * (sizeof(Element) + sizeof(float)) * 2 +
+                                               MAX_ROWS_ROUND * sizeof(float) * 4 + MAX_ROWS_ROUND * BYTE_PER_BLK * 2;
+
+    static_assert(UB_SIZE_NEEDED <= ArchTag::UB_SIZE, "COMPUTE_LEN exceeds the UB size");
+
+    /// Construct. The tile only uses eventId with paired set/wait, so it can run between other UB users.
+    CATLASS_DEVICE
+    TileMergeAttnState(Arch::Resource<ArchTag> const& resource, uint32_t ubOffset = 0, int32_t eventId_ = 0)
+        : eventId(eventId_)
+    {
+        ubInATensor = resource.ubBuf.template GetBufferByByte<Element>(ubOffset);
+        ubOffset += COMPUTE_LEN * sizeof(Element);
+        ubInBTensor = resource.ubBuf.template GetBufferByByte<Element>(ubOffset);
+        ubOffset += COMPUTE_LEN * sizeof(Element);
+        ubOATensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += COMPUTE_LEN * sizeof(float);
+        ubOBTensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += COMPUTE_LEN * sizeof(float);
+        ubLseATensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += MAX_ROWS_ROUND * sizeof(float);
+        ubLseBTensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += MAX_ROWS_ROUND * sizeof(float);
+        ubMaxTensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += MAX_ROWS_ROUND * sizeof(float);
+        ubSumTensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += MAX_ROWS_ROUND * sizeof(float);
+        ubBrcbATensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += MAX_ROWS_ROUND * BYTE_PER_BLK;
+        ubBrcbBTensor = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+    }
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<Element> const& gmDst, AscendC::GlobalTensor<Element> const& gmOA,
+        AscendC::GlobalTensor<float> const& gmLseA, AscendC::GlobalTensor<Element> const& gmOB,
+        AscendC::GlobalTensor<float> const& gmLseB, uint32_t rows, uint32_t headDim)
+    {
+        uint32_t headDimRound = RoundUp(headDim, ELE_NUM_PER_BLK);
+        uint32_t rowsPerLoop = Min(COMPUTE_LEN / headDimRound, MAX_ROWS);
+        uint32_t loops = CeilDiv(rows, rowsPerLoop);
+        for (uint32_t loopIdx = 0; loopIdx < loops; loopIdx++) {
+            uint32_t actualRows = (loopIdx == loops - 1) ? (rows - loopIdx * rowsPerLoop) : rowsPerLoop;
+            uint32_t actualRowsRound = RoundUp(actualRows, FLOAT_ELE_NUM_PER_BLK);
+            uint32_t calcLen = actualRows * headDimRound;
+            uint64_t gmRowOffset = static_cast<uint64_t>(loopIdx) * rowsPerLoop;
+            uint64_t gmOffset = gmRowOffset * headDim;
+
+            // ubInATensor is also the store source of the previous loop
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventId);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+            AscendC::DataCopyExtParams oCopyParams(
+                actualRows, headDim * sizeof(Element), 0, (headDimRound - headDim) / ELE_NUM_PER_BLK, 0);
+            AscendC::DataCopyPadExtParams<Element> oPadParams(false, 0, 0, 0);
+            AscendC::DataCopyPad(ubInATensor, gmOA[gmOffset], oCopyParams, oPadParams);
+            AscendC::DataCopyPad(ubInBTensor, gmOB[gmOffset], oCopyParams, oPadParams);
+            AscendC::DataCopyExtParams lseCopyParams(1, actualRows * sizeof(float), 0, 0, 0);
+            AscendC::DataCopyPadExtParams<float> lsePadParams(false, 0, 0, 0);
+            AscendC::DataCopyPad(ubLseATensor, gmLseA[gmRowOffset], lseCopyParams, lsePadParams);
+            AscendC::DataCopyPad(ubLseBTensor, gmLseB[gmRowOffset], lseCopyParams, lsePadParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventId);
+
+            AscendC::Cast(ubOATensor, ubInATensor, AscendC::RoundMode::CAST_NONE, calcLen);
+            AscendC::Cast(ubOBTensor, ubInBTensor, AscendC::RoundMode::CAST_NONE, calcLen);
+            // w_a = exp(lse_a - m), w_b = exp(lse_b - m), normalized by their sum
+            AscendC::Max(ubMaxTensor, ubLseATensor, ubLseBTensor, actualRows);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Sub(ubLseATensor, ubLseATensor, ubMaxTensor, actualRows);
+            AscendC::Sub(ubLseBTensor, ubLseBTensor, ubMaxTensor, actualRows);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Exp(ubLseATensor, ubLseATensor, actualRows);
+            AscendC::Exp(ubLseBTensor, ubLseBTensor, actualRows);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Add(ubSumTensor, ubLseATensor, ubLseBTensor, actualRows);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Div(ubLseATensor, ubLseATensor, ubSumTensor, actualRows);
+            AscendC::Div(ubLseBTensor, ubLseBTensor, ubSumTensor, actualRows);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Brcb(
+                ubBrcbATensor.template ReinterpretCast<uint32_t>(), ubLseATensor.template ReinterpretCast<uint32_t>(),
+                actualRowsRound / FLOAT_ELE_NUM_PER_BLK, AscendC::BrcbRepeatParams(1, 8));
+            AscendC::Brcb(
+                ubBrcbBTensor.template ReinterpretCast<uint32_t>(), ubLseBTensor.template ReinterpretCast<uint32_t>(),
+                actualRowsRound / FLOAT_ELE_NUM_PER_BLK, AscendC::BrcbRepeatParams(1, 8));
+            AscendC::PipeBarrier<PIPE_V>();
+
+            // one repeat per row, the row weight is the same 32B block for every column chunk
+            uint8_t rowStride = static_cast<uint8_t>(headDimRound / FLOAT_ELE_NUM_PER_BLK);
+            AscendC::BinaryRepeatParams repeatParams(1, 1, 0, rowStride, rowStride, 1);
+            for (uint32_t colOffset = 0; colOffset < headDim; colOffset += FLOAT_ELE_NUM_PER_VECCALC) {
+                uint64_t mask = Min(headDim - colOffset, FLOAT_ELE_NUM_PER_VECCALC);
+                AscendC::Mul(
+                    ubOATensor[colOffset], ubOATensor[colOffset], ubBrcbATensor, mask, actualRows, repeatParams);
+                AscendC::Mul(
+                    ubOBTensor[colOffset], ubOBTensor[colOffset], ubBrcbBTensor, mask, actualRows, repeatParams);
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Add(ubOATensor, ubOATensor, ubOBTensor, calcLen);
+            AscendC::PipeBarrier<PIPE_V>();
+
+            // ubInATensor is free once the input has been cast, reuse it for the output
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventId);
+            if constexpr (std::is_same_v<Element, bfloat16_t>) {
+                AscendC::Cast(ubInATensor, ubOATensor, AscendC::RoundMode::CAST_RINT, calcLen);
+            } else {
+                AscendC::Cast(ubInATensor, ubOATensor, AscendC::RoundMode::CAST_NONE, calcLen);
+            }
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(eventId);
+            AscendC::DataCopyPad(
+                gmDst[gmOffset], ubInATensor,
+                AscendC::DataCopyExtParams(
+                    actualRows, headDim * sizeof(Element), (headDimRound - headDim) / ELE_NUM_PER_BLK, 0, 0));
+        }
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventId);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+    }
+
+protected:
+    /// Data members
+    AscendC::LocalTensor<Element> ubInATensor;
+    AscendC::LocalTensor<Element> ubInBTensor;
+    AscendC::LocalTensor<float> ubOATensor;
+    AscendC::LocalTensor<float> ubOBTensor;
+    AscendC::LocalTensor<float> ubLseATensor;
+    AscendC::LocalTensor<float> ubLseBTensor;
+    AscendC::LocalTensor<float> ubMaxTensor;
+    AscendC::LocalTensor<float> ubSumTensor;
+    AscendC::LocalTensor<float> ubBrcbATensor;
+    AscendC::LocalTensor<float> ubBrcbBTensor;
+    int32_t eventId;
+};
+
+} // namespace Catlass::Gemm::Tile
+
+#endif // CATLASS_GEMM_TILE_ATLASA2_MERGE_ATTN_STATE_HPP
@@ -0,0 +1,396 @@
+/**
+ * Copyright (c) 2025-2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_ATLASA2_QUANT_PER_TOKEN_INT8_HPP
+#define CATLASS_GEMM_TILE_ATLASA2_QUANT_PER_TOKEN_INT8_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/helper.hpp"
+
+namespace Catlass::Gemm::Tile {
+
+/// Dynamic per-token quantization of the A operand (fp16/bf16 -> int8), used as PrologueA.
+/// - ComputeScale: one pass over the whole K range of the block rows, scale = absmax(row) / 127,
+///   the scales are written to GM for the dequant epilogue and kept in UB for the following tiles.
+/// - LoadScale: reloads the scales that an earlier ComputeScale stored in GM, so blocks sharing the same rows
+///   skip the absmax pass. The stored scale is used as is, which keeps the quantization consistent with the
+///   dequant epilogue when ElementScale is half.
+/// - operator(): quantizes one K tile as round(x * 127 / absmax(row)).
+/// Rows of the block are split between the AIV sub blocks, both passes use the same split.
+template <
+    class ArchTag, class SrcType_, class DstType_, class ScaleType_,
+    // Length of the compute elements
+    uint32_t COMPUTE_LEN_,
+    // Max rows of a block, i.e. L1TileShape::M
+    uint32_t MAX_ROWS_ = 128, uint32_t STAGES = 2,
+    // First event id, lets the prologue keep its flags apart from an epilogue sharing the AIV
+    int32_t EVENT_ID_BASE = 0>
+struct TileQuantPerTokenInt8 {
+    using ElementSrc = typename SrcType_::Element;
+    using ElementDst = typename DstType_::Element;
+    using ElementScale = typename ScaleType_::Element;
+    using LayoutSrc = typename SrcType_::Layout;
+    using LayoutDst = typename DstType_::Layout;
+    using LayoutScale = typename ScaleType_::Layout;
+
+    static_assert(
+        std::is_same_v<ElementSrc, half> || std::is_same_v<ElementSrc, bfloat16_t>,
+        "Unsupported source element, only can be half and bfloat16_t");
+    static_assert(std::is_same_v<ElementDst, int8_t>, "Unsupported destination element, only can be int8_t");
+    static_assert(
+        std::is_same_v<ElementScale, half> || std::is_same_v<ElementScale, float>,
+        "Unsupported scale element, only can be half and float");
+    static_assert(std::is_same_v<LayoutSrc, layout::RowMajor>, "Unsupported layout, only can be RowMajor");
+    static_assert(std::is_same_v<LayoutDst, LayoutSrc>, "layoutDst and layoutSrc must be the same");
+
+    static constexpr uint32_t COMPUTE_LEN = COMPUTE_LEN_;
+    static constexpr uint32_t MAX_ROWS = MAX_ROWS_;
+
+    static constexpr uint32_t ELE_NUM_PER_BLK_SRC = BYTE_PER_BLK / sizeof(ElementSrc);
+    static constexpr uint32_t ELE_NUM_PER_BLK_DST = BYTE_PER_BLK / sizeof(ElementDst);
+    static constexpr uint32_t ELE_NUM_PER_BLK_FP32 = BYTE_PER_BLK / sizeof(float);
+    static constexpr uint32_t ELE_NUM_PER_REPEAT_FP32 = BYTE_PER_VECTOR_FRACTAL / sizeof(float);
+    static constexpr uint32_t MAX_REPEAT = 255;
+    static constexpr uint32_t MAX_REP_STRIDE = 255;
+    // Column chunk of the absmax pass, limited by the repeat stride of the combine
+    static constexpr uint32_t MAX_CHUNK_LEN = MAX_REP_STRIDE * ELE_NUM_PER_BLK_FP32 / ELE_NUM_PER_REPEAT_FP32 *
+                                              ELE_NUM_PER_REPEAT_FP32;
+
+    static constexpr float QUANT_MAX = 127.0f;
+    // Lower bound of the row absmax, an all-zero row gets zero outputs instead of NaN
+    static constexpr float MIN_ABS_MAX = 1e-6f;
+
+    static_assert(
+        MAX_ROWS % ELE_NUM_PER_BLK_FP32 == 0 && MAX_ROWS <= MAX_REPEAT, "MAX_ROWS must be 8 aligned and <= 255");
+    static_assert(COMPUTE_LEN % ELE_NUM_PER_REPEAT_FP32 == 0, "COMPUTE_LEN must be 64 aligned");
+    static_assert(
+        COMPUTE_LEN >= MAX_ROWS * ELE_NUM_PER_REPEAT_FP32, "COMPUTE_LEN must hold one repeat for each row of a block");
+    static_assert(COMPUTE_LEN <= 16 * 1024, "COMPUTE_LEN cannot exceed 16 * 1024");
+
+    struct Params {
+        CATLASS_HOST_DEVICE
+        Params() = default;
+    };
+
+    /// Construct
+    CATLASS_DEVICE
+    TileQuantPerTokenInt8(Arch::Resource<ArchTag> const& resource, Params const& params_ = {}) : params(params_)
+    {
+        if constexpr (g_coreType == AscendC::AIV) {
+            uint32_t ubOffset = 0;
+            // Init buffers
+            for (uint32_t i = 0; i < STAGES; i++) {
+                ubInTensorList[i] = resource.ubBuf.template GetBufferByByte<ElementSrc>(ubOffset);
+                ubOffset += COMPUTE_LEN * sizeof(ElementSrc);
+                ubOutTensorList[i] = resource.ubBuf.template GetBufferByByte<ElementDst>(ubOffset);
+                ubOffset += COMPUTE_LEN * sizeof(ElementDst);
+
+                ubEventList[i] = EVENT_ID_BASE + i;
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubEventList[i]);
+                AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(ubEventList[i]);
+            }
+            ubFp32 = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += COMPUTE_LEN * sizeof(float);
+            ubHalf = resource.ubBuf.template GetBufferByByte<half>(ubOffset);
+            ubOffset += COMPUTE_LEN * sizeof(half);
+            ubAbsMax = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += MAX_ROWS * ELE_NUM_PER_REPEAT_FP32 * sizeof(float);
+            ubRowScale = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += MAX_ROWS * sizeof(float);
+            ubScaleOut = resource.ubBuf.template GetBufferByByte<ElementScale>(ubOffset);
+            ubOffset += RoundUp<BYTE_PER_BLK>(MAX_ROWS * static_cast<uint32_t>(sizeof(ElementScale)));
+            ubRowInvBrcb = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += MAX_ROWS * BYTE_PER_BLK;
+            assert(ubOffset <= ArchTag::UB_SIZE);
+        }
+    }
+
+    /// Destructor
+    CATLASS_DEVICE
+    ~TileQuantPerTokenInt8()
+    {
+        if constexpr (g_coreType == AscendC::AIV) {
+            for (uint32_t i = 0; i < STAGES; i++) {
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubEventList[i]);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(ubEventList[i]);
+            }
+        }
+    }
+
+    /// Compute the per-token scales of the block rows over the whole K range
+    CATLASS_DEVICE
+    void ComputeScale(
+        AscendC::GlobalTensor<ElementScale> const& gmScale, AscendC::GlobalTensor<ElementSrc> const& gmSrc,
+        LayoutSrc const& layoutSrc)
+    {
+        uint32_t rowOffset;
+        uint32_t rowsPerAiv;
+        GetRowTask(layoutSrc.shape(0), rowOffset, rowsPerAiv);
+        if (rowsPerAiv == 0) {
+            return;
+        }
+        uint32_t cols = layoutSrc.shape(1);
+        uint64_t strideSrc = layoutSrc.stride(0);
+
+        // Every row keeps one repeat of partial absmax, each chunk is merged into it by 64 columns
+        uint32_t chunkLen = Min(RoundDown<ELE_NUM_PER_REPEAT_FP32>(COMPUTE_LEN / rowsPerAiv), MAX_CHUNK_LEN);
+        chunkLen = Min(chunkLen, RoundUp<ELE_NUM_PER_REPEAT_FP32>(cols));
+        uint32_t chunkBlk = chunkLen / ELE_NUM_PER_BLK_FP32;
+
+        AscendC::Duplicate(ubAbsMax, 0.0f, rowsPerAiv * ELE_NUM_PER_REPEAT_FP32);
+        AscendC::PipeBarrier<PIPE_V>();
+
+        uint32_t chunks = CeilDiv(cols, chunkLen);
+        for (uint32_t chunkIdx = 0; chunkIdx < chunks; chunkIdx++) {
+            uint32_t colOffset = chunkIdx * chunkLen;
+            uint32_t actualLen = Min(chunkLen, cols - colOffset);
+
+            AscendC::DataCopyExtParams dataCopyParamsIn(
+                rowsPerAiv, actualLen * sizeof(ElementSrc), (strideSrc - actualLen) * sizeof(ElementSrc),
+                (chunkLen - RoundUp<ELE_NUM_PER_BLK_SRC>(actualLen)) / ELE_NUM_PER_BLK_SRC, 0);
+            AscendC::DataCopyPadExtParams<ElementSrc> padParams(false, 0, 0, 0);
+
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+            AscendC::DataCopyPad(
+                ubInTensorList[pingpong], gmSrc[rowOffset * strideSrc + colOffset], dataCopyParamsIn, padParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+
+            AscendC::Cast(ubFp32, ubInTensorList[pingpong], AscendC::RoundMode::CAST_NONE, rowsPerAiv * chunkLen);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+
+            AscendC::Abs(ubFp32, ubFp32, rowsPerAiv * chunkLen);
+            AscendC::PipeBarrier<PIPE_V>();
+
+            // The padding columns of the last chunk are excluded by the mask
+            AscendC::BinaryRepeatParams repeatParams(
+                1, 1, 1, BLK_NUM_PER_VECTOR_FRACTAL, BLK_NUM_PER_VECTOR_FRACTAL, chunkBlk);
+            for (uint32_t c = 0; c < actualLen; c += ELE_NUM_PER_REPEAT_FP32) {
+                AscendC::Max(
+                    ubAbsMax, ubAbsMax, ubFp32[c], static_cast<uint64_t>(Min(ELE_NUM_PER_REPEAT_FP32, actualLen - c)),
+                    static_cast<uint8_t>(rowsPerAiv), repeatParams);
+                AscendC::PipeBarrier<PIPE_V>();
+            }
+
+            pingpong = (pingpong + 1) % STAGES;
+        }
+
+        AscendC::WholeReduceMax(
+            ubRowScale, ubAbsMax, static_cast<int32_t>(ELE_NUM_PER_REPEAT_FP32), static_cast<int32_t>(rowsPerAiv), 1,
+            1, BLK_NUM_PER_VECTOR_FRACTAL, AscendC::ReduceOrder::ORDER_ONLY_VALUE);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Maxs(ubRowScale, ubRowScale, MIN_ABS_MAX, rowsPerAiv);
+        AscendC::PipeBarrier<PIPE_V>();
+
+        // 127 / absmax, broadcast to one block per row for the quant pass
+        AscendC::Duplicate(ubFp32, QUANT_MAX, rowsPerAiv);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Div(ubFp32, ubFp32, ubRowScale, rowsPerAiv);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::BrcbRepeatParams brcbParams;
+        brcbParams.dstBlkStride = 1;
+        brcbParams.dstRepStride = BLK_NUM_PER_VECTOR_FRACTAL;
+        AscendC::Brcb(
+            ubRowInvBrcb, ubFp32, static_cast<uint8_t>(CeilDiv<ELE_NUM_PER_BLK_FP32>(rowsPerAiv)), brcbParams);
+
+        // absmax / 127 for the dequant epilogue
+        AscendC::Muls(ubRowScale, ubRowScale, 1.0f / QUANT_MAX, rowsPerAiv);
+        AscendC::PipeBarrier<PIPE_V>();
+        // ubScaleOut is only read by MTE3, borrow the event of the first output buffer to guard it
+        int32_t scaleEventId = ubEventList[0];
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(scaleEventId);
+        if constexpr (std::is_same_v<ElementScale, float>) {
+            AscendC::DataCopy(ubScaleOut, ubRowScale, RoundUp<ELE_NUM_PER_BLK_FP32>(rowsPerAiv));
+        } else {
+            AscendC::Cast(ubScaleOut, ubRowScale, AscendC::RoundMode::CAST_RINT, rowsPerAiv);
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(scaleEventId);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(scaleEventId);
+        AscendC::DataCopyExtParams dataCopyParamsOut(1, rowsPerAiv * sizeof(ElementScale), 0, 0, 0);
+        AscendC::DataCopyPad(gmScale[rowOffset], ubScaleOut, dataCopyParamsOut);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(scaleEventId);
+    }
+
+    /// Load the per-token scales of the block rows written by an earlier ComputeScale, the GM writes must be
+    /// visible to this core (e.g. after a cross-core barrier)
+    CATLASS_DEVICE
+    void LoadScale(AscendC::GlobalTensor<ElementScale> const& gmScale, uint32_t rowsTotal)
+    {
+        uint32_t rowOffset;
+        uint32_t rowsPerAiv;
+        GetRowTask(rowsTotal, rowOffset, rowsPerAiv);
+        if (rowsPerAiv == 0) {
+            return;
+        }
+
+        // The input buffer of the current stage holds COMPUTE_LEN >= MAX_ROWS * 64 elements, enough for the scales
+        auto ubScaleIn = ubInTensorList[pingpong].template ReinterpretCast<ElementScale>();
+        AscendC::DataCopyExtParams dataCopyParamsIn(1, rowsPerAiv * sizeof(ElementScale), 0, 0, 0);
+        AscendC::DataCopyPadExtParams<ElementScale> padParams(false, 0, 0, 0);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+        AscendC::DataCopyPad(ubScaleIn, gmScale[rowOffset], dataCopyParamsIn, padParams);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+
+        if constexpr (std::is_same_v<ElementScale, float>) {
+            AscendC::DataCopy(ubRowScale, ubScaleIn, RoundUp<ELE_NUM_PER_BLK_FP32>(rowsPerAiv));
+        } else {
+            AscendC::Cast(ubRowScale, ubScaleIn, AscendC::RoundMode::CAST_NONE, rowsPerAiv);
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+        pingpong = (pingpong + 1) % STAGES;
+
+        // A half scale of an all-zero row may underflow to 0, keep the reciprocal finite so the row stays zero
+        AscendC::Maxs(ubRowScale, ubRowScale, MIN_ABS_MAX / QUANT_MAX, rowsPerAiv);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Duplicate(ubFp32, 1.0f, rowsPerAiv);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Div(ubFp32, ubFp32, ubRowScale, rowsPerAiv);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::BrcbRepeatParams brcbParams;
+        brcbParams.dstBlkStride = 1;
+        brcbParams.dstRepStride = BLK_NUM_PER_VECTOR_FRACTAL;
+        AscendC::Brcb(
+            ubRowInvBrcb, ubFp32, static_cast<uint8_t>(CeilDiv<ELE_NUM_PER_BLK_FP32>(rowsPerAiv)), brcbParams);
+        AscendC::PipeBarrier<PIPE_V>();
+    }
+
+    /// Quantize one K tile with the scales of the last ComputeScale or LoadScale
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementDst> const& gmDst, LayoutDst const& layoutDst,
+        AscendC::GlobalTensor<ElementSrc> const& gmSrc, LayoutSrc const& layoutSrc)
+    {
+        uint32_t rowOffset;
+        uint32_t rows;
+        GetRowTask(layoutSrc.shape(0), rowOffset, rows);
+        uint32_t cols = layoutSrc.shape(1);
+        uint32_t colsRound = RoundUp<ELE_NUM_PER_BLK_DST>(cols);
+        uint64_t strideSrc = layoutSrc.stride(0);
+        uint64_t strideDst = layoutDst.stride(0);
+
+        uint32_t rowsPerLoop = Min(COMPUTE_LEN / colsRound, MAX_REPEAT);
+        uint32_t loops = CeilDiv(rows, rowsPerLoop);
+        for (uint32_t loopIdx = 0; loopIdx < loops; loopIdx++) {
+            uint32_t rowIdx = loopIdx * rowsPerLoop;
+            uint32_t actualRows = (loopIdx == loops - 1) ? (rows - rowIdx) : rowsPerLoop;
+            uint32_t computeCount = actualRows * colsRound;
+
+            AscendC::DataCopyExtParams dataCopyParamsIn(
+                actualRows, cols * sizeof(ElementSrc), (strideSrc - cols) * sizeof(ElementSrc),
+                (colsRound - RoundUp<ELE_NUM_PER_BLK_SRC>(cols)) / ELE_NUM_PER_BLK_SRC, 0);
+            AscendC::DataCopyPadExtParams<ElementSrc> padParams(false, 0, 0, 0);
+
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+            AscendC::DataCopyPad(
+                ubInTensorList[pingpong], gmSrc[(rowOffset + rowIdx) * strideSrc], dataCopyParamsIn, padParams);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(ubEventList[pingpong]);
+
+            AscendC::Cast(ubFp32, ubInTensorList[pingpong], AscendC::RoundMode::CAST_NONE, computeCount);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubEventList[pingpong]);
+
+            MulRowScale(ubRowInvBrcb[rowIdx * ELE_NUM_PER_BLK_FP32], actualRows, colsRound);
+            AscendC::PipeBarrier<PIPE_V>();
+
+            // fp32 -> fp16 -> int8, the values are already in [-127, 127]
+            AscendC::Cast(ubHalf, ubFp32, AscendC::RoundMode::CAST_RINT, computeCount);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(ubEventList[pingpong]);
+            AscendC::Cast(ubOutTensorList[pingpong], ubHalf, AscendC::RoundMode::CAST_RINT, computeCount);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(ubEventList[pingpong]);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(ubEventList[pingpong]);
+
+            AscendC::DataCopyExtParams dataCopyParamsOut(
+                actualRows, cols * sizeof(ElementDst), 0, (strideDst - cols) * sizeof(ElementDst), 0);
+            AscendC::DataCopyPad(gmDst[(rowOffset + rowIdx) * strideDst], ubOutTensorList[pingpong], dataCopyParamsOut);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(ubEventList[pingpong]);
+
+            pingpong = (pingpong + 1) % STAGES;
+        }
+    }
+
+protected:
+    CATLASS_DEVICE
+    void GetRowTask(uint32_t rowsTotal, uint32_t& rowOffset, uint32_t& rows)
+    {
+        uint32_t subBlockNum = AscendC::GetSubBlockNum();
+        uint32_t subBlockIdx = AscendC::GetSubBlockIdx();
+        rows = rowsTotal / subBlockNum;
+        uint32_t rowsRemain = rowsTotal % subBlockNum;
+        rowOffset = subBlockIdx * rows + Min(subBlockIdx, rowsRemain);
+        if (subBlockIdx < rowsRemain) {
+            rows++;
+        }
+    }
+
+    CATLASS_DEVICE
+    void MulRowScale(AscendC::LocalTensor<float> const& ubScaleBrcb, uint32_t rows, uint32_t colsRound)
+    {
+        uint32_t rowStrideBlk = colsRound / ELE_NUM_PER_BLK_FP32;
+        if (rowStrideBlk <= MAX_REP_STRIDE) {
+            // One repeat per row, the scale block of the row is reused with stride 0
+            AscendC::BinaryRepeatParams repeatParams(1, 1, 0, rowStrideBlk, rowStrideBlk, 1);
+            for (uint32_t c = 0; c < colsRound; c += ELE_NUM_PER_REPEAT_FP32) {
+                AscendC::Mul(
+                    ubFp32[c], ubFp32[c], ubScaleBrcb,
+                    static_cast<uint64_t>(Min(ELE_NUM_PER_REPEAT_FP32, colsRound - c)), static_cast<uint8_t>(rows),
+                    repeatParams);
+            }
+            return;
+        }
+        // Rows too wide for the repeat stride, repeat along the columns of each row instead
+        AscendC::BinaryRepeatParams repeatParams(1, 1, 0, BLK_NUM_PER_VECTOR_FRACTAL, BLK_NUM_PER_VECTOR_FRACTAL, 0);
+        uint32_t fullRepeats = colsRound / ELE_NUM_PER_REPEAT_FP32;
+        uint32_t tail = colsRound % ELE_NUM_PER_REPEAT_FP32;
+        for (uint32_t r = 0; r < rows; r++) {
+            auto ubRow = ubFp32[r * colsRound];
+            auto ubScaleBlk = ubScaleBrcb[r * ELE_NUM_PER_BLK_FP32];
+            for (uint32_t i = 0; i < fullRepeats; i += MAX_REPEAT) {
+                AscendC::Mul(
+                    ubRow[i * ELE_NUM_PER_REPEAT_FP32], ubRow[i * ELE_NUM_PER_REPEAT_FP32], ubScaleBlk,
+                    static_cast<uint64_t>(ELE_NUM_PER_REPEAT_FP32),
+                    static_cast<uint8_t>(Min(MAX_REPEAT, fullRepeats - i)), repeatParams);
+            }
+            if (tail > 0) {
+                AscendC::Mul(
+                    ubRow[fullRepeats * ELE_NUM_PER_REPEAT_FP32], ubRow[fullRepeats * ELE_NUM_PER_REPEAT_FP32],
+                    ubScaleBlk, static_cast<uint64_t>(tail), 1, repeatParams);
+            }
+        }
+    }
+
+    /// Data members
+    AscendC::LocalTensor<ElementSrc> ubInTensorList[STAGES];
+    AscendC::LocalTensor<ElementDst> ubOutTensorList[STAGES];
+    AscendC::LocalTensor<float> ubFp32;
+    AscendC::LocalTensor<half> ubHalf;
+    AscendC::LocalTensor<float> ubAbsMax;
+    AscendC::LocalTensor<float> ubRowScale;
+    AscendC::LocalTensor<ElementScale> ubScaleOut;
+    AscendC::LocalTensor<float> ubRowInvBrcb;
+    int32_t ubEventList[STAGES];
+    uint32_t pingpong{0};
+
+    Params params;
+};
+
+} // namespace Catlass::Gemm::Tile
+
+#endif // CATLASS_GEMM_TILE_ATLASA2_QUANT_PER_TOKEN_INT8_HPP
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_ATLASA2_SMALL_INVERSE_HPP
+#define CATLASS_GEMM_TILE_ATLASA2_SMALL_INVERSE_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+
+namespace Catlass::Gemm::Tile {
+
+/// Inverts a small RowMajor n x n matrix (n <= MAX_N) held in UB by Gauss-Jordan elimination without pivoting.
+/// For every pivot p, row p is scaled by 1 / a[p][p] and eliminated from the other rows, then column p is
+/// replaced by the negated multipliers, so the matrix is overwritten by its inverse in place.
+/// The leading principal minors must be nonsingular, e.g. SPD, diagonally dominant or triangular matrices.
+template <class ArchTag, class Element_ = float, uint32_t MAX_N_ = 64>
+struct TileSmallInverse {
+    using Element = Element_;
+
+    static_assert(std::is_same_v<Element, float>, "TileSmallInverse only supports float");
+
+    static constexpr uint32_t MAX_N = MAX_N_;
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(Element);
+    static constexpr uint32_t MAX_N_ROUND = RoundUp(MAX_N, ELE_NUM_PER_BLK);
+    static constexpr uint32_t UB_SIZE_NEEDED = MAX_N * MAX_N_ROUND * sizeof(Element);
+
+    static_assert(UB_SIZE_NEEDED <= ArchTag::UB_SIZE, "MAX_N exceeds the UB size");
+
+    /// Construct. The tile only uses eventId with paired set/wait, so it can run between other UB users.
+    CATLASS_DEVICE
+    TileSmallInverse(Arch::Resource<ArchTag> const& resource, uint32_t ubOffset = 0, int32_t eventId_ = 0)
+        : eventId(eventId_)
+    {
+        ubMatTensor = resource.ubBuf.template GetBufferByByte<Element>(ubOffset);
+    }
+
+    /// gmDst = inverse(gmSrc), where the matrices have leading dimensions ldDst and ldSrc. gmDst may alias gmSrc.
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<Element> const& gmDst, uint32_t ldDst, AscendC::GlobalTensor<Element> const& gmSrc,
+        uint32_t ldSrc, uint32_t n)
+    {
+        uint32_t nRound = RoundUp(n, ELE_NUM_PER_BLK);
+
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventId);
+        AscendC::DataCopyExtParams copyInParams(
+            n, n * sizeof(Element), (ldSrc - n) * sizeof(Element), (nRound - n) / ELE_NUM_PER_BLK, 0);
+        AscendC::DataCopyPadExtParams<Element> padParams(false, 0, 0, 0);
+        AscendC::DataCopyPad(ubMatTensor, gmSrc, copyInParams, padParams);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_S>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_S>(eventId);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventId);
+
+        // Every vector instruction works on one row of n elements
+        AscendC::SetMaskCount();
+        AscendC::SetVectorMask<Element, AscendC::MaskMode::COUNTER>(n);
+        Element factors[MAX_N];
+        for (uint32_t pivotIdx = 0; pivotIdx < n; ++pivotIdx) {
+            for (uint32_t rowIdx = 0; rowIdx < n; ++rowIdx) {
+                factors[rowIdx] = ubMatTensor.GetValue(rowIdx * nRound + pivotIdx);
+            }
+            Element pivotInv = static_cast<Element>(1) / factors[pivotIdx];
+
+            auto ubPivotRow = ubMatTensor[pivotIdx * nRound];
+            AscendC::Muls<Element, false>(
+                ubPivotRow, ubPivotRow, pivotInv, AscendC::MASK_PLACEHOLDER, 1, AscendC::UnaryRepeatParams{});
+            AscendC::PipeBarrier<PIPE_V>();
+            for (uint32_t rowIdx = 0; rowIdx < n; ++rowIdx) {
+                if (rowIdx != pivotIdx) {
+                    AscendC::Axpy<Element, Element, false>(
+                        ubMatTensor[rowIdx * nRound], ubPivotRow, -factors[rowIdx], AscendC::MASK_PLACEHOLDER, 1,
+                        AscendC::UnaryRepeatParams{});
+                }
+            }
+
+            // Column p of the inverse holds the negated multipliers and the pivot reciprocal
+            AscendC::SetFlag<AscendC::HardEvent::V_S>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::V_S>(eventId);
+            for (uint32_t rowIdx = 0; rowIdx < n; ++rowIdx) {
+                ubMatTensor.SetValue(rowIdx * nRound + pivotIdx, -factors[rowIdx] * pivotInv);
+            }
+            ubMatTensor.SetValue(pivotIdx * nRound + pivotIdx, pivotInv);
+            AscendC::SetFlag<AscendC::HardEvent::S_V>(eventId);
+            AscendC::WaitFlag<AscendC::HardEvent::S_V>(eventId);
+        }
+        AscendC::SetMaskNorm();
+        AscendC::ResetMask();
+
+        AscendC::SetFlag<AscendC::HardEvent::S_MTE3>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::S_MTE3>(eventId);
+        AscendC::DataCopyExtParams copyOutParams(
+            n, n * sizeof(Element), (nRound - n) / ELE_NUM_PER_BLK, (ldDst - n) * sizeof(Element), 0);
+        AscendC::DataCopyPad(gmDst, ubMatTensor, copyOutParams);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_S>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_S>(eventId);
+    }
+
+protected:
+    /// Data members
+    AscendC::LocalTensor<Element> ubMatTensor;
+    int32_t eventId;
+};
+
+} // namespace Catlass::Gemm::Tile
+
+#endif // CATLASS_GEMM_TILE_ATLASA2_SMALL_INVERSE_HPP
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_ATLASA2_SMALL_TRSM_HPP
+#define CATLASS_GEMM_TILE_ATLASA2_SMALL_TRSM_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+
+namespace Catlass::Gemm::Tile {
+
+/// Solves L * X = B for a small RowMajor n x n triangular L (n <= MAX_N) and n x nrhs B (nrhs <= MAX_NRHS),
+/// with both matrices held in UB. For every pivot p in substitution order, row p of B is scaled by 1 / l[p][p]
+/// and eliminated from the rows not solved yet, so B is overwritten by X. Only the triangle of L is read.
+template <class ArchTag, class Element_ = float, uint32_t MAX_N_ = 64, uint32_t MAX_NRHS_ = 256>
+struct TileSmallTrsm {
+    using Element = Element_;
+
+    static_assert(std::is_same_v<Element, float>, "TileSmallTrsm only supports float");
+
+    static constexpr uint32_t MAX_N = MAX_N_;
+    static constexpr uint32_t MAX_NRHS = MAX_NRHS_;
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(Element);
+    static constexpr uint32_t MAX_N_ROUND = RoundUp(MAX_N, ELE_NUM_PER_BLK);
+    static constexpr uint32_t MAX_NRHS_ROUND = RoundUp(MAX_NRHS, ELE_NUM_PER_BLK);
+    static constexpr uint32_t UB_SIZE_NEEDED = MAX_N * (MAX_N_ROUND + MAX_NRHS_ROUND) * sizeof(Element);
+
+    static_assert(UB_SIZE_NEEDED <= ArchTag::UB_SIZE, "MAX_N and MAX_NRHS exceed the UB size");
+
+    /// Construct. The tile only uses eventId with paired set/wait, so it can run between other UB users.
+    CATLASS_DEVICE
+    TileSmallTrsm(Arch::Resource<ArchTag> const& resource, uint32_t ubOffset = 0, int32_t eventId_ = 0)
+        : eventId(eventId_)
+    {
+        ubLTensor = resource.ubBuf.template GetBufferByByte<Element>(ubOffset);
+        ubOffset += MAX_N * MAX_N_ROUND * sizeof(Element);
+        ubBTensor = resource.ubBuf.template GetBufferByByte<Element>(ubOffset);
+    }
+
+    /// gmB = inverse(gmL) * gmB, where the matrices have leading dimensions ldL and ldB.
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<Element> const& gmB, uint32_t ldB, AscendC::GlobalTensor<Element> const& gmL,
+        uint32_t ldL, uint32_t n, uint32_t nrhs, bool lower)
+    {
+        uint32_t nRound = RoundUp(n, ELE_NUM_PER_BLK);
+        uint32_t nrhsRound = RoundUp(nrhs, ELE_NUM_PER_BLK);
+
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventId);
+        AscendC::DataCopyPadExtParams<Element> padParams(false, 0, 0, 0);
+        AscendC::DataCopyPad(
+            ubLTensor, gmL,
+            AscendC::DataCopyExtParams(
+                n, n * sizeof(Element), (ldL - n) * sizeof(Element), (nRound - n) / ELE_NUM_PER_BLK, 0),
+            padParams);
+        AscendC::DataCopyPad(
+            ubBTensor, gmB,
+            AscendC::DataCopyExtParams(
+                n, nrhs * sizeof(Element), (ldB - nrhs) * sizeof(Element), (nrhsRound - nrhs) / ELE_NUM_PER_BLK, 0),
+            padParams);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_S>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_S>(eventId);
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventId);
+
+        // Every vector instruction works on one row of nrhs elements, L is only read by the scalar unit
+        AscendC::SetMaskCount();
+        AscendC::SetVectorMask<Element, AscendC::MaskMode::COUNTER>(nrhs);
+        for (uint32_t stepIdx = 0; stepIdx < n; ++stepIdx) {
+            uint32_t pivotIdx = lower ? stepIdx : n - 1 - stepIdx;
+            Element pivotInv = static_cast<Element>(1) / ubLTensor.GetValue(pivotIdx * nRound + pivotIdx);
+
+            auto ubPivotRow = ubBTensor[pivotIdx * nrhsRound];
+            AscendC::Muls<Element, false>(
+                ubPivotRow, ubPivotRow, pivotInv, AscendC::MASK_PLACEHOLDER, 1, AscendC::UnaryRepeatParams{});
+            AscendC::PipeBarrier<PIPE_V>();
+            // Rows below the pivot for lower, above it for upper
+            uint32_t rowStart = lower ? pivotIdx + 1 : 0;
+            uint32_t rowEnd = lower ? n : pivotIdx;
+            for (uint32_t rowIdx = rowStart; rowIdx < rowEnd; ++rowIdx) {
+                AscendC::Axpy<Element, Element, false>(
+                    ubBTensor[rowIdx * nrhsRound], ubPivotRow, -ubLTensor.GetValue(rowIdx * nRound + pivotIdx),
+                    AscendC::MASK_PLACEHOLDER, 1, AscendC::UnaryRepeatParams{});
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+        }
+        AscendC::SetMaskNorm();
+        AscendC::ResetMask();
+
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(eventId);
+        AscendC::DataCopyPad(
+            gmB, ubBTensor,
+            AscendC::DataCopyExtParams(
+                n, nrhs * sizeof(Element), (nrhsRound - nrhs) / ELE_NUM_PER_BLK, (ldB - nrhs) * sizeof(Element), 0));
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(eventId);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventId);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventId);
+    }
+
+protected:
+    /// Data members
+    AscendC::LocalTensor<Element> ubLTensor;
+    AscendC::LocalTensor<Element> ubBTensor;
+    int32_t eventId;
+};
+
+} // namespace Catlass::Gemm::Tile
+
+#endif // CATLASS_GEMM_TILE_ATLASA2_SMALL_TRSM_HPP
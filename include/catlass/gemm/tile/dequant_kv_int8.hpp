@@ -0,0 +1,18 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_DEQUANT_KV_INT8_HPP
+#define CATLASS_GEMM_TILE_DEQUANT_KV_INT8_HPP
+
+#if (defined(CATLASS_ARCH) && CATLASS_ARCH == 2201)
+#include "catlass/gemm/tile/atlasa2/dequant_kv_int8.hpp"
+#endif
+
+#endif
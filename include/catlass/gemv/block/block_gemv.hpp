@@ -22,5 +22,6 @@ struct BlockGemv {
 
 #include "catlass/gemv/block/block_gemv_aiv.hpp"
 #include "catlass/gemv/block/block_gemv_aic.hpp"
+#include "catlass/gemv/block/block_gemv_batched_aiv.hpp"
 
 #endif
@@ -0,0 +1,347 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMV_BLOCK_BLOCK_GEMV_BATCHED_AIV_HPP
+#define CATLASS_GEMV_BLOCK_BLOCK_GEMV_BATCHED_AIV_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemv_coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/numeric_size.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+
+namespace Catlass::Gemv::Block {
+
+/// Batched AIV GEMV, Y[b] = A * X[b] for every row b of X, with A streamed from GM only once.
+/// A is m x n RowMajor in half, int8_t or int4b_t. X is batch x n RowMajor half, Y is batch x m RowMajor.
+/// A quantized A is dequantized to half in UB (the cast sequence of TileCastInt8ToFp16 / TileCastInt4ToInt8)
+/// and rescaled by Scale, a (n / groupSize) x m RowMajor half matrix of per-group (or per-channel when
+/// groupSize == n) scales. The scales are applied to the fp32 partial sum of every group rather than to
+/// every element of A.
+template <uint32_t MAX_BATCH_, class UBTileShape_, class AType_, class XType_, class YType_, class ScaleType_>
+struct BlockGemv<Gemm::GemvAtlasA2Batched<MAX_BATCH_>, UBTileShape_, AType_, XType_, YType_, ScaleType_> {
+public:
+    // Type Aliases
+    using DispatchPolicy = Gemm::GemvAtlasA2Batched<MAX_BATCH_>;
+    using ArchTag = typename DispatchPolicy::ArchTag;
+    using UBTileShape = UBTileShape_;
+    using ElementA = typename AType_::Element;
+    using LayoutA = typename AType_::Layout;
+    using ElementX = typename XType_::Element;
+    using LayoutX = typename XType_::Layout;
+    using ElementY = typename YType_::Element;
+    using LayoutY = typename YType_::Layout;
+    using ElementAccumulator = float;
+
+    static constexpr bool HAS_SCALE = !std::is_void_v<ScaleType_>;
+    using ElementScale =
+        typename std::conditional_t<HAS_SCALE, ScaleType_, Gemm::GemmType<half, layout::RowMajor>>::Element;
+    using LayoutScale = layout::RowMajor;
+
+    static constexpr bool IS_QUANT = !std::is_same_v<ElementA, half>;
+    static constexpr uint32_t STAGES = DispatchPolicy::STAGES;
+    static constexpr uint32_t MAX_BATCH = DispatchPolicy::MAX_BATCH;
+    static constexpr uint32_t TILE_M = UBTileShape::M;
+    static constexpr uint32_t TILE_N = UBTileShape::N;
+
+    static_assert(
+        std::is_same_v<ElementA, half> || std::is_same_v<ElementA, int8_t> ||
+            std::is_same_v<ElementA, AscendC::int4b_t>,
+        "ElementA only supports half, int8_t and int4b_t");
+    static_assert(std::is_same_v<ElementX, half>, "ElementX only supports half");
+    static_assert(
+        std::is_same_v<ElementY, half> || std::is_same_v<ElementY, float>, "ElementY only supports half and float");
+    static_assert(std::is_same_v<ElementScale, half>, "ElementScale only supports half");
+    static_assert(!IS_QUANT || HAS_SCALE, "A quantized A requires a ScaleType");
+    static_assert(std::is_same_v<LayoutA, layout::RowMajor> && std::is_same_v<LayoutX, layout::RowMajor> &&
+                      std::is_same_v<LayoutY, layout::RowMajor>,
+                  "A, X and Y must be RowMajor");
+
+    // fp32 elements of one repeat, the width of one column chunk of the MulAddDst accumulation
+    static constexpr uint32_t CHUNK = BYTE_PER_VECTOR_FRACTAL / sizeof(ElementAccumulator);
+    static constexpr uint32_t ELE_NUM_PER_BLK_A = BYTE_PER_BLK * 8 / SizeOfBits<ElementA>::value;
+    static constexpr uint32_t ELE_NUM_PER_BLK_HALF = BYTE_PER_BLK / sizeof(half);
+    static constexpr uint32_t ELE_NUM_PER_BLK_Y = BYTE_PER_BLK / sizeof(ElementY);
+    static constexpr uint32_t ELE_NUM_PER_BLK_ACC = BYTE_PER_BLK / sizeof(ElementAccumulator);
+    // A tile of TILE_N columns touches at most TILE_N / CHUNK + 1 groups
+    static constexpr uint32_t SCALE_ROWS = TILE_N / CHUNK + 1;
+
+    static_assert(TILE_M % ELE_NUM_PER_BLK_HALF == 0 && TILE_M <= 255, "TILE_M must be a multiple of 16, at most 255");
+    static_assert(TILE_N % CHUNK == 0 && TILE_N / ELE_NUM_PER_BLK_HALF <= 255, "TILE_N must be a multiple of 64");
+    static_assert(MAX_BATCH > 0, "MAX_BATCH must be positive");
+
+    static constexpr uint32_t A_IN_SIZE = TILE_M * TILE_N * SizeOfBits<ElementA>::value / 8;
+    static constexpr uint32_t A_HALF_SIZE = IS_QUANT ? TILE_M * TILE_N * sizeof(half) : 0;
+    static constexpr uint32_t X_SIZE = MAX_BATCH * TILE_N * sizeof(ElementX);
+    static constexpr uint32_t SCALE_SIZE = SCALE_ROWS * TILE_M * sizeof(ElementScale);
+    static constexpr uint32_t SCALE_F_SIZE = SCALE_ROWS * TILE_M * sizeof(ElementAccumulator);
+    static constexpr uint32_t TEMP_SIZE = MAX_BATCH * TILE_M * CHUNK * sizeof(ElementAccumulator);
+    static constexpr uint32_t PARTIAL_SIZE = TILE_M * sizeof(ElementAccumulator);
+    static constexpr uint32_t ACC_SIZE = MAX_BATCH * TILE_M * sizeof(ElementAccumulator);
+    static constexpr uint32_t Y_SIZE = MAX_BATCH * TILE_M * sizeof(ElementY);
+    static_assert(
+        STAGES * (A_IN_SIZE + X_SIZE + SCALE_SIZE) + A_HALF_SIZE + SCALE_F_SIZE + TEMP_SIZE + PARTIAL_SIZE +
+                ACC_SIZE + Y_SIZE <=
+            ArchTag::UB_SIZE,
+        "UB out of bounds, reduce UBTileShape or MAX_BATCH");
+
+    CATLASS_DEVICE
+    BlockGemv()
+    {}
+
+    /// Construct
+    CATLASS_DEVICE
+    BlockGemv(Arch::Resource<ArchTag>& resource, uint32_t ubBufAddrStart = 0)
+    {
+        uint32_t ubOffset = ubBufAddrStart;
+        for (uint32_t i = 0; i < STAGES; i++) {
+            ubAInList[i] = resource.ubBuf.template GetBufferByByte<ElementA>(ubOffset);
+            ubOffset += A_IN_SIZE;
+            ubXList[i] = resource.ubBuf.template GetBufferByByte<ElementX>(ubOffset);
+            ubOffset += X_SIZE;
+            ubScaleList[i] = resource.ubBuf.template GetBufferByByte<ElementScale>(ubOffset);
+            ubOffset += SCALE_SIZE;
+
+            ubInEventList[i] = i;
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubInEventList[i]);
+        }
+        if constexpr (IS_QUANT) {
+            ubAHalf = resource.ubBuf.template GetBufferByByte<half>(ubOffset);
+            ubOffset += A_HALF_SIZE;
+        }
+        ubScaleF = resource.ubBuf.template GetBufferByByte<ElementAccumulator>(ubOffset);
+        ubOffset += SCALE_F_SIZE;
+        ubTemp = resource.ubBuf.template GetBufferByByte<ElementAccumulator>(ubOffset);
+        ubOffset += TEMP_SIZE;
+        ubPartial = resource.ubBuf.template GetBufferByByte<ElementAccumulator>(ubOffset);
+        ubOffset += PARTIAL_SIZE;
+        ubAcc = resource.ubBuf.template GetBufferByByte<ElementAccumulator>(ubOffset);
+        ubOffset += ACC_SIZE;
+        ubY = resource.ubBuf.template GetBufferByByte<ElementY>(ubOffset);
+
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    /// Destructor
+    CATLASS_DEVICE
+    ~BlockGemv()
+    {
+        for (uint32_t i = 0; i < STAGES; i++) {
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubInEventList[i]);
+        }
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+    /// Compute Y[0:batch, 0:m] = A[0:m, 0:n] * X[0:batch, 0:n]^T, where (m, n) = actualShape and m <= TILE_M.
+    /// gmScale points at the scales of row 0 of A, groupSize is the number of columns of A sharing one scale.
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<ElementA> const& gmA, LayoutA const& layoutA, AscendC::GlobalTensor<ElementX> const& gmX,
+        LayoutX const& layoutX, AscendC::GlobalTensor<ElementScale> const& gmScale, LayoutScale const& layoutScale,
+        AscendC::GlobalTensor<ElementY> const& gmY, LayoutY const& layoutY, GemvCoord const& actualShape,
+        uint32_t batch, uint32_t groupSize)
+    {
+        uint32_t mActual = actualShape.m();
+        uint32_t nTotal = actualShape.n();
+        uint32_t nLoops = CeilDiv(nTotal, TILE_N);
+
+        // The previous block must have left ubAcc and ubY
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+        AscendC::Duplicate<ElementAccumulator>(ubTemp, (ElementAccumulator)0.0, batch * TILE_M * CHUNK);
+        AscendC::Duplicate<ElementAccumulator>(ubAcc, (ElementAccumulator)0.0, batch * TILE_M);
+
+        CopyTileIn(
+            stageId, gmA, layoutA, gmX, layoutX, gmScale, layoutScale, 0, mActual, nTotal, batch, groupSize);
+        for (uint32_t nLoopIdx = 0; nLoopIdx < nLoops; nLoopIdx++) {
+            uint32_t nOffset = nLoopIdx * TILE_N;
+            uint32_t nActual = (nLoopIdx == nLoops - 1) ? (nTotal - nOffset) : TILE_N;
+            uint32_t stageIdNext = (stageId + 1 < STAGES) ? (stageId + 1) : 0;
+            if (nLoopIdx + 1 < nLoops) {
+                CopyTileIn(
+                    stageIdNext, gmA, layoutA, gmX, layoutX, gmScale, layoutScale, nOffset + TILE_N, mActual, nTotal,
+                    batch, groupSize);
+            }
+
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(ubInEventList[stageId]);
+            ComputeTile(stageId, nOffset, nActual, mActual, nTotal, batch, groupSize);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(ubInEventList[stageId]);
+            stageId = stageIdNext;
+        }
+
+        CopyOut(gmY, layoutY, mActual, batch);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_ID0);
+    }
+
+private:
+    /// Load columns [nOffset, nOffset + TILE_N) of A and X, and the scales of the groups they touch, into stage
+    CATLASS_DEVICE
+    void CopyTileIn(
+        uint32_t stage, AscendC::GlobalTensor<ElementA> const& gmA, LayoutA const& layoutA,
+        AscendC::GlobalTensor<ElementX> const& gmX, LayoutX const& layoutX,
+        AscendC::GlobalTensor<ElementScale> const& gmScale, LayoutScale const& layoutScale,
+        uint32_t nOffset, uint32_t mActual, uint32_t nTotal, uint32_t batch, uint32_t groupSize)
+    {
+        uint32_t nActual = (nTotal - nOffset < TILE_N) ? (nTotal - nOffset) : TILE_N;
+
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(ubInEventList[stage]);
+
+        uint32_t nRoundA = RoundUp(nActual, ELE_NUM_PER_BLK_A);
+        AscendC::DataCopyExtParams aParams(
+            mActual, BitsToBytes<uint32_t>(nActual * SizeOfBits<ElementA>::value),
+            BitsToBytes<uint32_t>((layoutA.stride(0) - nActual) * SizeOfBits<ElementA>::value),
+            (TILE_N - nRoundA) / ELE_NUM_PER_BLK_A, 0);
+        AscendC::DataCopyPad(
+            ubAInList[stage], gmA[nOffset], aParams, AscendC::DataCopyPadExtParams<ElementA>(false, 0, 0, 0));
+
+        uint32_t nRoundX = RoundUp(nActual, ELE_NUM_PER_BLK_HALF);
+        AscendC::DataCopyExtParams xParams(
+            batch, nActual * sizeof(ElementX), (layoutX.stride(0) - nActual) * sizeof(ElementX),
+            (TILE_N - nRoundX) / ELE_NUM_PER_BLK_HALF, 0);
+        AscendC::DataCopyPad(
+            ubXList[stage], gmX[nOffset], xParams, AscendC::DataCopyPadExtParams<ElementX>(false, 0, 0, 0));
+
+        if constexpr (HAS_SCALE) {
+            uint32_t groupFirst = nOffset / groupSize;
+            uint32_t groupLast = (nOffset + nActual - 1) / groupSize;
+            uint32_t mRound = RoundUp(mActual, ELE_NUM_PER_BLK_HALF);
+            AscendC::DataCopyExtParams scaleParams(
+                groupLast - groupFirst + 1, mActual * sizeof(ElementScale),
+                (layoutScale.stride(0) - mActual) * sizeof(ElementScale), (TILE_M - mRound) / ELE_NUM_PER_BLK_HALF, 0);
+            AscendC::DataCopyPad(
+                ubScaleList[stage], gmScale[groupFirst * layoutScale.stride(0)], scaleParams,
+                AscendC::DataCopyPadExtParams<ElementScale>(false, 0, 0, 0));
+        }
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(ubInEventList[stage]);
+    }
+
+    CATLASS_DEVICE
+    void ComputeTile(
+        uint32_t stage, uint32_t nOffset, uint32_t nActual, uint32_t mActual, uint32_t nTotal, uint32_t batch,
+        uint32_t groupSize)
+    {
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::LocalTensor<half> ubA;
+        if constexpr (IS_QUANT) {
+            // int8/int4 -> half is exact, the scales are applied to the group sums
+            AscendC::Cast(ubAHalf, ubAInList[stage], AscendC::RoundMode::CAST_NONE, mActual * TILE_N);
+            ubA = ubAHalf;
+        } else {
+            ubA = ubAInList[stage];
+        }
+        uint32_t groupFirst = 0;
+        if constexpr (HAS_SCALE) {
+            groupFirst = nOffset / groupSize;
+            uint32_t groupLast = (nOffset + nActual - 1) / groupSize;
+            AscendC::Cast(
+                ubScaleF, ubScaleList[stage], AscendC::RoundMode::CAST_NONE, (groupLast - groupFirst + 1) * TILE_M);
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+
+        AscendC::BinaryRepeatParams params;
+        params.dstBlkStride = 1;
+        params.src0BlkStride = 1;
+        params.src1BlkStride = 1;
+        params.dstRepStride = CHUNK / ELE_NUM_PER_BLK_ACC;
+        params.src0RepStride = TILE_N / ELE_NUM_PER_BLK_HALF;
+        // Broadcast the x chunk to every row of A
+        params.src1RepStride = 0;
+
+        uint32_t chunks = CeilDiv(nActual, CHUNK);
+        for (uint32_t chunkIdx = 0; chunkIdx < chunks; chunkIdx++) {
+            uint32_t colStart = chunkIdx * CHUNK;
+            uint32_t colEnd = (colStart + CHUNK < nActual) ? (colStart + CHUNK) : nActual;
+            if (colEnd - colStart == CHUNK) {
+                AscendC::SetMaskCount();
+                AscendC::SetVectorMask<ElementAccumulator, AscendC::MaskMode::COUNTER>(mActual * CHUNK);
+                for (uint32_t batchIdx = 0; batchIdx < batch; batchIdx++) {
+                    AscendC::MulAddDst<ElementAccumulator, half, false>(
+                        ubTemp[batchIdx * TILE_M * CHUNK], ubA[colStart],
+                        ubXList[stage][batchIdx * TILE_N + colStart], AscendC::MASK_PLACEHOLDER, 1, params);
+                }
+                AscendC::SetMaskNorm();
+                AscendC::ResetMask();
+            } else {
+                uint64_t remainMask = colEnd - colStart;
+                for (uint32_t batchIdx = 0; batchIdx < batch; batchIdx++) {
+                    AscendC::MulAddDst<ElementAccumulator, half, true>(
+                        ubTemp[batchIdx * TILE_M * CHUNK], ubA[colStart],
+                        ubXList[stage][batchIdx * TILE_N + colStart], remainMask, mActual, params);
+                }
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+
+            uint32_t colGlobalEnd = nOffset + colEnd;
+            if (colGlobalEnd % groupSize == 0 || colGlobalEnd == nTotal) {
+                FlushGroup((colGlobalEnd - 1) / groupSize - groupFirst, mActual, batch);
+            }
+        }
+    }
+
+    /// Reduce the lane sums of the finished group and add them, scaled, into the accumulators
+    CATLASS_DEVICE
+    void FlushGroup(uint32_t scaleRow, uint32_t mActual, uint32_t batch)
+    {
+        for (uint32_t batchIdx = 0; batchIdx < batch; batchIdx++) {
+            AscendC::LocalTensor<ElementAccumulator> ubAccBatch = ubAcc[batchIdx * TILE_M];
+            AscendC::WholeReduceSum<ElementAccumulator, true>(
+                ubPartial, ubTemp[batchIdx * TILE_M * CHUNK], CHUNK, mActual, 1, 1, CHUNK / ELE_NUM_PER_BLK_ACC);
+            AscendC::PipeBarrier<PIPE_V>();
+            if constexpr (HAS_SCALE) {
+                AscendC::Mul(ubPartial, ubPartial, ubScaleF[scaleRow * TILE_M], mActual);
+                AscendC::PipeBarrier<PIPE_V>();
+            }
+            AscendC::Add(ubAccBatch, ubAccBatch, ubPartial, mActual);
+            AscendC::PipeBarrier<PIPE_V>();
+        }
+        AscendC::Duplicate<ElementAccumulator>(ubTemp, (ElementAccumulator)0.0, batch * TILE_M * CHUNK);
+        AscendC::PipeBarrier<PIPE_V>();
+    }
+
+    CATLASS_DEVICE
+    void CopyOut(AscendC::GlobalTensor<ElementY> const& gmY, LayoutY const& layoutY, uint32_t mActual, uint32_t batch)
+    {
+        AscendC::LocalTensor<ElementY> ubOut;
+        if constexpr (std::is_same_v<ElementY, float>) {
+            ubOut = ubAcc;
+        } else {
+            AscendC::Cast(ubY, ubAcc, AscendC::RoundMode::CAST_RINT, batch * TILE_M);
+            ubOut = ubY;
+        }
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        uint32_t mRound = RoundUp(mActual, ELE_NUM_PER_BLK_Y);
+        AscendC::DataCopyExtParams outParams(
+            batch, mActual * sizeof(ElementY), (TILE_M - mRound) / ELE_NUM_PER_BLK_Y,
+            (layoutY.stride(0) - mActual) * sizeof(ElementY), 0);
+        AscendC::DataCopyPad(gmY, ubOut, outParams);
+    }
+
+    // Multi-stage tensors list
+    AscendC::LocalTensor<ElementA> ubAInList[STAGES];
+    AscendC::LocalTensor<ElementX> ubXList[STAGES];
+    AscendC::LocalTensor<ElementScale> ubScaleList[STAGES];
+    AscendC::LocalTensor<half> ubAHalf;
+    AscendC::LocalTensor<ElementAccumulator> ubScaleF;
+    // Per batch, TILE_M rows of CHUNK fp32 lane sums of the current group
+    AscendC::LocalTensor<ElementAccumulator> ubTemp;
+    AscendC::LocalTensor<ElementAccumulator> ubPartial;
+    AscendC::LocalTensor<ElementAccumulator> ubAcc;
+    AscendC::LocalTensor<ElementY> ubY;
+
+    int32_t ubInEventList[STAGES];
+    uint32_t stageId{0};
+};
+
+} // namespace Catlass::Gemv::Block
+
+#endif // CATLASS_GEMV_BLOCK_BLOCK_GEMV_BATCHED_AIV_HPP
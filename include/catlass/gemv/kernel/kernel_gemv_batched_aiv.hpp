@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMV_KERNEL_GEMV_BATCHED_AIV_HPP
+#define CATLASS_GEMV_KERNEL_GEMV_BATCHED_AIV_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/gemv_coord.hpp"
+
+namespace Catlass::Gemv::Kernel {
+
+// Template for batched gemv kernel, Compute Y[b] = dequant(A) * X[b] for b in [0, batch).
+// Every AIV owns TILE_M rows of A at a time and streams them once for all the x vectors. groupSize == 0 selects
+// per-channel scales (one scale per row of A), otherwise n must be a multiple of groupSize.
+template <class BlockGemv_>
+class KernelGemvBatchedAiv {
+public:
+    using BlockGemv = BlockGemv_;
+    using ArchTag = typename BlockGemv::ArchTag;
+    using UBTileShape = typename BlockGemv::UBTileShape;
+    using ElementA = typename BlockGemv::ElementA;
+    using LayoutA = typename BlockGemv::LayoutA;
+    using ElementX = typename BlockGemv::ElementX;
+    using LayoutX = typename BlockGemv::LayoutX;
+    using ElementY = typename BlockGemv::ElementY;
+    using LayoutY = typename BlockGemv::LayoutY;
+    using ElementScale = typename BlockGemv::ElementScale;
+    using LayoutScale = typename BlockGemv::LayoutScale;
+    using ElementAccumulator = typename BlockGemv::ElementAccumulator;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemvCoord problemShape;
+        uint32_t batch;
+        uint32_t groupSize;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrX;
+        LayoutX layoutX;
+        GM_ADDR ptrScale;
+        LayoutScale layoutScale;
+        GM_ADDR ptrY;
+        LayoutY layoutY;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GemvCoord const& problemShape_, uint32_t batch_, uint32_t groupSize_, GM_ADDR ptrA_, LayoutA layoutA_,
+            GM_ADDR ptrX_, LayoutX layoutX_, GM_ADDR ptrScale_, LayoutScale layoutScale_, GM_ADDR ptrY_,
+            LayoutY layoutY_)
+            : problemShape(problemShape_),
+              batch(batch_),
+              groupSize(groupSize_),
+              ptrA(ptrA_),
+              layoutA(layoutA_),
+              ptrX(ptrX_),
+              layoutX(layoutX_),
+              ptrScale(ptrScale_),
+              layoutScale(layoutScale_),
+              ptrY(ptrY_),
+              layoutY(layoutY_)
+        {}
+    };
+
+    struct Arguments {
+        GemvCoord problemShape;
+        uint32_t batch;
+        uint32_t groupSize; // 0: per-channel
+        GM_ADDR ptrA;
+        GM_ADDR ptrX;
+        GM_ADDR ptrScale; // nullptr when A is not quantized
+        GM_ADDR ptrY;
+    };
+
+    static bool CanImplement(const Arguments& args)
+    {
+        uint32_t n = args.problemShape.n();
+        if (args.batch == 0 || args.batch > BlockGemv::MAX_BATCH || n == 0) {
+            return false;
+        }
+        if constexpr (std::is_same_v<ElementA, AscendC::int4b_t>) {
+            // Every row of A must start on a byte
+            if (n % 2 != 0) {
+                return false;
+            }
+        }
+        if constexpr (BlockGemv::HAS_SCALE) {
+            if (args.ptrScale == nullptr) {
+                return false;
+            }
+            // Group boundaries must fall on the 64 column chunks of the accumulation
+            if (args.groupSize != 0 && (args.groupSize % BlockGemv::CHUNK != 0 || n % args.groupSize != 0)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        uint32_t m = args.problemShape.m();
+        uint32_t n = args.problemShape.n();
+        uint32_t groupSize = (args.groupSize == 0) ? n : args.groupSize;
+        LayoutA layoutA{m, n};
+        LayoutX layoutX{args.batch, n};
+        LayoutScale layoutScale{CeilDiv(n, groupSize), m};
+        LayoutY layoutY{args.batch, m};
+        Params params{args.problemShape, args.batch,    groupSize,   args.ptrA, layoutA, args.ptrX,
+                      layoutX,           args.ptrScale, layoutScale, args.ptrY, layoutY};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    KernelGemvBatchedAiv()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params) {};
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {}
+
+    /// Executes one batched gemv
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        Arch::Resource<ArchTag> resource;
+        BlockGemv blockGemv(resource);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer((__gm__ ElementA*)params.ptrA);
+        AscendC::GlobalTensor<ElementX> gmX;
+        gmX.SetGlobalBuffer((__gm__ ElementX*)params.ptrX);
+        AscendC::GlobalTensor<ElementScale> gmScale;
+        gmScale.SetGlobalBuffer((__gm__ ElementScale*)params.ptrScale);
+        AscendC::GlobalTensor<ElementY> gmY;
+        gmY.SetGlobalBuffer((__gm__ ElementY*)params.ptrY);
+
+        uint32_t m = params.problemShape.m();
+        uint32_t n = params.problemShape.n();
+        uint32_t mLoops = CeilDiv(m, UBTileShape::M);
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetTaskRation();
+        for (uint32_t loopIdx = AscendC::GetBlockIdx(); loopIdx < mLoops; loopIdx += aivNum) {
+            uint32_t mOffset = loopIdx * UBTileShape::M;
+            uint32_t mActual = (mOffset + UBTileShape::M < m) ? UBTileShape::M : (m - mOffset);
+            blockGemv(
+                gmA[static_cast<int64_t>(mOffset) * n], params.layoutA, gmX, params.layoutX, gmScale[mOffset],
+                params.layoutScale, gmY[mOffset], params.layoutY, GemvCoord{mActual, n}, params.batch,
+                params.groupSize);
+        }
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+};
+
+} // namespace Catlass::Gemv::Kernel
+
+#endif // CATLASS_GEMV_KERNEL_GEMV_BATCHED_AIV_HPP
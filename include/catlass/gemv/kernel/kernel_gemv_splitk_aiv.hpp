@@ -0,0 +1,304 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMV_KERNEL_GEMV_SPLITK_AIV_HPP
+#define CATLASS_GEMV_KERNEL_GEMV_SPLITK_AIV_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/gemv_coord.hpp"
+
+namespace Catlass::Gemv::Kernel {
+
+// Template for split-k gemv kernel, Compute Y[b] = dequant(A) * X[b] for b in [0, batch) with n split across AIVs.
+// BlockGemv is the batched AIV gemv block with an fp32 Y, it computes the partial sums of TILE_M rows over one slice
+// of n. The partial sums are either atomically added into one fp32 workspace (fast, order of the additions is not
+// fixed) or, in deterministic mode, stored per slice and summed in slice order by ReduceAdd, which also casts the
+// result to the output type.
+template <class BlockGemv_, class ReduceAdd_>
+class KernelGemvSplitkAiv {
+public:
+    using BlockGemv = BlockGemv_;
+    using ArchTag = typename BlockGemv::ArchTag;
+    using UBTileShape = typename BlockGemv::UBTileShape;
+    using ElementA = typename BlockGemv::ElementA;
+    using LayoutA = typename BlockGemv::LayoutA;
+    using ElementX = typename BlockGemv::ElementX;
+    using LayoutX = typename BlockGemv::LayoutX;
+    using ElementScale = typename BlockGemv::ElementScale;
+    using LayoutScale = typename BlockGemv::LayoutScale;
+    using ElementAccumulator = typename BlockGemv::ElementY;
+    using LayoutWorkspace = typename BlockGemv::LayoutY;
+
+    using ReduceAdd = ReduceAdd_;
+    using ElementY = typename ReduceAdd::ElementOut;
+
+    static_assert(std::is_same_v<ElementAccumulator, float>, "The partial sums of BlockGemv must be float");
+    static_assert(
+        std::is_same_v<typename ReduceAdd::ElementAccumulator, ElementAccumulator>,
+        "ReduceAdd must read the partial sums of BlockGemv");
+
+    // Every slice keeps at least this many columns of A, so that a slice fills the double buffer
+    static constexpr uint32_t MIN_K_PER_SLICE = 2 * UBTileShape::N;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemvCoord problemShape;
+        uint32_t batch;
+        uint32_t groupSize;
+        uint32_t splitkFactor;
+        uint32_t kSlice;
+        bool deterministic;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrX;
+        LayoutX layoutX;
+        GM_ADDR ptrScale;
+        LayoutScale layoutScale;
+        GM_ADDR ptrY;
+        GM_ADDR ptrWorkspace;
+        LayoutWorkspace layoutWorkspace;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params()
+        {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GemvCoord const& problemShape_, uint32_t batch_, uint32_t groupSize_, uint32_t splitkFactor_,
+            uint32_t kSlice_, bool deterministic_, GM_ADDR ptrA_, LayoutA layoutA_, GM_ADDR ptrX_, LayoutX layoutX_,
+            GM_ADDR ptrScale_, LayoutScale layoutScale_, GM_ADDR ptrY_, GM_ADDR ptrWorkspace_,
+            LayoutWorkspace layoutWorkspace_)
+            : problemShape(problemShape_),
+              batch(batch_),
+              groupSize(groupSize_),
+              splitkFactor(splitkFactor_),
+              kSlice(kSlice_),
+              deterministic(deterministic_),
+              ptrA(ptrA_),
+              layoutA(layoutA_),
+              ptrX(ptrX_),
+              layoutX(layoutX_),
+              ptrScale(ptrScale_),
+              layoutScale(layoutScale_),
+              ptrY(ptrY_),
+              ptrWorkspace(ptrWorkspace_),
+              layoutWorkspace(layoutWorkspace_)
+        {}
+    };
+
+    struct Arguments {
+        GemvCoord problemShape;
+        uint32_t batch;
+        uint32_t groupSize;    // 0: per-channel
+        uint32_t splitkFactor; // 0: chosen from m, n and aivNum
+        uint32_t aivNum;       // number of AIVs the kernel is launched on, used by the automatic split
+        bool deterministic;
+        GM_ADDR ptrA;
+        GM_ADDR ptrX;
+        GM_ADDR ptrScale; // nullptr when A is not quantized
+        GM_ADDR ptrY;
+    };
+
+    /// Choose the number of slices of n. Split only as far as needed to give every AIV a task, and never below
+    /// MIN_K_PER_SLICE columns per slice.
+    static uint32_t GetSplitkFactor(GemvCoord const& problemShape, uint32_t aivNum)
+    {
+        uint32_t mLoops = CeilDiv(problemShape.m(), UBTileShape::M);
+        if (aivNum <= mLoops) {
+            return 1;
+        }
+        uint32_t splitkFactor = aivNum / mLoops;
+        uint32_t maxSplitkFactor = CeilDiv(problemShape.n(), MIN_K_PER_SLICE);
+        return (splitkFactor < maxSplitkFactor) ? splitkFactor : maxSplitkFactor;
+    }
+
+    /// Length of one slice of n. Slices start on a group boundary so that every slice reads whole groups of scales
+    static uint32_t GetKSlice(Arguments const& args)
+    {
+        uint32_t n = args.problemShape.n();
+        uint32_t splitkFactor =
+            (args.splitkFactor == 0) ? GetSplitkFactor(args.problemShape, args.aivNum) : args.splitkFactor;
+        uint32_t kAlign = UBTileShape::N;
+        if constexpr (BlockGemv::HAS_SCALE) {
+            if (args.groupSize != 0) {
+                kAlign = args.groupSize;
+            }
+        }
+        return RoundUp(CeilDiv(n, splitkFactor), kAlign);
+    }
+
+    static bool CanImplement(const Arguments& args)
+    {
+        uint32_t n = args.problemShape.n();
+        if (args.batch == 0 || args.batch > BlockGemv::MAX_BATCH || n == 0) {
+            return false;
+        }
+        if (args.splitkFactor == 0 && args.aivNum == 0) {
+            return false;
+        }
+        if constexpr (std::is_same_v<ElementA, AscendC::int4b_t>) {
+            // Every row and every slice of A must start on a byte
+            if (n % 2 != 0) {
+                return false;
+            }
+        }
+        if constexpr (BlockGemv::HAS_SCALE) {
+            if (args.ptrScale == nullptr) {
+                return false;
+            }
+            if (args.groupSize != 0 && (args.groupSize % BlockGemv::CHUNK != 0 || n % args.groupSize != 0)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments& args)
+    {
+        size_t sliceSize = sizeof(ElementAccumulator) * args.batch * args.problemShape.m();
+        if (args.deterministic) {
+            return sliceSize * CeilDiv(args.problemShape.n(), GetKSlice(args));
+        }
+        return sliceSize;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments& args, uint8_t* workspace)
+    {
+        uint32_t m = args.problemShape.m();
+        uint32_t n = args.problemShape.n();
+        uint32_t groupSize = (args.groupSize == 0) ? n : args.groupSize;
+        uint32_t kSlice = GetKSlice(args);
+        // Recount the slices, the rounding of kSlice may leave fewer than requested
+        uint32_t splitkFactor = CeilDiv(n, kSlice);
+        LayoutA layoutA{m, n};
+        LayoutX layoutX{args.batch, n};
+        LayoutScale layoutScale{CeilDiv(n, groupSize), m};
+        LayoutWorkspace layoutWorkspace{args.batch, m};
+        Params params{args.problemShape, args.batch, groupSize, splitkFactor, kSlice, args.deterministic,
+                      args.ptrA,         layoutA,    args.ptrX, layoutX,      args.ptrScale, layoutScale,
+                      args.ptrY,         workspace,  layoutWorkspace};
+        return params;
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    KernelGemvSplitkAiv()
+    {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE void operator()(Params const& params) {};
+
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIC>(Params const& params)
+    {}
+
+    /// Executes one split-k gemv
+    template <>
+    CATLASS_DEVICE void operator()<AscendC::AIV>(Params const& params)
+    {
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer((__gm__ ElementA*)params.ptrA);
+        AscendC::GlobalTensor<ElementX> gmX;
+        gmX.SetGlobalBuffer((__gm__ ElementX*)params.ptrX);
+        AscendC::GlobalTensor<ElementScale> gmScale;
+        gmScale.SetGlobalBuffer((__gm__ ElementScale*)params.ptrScale);
+        AscendC::GlobalTensor<ElementY> gmY;
+        gmY.SetGlobalBuffer((__gm__ ElementY*)params.ptrY);
+        AscendC::GlobalTensor<ElementAccumulator> gmWorkspace;
+        gmWorkspace.SetGlobalBuffer((__gm__ ElementAccumulator*)params.ptrWorkspace);
+
+        uint32_t m = params.problemShape.m();
+        uint32_t n = params.problemShape.n();
+        uint64_t sliceSize = static_cast<uint64_t>(params.batch) * m;
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetTaskRation();
+        uint32_t aivId = AscendC::GetBlockIdx();
+
+        if (!params.deterministic) {
+            ZeroWorkspace(gmWorkspace, sliceSize, aivId, aivNum);
+            AscendC::PipeBarrier<PIPE_ALL>();
+            Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+            AscendC::SetAtomicAdd<ElementAccumulator>();
+        }
+
+        {
+            BlockGemv blockGemv(resource);
+            uint32_t mLoops = CeilDiv(m, UBTileShape::M);
+            uint32_t loops = mLoops * params.splitkFactor;
+            // Slices of the same rows are adjacent, so that concurrent tasks share the rows of A in L2
+            for (uint32_t loopIdx = aivId; loopIdx < loops; loopIdx += aivNum) {
+                uint32_t mIdx = loopIdx / params.splitkFactor;
+                uint32_t kIdx = loopIdx % params.splitkFactor;
+                uint32_t mOffset = mIdx * UBTileShape::M;
+                uint32_t mActual = (mOffset + UBTileShape::M < m) ? UBTileShape::M : (m - mOffset);
+                uint32_t kOffset = kIdx * params.kSlice;
+                uint32_t kActual = (kOffset + params.kSlice < n) ? params.kSlice : (n - kOffset);
+                uint64_t gmOffsetWorkspace = params.deterministic ? kIdx * sliceSize : 0;
+                uint64_t gmOffsetScale = static_cast<uint64_t>(kOffset / params.groupSize) * m + mOffset;
+                blockGemv(
+                    gmA[static_cast<int64_t>(mOffset) * n + kOffset], params.layoutA, gmX[kOffset], params.layoutX,
+                    gmScale[gmOffsetScale], params.layoutScale, gmWorkspace[gmOffsetWorkspace + mOffset],
+                    params.layoutWorkspace, GemvCoord{mActual, kActual}, params.batch, params.groupSize);
+            }
+        }
+        AscendC::PipeBarrier<PIPE_ALL>();
+        if (!params.deterministic) {
+            AscendC::SetAtomicNone();
+        }
+
+        Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+        ReduceAdd reduceAdd(resource);
+        reduceAdd(gmY, gmWorkspace, sliceSize, params.deterministic ? params.splitkFactor : 1);
+
+        AscendC::PipeBarrier<PIPE_ALL>();
+    }
+
+private:
+    /// Zero this AIV's share of the atomic accumulation workspace
+    CATLASS_DEVICE
+    void ZeroWorkspace(
+        AscendC::GlobalTensor<ElementAccumulator> const& gmWorkspace, uint64_t elementCount, uint32_t aivId,
+        uint32_t aivNum)
+    {
+        constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(ElementAccumulator);
+        constexpr uint32_t FILL_LENGTH = 4096;
+        uint64_t elementsPerAiv = RoundUp(CeilDiv(elementCount, static_cast<uint64_t>(aivNum)), ELE_NUM_PER_BLK);
+        uint64_t start = aivId * elementsPerAiv;
+        if (start >= elementCount) {
+            return;
+        }
+        uint64_t end = (start + elementsPerAiv < elementCount) ? (start + elementsPerAiv) : elementCount;
+
+        AscendC::LocalTensor<ElementAccumulator> ubZero =
+            resource.ubBuf.template GetBufferByByte<ElementAccumulator>(0);
+        AscendC::Duplicate<ElementAccumulator>(ubZero, (ElementAccumulator)0.0, FILL_LENGTH);
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_ID0);
+        for (uint64_t offset = start; offset < end; offset += FILL_LENGTH) {
+            uint32_t actualLength = (offset + FILL_LENGTH < end) ? FILL_LENGTH : (end - offset);
+            AscendC::DataCopyPad(
+                gmWorkspace[offset], ubZero,
+                AscendC::DataCopyExtParams(1, actualLength * sizeof(ElementAccumulator), 0, 0, 0));
+        }
+    }
+
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Gemv::Kernel
+
+#endif // CATLASS_GEMV_KERNEL_GEMV_SPLITK_AIV_HPP
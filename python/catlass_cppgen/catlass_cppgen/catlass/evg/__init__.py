@@ -15,6 +15,7 @@ from catlass_cppgen.catlass.evg.node import (
     LoadNode,
     NodeBase,
     NodeMetadata,
+    ReduceNode,
     StoreNode,
     TopoVisitorNode,
 )
@@ -28,6 +29,7 @@ __all__ = [
     "LoadNode",
     "NodeBase",
     "NodeMetadata",
+    "ReduceNode",
     "StoreNode",
     "TopoVisitorNode",
 ]
@@ -23,6 +23,7 @@ from .node import (
     ConstantNode,
     LoadNode,
     NodeBase,
+    ReduceNode,
     StoreNode,
     TopoVisitorNode,
 )
@@ -33,6 +34,51 @@ if TYPE_CHECKING:
 
 
 # ============ Graph Passes ============
+def SpliceReduceNodes(dag: EpilogueVisitorGraph):
+    """
+    Turn each reduce node into a pass-through visitor on the main output path.
+
+    The Catlass reduce visitors write the reduced result to GM by themselves and forward
+    their input unchanged, so:
+        - the returned store node consuming the reduce node is dropped, the reduce node
+          takes over its name (pointer) and shape (layout)
+        - the other users of the reduce input are rewired to consume the reduce node
+    e.g. `accum -> reduce -> row_sum`, `accum -> result` becomes `accum -> reduce -> result`
+    """
+    for node in dag.topological_nodes():
+        if not isinstance(node, ReduceNode):
+            continue
+
+        outputs = dag.get_outputs(node)
+        if (
+            len(outputs) != 1
+            or not isinstance(outputs[0], StoreNode)
+            or not outputs[0].metadata.is_output
+        ):
+            raise ValueError(
+                f"Result of reduce node '{node.name}' must be returned directly"
+            )
+        store_node = outputs[0]
+        out_shape = tuple(store_node.metadata.shape)
+        if node.dim == 0:
+            node.reduce_shape = (1, out_shape[-1])
+        else:
+            node.reduce_shape = (1, out_shape[0])
+        node.output_name = store_node.name
+        dag.remove_node(store_node)
+
+        input_node = dag.get_inputs(node)[0]
+        users = [user for user in dag.get_outputs(input_node) if user != node]
+        if not users:
+            raise ValueError(
+                f"Input of reduce node '{node.name}' must also contribute to the returned output"
+            )
+        for user in users:
+            pos = dag.get_edge_pos(input_node, user)
+            dag.remove_edge(input_node, user)
+            dag.add_edge(node, user, pos)
+
+
 def EliminateDupAndDeadNodes(dag: EpilogueVisitorGraph):
     """
     1) Eliminate duplicated nodes:
@@ -328,9 +374,16 @@ def BroadcastPropagation(dag: EpilogueVisitorGraph):
             raise RuntimeError(
                 f"Node '{node.name}' shape {src_shape} cannot be broadcast to output shape {dst_shape}"
             )
-        if col_broadcast:
-            raise RuntimeError("EVG does not support ColumnBroadcast yet!")
-        if row_broadcast:
+        if row_broadcast and col_broadcast:
+            # A single element broadcast to the whole tile, e.g. alpha with shape (1, 1)
+            node.metadata.broadcast = BroadcastType.RowColBroadcast
+            node.metadata.shape = (1, 1)
+        elif col_broadcast:
+            # One value per row, e.g. per-token scale with shape (m, 1).
+            # The M values are stored contiguously and described by a (1, m) layout.
+            node.metadata.broadcast = BroadcastType.ColBroadcast
+            node.metadata.shape = (1, src_shape[0])
+        elif row_broadcast:
             node.metadata.broadcast = BroadcastType.RowBroadcast
             if len(node.metadata.shape) == 1:
                 node.metadata.shape = (1, node.metadata.shape[0])
@@ -340,15 +393,16 @@ def DynamicShapeTransfer(dag: EpilogueVisitorGraph):
     """
     Subtitutes all shape infos into a experssion of m & n, which aims to support dynamic shape.
     """
-    for node in dag.topological_nodes():
+
+    def transfer(shape):
         # Within dynamic shape mode, the symbolic shape should be a sympy.Symbol or
-        # a sympy expression containing Symbol(s) (e.g. 2*s20). Skip nodes whose shape
-        # is fully static (no free symbols at all).
+        # a sympy expression containing Symbol(s) (e.g. 2*s20). Skip shapes that are
+        # fully static (no free symbols at all).
         if all(
             not (isinstance(shape_i, Expr) and shape_i.free_symbols)
-            for shape_i in node.metadata.shape
+            for shape_i in shape
         ):
-            continue
+            return shape
         symbolic_shape = []
         # Replace longer keys first so that a compound expression like "2*s20" is
         # substituted as a whole before its substring "s20" gets matched, e.g.
@@ -358,12 +412,17 @@ def DynamicShapeTransfer(dag: EpilogueVisitorGraph):
             key=lambda kv: len(kv[0]),
             reverse=True,
         )
-        for shape_i in node.metadata.shape:
+        for shape_i in shape:
             shape_i = str(shape_i)
             for key, item in sorted_substitution:
                 shape_i = shape_i.replace(key, item)
             symbolic_shape.append(shape_i)
-        node.metadata.shape = tuple(symbolic_shape) if symbolic_shape else ()
+        return tuple(symbolic_shape) if symbolic_shape else ()
+
+    for node in dag.topological_nodes():
+        node.metadata.shape = transfer(node.metadata.shape)
+        if isinstance(node, ReduceNode):
+            node.reduce_shape = transfer(node.reduce_shape)
 
 
 def SetNodeImpl(dag: EpilogueVisitorGraph):
@@ -495,6 +554,7 @@ def DAG2Tree(dag: EpilogueVisitorGraph):
 class EVGDef:
     def __init__(self, dag: EpilogueVisitorGraph):
         self.dag = dag
+        SpliceReduceNodes(self.dag)
         EliminateDupAndDeadNodes(self.dag)
         ScalarOpsIdentification(self.dag)
         InferShape(self.dag)
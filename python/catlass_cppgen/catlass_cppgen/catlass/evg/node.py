@@ -27,9 +27,13 @@ from .node_impl import (
     AuxStoreImpl,
     ComputeImpl,
     CastImpl,
+    ColBroadcastImpl,
+    ColReduceImpl,
     NoOpImpl,
     RowBroadcastImpl,
+    RowReduceImpl,
     ScalarComputeImpl,
+    ScalarLoadImpl,
     TopoVisitorImpl,
 )
 
@@ -121,9 +125,26 @@ class CastNode(NodeBase):
 
 
 class ReduceNode(NodeBase):
-    def __init__(self, name: str, metadata: NodeMetadata, reduce_fn):
+    def __init__(self, name: str, metadata: NodeMetadata, reduce_fn, dim: int = 0):
         super().__init__(name, metadata)
         self.reduce_fn = reduce_fn
+        self.dim = dim
+        # Filled by `SpliceReduceNodes`: the returned tensor holding the reduced result
+        self.output_name = name
+        self.reduce_shape: Tuple = ()
+
+    # Possible impls:
+    #   1. RowReduceImpl, dim = 0, reduce (m, n) to (1, n)
+    #   2. ColReduceImpl, dim = 1, reduce (m, n) to (m, 1), stored as (1, m)
+    def get_impl(self):
+        if self.dim == 0:
+            self.impl = RowReduceImpl(self)
+        elif self.dim == 1:
+            self.impl = ColReduceImpl(self)
+        else:
+            raise ValueError(
+                f"Node `{self.name}` only supports reduce dim 0 or 1, got {self.dim}"
+            )
 
 
 class ConstantNode(NodeBase):
@@ -140,6 +161,8 @@ class LoadNode(NodeBase):
     #   1. AccLoadImpl
     #   2. AuxLoadImpl
     #   3. RowBroadcastImpl
+    #   4. ColBroadcastImpl
+    #   5. ScalarLoadImpl
     def get_impl(self):
         if self.metadata.broadcast != BroadcastType.NoBroadcast:
             if self.metadata.op.lower() != "auxload":
@@ -147,6 +170,12 @@ class LoadNode(NodeBase):
             if self.metadata.broadcast == BroadcastType.RowBroadcast:
                 self.impl = RowBroadcastImpl(self)
                 return
+            if self.metadata.broadcast == BroadcastType.ColBroadcast:
+                self.impl = ColBroadcastImpl(self)
+                return
+            if self.metadata.broadcast == BroadcastType.RowColBroadcast:
+                self.impl = ScalarLoadImpl(self)
+                return
             raise RuntimeError(
                 f"Node `{self.name}` does not support {BroadcastTag[self.metadata.broadcast]}"
             )
@@ -72,6 +72,28 @@ class ReductionImplBase(ImplBase):
     def __init__(self, node):
         super().__init__(node)
         self.reduce_fn = self.node.reduce_fn
+        # the visitor itself forwards its input, the layout describes the reduced result
+        self.shape = node.reduce_shape
+        self.layout_name = None
+
+    @property
+    def args_decl(self):
+        if not self.layout_name:
+            self.layout_name, _ = self.make_layout()
+        return f"{{{self.node.output_name}_ptr, {self.layout_name}}}"
+
+    def reduce_type_decl(self, visitor):
+        if self._type_decl is not None:
+            return self._type_decl
+
+        self.layout_name, layout_str = self.make_layout()
+        self._type_decl = layout_str
+        self._type_decl += f"""
+using {self.type_name} = Catlass::Epilogue::Fusion::{visitor}<
+    {EpilogueOpTag[self.reduce_fn]}, {self.element.value}, decltype({self.layout_name})
+>;
+"""
+        return self._type_decl
 
 
 class NoOpImpl(ImplBase):
@@ -258,6 +280,74 @@ using {self.type_name} = Catlass::Epilogue::Fusion::VisitorRowBroadcast<
         return f"{{{self.name}_ptr, {self.layout_name}}}"
 
 
+class ColBroadcastImpl(ImplBase):
+    def __init__(self, node):
+        super().__init__(node)
+        self.layout_name = None
+
+    @property
+    def type_decl(self):
+        """
+        Return the string defining the type
+        """
+        if self._type_decl is not None:
+            return self._type_decl
+
+        self.layout_name, layout_str = self.make_layout()
+        self._type_decl = layout_str
+        self._type_decl += f"""
+using {self.type_name} = Catlass::Epilogue::Fusion::VisitorColBroadcast<
+    {self.element.value}, decltype({self.layout_name})
+>;
+"""
+        return self._type_decl
+
+    @property
+    def args_decl(self):
+        if not self.layout_name:
+            self.layout_name, _ = self.make_layout()
+        return f"{{{self.name}_ptr, {self.layout_name}}}"
+
+
+class ScalarLoadImpl(ImplBase):
+    @property
+    def type_decl(self):
+        """
+        Return the string defining the type
+        """
+        if self._type_decl is not None:
+            return self._type_decl
+
+        self._type_decl = f"""
+using {self.type_name} = Catlass::Epilogue::Fusion::VisitorScalarLoad<
+    {self.element.value}
+>;
+"""
+        return self._type_decl
+
+    @property
+    def args_decl(self):
+        return f"{{{self.name}_ptr}}"
+
+
+class RowReduceImpl(ReductionImplBase):
+    @property
+    def type_decl(self):
+        """
+        Return the string defining the type
+        """
+        return self.reduce_type_decl("VisitorRowReduce")
+
+
+class ColReduceImpl(ReductionImplBase):
+    @property
+    def type_decl(self):
+        """
+        Return the string defining the type
+        """
+        return self.reduce_type_decl("VisitorColReduce")
+
+
 class TopoVisitorImpl(ImplBase):
     def __init__(self, node):
         super().__init__(node.output_node)
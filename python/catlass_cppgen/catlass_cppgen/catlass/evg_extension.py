@@ -31,10 +31,11 @@ from .evg.node import (
     LoadNode,
     NodeBase,
     NodeMetadata,
+    ReduceNode,
     StoreNode,
     TopoVisitorNode,
 )
-from .library import EpilogueOp
+from .library import EpilogueOp, EpilogueReduceOp
 
 
 def _as_tuple(x: Union[Tuple, Any]) -> Tuple:
@@ -121,10 +122,14 @@ class EpilogueVisitorGraph:
                 node.subgraph.get_storage_nodes(nodes_element_dict)
                 continue
             element = node.metadata.element
+            # VisitorColReduce holds a combine buffer plus a per-row result buffer.
+            # The small Brcb buffers of VisitorColBroadcast / VisitorScalarLoad fit in
+            # the UB headroom left by computeLength, so they count as one node.
+            num = 2 if isinstance(node, ReduceNode) and node.dim == 1 else 1
             if element in nodes_element_dict:
-                nodes_element_dict[element] += 1
+                nodes_element_dict[element] += num
             else:
-                nodes_element_dict[element] = 1
+                nodes_element_dict[element] = num
 
     def to_networkx(self) -> nx.DiGraph:
         return self._graph
@@ -222,6 +227,21 @@ class EpilogueVisitorGraph:
         self.add_node(compute_node)
         return name
 
+    def add_reduce_node(self, op, element: DataType, dim: int):
+        name = f"reduce_{next(self.compute_counter)}"
+        metadata = NodeMetadata(
+            op="reduce",
+            element=element,
+        )
+        reduce_node = ReduceNode(
+            name=name,
+            metadata=metadata,
+            reduce_fn=op,
+            dim=dim,
+        )
+        self.add_node(reduce_node)
+        return name
+
     def add_constant_node(self, value, dtype):
         if isinstance(dtype, DataType):
             element = dtype
@@ -294,6 +314,9 @@ class PythonEVGParser(EpilogueVisitorGraph, ast.NodeVisitor):
             "min": EpilogueOp.Min,
             "sigmoid": EpilogueOp.Sigmoid,
             "silu": EpilogueOp.Silu,
+            "reduce_sum": EpilogueOp.ReduceSum,
+            "reduce_max": EpilogueOp.ReduceMax,
+            "reduce_min": EpilogueOp.ReduceMin,
         }
         return mapping[op]
 
@@ -409,6 +432,17 @@ class PythonEVGParser(EpilogueVisitorGraph, ast.NodeVisitor):
         op = self.ast_op_bindings(func)
         # all elements of args should be same for a single compute node.
         input_element = self.get_node(args[0]).metadata.element
+
+        if op in EpilogueReduceOp:
+            # reduce ops look like reduce_sum(input, dim)
+            # dim = 0 reduces (m, n) to (1, n), dim = 1 reduces (m, n) to (m, 1)
+            dim = args[1] if len(args) > 1 else 0
+            if dim not in (0, 1):
+                raise SyntaxError(f"{func} only supports dim 0 or 1, got {dim}")
+            name = self.add_reduce_node(op, input_element, dim)
+            self.add_edge(args[0], name, pos=0)
+            return name
+
         name = self.add_compute_node(op, input_element)
 
         # add edges
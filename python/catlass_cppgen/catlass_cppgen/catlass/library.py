@@ -79,6 +79,11 @@ class EpilogueOp(enum.Enum):
     Mins = enum_auto()
     AddRelu = enum_auto()
 
+    # reduce op
+    ReduceSum = enum_auto()
+    ReduceMax = enum_auto()
+    ReduceMin = enum_auto()
+
 
 EpilogueOpTag = {
     # unary op
@@ -106,6 +111,10 @@ EpilogueOpTag = {
     EpilogueOp.Maxs: "Catlass::Epilogue::Fusion::Maxs",
     EpilogueOp.Mins: "Catlass::Epilogue::Fusion::Mins",
     EpilogueOp.AddRelu: "Catlass::Epilogue::Fusion::AddRelu",
+    # reduce
+    EpilogueOp.ReduceSum: "Catlass::Epilogue::Fusion::ReduceSum",
+    EpilogueOp.ReduceMax: "Catlass::Epilogue::Fusion::ReduceMax",
+    EpilogueOp.ReduceMin: "Catlass::Epilogue::Fusion::ReduceMin",
 }
 
 
@@ -121,6 +130,13 @@ EpilogueScalarOp = {
 }
 
 
+EpilogueReduceOp = {
+    EpilogueOp.ReduceSum,
+    EpilogueOp.ReduceMax,
+    EpilogueOp.ReduceMin,
+}
+
+
 class CastType(enum.Enum):
     NONE = enum_auto()  # When there is precision loss in conversion, it means RINT mode; when there is no precision loss, it means no rounding
     RINT = enum_auto()  # round to nearest even (bankers' rounding)
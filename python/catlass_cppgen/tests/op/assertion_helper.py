@@ -128,3 +128,14 @@ class TestEvgAssertions(TestAssertions):
         ):
             self.t.assertIsNotNone(match, "TreeVisitor not found")
             self.t.assertEqual(match.group(1), vistor_param)
+
+    def test_visitor_reduce(
+        self, template_str: str, node: str, visitor: str, op: EpilogueOp
+    ):
+        match = re.search(
+            rf"using\s+{node}\s*=\s*Catlass::Epilogue::Fusion::(\S+)<\s*(\S+),",
+            template_str,
+        )
+        self.t.assertIsNotNone(match, f"Reduce visitor not found for node {node}")
+        self.t.assertEqual(match.group(1), visitor)
+        self.t.assertEqual(match.group(2), EpilogueOpTag[op])
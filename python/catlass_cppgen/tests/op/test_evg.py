@@ -450,6 +450,97 @@ def epilogue(accum, bias):
             ("Compute0, Accum", "Compute1, EVGCompute0, Bias", "Result, EVGCompute1"),
         )
 
+    def test_evg_reduce(self):
+        fn_src = """
+def epilogue(accum):
+    row_sum = reduce_sum(accum, 0)
+    col_max = reduce_max(accum, 1)
+    result = accum
+    return result, row_sum, col_max
+"""
+        inputs = {
+            "accum": OpTensor.from_shape_stride(
+                shape=(128, 256), stride=(256, 1), dtype=DataType.FLOAT
+            ),
+            "result": OpTensor.from_shape_stride(
+                shape=(128, 256), stride=(256, 1), dtype=DataType.FLOAT
+            ),
+            "row_sum": OpTensor.from_shape_stride(
+                shape=(1, 256), stride=(256, 1), dtype=DataType.FLOAT
+            ),
+            "col_max": OpTensor.from_shape_stride(
+                shape=(128, 1), stride=(1, 1), dtype=DataType.FLOAT
+            ),
+        }
+        evg_str, evg_args = self._build_evg(fn_src, inputs)
+        self.check.test_accu_dtype(evg_str, DataType.FLOAT)
+        self.check.test_visitor_reduce(
+            evg_str, "Reduce0", "VisitorRowReduce", EpilogueOp.ReduceSum
+        )
+        self.check.test_visitor_reduce(
+            evg_str, "Reduce1", "VisitorColReduce", EpilogueOp.ReduceMax
+        )
+        self.assertIn("tagReduce0{1, 256}", evg_str)
+        self.assertIn("tagReduce1{1, 128}", evg_str)
+        self.check.test_tree_visitor(
+            evg_str,
+            ("Reduce0, Accum", "Reduce1, EVGReduce0", "Result, EVGReduce1"),
+        )
+        self.assertIn("{row_sum_ptr, layoutReduce0}", evg_args)
+        self.assertIn("{col_max_ptr, layoutReduce1}", evg_args)
+
+    def test_evg_reduce_not_returned(self):
+        fn_src = """
+def epilogue(accum):
+    row_sum = reduce_sum(accum, 0)
+    result = accum
+    return result
+"""
+        inputs = {
+            "accum": OpTensor.from_shape_stride(
+                shape=(128, 256), stride=(256, 1), dtype=DataType.FLOAT
+            ),
+            "result": OpTensor.from_shape_stride(
+                shape=(128, 256), stride=(256, 1), dtype=DataType.FLOAT
+            ),
+        }
+        with self.assertRaises(ValueError):
+            self._build_evg(fn_src, inputs)
+
+    def test_evg_col_broadcast_scalar(self):
+        fn_src = """
+def epilogue(accum, token_scale, alpha):
+    result = accum * token_scale * alpha
+    return result
+"""
+        inputs = {
+            "accum": OpTensor.from_shape_stride(
+                shape=(128, 256), stride=(256, 1), dtype=DataType.FLOAT
+            ),
+            "token_scale": OpTensor.from_shape_stride(
+                shape=(128, 1), stride=(1, 1), dtype=DataType.FLOAT
+            ),
+            "alpha": OpTensor.from_shape_stride(
+                shape=(1, 1), stride=(1, 1), dtype=DataType.FLOAT
+            ),
+            "result": OpTensor.from_shape_stride(
+                shape=(128, 256), stride=(256, 1), dtype=DataType.FLOAT
+            ),
+        }
+        evg_str, evg_args = self._build_evg(fn_src, inputs)
+        self.check.test_accu_dtype(evg_str, DataType.FLOAT)
+        self.check.test_boardcast(
+            evg_str, "TokenScale", BroadcastType.ColBroadcast
+        )
+        self.assertIn("tagTokenScale{1, 128}", evg_str)
+        self.assertRegex(
+            evg_str,
+            r"using\s+Alpha\s*=\s*Catlass::Epilogue::Fusion::VisitorScalarLoad<",
+        )
+        self.check.test_visitor_compute(evg_str, EpilogueOp.Mul)
+        self.assertIn("{token_scale_ptr, layoutTokenScale}", evg_args)
+        self.assertIn("{alpha_ptr}", evg_args)
+
 
 ######################################
 
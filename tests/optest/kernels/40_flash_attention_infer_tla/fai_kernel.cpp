@@ -740,7 +740,7 @@ CATLASS_GLOBAL __mix__(1,2) void FAInferTla(
         DispatchPolicyQKTail, L1TileShape, L0TileShape, ElementQ, ElementK, ElementS, void, TileCopyQK>;
 
     // Epilogue Block模块，实现Flash Attention Infer中当前S基块的softmax
-    using DispatchPolicyOnlineSoftmax = Epilogue::EpilogueAtlasA2OnlineSoftmax;
+    using DispatchPolicyOnlineSoftmax = Epilogue::EpilogueAtlasA2OnlineSoftmax<>;
     using PType = Gemm::GemmType<ElementP, LayoutP>;
     using SType = Gemm::GemmType<ElementS, LayoutS>;
     using maskType = Gemm::GemmType<ElementMask, LayoutMask>;
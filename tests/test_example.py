@@ -107,6 +107,30 @@ class CatlassExampleTest(unittest.TestCase):
                     "--datapath", os.path.join(CMAKE_EXAMPLES_PATH, "19_mla", "data")]
         self.run_case("19_mla", case_cpp)
 
+    @only_on_2201
+    def test_19_mla_tree(self):
+        # qSeqlen 17..64 packs 2 or 4 heads per task so that heads * qSeqlen fills 128 rows
+        batch = 2
+        q_seqlen_list = "24,40"
+        kv_seqlen_list = "512,1024"
+        num_heads = 16
+        num_blocks = 16
+        block_size = 128
+        dtype = "half"
+
+        case_py = [str(batch), q_seqlen_list, kv_seqlen_list,
+                   str(num_heads), str(num_blocks), str(block_size), dtype, "tree"]
+        ret = subprocess.run(
+            ["python", os.path.join(CMAKE_EXAMPLES_PATH, "19_mla", "gen_data.py")]
+            + case_py
+        )
+        case_cpp = [str(batch), q_seqlen_list, kv_seqlen_list,
+                    str(num_heads), str(num_blocks), str(block_size),
+                    "--dtype", dtype,
+                    "--datapath", os.path.join(CMAKE_EXAMPLES_PATH, "19_mla", "data"),
+                    "--tree"]
+        self.run_case("19_mla", case_cpp)
+
     @only_on_2201
     def test_24_conv_bias(self):
         case_base = [
@@ -475,6 +499,7 @@ class CatlassExampleTest(unittest.TestCase):
 
 normal_cases_2201 = [
     "00_basic_matmul 256 512 1024 0",
+    "00_basic_matmul_l2_aware 256 512 1024 0",
     "01_batched_matmul 5 256 512 1024 0",
     "02_grouped_matmul_slice_m 128 512 1024 2048 0",
     "03_matmul_add 256 512 1024 0",
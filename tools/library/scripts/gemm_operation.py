@@ -27,6 +27,7 @@ class GemmOperation:
         c_type: library.GemmTypeDescription,
         block_swizzle: str,
         arch: library.ArchTag = library.ArchTag.A2,
+        stages: tuple = None,
     ):
         self.operation_type = 'gemm'
         self.kernel_type = kernel_type
@@ -37,6 +38,7 @@ class GemmOperation:
         self.c_type = c_type
         self.block_swizzle = block_swizzle
         self.arch = arch
+        self.stages = stages # L1/L0A/L0B stages, None for the dispatch policy default
 
         self.kernel_name = self.get_name()
 
@@ -74,6 +76,7 @@ void Register_{kernel_name}(Manifest &manifest)
             "{data_type_a}x{layout_a}_"
             "{data_type_b}x{layout_b}_"
             "{data_type_c}x{layout_c}_"
+            "{stages}"
             "{l1_tile_shape}_"
             "{l0_tile_shape}_"
             "{block_swizzle}"
@@ -88,11 +91,18 @@ void Register_{kernel_name}(Manifest &manifest)
             layout_a=self.a_type.layout.get_name(),
             layout_b=self.b_type.layout.get_name(),
             layout_c=self.c_type.layout.get_name(),
+            stages=self.get_stages_name(),
             l1_tile_shape='x'.join(str(val) for val in self.l1_tile_shape),
             l0_tile_shape='x'.join(str(val) for val in self.l0_tile_shape),
             block_swizzle=self.get_block_swizzle_name()
         )
 
+    def get_stages_name(self):
+        # placed before the tile shapes, the tuner parses tile shapes and swizzle from the tail of the name
+        if self.stages is None:
+            return ''
+        return 'stages' + 'x'.join(str(val) for val in self.stages) + '_'
+
     def get_block_swizzle_name(self):
         match = re.search(r'<(\d+)\s*,\s*(\d+)\s*>', self.block_swizzle)
         if not match:
@@ -204,7 +214,7 @@ class BasicMatmulKernelInstance:
         Gemm::Device::DeviceGemm<
             Gemm::Kernel::BasicMatmul<
                 Gemm::Block::BlockMmad<
-                    Gemm::MmadAtlasA2Pingpong<true>,
+                    Gemm::MmadAtlasA2Pingpong<true, {l1_stages}, {l0a_stages}, {l0b_stages}>,
                     GemmShape<{l1_m}, {l1_n}, {l1_k}>,
                     GemmShape<{l0_m}, {l0_n}, {l0_k}>,
                     Gemm::GemmType<{element_a}, {layout_a}>,
@@ -218,7 +228,11 @@ class BasicMatmulKernelInstance:
 
 
     def gen_src(self, gemm_operation):
+        l1_stages, l0a_stages, l0b_stages = gemm_operation.stages or (2, 2, 2)
         src = self.template.format(
+            l1_stages=str(l1_stages),
+            l0a_stages=str(l0a_stages),
+            l0b_stages=str(l0b_stages),
             l1_m=str(gemm_operation.l1_tile_shape[0]),
             l1_n=str(gemm_operation.l1_tile_shape[1]),
             l1_k=str(gemm_operation.l1_tile_shape[2]),
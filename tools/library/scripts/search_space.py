@@ -55,6 +55,8 @@ ATLAS_A2_L0A_SIZE_MAX = 64 * 1024
 ATLAS_A2_L0B_SIZE_MAX = 64 * 1024
 ATLAS_A2_L0C_SIZE_MAX = 128 * 1024
 
+MAX_EVENT_ID_NUM = 8 # number of event ids of each HardEvent type
+
 
 @dataclass
 class SearchSpaceConfiguration:
@@ -144,10 +146,14 @@ def tile_shape_constraint_for_pingpong(
     stages_tuple
 ):
     # constraint function for "Gemm::MmadAtlasA2Pingpong"
+    # stages_tuple: a single stage count shared by L1/L0A/L0B, or L1/L0A/L0B stages
     l1_m, l1_n, l1_k = l1_tile_shape
     l0_m, l0_n, l0_k = l0_tile_shape
     element_a_size, element_b_size, element_accumulator_size = element_sizes_tuple
-    stages = stages_tuple
+    if isinstance(stages_tuple, int):
+        l1_stages = l0a_stages = l0b_stages = stages_tuple
+    else:
+        l1_stages, l0a_stages, l0b_stages = stages_tuple
 
     l1a_tile_size = l1_m * l1_k * element_a_size
     l1b_tile_size = l1_n * l1_k * element_b_size
@@ -163,16 +169,20 @@ def tile_shape_constraint_for_pingpong(
     if l0_k > l1_k:
         return False
 
+    # each L1/L0 buffer of A and B occupies one event id of its HardEvent type
+    if l1_stages * 2 > MAX_EVENT_ID_NUM or l0a_stages + l0b_stages > MAX_EVENT_ID_NUM:
+        return False
+
     # check L1
-    if (l1a_tile_size * stages + l1b_tile_size * stages) > arch_info.l1_max_size:
+    if (l1a_tile_size * l1_stages + l1b_tile_size * l1_stages) > arch_info.l1_max_size:
         return False
 
     # check L0A
-    if l0a_tile_size * stages > arch_info.l0a_max_size:
+    if l0a_tile_size * l0a_stages > arch_info.l0a_max_size:
         return False
 
     # check L0B
-    if l0b_tile_size * stages > arch_info.l0b_max_size:
+    if l0b_tile_size * l0b_stages > arch_info.l0b_max_size:
         return False
 
     # check L0C
@@ -371,22 +381,31 @@ def register_gemm_00_basic_matmul_operation(manifest):
         [library.DataType.fp16, library.DataType.fp16, library.DataType.fp16]
     ]
 
+    # Gemm::MmadAtlasA2Pingpong的L1/L0A/L0B缓冲级数
+    stages_list = [
+        (2, 2, 2),
+        (3, 2, 2),
+    ]
+
     # 设定L1/L0TileShape的搜索范围、搜索步长、减枝函数，生成范围内全量搜索结点
-    tile_shapes = list(generate_tile_shapes(
-        tile_shape_constraint_for_pingpong, # 自定义减枝函数
-        arch_tag = manifest.arch,
-        element_sizes=(2, 2, 4), # size of ElementA, ElementB, ElementAccumulator
-        stages=(2),
-        step=16,
-        tile_shape_range=TileShapeRange(
-            l1_tile_m_range=(32, 128),
-            l1_tile_n_range=(128, 256),
-            l1_tile_k_range=(128, 256),
-            l0_tile_m_range=(32, 128),
-            l0_tile_n_range=(128, 256),
-            l0_tile_k_range=(32, 64)
-        )
-    ))
+    # 缓冲级数影响L1/L0容量约束，因此按级数分别生成
+    tile_shapes = []
+    for stages in stages_list:
+        tile_shapes.extend((stages, tile_shape) for tile_shape in generate_tile_shapes(
+            tile_shape_constraint_for_pingpong, # 自定义减枝函数
+            arch_tag = manifest.arch,
+            element_sizes=(2, 2, 4), # size of ElementA, ElementB, ElementAccumulator
+            stages=stages,
+            step=16,
+            tile_shape_range=TileShapeRange(
+                l1_tile_m_range=(32, 128),
+                l1_tile_n_range=(128, 256),
+                l1_tile_k_range=(128, 256),
+                l0_tile_m_range=(32, 128),
+                l0_tile_n_range=(128, 256),
+                l0_tile_k_range=(32, 64)
+            )
+        ))
     LOGGER.info(f'00_basic_matmul tile_shapes size={len(tile_shapes)}')
 
     block_swizzle_descriptions = [
@@ -395,7 +414,7 @@ def register_gemm_00_basic_matmul_operation(manifest):
     ]
 
     # 正交tiling参数组合
-    for layout, data_type, tile_shape, block_swizzle in product(
+    for layout, data_type, (stages, tile_shape), block_swizzle in product(
         layouts, data_types, tile_shapes, block_swizzle_descriptions
     ):
         l1_tile_shape, l0_tile_shape = tile_shape
@@ -410,6 +429,7 @@ def register_gemm_00_basic_matmul_operation(manifest):
             b_type=tensor_b,
             c_type=tensor_c,
             block_swizzle=block_swizzle,
+            stages=stages,
         )
         manifest.append(op)
 ################## 00_basic_matmul end ##################